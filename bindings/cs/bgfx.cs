@@ -606,6 +606,11 @@ public static partial class bgfx
 		/// Enable profiler.
 		/// </summary>
 		Profiler               = 0x00000010,
+	
+		/// <summary>
+		/// Enable per draw call profiler.
+		/// </summary>
+		ProfilerDraw           = 0x00000020,
 	}
 	
 	[Flags]
@@ -2111,6 +2116,15 @@ public static partial class bgfx
 		public long gpuTimeEnd;
 	}
 	
+	public unsafe struct DrawStats
+	{
+		public fixed byte marker[64];
+		public ProgramHandle program;
+		public uint numDraw;
+		public long cpuTime;
+		public long gpuTime;
+	}
+	
 	public unsafe struct EncoderStats
 	{
 		public long cpuTimeBegin;
@@ -2158,6 +2172,8 @@ public static partial class bgfx
 		public ViewStats* viewStats;
 		public byte numEncoders;
 		public EncoderStats* encoderStats;
+		public ushort numDrawStats;
+		public DrawStats* drawStats;
 	}
 	
 	public unsafe struct VertexLayout
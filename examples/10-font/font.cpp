@@ -91,8 +91,9 @@ public:
 		// This initializes the same allocator used by stb_truetype, so must do that before creating the font manager
 		imguiCreate();
 
-		// Init the text rendering system.
-		m_fontManager = new FontManager(512);
+		// Init the text rendering system. Glyphs are baked on worker threads,
+		// and added to atlas by FontManager::update.
+		m_fontManager = new FontManager(512, 2);
 		m_textBufferManager = new TextBufferManager(m_fontManager);
 
 		// Load some TTF files.
@@ -102,13 +103,9 @@ public:
 			m_fontFiles[ii] = loadTtf(m_fontManager, s_fontFilePath[ii]);
 			m_fonts[ii] = m_fontManager->createFontByPixelSize(m_fontFiles[ii], 0, 32);
 
-			// Preload glyphs and blit them to atlas.
+			// Queue glyphs for baking, they are blitted to atlas as they
+			// become ready.
 			m_fontManager->preloadGlyph(m_fonts[ii], L"abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ. \n");
-
-			// You can unload the truetype files at this stage, but in that
-			// case, the set of glyph's will be limited to the set of preloaded
-			// glyph.
-			m_fontManager->destroyTtf(m_fontFiles[ii]);
 		}
 
 		m_fontAwesomeTtf = loadTtf(m_fontManager, "font/fontawesome-webfont.ttf");
@@ -125,81 +122,19 @@ public:
 		// is loaded so glyph will be generated as needed.
 		m_visitor10 = m_fontManager->createFontByPixelSize(m_visitorTtf, 0, 10);
 
-		//create a static text buffer compatible with alpha font
-		//a static text buffer content cannot be modified after its first submit.
-		m_staticText = m_textBufferManager->createTextBuffer(FONT_TYPE_ALPHA, BufferType::Static);
-
-		// The pen position represent the top left of the box of the first line
-		// of text.
-		m_textBufferManager->setPenPosition(m_staticText, 24.0f, 100.0f);
-
-		for (uint32_t ii = 0; ii < numFonts; ++ii)
-		{
-			// Add some text to the buffer.
-			// The position of the pen is adjusted when there is an endline.
-			m_textBufferManager->appendText(m_staticText, m_fonts[ii], L"The quick brown fox jumps over the lazy dog\n");
-		}
-
-		// Now write some styled text.
-
-		// Setup style colors.
-		m_textBufferManager->setBackgroundColor(m_staticText, 0x551111ff);
-		m_textBufferManager->setUnderlineColor(m_staticText, 0xff2222ff);
-		m_textBufferManager->setOverlineColor(m_staticText, 0x2222ffff);
-		m_textBufferManager->setStrikeThroughColor(m_staticText, 0x22ff22ff);
-
-		// Background.
-		m_textBufferManager->setStyle(m_staticText, STYLE_BACKGROUND);
-		m_textBufferManager->appendText(m_staticText, m_fonts[0], L"The quick ");
-
-		// Strike-through.
-		m_textBufferManager->setStyle(m_staticText, STYLE_STRIKE_THROUGH);
-		m_textBufferManager->appendText(m_staticText, m_fonts[0], L"brown fox ");
-
-		// Overline.
-		m_textBufferManager->setStyle(m_staticText, STYLE_OVERLINE);
-		m_textBufferManager->appendText(m_staticText, m_fonts[0], L"jumps over ");
-
-		// Underline.
-		m_textBufferManager->setStyle(m_staticText, STYLE_UNDERLINE);
-		m_textBufferManager->appendText(m_staticText, m_fonts[0], L"the lazy ");
-
-		// Background + strike-through.
-		m_textBufferManager->setStyle(m_staticText, STYLE_BACKGROUND | STYLE_STRIKE_THROUGH);
-		m_textBufferManager->appendText(m_staticText, m_fonts[0], L"dog\n");
+		buildStaticText();
 
-		m_textBufferManager->setStyle(m_staticText, STYLE_NORMAL);
-		m_textBufferManager->appendText(m_staticText, m_fontAwesome72,
-			" " ICON_FA_POWER_OFF
-			" " ICON_FA_TWITTER_SQUARE
-			" " ICON_FA_CERTIFICATE
-			" " ICON_FA_FLOPPY_O
-			" " ICON_FA_GITHUB
-			" " ICON_FA_GITHUB_ALT
-			"\n"
-			);
-		m_textBufferManager->appendText(m_staticText, m_fontKenney64,
-			" " ICON_KI_COMPUTER
-			" " ICON_KI_JOYSTICK
-			" " ICON_KI_EXLAMATION
-			" " ICON_KI_STAR
-			" " ICON_KI_BUTTON_START
-			" " ICON_KI_DOWNLOAD
-			"\n"
-			);
-
-		// Create a transient buffer for real-time data.
-		m_transientText = m_textBufferManager->createTextBuffer(FONT_TYPE_ALPHA, BufferType::Transient);
+		// Create a dynamic buffer for real-time data, it only uploads glyphs
+		// that changed. Every glyph is drawn as one instance when instancing
+		// is supported.
+		m_dynamicText = m_textBufferManager->createTextBuffer(FONT_TYPE_ALPHA, BufferType::Dynamic, true);
+		m_dynamicTextWidth = 0;
 	}
 
 	virtual int shutdown() override
 	{
 		imguiDestroy();
 
-		m_fontManager->destroyTtf(m_fontKenneyTtf);
-		m_fontManager->destroyTtf(m_fontAwesomeTtf);
-		m_fontManager->destroyTtf(m_visitorTtf);
-
 		// Destroy the fonts.
 		m_fontManager->destroyFont(m_fontKenney64);
 		m_fontManager->destroyFont(m_fontAwesome72);
@@ -209,8 +144,18 @@ public:
 			m_fontManager->destroyFont(m_fonts[ii]);
 		}
 
+		// Fonts cancel their pending glyphs when destroyed, after that
+		// truetype files are not used by bake threads anymore.
+		m_fontManager->destroyTtf(m_fontKenneyTtf);
+		m_fontManager->destroyTtf(m_fontAwesomeTtf);
+		m_fontManager->destroyTtf(m_visitorTtf);
+		for (uint32_t ii = 0; ii < numFonts; ++ii)
+		{
+			m_fontManager->destroyTtf(m_fontFiles[ii]);
+		}
+
 		m_textBufferManager->destroyTextBuffer(m_staticText);
-		m_textBufferManager->destroyTextBuffer(m_transientText);
+		m_textBufferManager->destroyTextBuffer(m_dynamicText);
 
 		delete m_textBufferManager;
 		delete m_fontManager;
@@ -250,15 +195,37 @@ public:
 			const double freq = double(bx::getHPFrequency() );
 			const double toMs = 1000.0 / freq;
 
-			// Use transient text to display debug information.
+			// Use dynamic text to display debug information.
 			char fpsText[64];
 			bx::snprintf(fpsText, BX_COUNTOF(fpsText), "Frame: % 7.3f[ms]", double(frameTime) * toMs);
 
-			m_textBufferManager->clearTextBuffer(m_transientText);
-			m_textBufferManager->setPenPosition(m_transientText, m_width - 150.0f, 10.0f);
-			m_textBufferManager->appendText(m_transientText, m_visitor10, "Transient\n");
-			m_textBufferManager->appendText(m_transientText, m_visitor10, "text buffer\n");
-			m_textBufferManager->appendText(m_transientText, m_visitor10, fpsText);
+			// Advance atlas and add glyphs baked since last frame. Text is
+			// generated again when any of its glyphs became ready, moved or
+			// was evicted.
+			if (0 != m_fontManager->update() )
+			{
+				m_dynamicTextWidth = 0;
+
+				// Static text buffer can't be modified after its first
+				// submit, it's created again.
+				m_textBufferManager->destroyTextBuffer(m_staticText);
+				buildStaticText();
+			}
+
+			// Only frame time changes every frame, text before the mark is
+			// generated again only when window is resized.
+			if (m_dynamicTextWidth != m_width)
+			{
+				m_dynamicTextWidth = m_width;
+				m_textBufferManager->clearTextBuffer(m_dynamicText);
+				m_textBufferManager->setPenPosition(m_dynamicText, m_width - 150.0f, 10.0f);
+				m_textBufferManager->appendText(m_dynamicText, m_visitor10, "Dynamic\n");
+				m_textBufferManager->appendText(m_dynamicText, m_visitor10, "text buffer\n");
+				m_textBufferManager->markTextBuffer(m_dynamicText);
+			}
+
+			m_textBufferManager->rewindTextBuffer(m_dynamicText);
+			m_textBufferManager->appendText(m_dynamicText, m_visitor10, fpsText);
 
 			const bx::Vec3 at  = { 0.0f, 0.0f,  0.0f };
 			const bx::Vec3 eye = { 0.0f, 0.0f, -1.0f };
@@ -288,7 +255,7 @@ public:
 			}
 
 			// Submit the debug text.
-			m_textBufferManager->submitTextBuffer(m_transientText, 0);
+			m_textBufferManager->submitTextBuffer(m_dynamicText, 0);
 
 			// Submit the static text.
 			m_textBufferManager->submitTextBuffer(m_staticText, 0);
@@ -303,6 +270,72 @@ public:
 		return false;
 	}
 
+	void buildStaticText()
+	{
+		//create a static text buffer compatible with alpha font
+		//a static text buffer content cannot be modified after its first submit.
+		m_staticText = m_textBufferManager->createTextBuffer(FONT_TYPE_ALPHA, BufferType::Static);
+
+		// The pen position represent the top left of the box of the first line
+		// of text.
+		m_textBufferManager->setPenPosition(m_staticText, 24.0f, 100.0f);
+
+		for (uint32_t ii = 0; ii < numFonts; ++ii)
+		{
+			// Add some text to the buffer.
+			// The position of the pen is adjusted when there is an endline.
+			m_textBufferManager->appendText(m_staticText, m_fonts[ii], L"The quick brown fox jumps over the lazy dog\n");
+		}
+
+		// Now write some styled text.
+
+		// Setup style colors.
+		m_textBufferManager->setBackgroundColor(m_staticText, 0x551111ff);
+		m_textBufferManager->setUnderlineColor(m_staticText, 0xff2222ff);
+		m_textBufferManager->setOverlineColor(m_staticText, 0x2222ffff);
+		m_textBufferManager->setStrikeThroughColor(m_staticText, 0x22ff22ff);
+
+		// Background.
+		m_textBufferManager->setStyle(m_staticText, STYLE_BACKGROUND);
+		m_textBufferManager->appendText(m_staticText, m_fonts[0], L"The quick ");
+
+		// Strike-through.
+		m_textBufferManager->setStyle(m_staticText, STYLE_STRIKE_THROUGH);
+		m_textBufferManager->appendText(m_staticText, m_fonts[0], L"brown fox ");
+
+		// Overline.
+		m_textBufferManager->setStyle(m_staticText, STYLE_OVERLINE);
+		m_textBufferManager->appendText(m_staticText, m_fonts[0], L"jumps over ");
+
+		// Underline.
+		m_textBufferManager->setStyle(m_staticText, STYLE_UNDERLINE);
+		m_textBufferManager->appendText(m_staticText, m_fonts[0], L"the lazy ");
+
+		// Background + strike-through.
+		m_textBufferManager->setStyle(m_staticText, STYLE_BACKGROUND | STYLE_STRIKE_THROUGH);
+		m_textBufferManager->appendText(m_staticText, m_fonts[0], L"dog\n");
+
+		m_textBufferManager->setStyle(m_staticText, STYLE_NORMAL);
+		m_textBufferManager->appendText(m_staticText, m_fontAwesome72,
+			" " ICON_FA_POWER_OFF
+			" " ICON_FA_TWITTER_SQUARE
+			" " ICON_FA_CERTIFICATE
+			" " ICON_FA_FLOPPY_O
+			" " ICON_FA_GITHUB
+			" " ICON_FA_GITHUB_ALT
+			"\n"
+			);
+		m_textBufferManager->appendText(m_staticText, m_fontKenney64,
+			" " ICON_KI_COMPUTER
+			" " ICON_KI_JOYSTICK
+			" " ICON_KI_EXLAMATION
+			" " ICON_KI_STAR
+			" " ICON_KI_BUTTON_START
+			" " ICON_KI_DOWNLOAD
+			"\n"
+			);
+	}
+
 	entry::MouseState m_mouseState;
 
 	uint32_t m_width;
@@ -320,7 +353,8 @@ public:
 	FontHandle m_fontKenney64;
 	TrueTypeHandle m_visitorTtf;
 
-	TextBufferHandle m_transientText;
+	TextBufferHandle m_dynamicText;
+	uint32_t m_dynamicTextWidth;
 	TextBufferHandle m_staticText;
 
 	static const uint32_t numFonts = BX_COUNTOF(s_fontFilePath);
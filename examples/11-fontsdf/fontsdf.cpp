@@ -18,6 +18,17 @@
 namespace
 {
 
+// Glyph churn cycles through these font sizes and code point ranges, so that glyphs no longer
+// drawn are evicted from atlas when it fills up, and remaining ones are moved by defragmentation.
+static const uint32_t s_churnPixelSize[] = { 32, 48, 64, 96 };
+
+static const CodePoint s_churnRange[][2] =
+{
+	{ 0x0021, 0x007e }, // Basic Latin
+	{ 0x00a1, 0x00ff }, // Latin-1 Supplement
+	{ 0x0100, 0x017f }, // Latin Extended-A
+};
+
 TrueTypeHandle loadTtf(FontManager* _fm, const char* _filePath)
 {
 	uint32_t size;
@@ -108,6 +119,20 @@ public:
 		m_textRotation = 0.0f;
 		m_textScale = 1.0f;
 		m_textSize = 14.0f;
+
+		for (uint32_t ii = 0; ii < BX_COUNTOF(s_churnPixelSize); ++ii)
+		{
+			m_churnFont[ii] = m_fontManager->createFontByPixelSize(m_font, 0, s_churnPixelSize[ii], FONT_TYPE_DISTANCE);
+		}
+
+		m_churnBuffer = m_textBufferManager->createTextBuffer(FONT_TYPE_DISTANCE, BufferType::Transient);
+		m_textBufferManager->setTextColor(m_churnBuffer, 0xffff80ff);
+
+		m_glyphChurn  = false;
+		m_churnStep   = 0;
+		m_churnTime   = 0.0f;
+		m_numUpdates  = 0;
+		m_numRemapped = 0;
 	}
 
 	virtual int shutdown() override
@@ -121,7 +146,13 @@ public:
 		m_fontManager->destroyFont(m_fontSdf);
 		m_fontManager->destroyFont(m_fontScaled);
 
+		for (uint32_t ii = 0; ii < BX_COUNTOF(s_churnPixelSize); ++ii)
+		{
+			m_fontManager->destroyFont(m_churnFont[ii]);
+		}
+
 		m_textBufferManager->destroyTextBuffer(m_scrollableBuffer);
+		m_textBufferManager->destroyTextBuffer(m_churnBuffer);
 
 		delete m_textBufferManager;
 		delete m_fontManager;
@@ -176,6 +207,72 @@ public:
 			ImGui::SliderFloat("Rotate", &m_textRotation, 0.0f, bx::kPi*2.0f);
 			recomputeVisibleText |= ImGui::SliderFloat("Scale", &m_textScale, 0.1f, 10.0f);
 
+			bool recomputeChurnText = false;
+			if (ImGui::Checkbox("Glyph churn", &m_glyphChurn) )
+			{
+				m_churnTime = 0.0f;
+				recomputeChurnText = true;
+			}
+
+			// Every step uses another font size and code point range, glyphs from previous steps
+			// are not referenced anymore and can be evicted.
+			int64_t now = bx::getHPCounter();
+			static int64_t last = now;
+			const int64_t frameTime = now - last;
+			last = now;
+
+			if (m_glyphChurn)
+			{
+				m_churnTime += float(double(frameTime)/double(bx::getHPFrequency() ) );
+				if (m_churnTime > 0.25f)
+				{
+					m_churnTime = 0.0f;
+					++m_churnStep;
+					recomputeChurnText = true;
+				}
+			}
+
+			// Advance atlas and add glyphs baked since last frame. Text is generated again when
+			// any of its glyphs moved or was evicted.
+			const uint32_t numRemapped = m_fontManager->update();
+			if (0 != numRemapped)
+			{
+				++m_numUpdates;
+				m_numRemapped += numRemapped;
+				recomputeVisibleText = true;
+				recomputeChurnText   = true;
+			}
+
+			ImGui::Text("Atlas regions: %d", m_fontManager->getAtlas()->getRegionCount() );
+			ImGui::Text("Atlas changes: %d (%d glyphs)", m_numUpdates, m_numRemapped);
+
+			if (recomputeChurnText)
+			{
+				m_textBufferManager->clearTextBuffer(m_churnBuffer);
+
+				if (m_glyphChurn)
+				{
+					const uint32_t size  = m_churnStep % BX_COUNTOF(s_churnPixelSize);
+					const uint32_t range = (m_churnStep / BX_COUNTOF(s_churnPixelSize) ) % BX_COUNTOF(s_churnRange);
+
+					wchar_t text[256];
+					uint32_t len = 0;
+					for (CodePoint cp = s_churnRange[range][0]; cp <= s_churnRange[range][1] && len < BX_COUNTOF(text)-2; ++cp)
+					{
+						text[len++] = wchar_t(cp);
+
+						if (0 == (cp - s_churnRange[range][0] + 1) % 32)
+						{
+							text[len++] = L'\n';
+						}
+					}
+					text[len] = L'\0';
+
+					m_textBufferManager->setPenPosition(m_churnBuffer, 10.0f, 10.0f);
+					m_textBufferManager->appendText(m_churnBuffer, m_churnFont[size], text);
+				}
+			}
+
 			if (recomputeVisibleText)
 			{
 				m_textBufferManager->clearTextBuffer(m_scrollableBuffer);
@@ -240,6 +337,11 @@ public:
 			// Draw your text.
 			m_textBufferManager->submitTextBuffer(m_scrollableBuffer, 0);
 
+			if (m_glyphChurn)
+			{
+				m_textBufferManager->submitTextBuffer(m_churnBuffer, 0);
+			}
+
 			// Advance to next frame. Rendering thread will be kicked to
 			// process submitted rendering primitives.
 			bgfx::frame();
@@ -269,6 +371,14 @@ public:
 
 	TextBufferHandle m_scrollableBuffer;
 
+	FontHandle m_churnFont[BX_COUNTOF(s_churnPixelSize)];
+	TextBufferHandle m_churnBuffer;
+	bool m_glyphChurn;
+	uint32_t m_churnStep;
+	float m_churnTime;
+	uint32_t m_numUpdates;
+	uint32_t m_numRemapped;
+
 	TextLineMetrics m_metrics = TextLineMetrics(FontInfo());
 	uint32_t m_lineCount;
 	float m_visibleLineCount;
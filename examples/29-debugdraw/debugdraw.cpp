@@ -11,6 +11,9 @@
 #include "camera.h"
 #include "imgui/imgui.h"
 
+#include <bx/rng.h>
+#include <bx/semaphore.h>
+#include <bx/thread.h>
 #include <bx/uint32_t.h>
 
 namespace
@@ -758,6 +761,184 @@ void imageCheckerboard(void* _dst, uint32_t _width, uint32_t _height, uint32_t _
 	}
 }
 
+static constexpr uint32_t kCullNumObjects = 64<<10;
+static constexpr uint32_t kCullMaxThreads = 4;
+
+struct CullBenchmark
+{
+	void init()
+	{
+		bx::AllocatorI* allocator = entry::getAllocator();
+
+		m_data    = (float*   )BX_ALIGNED_ALLOC(allocator, 6*kCullNumObjects*sizeof(float), 16);
+		m_aabb    = (Aabb*    )BX_ALLOC(allocator, kCullNumObjects*sizeof(Aabb) );
+		m_mask    = (uint32_t*)BX_ALLOC(allocator, kCullNumObjects/32*sizeof(uint32_t) );
+		m_indices = (uint32_t*)BX_ALLOC(allocator, kCullNumObjects*sizeof(uint32_t) );
+
+		for (uint32_t ii = 0; ii < 3; ++ii)
+		{
+			m_soa.min[ii] = &m_data[(ii+0)*kCullNumObjects];
+			m_soa.max[ii] = &m_data[(ii+3)*kCullNumObjects];
+		}
+		m_soa.num = kCullNumObjects;
+
+		bx::RngMwc rng;
+
+		for (uint32_t ii = 0; ii < kCullNumObjects; ++ii)
+		{
+			const bx::Vec3 pos =
+			{
+				bx::frndh(&rng)*40.0f,
+				bx::frndh(&rng)*40.0f,
+				bx::frndh(&rng)*40.0f,
+			};
+
+			const float extents = 0.1f + bx::frnd(&rng);
+
+			Aabb& aabb = m_aabb[ii];
+			toAabb(aabb, pos, { extents, extents, extents });
+
+			float* data = m_data;
+			data[0*kCullNumObjects + ii] = aabb.min.x;
+			data[1*kCullNumObjects + ii] = aabb.min.y;
+			data[2*kCullNumObjects + ii] = aabb.min.z;
+			data[3*kCullNumObjects + ii] = aabb.max.x;
+			data[4*kCullNumObjects + ii] = aabb.max.y;
+			data[5*kCullNumObjects + ii] = aabb.max.z;
+		}
+
+		m_numThreads = 1;
+
+		for (uint32_t ii = 0; ii < kCullMaxThreads-1; ++ii)
+		{
+			m_thread[ii].init(threadFunc, this);
+		}
+
+		m_scalarTime   = 0.0;
+		m_simdTime     = 0.0;
+		m_threadedTime = 0.0;
+		m_numVisible   = 0;
+	}
+
+	void shutdown()
+	{
+		for (uint32_t ii = 0; ii < kCullMaxThreads-1; ++ii)
+		{
+			m_thread[ii].push(reinterpret_cast<void*>(UINTPTR_MAX) );
+			m_thread[ii].shutdown();
+		}
+
+		bx::AllocatorI* allocator = entry::getAllocator();
+		BX_FREE(allocator, m_indices);
+		BX_FREE(allocator, m_mask);
+		BX_FREE(allocator, m_aabb);
+		BX_ALIGNED_FREE(allocator, m_data, 16);
+	}
+
+	void cullRange(uint32_t _idx, uint32_t _numThreads)
+	{
+		// Ranges start at multiple of 32 so that threads never share mask word.
+		const uint32_t num   = ( (kCullNumObjects/_numThreads)+31) & ~31u;
+		const uint32_t first = bx::uint32_min(_idx*num, kCullNumObjects);
+		frustumCull(m_mask, m_planes, BX_COUNTOF(m_planes), m_soa, first, num);
+	}
+
+	static int32_t threadFunc(bx::Thread* _thread, void* _userData)
+	{
+		CullBenchmark* self = static_cast<CullBenchmark*>(_userData);
+		const uint32_t idx = uint32_t(_thread - self->m_thread) + 1;
+
+		for (;;)
+		{
+			const uintptr_t numThreads = reinterpret_cast<uintptr_t>(_thread->pop() );
+			if (UINTPTR_MAX == numThreads)
+			{
+				break;
+			}
+
+			self->cullRange(idx, uint32_t(numThreads) );
+			self->m_done.post();
+		}
+
+		return bx::kExitSuccess;
+	}
+
+	void update(const float* _mtxVp)
+	{
+		buildFrustumPlanes(m_planes, _mtxVp);
+
+		const double toMs = 1000.0/double(bx::getHPFrequency() );
+
+		// Scalar loop over array of structures.
+		int64_t start = bx::getHPCounter();
+		uint32_t numVisible = 0;
+		for (uint32_t ii = 0; ii < kCullNumObjects; ++ii)
+		{
+			const Aabb& aabb = m_aabb[ii];
+
+			// Same corner furthest along plane normal, and same operation order as SIMD path,
+			// so both produce identical results.
+			bool visible = true;
+			for (uint32_t jj = 0; jj < BX_COUNTOF(m_planes) && visible; ++jj)
+			{
+				const bx::Plane& plane = m_planes[jj];
+				const float px = 0.0f <= plane.normal.x ? aabb.max.x : aabb.min.x;
+				const float py = 0.0f <= plane.normal.y ? aabb.max.y : aabb.min.y;
+				const float pz = 0.0f <= plane.normal.z ? aabb.max.z : aabb.min.z;
+				visible = 0.0f <= plane.normal.x*px + (plane.normal.y*py + (plane.normal.z*pz + plane.dist) );
+			}
+
+			m_indices[numVisible] = ii;
+			numVisible += visible;
+		}
+		const double scalarTime = double(bx::getHPCounter() - start)*toMs;
+
+		// Batch SIMD on single thread.
+		start = bx::getHPCounter();
+		frustumCull(m_mask, m_planes, BX_COUNTOF(m_planes), m_soa);
+		m_numVisible = frustumCullCompact(m_indices, m_mask, kCullNumObjects);
+		const double simdTime = double(bx::getHPCounter() - start)*toMs;
+
+		// Batch SIMD split across worker threads.
+		start = bx::getHPCounter();
+		const uint32_t numThreads = bx::uint32_clamp(uint32_t(m_numThreads), 1, kCullMaxThreads);
+		for (uint32_t ii = 0; ii < numThreads-1; ++ii)
+		{
+			m_thread[ii].push(reinterpret_cast<void*>(uintptr_t(numThreads) ) );
+		}
+		cullRange(0, numThreads);
+		for (uint32_t ii = 0; ii < numThreads-1; ++ii)
+		{
+			m_done.wait();
+		}
+		frustumCullCompact(m_indices, m_mask, kCullNumObjects);
+		const double threadedTime = double(bx::getHPCounter() - start)*toMs;
+
+		BX_ASSERT(numVisible == m_numVisible, "Scalar and SIMD culling results differ %d != %d.", numVisible, m_numVisible);
+
+		m_scalarTime   = bx::lerp(float(scalarTime),   float(m_scalarTime),   0.9f);
+		m_simdTime     = bx::lerp(float(simdTime),     float(m_simdTime),     0.9f);
+		m_threadedTime = bx::lerp(float(threadedTime), float(m_threadedTime), 0.9f);
+	}
+
+	bx::Thread    m_thread[kCullMaxThreads-1];
+	bx::Semaphore m_done;
+
+	bx::Plane m_planes[6];
+	AabbSoA   m_soa;
+
+	float*    m_data;
+	Aabb*     m_aabb;
+	uint32_t* m_mask;
+	uint32_t* m_indices;
+
+	double   m_scalarTime;
+	double   m_simdTime;
+	double   m_threadedTime;
+	uint32_t m_numVisible;
+	int32_t  m_numThreads;
+};
+
 class ExampleDebugDraw : public entry::AppI
 {
 public:
@@ -815,10 +996,14 @@ public:
 			);
 
 		imguiCreate();
+
+		m_cullBenchmark.init();
 	}
 
 	virtual int shutdown() override
 	{
+		m_cullBenchmark.shutdown();
+
 		imguiDestroy();
 
 		ddDestroy(m_bunny);
@@ -892,6 +1077,20 @@ public:
 			static float timeScale = 1.0f;
 			ImGui::SliderFloat("T scale", &timeScale, -1.0f, 1.0f);
 
+			static bool cullBenchmark = false;
+			ImGui::Separator();
+			ImGui::Checkbox("Frustum cull benchmark", &cullBenchmark);
+
+			if (cullBenchmark)
+			{
+				const CullBenchmark& cb = m_cullBenchmark;
+				ImGui::SliderInt("Num threads", &m_cullBenchmark.m_numThreads, 1, kCullMaxThreads);
+				ImGui::Text("Visible: %d / %d", cb.m_numVisible, kCullNumObjects);
+				ImGui::Text("Scalar   %7.3f [ms] %8.0f [obj/ms]", cb.m_scalarTime,   kCullNumObjects/bx::max(cb.m_scalarTime,   1e-6) );
+				ImGui::Text("SIMD     %7.3f [ms] %8.0f [obj/ms]", cb.m_simdTime,     kCullNumObjects/bx::max(cb.m_simdTime,     1e-6) );
+				ImGui::Text("Threaded %7.3f [ms] %8.0f [obj/ms]", cb.m_threadedTime, kCullNumObjects/bx::max(cb.m_threadedTime, 1e-6) );
+			}
+
 			ImGui::End();
 
 			imguiEndFrame();
@@ -931,6 +1130,11 @@ public:
 			bx::mtxProj(proj, 45.0f, float(m_width)/float(m_height), 1.0f, 15.0f, bgfx::getCaps()->homogeneousDepth);
 			bx::mtxMul(mtxVp, view, proj);
 
+			if (cullBenchmark)
+			{
+				m_cullBenchmark.update(mtxVp);
+			}
+
 			Ray ray = makeRay(
 				   (float(m_mouseState.m_mx)/float(m_width)  * 2.0f - 1.0f)
 				, -(float(m_mouseState.m_my)/float(m_height) * 2.0f - 1.0f)
@@ -1214,6 +1418,8 @@ public:
 	SpriteHandle   m_sprite;
 	GeometryHandle m_bunny;
 
+	CullBenchmark m_cullBenchmark;
+
 	int64_t m_timeOffset;
 
 	uint32_t m_width;
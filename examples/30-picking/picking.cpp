@@ -6,6 +6,7 @@
 #include "common.h"
 #include "bgfx_utils.h"
 #include "imgui/imgui.h"
+#include "bvh.h"
 #include <bx/rng.h>
 #include <map>
 
@@ -18,6 +19,54 @@ namespace
 
 #define ID_DIM 8  // Size of the ID buffer
 
+static bx::Vec3 getPosition(const Mesh* _mesh, const Group& _group, uint32_t _index)
+{
+	const uint32_t index = _group.m_index32
+		? ( (const uint32_t*)_group.m_indices)[_index]
+		: ( (const uint16_t*)_group.m_indices)[_index]
+		;
+
+	float pos[4];
+	bgfx::vertexUnpack(pos, bgfx::Attrib::Position, _mesh->m_layout, _group.m_vertices, index);
+
+	const bx::Vec3 result = bx::load<bx::Vec3>(pos);
+	return _group.m_quantized
+		? bx::add(_group.m_dequantOffset, bx::mul(result, _group.m_dequantScale) )
+		: result
+		;
+}
+
+// Collects mesh triangles in model space for CPU picking. Mesh must be loaded with RAM copy.
+static Triangle* createTriangles(const Mesh* _mesh, uint32_t& _outNum)
+{
+	_outNum = 0;
+	for (GroupArray::const_iterator it = _mesh->m_groups.begin(), itEnd = _mesh->m_groups.end(); it != itEnd; ++it)
+	{
+		_outNum += (it->m_lods.empty() ? it->m_numIndices : it->m_lods[0].m_numIndices)/3;
+	}
+
+	Triangle* triangles = (Triangle*)BX_ALLOC(entry::getAllocator(), _outNum*sizeof(Triangle) );
+	Triangle* triangle  = triangles;
+
+	for (GroupArray::const_iterator it = _mesh->m_groups.begin(), itEnd = _mesh->m_groups.end(); it != itEnd; ++it)
+	{
+		const Group& group = *it;
+
+		// Only most detailed level is picked.
+		const uint32_t start = group.m_lods.empty() ? 0                    : group.m_lods[0].m_startIndex;
+		const uint32_t num   = group.m_lods.empty() ? group.m_numIndices : group.m_lods[0].m_numIndices;
+
+		for (uint32_t ii = start, end = start + num/3*3; ii < end; ii += 3, ++triangle)
+		{
+			triangle->v0 = getPosition(_mesh, group, ii+0);
+			triangle->v1 = getPosition(_mesh, group, ii+1);
+			triangle->v2 = getPosition(_mesh, group, ii+2);
+		}
+	}
+
+	return triangles;
+}
+
 class ExamplePicking : public entry::AppI
 {
 public:
@@ -95,12 +144,20 @@ public:
 		m_currFrame = UINT32_MAX;
 		m_fov = 3.0f;
 		m_cameraSpin = false;
+		m_bvhPicking = false;
+		m_bvhTime = 0.0f;
 
 		bx::RngMwc mwc;  // Random number generator
 		for (uint32_t ii = 0; ii < 12; ++ii)
 		{
-			m_meshes[ii]    = meshLoad(meshPaths[ii % BX_COUNTOF(meshPaths)]);
+			m_meshes[ii]    = meshLoad(meshPaths[ii % BX_COUNTOF(meshPaths)], true);
 			m_meshScale[ii] = meshScale[ii % BX_COUNTOF(meshPaths)];
+
+			// Model space hierarchy, rays are transformed into model space when picking.
+			m_triangles[ii] = createTriangles(m_meshes[ii], m_numTriangles[ii]);
+			m_bvh[ii] = BX_NEW(entry::getAllocator(), Bvh)(entry::getAllocator() );
+			m_bvh[ii]->build(m_triangles[ii], m_numTriangles[ii]);
+
 			// For the sake of this example, we'll give each mesh a random color,  so the debug output looks colorful.
 			// In an actual app, you'd probably just want to count starting from 1
 			uint32_t rr = mwc.gen() % 256;
@@ -161,6 +218,8 @@ public:
 	{
 		for (uint32_t ii = 0; ii < 12; ++ii)
 		{
+			BX_DELETE(entry::getAllocator(), m_bvh[ii]);
+			BX_FREE(entry::getAllocator(), m_triangles[ii]);
 			meshUnload(m_meshes[ii]);
 		}
 
@@ -227,6 +286,12 @@ public:
 				ImGui::Image(m_pickingRT, ImVec2(m_width / 5.0f - 16.0f, m_width / 5.0f - 16.0f) );
 				ImGui::SliderFloat("Field of view", &m_fov, 1.0f, 60.0f);
 				ImGui::Checkbox("Spin Camera", &m_cameraSpin);
+				ImGui::Checkbox("CPU picking (BVH)", &m_bvhPicking);
+
+				if (m_bvhPicking)
+				{
+					ImGui::Text("Ray query: %0.3f [ms]", m_bvhTime);
+				}
 
 				ImGui::End();
 
@@ -289,6 +354,22 @@ public:
 				const float tintBasic[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
 				const float tintHighlighted[4] = { 0.3f, 0.3f, 2.0f, 1.0f };
 
+				// CPU picking casts mouse ray against model space hierarchy of each mesh, instead
+				// of reading back ID buffer.
+				const bool bvhPick = true
+					&& m_bvhPicking
+					&& m_mouseState.m_buttons[entry::MouseButton::Left]
+					&& !ImGui::MouseOverArea()
+					;
+				const Ray ray = makeRay(mouseXNDC, mouseYNDC, invViewProj);
+				float bvhDist = bx::kFloatLargest;
+				int64_t bvhTime = 0;
+
+				if (bvhPick)
+				{
+					m_highlighted = UINT32_MAX;
+				}
+
 				for (uint32_t mesh = 0; mesh < 12; ++mesh)
 				{
 					const float scale = m_meshScale[mesh];
@@ -305,6 +386,31 @@ public:
 						, 0.0f
 						);
 
+					if (bvhPick)
+					{
+						const int64_t start = bx::getHPCounter();
+
+						float mtxInv[16];
+						bx::mtxInverse(mtxInv, mtx);
+
+						Ray modelRay;
+						modelRay.pos = bx::mul(ray.pos, mtxInv);
+						modelRay.dir = bx::mulXyz0(ray.dir, mtxInv);
+
+						Hit hit;
+						if (m_bvh[mesh]->intersect(modelRay, &hit) )
+						{
+							const float dist = bx::length(bx::sub(bx::mul(hit.pos, mtx), ray.pos) );
+							if (dist < bvhDist)
+							{
+								bvhDist       = dist;
+								m_highlighted = mesh;
+							}
+						}
+
+						bvhTime += bx::getHPCounter() - start;
+					}
+
 					// Submit mesh to both of our render passes
 					// Set uniform based on if this is the highlighted mesh
 					bgfx::setUniform(u_tint
@@ -385,8 +491,14 @@ public:
 					}
 				}
 
+				if (bvhPick)
+				{
+					m_bvhTime = float(bvhTime*1000.0/double(bx::getHPFrequency() ) );
+				}
+
 				// Start a new readback?
 				if (!m_reading
+				&&  !m_bvhPicking
 				&&  m_mouseState.m_buttons[entry::MouseButton::Left])
 				{
 					// Blit and read
@@ -416,6 +528,9 @@ public:
 	int64_t m_timeOffset;
 
 	Mesh* m_meshes[12];
+	Triangle* m_triangles[12];
+	uint32_t m_numTriangles[12];
+	Bvh* m_bvh[12];
 	float m_meshScale[12];
 	float m_idsF[12][4];
 	uint32_t m_idsU[12];
@@ -437,7 +552,9 @@ public:
 	uint32_t m_currFrame;
 
 	float m_fov;
+	float m_bvhTime;
 	bool  m_cameraSpin;
+	bool  m_bvhPicking;
 };
 
 } // namespace
@@ -90,11 +90,13 @@ struct Emitter
 
 	EmitterShape::Enum     m_shape;
 	EmitterDirection::Enum m_direction;
+	bool                   m_gpu;
 
 	void create()
 	{
 		m_shape      = EmitterShape::Sphere;
 		m_direction  = EmitterDirection::Outward;
+		m_gpu        = false;
 
 		m_handle = psCreateEmitter(m_shape, m_direction, 1024);
 		m_uniforms.reset();
@@ -115,13 +117,19 @@ struct Emitter
 //		if (ImGui::CollapsingHeader("General") )
 		{
 			if (ImGui::Combo("Shape", (int*)&m_shape, s_shapeNames, BX_COUNTOF(s_shapeNames) )
-			||  ImGui::Combo("Direction", (int*)&m_direction, s_directionName, BX_COUNTOF(s_directionName) ) )
+			||  ImGui::Combo("Direction", (int*)&m_direction, s_directionName, BX_COUNTOF(s_directionName) )
+			||  ImGui::Checkbox("GPU simulation", &m_gpu) )
 			{
+				m_gpu = m_gpu && psIsGpuSupported();
+
 				psDestroyEmitter(m_handle);
-				m_handle = psCreateEmitter(m_shape, m_direction, 1024);
+				m_handle = m_gpu
+					? psCreateEmitter(m_shape, m_direction, 65536, EmitterSimulation::Gpu)
+					: psCreateEmitter(m_shape, m_direction, 1024)
+					;
 			}
 
-			ImGui::SliderInt("particles / s", (int*)&m_uniforms.m_particlesPerSecond, 0, 1024);
+			ImGui::SliderInt("particles / s", (int*)&m_uniforms.m_particlesPerSecond, 0, m_gpu ? 65536 : 1024);
 
 			ImGui::SliderFloat("Gravity scale"
 					, &m_uniforms.m_gravityScale
@@ -383,6 +391,31 @@ public:
 			static bool showBounds;
 			ImGui::Checkbox("Show bounds", &showBounds);
 
+			static bool benchmark = false;
+			if (ImGui::Checkbox("Benchmark scalar AoS path", &benchmark) )
+			{
+				psSetBenchmark(benchmark);
+			}
+
+			PsStats stats;
+			psGetStats(stats);
+
+			const double toMs = 1000.0/double(bx::getHPFrequency() );
+			ImGui::Text("Particles: %d", stats.m_numParticles);
+			ImGui::Text("Render: %0.3f [ms]", double(stats.m_renderTime)*toMs);
+
+			if (benchmark)
+			{
+				ImGui::Text("         SoA/radix   AoS/qsort");
+				ImGui::Text("Update: %7.3f [ms] %7.3f [ms]", double(stats.m_updateTime)*toMs, double(stats.m_referenceUpdateTime)*toMs);
+				ImGui::Text("Sort:   %7.3f [ms] %7.3f [ms]", double(stats.m_sortTime)*toMs,   double(stats.m_referenceSortTime)*toMs);
+			}
+			else
+			{
+				ImGui::Text("Update: %0.3f [ms]", double(stats.m_updateTime)*toMs);
+				ImGui::Text("Sort:   %0.3f [ms]", double(stats.m_sortTime)*toMs);
+			}
+
 			ImGui::Text("Emitter:");
 			static int currentEmitter = 0;
 			for (uint32_t ii = 0; ii < BX_COUNTOF(m_emitter); ++ii)
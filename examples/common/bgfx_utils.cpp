@@ -12,10 +12,14 @@ namespace stl = tinystl;
 
 #include <bgfx/bgfx.h>
 #include <bx/commandline.h>
+#include <bx/cpu.h>
 #include <bx/endian.h>
 #include <bx/math.h>
+#include <bx/mutex.h>
 #include <bx/readerwriter.h>
+#include <bx/semaphore.h>
 #include <bx/string.h>
+#include <bx/thread.h>
 #include "entry/entry.h"
 #include <meshoptimizer/src/meshoptimizer.h>
 
@@ -23,6 +27,30 @@ namespace stl = tinystl;
 
 #include <bimg/decode.h>
 
+#include <thread> // std::thread::hardware_concurrency
+
+#ifndef BGFX_UTILS_CONFIG_MMAP
+#	define BGFX_UTILS_CONFIG_MMAP (0  \
+		|| BX_PLATFORM_LINUX           \
+		|| BX_PLATFORM_OSX             \
+		|| BX_PLATFORM_WINDOWS         \
+		)
+#endif // BGFX_UTILS_CONFIG_MMAP
+
+#if BGFX_UTILS_CONFIG_MMAP
+#	if BX_PLATFORM_WINDOWS
+#		ifndef NOMINMAX
+#			define NOMINMAX
+#		endif // NOMINMAX
+#		include <windows.h>
+#	else
+#		include <fcntl.h>
+#		include <sys/mman.h>
+#		include <sys/stat.h>
+#		include <unistd.h>
+#	endif // BX_PLATFORM_WINDOWS
+#endif // BGFX_UTILS_CONFIG_MMAP
+
 void* load(bx::FileReaderI* _reader, bx::AllocatorI* _allocator, const char* _filePath, uint32_t* _size)
 {
 	if (bx::open(_reader, _filePath) )
@@ -60,6 +88,101 @@ void unload(void* _ptr)
 	BX_FREE(entry::getAllocator(), _ptr);
 }
 
+struct MappedFile
+{
+	void* m_data;
+	uint32_t m_size;
+	bool m_mapped;
+};
+
+// Maps file into memory when platform supports it, otherwise (or when mapping fails) reads it
+// with entry file reader.
+static bool mapFile(MappedFile& _file, const char* _filePath)
+{
+	_file.m_data   = NULL;
+	_file.m_size   = 0;
+	_file.m_mapped = false;
+
+#if BGFX_UTILS_CONFIG_MMAP
+	char filePath[bx::kMaxFilePath];
+	bx::strCopy(filePath, BX_COUNTOF(filePath), entry::getCurrentDir() );
+	bx::strCat(filePath, BX_COUNTOF(filePath), _filePath);
+
+#	if BX_PLATFORM_WINDOWS
+	HANDLE file = CreateFileA(filePath, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (INVALID_HANDLE_VALUE != file)
+	{
+		const DWORD size = GetFileSize(file, NULL);
+		HANDLE mapping = 0 < size && INVALID_FILE_SIZE != size
+			? CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL)
+			: NULL
+			;
+
+		if (NULL != mapping)
+		{
+			// View keeps mapping alive after handles are closed.
+			_file.m_data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+			_file.m_size = size;
+			CloseHandle(mapping);
+		}
+
+		CloseHandle(file);
+	}
+#	else
+	int fd = ::open(filePath, O_RDONLY);
+	if (-1 != fd)
+	{
+		struct stat st;
+		if (0 == fstat(fd, &st)
+		&&  0 < st.st_size)
+		{
+			void* data = mmap(NULL, size_t(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+			if (MAP_FAILED != data)
+			{
+				_file.m_data = data;
+				_file.m_size = uint32_t(st.st_size);
+			}
+		}
+
+		::close(fd);
+	}
+#	endif // BX_PLATFORM_WINDOWS
+
+	if (NULL != _file.m_data)
+	{
+		_file.m_mapped = true;
+		return true;
+	}
+#endif // BGFX_UTILS_CONFIG_MMAP
+
+	_file.m_data = load(_filePath, &_file.m_size);
+	return NULL != _file.m_data;
+}
+
+static void unmapFile(MappedFile& _file)
+{
+	if (!_file.m_mapped)
+	{
+		unload(_file.m_data);
+	}
+#if BGFX_UTILS_CONFIG_MMAP
+#	if BX_PLATFORM_WINDOWS
+	else
+	{
+		UnmapViewOfFile(_file.m_data);
+	}
+#	else
+	else
+	{
+		munmap(_file.m_data, _file.m_size);
+	}
+#	endif // BX_PLATFORM_WINDOWS
+#endif // BGFX_UTILS_CONFIG_MMAP
+
+	_file.m_data = NULL;
+	_file.m_size = 0;
+}
+
 static const bgfx::Memory* loadMem(bx::FileReaderI* _reader, const char* _filePath)
 {
 	if (bx::open(_reader, _filePath) )
@@ -96,10 +219,8 @@ static void* loadMem(bx::FileReaderI* _reader, bx::AllocatorI* _allocator, const
 	return NULL;
 }
 
-static bgfx::ShaderHandle loadShader(bx::FileReaderI* _reader, const char* _name)
+static const char* getShaderPath()
 {
-	char filePath[512];
-
 	const char* shaderPath = "???";
 
 	switch (bgfx::getRendererType() )
@@ -121,11 +242,25 @@ static bgfx::ShaderHandle loadShader(bx::FileReaderI* _reader, const char* _name
 		break;
 	}
 
-	bx::strCopy(filePath, BX_COUNTOF(filePath), shaderPath);
+	return shaderPath;
+}
+
+static bgfx::ShaderHandle loadShader(bx::FileReaderI* _reader, const char* _name)
+{
+	char filePath[512];
+
+	bx::strCopy(filePath, BX_COUNTOF(filePath), getShaderPath() );
 	bx::strCat(filePath, BX_COUNTOF(filePath), _name);
 	bx::strCat(filePath, BX_COUNTOF(filePath), ".bin");
 
-	bgfx::ShaderHandle handle = bgfx::createShader(loadMem(_reader, filePath) );
+	const bgfx::Memory* mem = loadMem(_reader, filePath);
+	if (NULL == mem)
+	{
+		bgfx::ShaderHandle invalid = BGFX_INVALID_HANDLE;
+		return invalid;
+	}
+
+	bgfx::ShaderHandle handle = bgfx::createShader(mem);
 	bgfx::setName(handle, _name);
 
 	return handle;
@@ -143,6 +278,24 @@ bgfx::ProgramHandle loadProgram(bx::FileReaderI* _reader, const char* _vsName, c
 	if (NULL != _fsName)
 	{
 		fsh = loadShader(_reader, _fsName);
+
+		if (!bgfx::isValid(vsh)
+		||  !bgfx::isValid(fsh) )
+		{
+			// Shader that did load would leak, since program is not created.
+			if (bgfx::isValid(vsh) )
+			{
+				bgfx::destroy(vsh);
+			}
+
+			if (bgfx::isValid(fsh) )
+			{
+				bgfx::destroy(fsh);
+			}
+
+			bgfx::ProgramHandle invalid = BGFX_INVALID_HANDLE;
+			return invalid;
+		}
 	}
 
 	return bgfx::createProgram(vsh, fsh, true /* destroy shaders when program is destroyed */);
@@ -153,6 +306,256 @@ bgfx::ProgramHandle loadProgram(const char* _vsName, const char* _fsName)
 	return loadProgram(entry::getFileReader(), _vsName, _fsName);
 }
 
+#define BGFX_SHADER_PACK_MAGIC BX_MAKEFOURCC('S', 'P', 'K', 1)
+
+struct ShaderPackDefine
+{
+	stl::string m_name;
+	uint32_t m_axis;
+	uint32_t m_value;
+};
+
+struct ShaderPack
+{
+	MappedFile m_file;
+	stl::string m_name;
+	stl::vector<ShaderPackDefine> m_defines;
+	stl::vector<uint32_t> m_strides;
+	stl::vector<uint32_t> m_keys;
+	stl::vector<uint32_t> m_blobIdx;
+	stl::vector<uint32_t> m_blobOffset;
+	stl::vector<uint32_t> m_blobSize;
+	stl::vector<bgfx::ShaderHandle> m_shaders;
+	int32_t m_refCount;
+};
+
+static void shaderPackRelease(ShaderPack* _pack)
+{
+	// Last reference is either shaderPackUnload or renderer releasing memory of last created
+	// shader, mapping must outlive both.
+	if (1 == bx::atomicFetchAndSub(&_pack->m_refCount, 1) )
+	{
+		unmapFile(_pack->m_file);
+		delete _pack;
+	}
+}
+
+static void shaderPackReleaseCb(void* _ptr, void* _userData)
+{
+	BX_UNUSED(_ptr);
+	shaderPackRelease( (ShaderPack*)_userData);
+}
+
+ShaderPack* shaderPackLoad(const char* _name)
+{
+	char filePath[512];
+	bx::strCopy(filePath, BX_COUNTOF(filePath), getShaderPath() );
+	bx::strCat(filePath, BX_COUNTOF(filePath), _name);
+	bx::strCat(filePath, BX_COUNTOF(filePath), ".bin");
+
+	ShaderPack* pack = new ShaderPack;
+	pack->m_name = _name;
+	pack->m_refCount = 1;
+
+	if (!mapFile(pack->m_file, filePath) )
+	{
+		DBG("Failed to load %s.", filePath);
+		delete pack;
+		return NULL;
+	}
+
+	bx::MemoryReader reader(pack->m_file.m_data, pack->m_file.m_size);
+	bx::Error err;
+
+	uint32_t magic = 0;
+	bx::read(&reader, magic, &err);
+
+	if (BGFX_SHADER_PACK_MAGIC != magic)
+	{
+		DBG("%s is not shader pack.", filePath);
+		shaderPackRelease(pack);
+		return NULL;
+	}
+
+	uint16_t numAxes = 0;
+	bx::read(&reader, numAxes, &err);
+
+	uint32_t stride = 1;
+	for (uint32_t axis = 0; axis < numAxes && err.isOk(); ++axis)
+	{
+		uint8_t numDefines = 0;
+		bx::read(&reader, numDefines, &err);
+
+		for (uint32_t value = 1; value <= numDefines && err.isOk(); ++value)
+		{
+			uint8_t len = 0;
+			bx::read(&reader, len, &err);
+
+			char name[256];
+			bx::read(&reader, name, len, &err);
+			name[len] = '\0';
+
+			ShaderPackDefine define;
+			define.m_name  = name;
+			define.m_axis  = axis;
+			define.m_value = value;
+			pack->m_defines.push_back(define);
+		}
+
+		pack->m_strides.push_back(stride);
+		stride *= numDefines + 1;
+	}
+
+	uint32_t numEntries = 0;
+	bx::read(&reader, numEntries, &err);
+
+	pack->m_keys.resize(numEntries);
+	pack->m_blobIdx.resize(numEntries);
+
+	for (uint32_t ii = 0; ii < numEntries && err.isOk(); ++ii)
+	{
+		bx::read(&reader, pack->m_keys[ii], &err);
+		bx::read(&reader, pack->m_blobIdx[ii], &err);
+	}
+
+	uint32_t numBlobs = 0;
+	bx::read(&reader, numBlobs, &err);
+
+	pack->m_blobOffset.resize(numBlobs);
+	pack->m_blobSize.resize(numBlobs);
+	pack->m_shaders.resize(numBlobs, BGFX_INVALID_HANDLE);
+
+	for (uint32_t ii = 0; ii < numBlobs && err.isOk(); ++ii)
+	{
+		bx::read(&reader, pack->m_blobOffset[ii], &err);
+		bx::read(&reader, pack->m_blobSize[ii], &err);
+
+		if (uint64_t(pack->m_blobOffset[ii]) + pack->m_blobSize[ii] > pack->m_file.m_size)
+		{
+			BX_ERROR_SET(&err, BX_ERROR_READERWRITER_READ, "ShaderPack: Blob out of bounds.");
+		}
+	}
+
+	if (!err.isOk() )
+	{
+		DBG("%s is corrupted.", filePath);
+		shaderPackRelease(pack);
+		return NULL;
+	}
+
+	return pack;
+}
+
+void shaderPackUnload(ShaderPack* _pack)
+{
+	for (uint32_t ii = 0, num = uint32_t(_pack->m_shaders.size() ); ii < num; ++ii)
+	{
+		if (bgfx::isValid(_pack->m_shaders[ii]) )
+		{
+			bgfx::destroy(_pack->m_shaders[ii]);
+		}
+	}
+
+	shaderPackRelease(_pack);
+}
+
+uint32_t shaderPackGetKey(const ShaderPack* _pack, const char* _defines)
+{
+	uint32_t key = 0;
+	stl::vector<bool> axisSet(_pack->m_strides.size(), false);
+
+	for (bx::StringView parse(_defines); !parse.isEmpty();)
+	{
+		const bx::StringView sep = bx::strFind(parse, ';');
+		const bx::StringView name = bx::strTrim(bx::StringView(parse.getPtr(), sep.getPtr() ), " \t");
+		parse = bx::StringView(sep.getPtr() == parse.getTerm() ? sep.getPtr() : sep.getPtr()+1, parse.getTerm() );
+
+		if (name.isEmpty() )
+		{
+			continue;
+		}
+
+		bool found = false;
+		for (uint32_t ii = 0, num = uint32_t(_pack->m_defines.size() ); ii < num && !found; ++ii)
+		{
+			const ShaderPackDefine& define = _pack->m_defines[ii];
+			if (0 == bx::strCmp(name, define.m_name.c_str() ) )
+			{
+				// Defines on the same axis are mutually exclusive, summing them would
+				// produce key of unrelated permutation.
+				BX_CHECK(!axisSet[define.m_axis]
+					, "ShaderPack: Define '%.*s' conflicts with another define on the same axis."
+					, name.getLength()
+					, name.getPtr()
+					);
+				if (axisSet[define.m_axis])
+				{
+					return UINT32_MAX;
+				}
+
+				axisSet[define.m_axis] = true;
+				key += define.m_value * _pack->m_strides[define.m_axis];
+				found = true;
+			}
+		}
+
+		if (!found)
+		{
+			return UINT32_MAX;
+		}
+	}
+
+	return key;
+}
+
+bgfx::ShaderHandle shaderPackGetShader(ShaderPack* _pack, uint32_t _key)
+{
+	uint32_t first = 0;
+	uint32_t last  = uint32_t(_pack->m_keys.size() );
+
+	while (first < last)
+	{
+		const uint32_t mid = (first + last) / 2;
+		if (_pack->m_keys[mid] < _key)
+		{
+			first = mid + 1;
+		}
+		else
+		{
+			last = mid;
+		}
+	}
+
+	if (first == _pack->m_keys.size()
+	||  _pack->m_keys[first] != _key)
+	{
+		return BGFX_INVALID_HANDLE;
+	}
+
+	const uint32_t blob = _pack->m_blobIdx[first];
+	bgfx::ShaderHandle& handle = _pack->m_shaders[blob];
+
+	if (!bgfx::isValid(handle) )
+	{
+		bx::atomicFetchAndAdd(&_pack->m_refCount, 1);
+
+		const bgfx::Memory* mem = bgfx::makeRef(
+			  (const uint8_t*)_pack->m_file.m_data + _pack->m_blobOffset[blob]
+			, _pack->m_blobSize[blob]
+			, shaderPackReleaseCb
+			, _pack
+			);
+
+		handle = bgfx::createShader(mem);
+
+		char name[256];
+		bx::snprintf(name, BX_COUNTOF(name), "%s#%x", _pack->m_name.c_str(), _key);
+		bgfx::setName(handle, name);
+	}
+
+	return handle;
+}
+
 static void imageReleaseCb(void* _ptr, void* _userData)
 {
 	BX_UNUSED(_ptr);
@@ -371,7 +774,13 @@ void Group::reset()
 	m_vertices = NULL;
 	m_numIndices = 0;
 	m_indices = NULL;
+	m_index32 = false;
+	m_quantized = false;
+	m_dequantOffset = bx::Vec3(0.0f, 0.0f, 0.0f);
+	m_dequantScale = 1.0f;
 	m_prims.clear();
+	m_meshlets.clear();
+	m_lods.clear();
 }
 
 namespace bgfx
@@ -379,13 +788,171 @@ namespace bgfx
 	int32_t read(bx::ReaderI* _reader, bgfx::VertexLayout& _layout, bx::Error* _err = NULL);
 }
 
-void Mesh::load(bx::ReaderSeekerI* _reader, bool _ramcopy)
+// Keeps mesh file mapped while renderer references vertex and index data in it.
+struct MeshFile
+{
+	MappedFile m_file;
+	int32_t m_refCount;
+};
+
+static void meshFileRelease(MeshFile* _file)
+{
+	if (1 == bx::atomicFetchAndSub(&_file->m_refCount, 1) )
+	{
+		unmapFile(_file->m_file);
+		delete _file;
+	}
+}
+
+static void meshFileReleaseCb(void* _ptr, void* _userData)
+{
+	BX_UNUSED(_ptr);
+	meshFileRelease( (MeshFile*)_userData);
+}
+
+// Returns pointer to next _size bytes of mesh file and skips them, or NULL when reading from
+// stream, or when data is out of file bounds.
+static const uint8_t* getMeshFileData(bx::ReaderSeekerI* _reader, uint32_t _size, MeshFile* _file)
+{
+	if (NULL != _file)
+	{
+		const int64_t offset = bx::seek(_reader);
+		if (offset + _size <= _file->m_file.m_size)
+		{
+			bx::skip(_reader, _size);
+			return (const uint8_t*)_file->m_file.m_data + offset;
+		}
+	}
+
+	return NULL;
+}
+
+// References data in mesh file without copy when possible, otherwise reads it.
+static const bgfx::Memory* readMemory(bx::ReaderSeekerI* _reader, uint32_t _size, MeshFile* _file)
+{
+	const uint8_t* data = getMeshFileData(_reader, _size, _file);
+	if (NULL != data)
+	{
+		bx::atomicFetchAndAdd(&_file->m_refCount, 1);
+		return bgfx::makeRef(data, _size, meshFileReleaseCb, _file);
+	}
+
+	const bgfx::Memory* mem = bgfx::alloc(_size);
+	bx::read(_reader, mem->data, mem->size);
+	return mem;
+}
+
+static void readNumVertices(bx::ReaderI* _reader, Group& _group, bool _vertex32)
+{
+	if (_vertex32)
+	{
+		bx::read(_reader, _group.m_numVertices);
+	}
+	else
+	{
+		uint16_t numVertices;
+		bx::read(_reader, numVertices);
+		_group.m_numVertices = numVertices;
+	}
+}
+
+// Vertex or index buffer decoded on worker thread, created later on API thread.
+struct MeshDeferredBuffer
+{
+	uint32_t m_group;
+	bool m_index;
+	uint16_t m_flags;
+	const bgfx::Memory* m_mem;
+	bgfx::VertexLayout m_layout;
+};
+
+struct MeshDeferredBuffers
+{
+	stl::vector<MeshDeferredBuffer> m_buffers;
+};
+
+static bgfx::VertexBufferHandle createVertexBuffer(MeshDeferredBuffers* _deferred, uint32_t _group, const bgfx::Memory* _mem, const bgfx::VertexLayout& _layout)
+{
+	if (NULL == _deferred)
+	{
+		return bgfx::createVertexBuffer(_mem, _layout);
+	}
+
+	MeshDeferredBuffer buffer;
+	buffer.m_group  = _group;
+	buffer.m_index  = false;
+	buffer.m_flags  = BGFX_BUFFER_NONE;
+	buffer.m_mem    = _mem;
+	buffer.m_layout = _layout;
+	_deferred->m_buffers.push_back(buffer);
+
+	return BGFX_INVALID_HANDLE;
+}
+
+static bgfx::IndexBufferHandle createIndexBuffer(MeshDeferredBuffers* _deferred, uint32_t _group, const bgfx::Memory* _mem, uint16_t _flags)
+{
+	if (NULL == _deferred)
+	{
+		return bgfx::createIndexBuffer(_mem, _flags);
+	}
+
+	MeshDeferredBuffer buffer;
+	buffer.m_group = _group;
+	buffer.m_index = true;
+	buffer.m_flags = _flags;
+	buffer.m_mem   = _mem;
+	_deferred->m_buffers.push_back(buffer);
+
+	return BGFX_INVALID_HANDLE;
+}
+
+static void createDeferredBuffers(Mesh& _mesh, const MeshDeferredBuffers& _deferred)
 {
-#define BGFX_CHUNK_MAGIC_VB  BX_MAKEFOURCC('V', 'B', ' ', 0x1)
-#define BGFX_CHUNK_MAGIC_VBC BX_MAKEFOURCC('V', 'B', 'C', 0x0)
-#define BGFX_CHUNK_MAGIC_IB  BX_MAKEFOURCC('I', 'B', ' ', 0x0)
-#define BGFX_CHUNK_MAGIC_IBC BX_MAKEFOURCC('I', 'B', 'C', 0x1)
+	for (uint32_t ii = 0, num = uint32_t(_deferred.m_buffers.size() ); ii < num; ++ii)
+	{
+		const MeshDeferredBuffer& buffer = _deferred.m_buffers[ii];
+
+		// Buffers of group truncated by corrupt file are still created to release their memory.
+		if (buffer.m_group >= _mesh.m_groups.size() )
+		{
+			if (buffer.m_index)
+			{
+				bgfx::destroy(bgfx::createIndexBuffer(buffer.m_mem, buffer.m_flags) );
+			}
+			else
+			{
+				bgfx::destroy(bgfx::createVertexBuffer(buffer.m_mem, buffer.m_layout) );
+			}
+
+			continue;
+		}
+
+		Group& group = _mesh.m_groups[buffer.m_group];
+		if (buffer.m_index)
+		{
+			group.m_ibh = bgfx::createIndexBuffer(buffer.m_mem, buffer.m_flags);
+		}
+		else
+		{
+			group.m_vbh = bgfx::createVertexBuffer(buffer.m_mem, buffer.m_layout);
+		}
+	}
+}
+
+void Mesh::load(bx::ReaderSeekerI* _reader, bool _ramcopy, MeshFile* _file, MeshDeferredBuffers* _deferred)
+{
+#define BGFX_CHUNK_MAGIC_VB    BX_MAKEFOURCC('V', 'B', ' ', 0x1)
+#define BGFX_CHUNK_MAGIC_VB32  BX_MAKEFOURCC('V', 'B', ' ', 0x2)
+#define BGFX_CHUNK_MAGIC_VBC   BX_MAKEFOURCC('V', 'B', 'C', 0x0)
+#define BGFX_CHUNK_MAGIC_VBC32 BX_MAKEFOURCC('V', 'B', 'C', 0x1)
+#define BGFX_CHUNK_MAGIC_IB    BX_MAKEFOURCC('I', 'B', ' ', 0x0)
+#define BGFX_CHUNK_MAGIC_IB32  BX_MAKEFOURCC('I', 'B', '3', 0x0)
+#define BGFX_CHUNK_MAGIC_IBC   BX_MAKEFOURCC('I', 'B', 'C', 0x1)
+#define BGFX_CHUNK_MAGIC_IBC32 BX_MAKEFOURCC('I', 'C', '3', 0x0)
 #define BGFX_CHUNK_MAGIC_PRI BX_MAKEFOURCC('P', 'R', 'I', 0x0)
+#define BGFX_CHUNK_MAGIC_MSL BX_MAKEFOURCC('M', 'S', 'L', 0x0)
+#define BGFX_CHUNK_MAGIC_LOD BX_MAKEFOURCC('L', 'O', 'D', 0x0)
+#define BGFX_CHUNK_MAGIC_QNT BX_MAKEFOURCC('Q', 'N', 'T', 0x0)
 
 	using namespace bx;
 	using namespace bgfx;
@@ -402,6 +969,7 @@ void Mesh::load(bx::ReaderSeekerI* _reader, bool _ramcopy)
 		switch (chunk)
 		{
 			case BGFX_CHUNK_MAGIC_VB:
+			case BGFX_CHUNK_MAGIC_VB32:
 			{
 				read(_reader, group.m_sphere);
 				read(_reader, group.m_aabb);
@@ -411,19 +979,19 @@ void Mesh::load(bx::ReaderSeekerI* _reader, bool _ramcopy)
 				
 				uint16_t stride = m_layout.getStride();
 				
-				read(_reader, group.m_numVertices);
-				const bgfx::Memory* mem = bgfx::alloc(group.m_numVertices*stride);
-				read(_reader, mem->data, mem->size);
+				readNumVertices(_reader, group, BGFX_CHUNK_MAGIC_VB32 == chunk);
+				const bgfx::Memory* mem = readMemory(_reader, group.m_numVertices*stride, _file);
 				if ( _ramcopy )
 				{
 					group.m_vertices = (uint8_t*)BX_ALLOC(allocator, group.m_numVertices*stride);
 					bx::memCopy(group.m_vertices, mem->data, mem->size);
 				}
-				group.m_vbh = bgfx::createVertexBuffer(mem, m_layout);
+				group.m_vbh = createVertexBuffer(_deferred, uint32_t(m_groups.size() ), mem, m_layout);
 			}
 				break;
 				
 			case BGFX_CHUNK_MAGIC_VBC:
+			case BGFX_CHUNK_MAGIC_VBC32:
 			{
 				read(_reader, group.m_sphere);
 				read(_reader, group.m_aabb);
@@ -433,19 +1001,29 @@ void Mesh::load(bx::ReaderSeekerI* _reader, bool _ramcopy)
 				
 				uint16_t stride = m_layout.getStride();
 				
-				read(_reader, group.m_numVertices);
+				readNumVertices(_reader, group, BGFX_CHUNK_MAGIC_VBC32 == chunk);
 				
 				const bgfx::Memory* mem = bgfx::alloc(group.m_numVertices*stride);
 				
 				uint32_t compressedSize;
 				bx::read(_reader, compressedSize);
 				
-				void* compressedVertices = BX_ALLOC(allocator, compressedSize);
-				bx::read(_reader, compressedVertices, compressedSize);
+				// Decode straight from mapped file into memory passed to renderer.
+				void* compressedVertices = NULL;
+				const uint8_t* compressed = getMeshFileData(_reader, compressedSize, _file);
+				if (NULL == compressed)
+				{
+					compressedVertices = BX_ALLOC(allocator, compressedSize);
+					bx::read(_reader, compressedVertices, compressedSize);
+					compressed = (const uint8_t*)compressedVertices;
+				}
 				
-				meshopt_decodeVertexBuffer(mem->data, group.m_numVertices, stride, (uint8_t*)compressedVertices, compressedSize);
+				meshopt_decodeVertexBuffer(mem->data, group.m_numVertices, stride, compressed, compressedSize);
 				
-				BX_FREE(allocator, compressedVertices);
+				if (NULL != compressedVertices)
+				{
+					BX_FREE(allocator, compressedVertices);
+				}
 
 				if ( _ramcopy )
 				{
@@ -453,52 +1031,113 @@ void Mesh::load(bx::ReaderSeekerI* _reader, bool _ramcopy)
 					bx::memCopy(group.m_vertices, mem->data, mem->size);
 				}
 				
-				group.m_vbh = bgfx::createVertexBuffer(mem, m_layout);
+				group.m_vbh = createVertexBuffer(_deferred, uint32_t(m_groups.size() ), mem, m_layout);
 			}
 				break;
 				
 			case BGFX_CHUNK_MAGIC_IB:
+			case BGFX_CHUNK_MAGIC_IB32:
 			{
+				group.m_index32 = BGFX_CHUNK_MAGIC_IB32 == chunk;
+				const uint32_t indexSize = group.m_index32 ? 4 : 2;
+
 				read(_reader, group.m_numIndices);
-				const bgfx::Memory* mem = bgfx::alloc(group.m_numIndices*2);
-				read(_reader, mem->data, mem->size);
+				const bgfx::Memory* mem = readMemory(_reader, group.m_numIndices*indexSize, _file);
 				if ( _ramcopy )
 				{
-					group.m_indices = (uint16_t*)BX_ALLOC(allocator, group.m_numIndices*2);
+					group.m_indices = BX_ALLOC(allocator, group.m_numIndices*indexSize);
 					bx::memCopy(group.m_indices, mem->data, mem->size);
 				}
 
-				group.m_ibh = bgfx::createIndexBuffer(mem);
+				group.m_ibh = createIndexBuffer(_deferred, uint32_t(m_groups.size() ), mem, group.m_index32 ? BGFX_BUFFER_INDEX32 : BGFX_BUFFER_NONE);
 			}
 				break;
 				
 			case BGFX_CHUNK_MAGIC_IBC:
+			case BGFX_CHUNK_MAGIC_IBC32:
 			{
+				group.m_index32 = BGFX_CHUNK_MAGIC_IBC32 == chunk;
+				const uint32_t indexSize = group.m_index32 ? 4 : 2;
+
 				bx::read(_reader, group.m_numIndices);
 				
-				const bgfx::Memory* mem = bgfx::alloc(group.m_numIndices*2);
+				const bgfx::Memory* mem = bgfx::alloc(group.m_numIndices*indexSize);
 				
 				uint32_t compressedSize;
 				bx::read(_reader, compressedSize);
 				
-				void* compressedIndices = BX_ALLOC(allocator, compressedSize);
-				
-				bx::read(_reader, compressedIndices, compressedSize);
+				void* compressedIndices = NULL;
+				const uint8_t* compressed = getMeshFileData(_reader, compressedSize, _file);
+				if (NULL == compressed)
+				{
+					compressedIndices = BX_ALLOC(allocator, compressedSize);
+					bx::read(_reader, compressedIndices, compressedSize);
+					compressed = (const uint8_t*)compressedIndices;
+				}
 				
-				meshopt_decodeIndexBuffer(mem->data, group.m_numIndices, 2, (uint8_t*)compressedIndices, compressedSize);
+				meshopt_decodeIndexBuffer(mem->data, group.m_numIndices, indexSize, compressed, compressedSize);
 				
-				BX_FREE(allocator, compressedIndices);
+				if (NULL != compressedIndices)
+				{
+					BX_FREE(allocator, compressedIndices);
+				}
 				
 				if ( _ramcopy )
 				{
-					group.m_indices = (uint16_t*)BX_ALLOC(allocator, group.m_numIndices*2);
+					group.m_indices = BX_ALLOC(allocator, group.m_numIndices*indexSize);
 					bx::memCopy(group.m_indices, mem->data, mem->size);
 				}
 				
-				group.m_ibh = bgfx::createIndexBuffer(mem);
+				group.m_ibh = createIndexBuffer(_deferred, uint32_t(m_groups.size() ), mem, group.m_index32 ? BGFX_BUFFER_INDEX32 : BGFX_BUFFER_NONE);
 			}
 				break;
 				
+			case BGFX_CHUNK_MAGIC_MSL:
+			{
+				uint32_t num;
+				read(_reader, num);
+
+				group.m_meshlets.resize(num);
+
+				for (uint32_t ii = 0; ii < num; ++ii)
+				{
+					Meshlet& meshlet = group.m_meshlets[ii];
+					read(_reader, meshlet.m_startIndex);
+					read(_reader, meshlet.m_numIndices);
+					read(_reader, meshlet.m_sphere);
+					read(_reader, meshlet.m_coneApex);
+					read(_reader, meshlet.m_coneAxis);
+					read(_reader, meshlet.m_coneCutoff);
+				}
+			}
+				break;
+
+			case BGFX_CHUNK_MAGIC_QNT:
+			{
+				group.m_quantized = true;
+				read(_reader, group.m_dequantOffset);
+				read(_reader, group.m_dequantScale);
+			}
+				break;
+
+			case BGFX_CHUNK_MAGIC_LOD:
+			{
+				uint8_t num;
+				read(_reader, num);
+
+				group.m_lods.resize(num);
+
+				for (uint32_t ii = 0; ii < num; ++ii)
+				{
+					Lod& lod = group.m_lods[ii];
+					read(_reader, lod.m_startIndex);
+					read(_reader, lod.m_numIndices);
+					read(_reader, lod.m_numVertices);
+					read(_reader, lod.m_error);
+				}
+			}
+				break;
+
 			case BGFX_CHUNK_MAGIC_PRI:
 			{
 				uint16_t len;
@@ -570,6 +1209,95 @@ void Mesh::unload()
 	m_groups.clear();
 }
 
+static void setGroupBuffers(const Group& _group, uint32_t _lod)
+{
+	if (_group.m_lods.empty() )
+	{
+		bgfx::setIndexBuffer(_group.m_ibh);
+		bgfx::setVertexBuffer(0, _group.m_vbh);
+	}
+	else
+	{
+		const Lod& lod = _group.m_lods[_lod];
+		bgfx::setIndexBuffer(_group.m_ibh, lod.m_startIndex, lod.m_numIndices);
+		bgfx::setVertexBuffer(0, _group.m_vbh, 0, lod.m_numVertices);
+	}
+}
+
+static void setGroupTransform(const Group& _group, uint32_t _cached, const float* _mtx, uint16_t _numMatrices)
+{
+	if (!_group.m_quantized)
+	{
+		bgfx::setTransform(_cached, _numMatrices);
+		return;
+	}
+
+	const float scale = _group.m_dequantScale;
+	const bx::Vec3& offset = _group.m_dequantOffset;
+
+	float dequant[16];
+	bx::mtxSRT(dequant, scale, scale, scale, 0.0f, 0.0f, 0.0f, offset.x, offset.y, offset.z);
+
+	bgfx::Transform transform;
+	const uint32_t cached = bgfx::allocTransform(&transform, _numMatrices);
+
+	for (uint16_t ii = 0; ii < _numMatrices; ++ii)
+	{
+		if (NULL == _mtx)
+		{
+			bx::memCopy(&transform.data[ii*16], dequant, sizeof(dequant) );
+		}
+		else
+		{
+			bx::mtxMul(&transform.data[ii*16], dequant, &_mtx[ii*16]);
+		}
+	}
+
+	bgfx::setTransform(cached, _numMatrices);
+}
+
+static uint32_t selectLod(const Group& _group, const float* _mtx, const bx::Vec3& _eye, float _projScale, float _maxError)
+{
+	const uint32_t numLods = uint32_t(_group.m_lods.size() );
+	if (1 >= numLods)
+	{
+		return 0;
+	}
+
+	bx::Vec3 center = _group.m_sphere.center;
+	float scale = 1.0f;
+
+	if (NULL != _mtx)
+	{
+		center = bx::mul(center, _mtx);
+		scale  = bx::max(
+			  bx::length(bx::Vec3(_mtx[0], _mtx[1], _mtx[ 2]) )
+			, bx::max(
+				  bx::length(bx::Vec3(_mtx[4], _mtx[5], _mtx[ 6]) )
+				, bx::length(bx::Vec3(_mtx[8], _mtx[9], _mtx[10]) )
+				) );
+	}
+
+	// Distance to bounding sphere surface, error is not projected when eye is inside.
+	const float distance = bx::length(bx::sub(center, _eye) ) - _group.m_sphere.radius*scale;
+	if (distance <= 0.0f)
+	{
+		return 0;
+	}
+
+	const float errorToPixels = scale*_projScale/distance;
+
+	for (uint32_t ii = numLods-1; ii > 0; --ii)
+	{
+		if (_group.m_lods[ii].m_error*errorToPixels <= _maxError)
+		{
+			return ii;
+		}
+	}
+
+	return 0;
+}
+
 void Mesh::submit(bgfx::ViewId _id, bgfx::ProgramHandle _program, const float* _mtx, uint64_t _state) const
 {
 	if (BGFX_STATE_MASK == _state)
@@ -584,15 +1312,15 @@ void Mesh::submit(bgfx::ViewId _id, bgfx::ProgramHandle _program, const float* _
 		;
 	}
 	
-	bgfx::setTransform(_mtx);
+	uint32_t cached = bgfx::setTransform(_mtx);
 	bgfx::setState(_state);
 	
 	for (GroupArray::const_iterator it = m_groups.begin(), itEnd = m_groups.end(); it != itEnd; ++it)
 	{
 		const Group& group = *it;
 		
-		bgfx::setIndexBuffer(group.m_ibh);
-		bgfx::setVertexBuffer(0, group.m_vbh);
+		setGroupTransform(group, cached, _mtx, 1);
+		setGroupBuffers(group, 0);
 		bgfx::submit(_id, _program, 0, (it == itEnd-1) ? (BGFX_DISCARD_INDEX_BUFFER | BGFX_DISCARD_VERTEX_STREAMS | BGFX_DISCARD_STATE) : BGFX_DISCARD_NONE);
 	}
 }
@@ -622,13 +1350,40 @@ void Mesh::submit(const MeshState*const* _state, uint8_t _numPasses, const float
 		{
 			const Group& group = *it;
 			
-			bgfx::setIndexBuffer(group.m_ibh);
-			bgfx::setVertexBuffer(0, group.m_vbh);
+			setGroupTransform(group, cached, _mtx, _numMatrices);
+			setGroupBuffers(group, 0);
 			bgfx::submit(state.m_viewId, state.m_program, 0, (it == itEnd - 1) ? (BGFX_DISCARD_INDEX_BUFFER | BGFX_DISCARD_VERTEX_STREAMS | BGFX_DISCARD_STATE) : BGFX_DISCARD_NONE);
 		}
 	}
 }
 
+void Mesh::submit(bgfx::ViewId _id, bgfx::ProgramHandle _program, const float* _mtx, uint64_t _state, const bx::Vec3& _eye, float _projScale, float _maxError) const
+{
+	if (BGFX_STATE_MASK == _state)
+	{
+		_state = 0
+		| BGFX_STATE_WRITE_RGB
+		| BGFX_STATE_WRITE_A
+		| BGFX_STATE_WRITE_Z
+		| BGFX_STATE_DEPTH_TEST_LESS
+		| BGFX_STATE_CULL_CCW
+		| BGFX_STATE_MSAA
+		;
+	}
+
+	uint32_t cached = bgfx::setTransform(_mtx);
+	bgfx::setState(_state);
+
+	for (GroupArray::const_iterator it = m_groups.begin(), itEnd = m_groups.end(); it != itEnd; ++it)
+	{
+		const Group& group = *it;
+
+		setGroupTransform(group, cached, _mtx, 1);
+		setGroupBuffers(group, selectLod(group, _mtx, _eye, _projScale, _maxError) );
+		bgfx::submit(_id, _program, 0, (it == itEnd-1) ? (BGFX_DISCARD_INDEX_BUFFER | BGFX_DISCARD_VERTEX_STREAMS | BGFX_DISCARD_STATE) : BGFX_DISCARD_NONE);
+	}
+}
+
 Mesh* meshLoad(bx::ReaderSeekerI* _reader, bool _ramcopy)
 {
 	Mesh* mesh = new Mesh;
@@ -638,15 +1393,182 @@ Mesh* meshLoad(bx::ReaderSeekerI* _reader, bool _ramcopy)
 
 Mesh* meshLoad(const char* _filePath, bool _ramcopy)
 {
-	bx::FileReaderI* reader = entry::getFileReader();
-	if (bx::open(reader, _filePath) )
+	MeshFile* file = new MeshFile;
+	file->m_refCount = 1;
+
+	if (!mapFile(file->m_file, _filePath) )
 	{
-		Mesh* mesh = meshLoad(reader, _ramcopy);
-		bx::close(reader);
-		return mesh;
+		delete file;
+		return NULL;
 	}
 
-	return NULL;
+	// Uncompressed vertex and index buffers reference mapped file directly, it's unmapped once
+	// renderer releases last of them.
+	bx::MemoryReader reader(file->m_file.m_data, file->m_file.m_size);
+
+	Mesh* mesh = new Mesh;
+	mesh->load(&reader, _ramcopy, file);
+
+	meshFileRelease(file);
+
+	return mesh;
+}
+
+#define BGFX_UTILS_MESH_ASYNC_MAX_THREADS 16
+
+struct MeshAsync
+{
+	MeshFile* m_file;
+	bool m_ramcopy;
+	Mesh* m_mesh;
+	MeshDeferredBuffers m_deferred;
+	bx::Semaphore m_done;
+};
+
+// Worker threads are spawned on demand, and exit once queue is drained.
+struct MeshAsyncPool
+{
+	MeshAsyncPool()
+		: m_numThreads(0)
+	{
+		bx::memSet(m_active, 0, sizeof(m_active) );
+	}
+
+	~MeshAsyncPool()
+	{
+		for (uint32_t ii = 0; ii < BX_COUNTOF(m_thread); ++ii)
+		{
+			if (m_thread[ii].isRunning() )
+			{
+				m_thread[ii].shutdown();
+			}
+		}
+	}
+
+	bx::Mutex m_mutex;
+	stl::vector<MeshAsync*> m_queue;
+	uint32_t m_numThreads;
+	bx::Thread m_thread[BGFX_UTILS_MESH_ASYNC_MAX_THREADS];
+	bool m_active[BGFX_UTILS_MESH_ASYNC_MAX_THREADS];
+};
+
+static MeshAsyncPool s_meshAsyncPool;
+
+static void meshAsyncLoad(MeshAsync* _async)
+{
+	MeshFile* file = _async->m_file;
+	bx::MemoryReader reader(file->m_file.m_data, file->m_file.m_size);
+
+	Mesh* mesh = new Mesh;
+	mesh->load(&reader, _async->m_ramcopy, file, &_async->m_deferred);
+	_async->m_mesh = mesh;
+
+	meshFileRelease(file);
+	_async->m_file = NULL;
+
+	_async->m_done.post();
+}
+
+static int32_t meshAsyncThreadFunc(bx::Thread* _thread, void* _userData)
+{
+	BX_UNUSED(_thread);
+	const uint32_t slot = uint32_t(uintptr_t(_userData) );
+
+	MeshAsyncPool& pool = s_meshAsyncPool;
+
+	for (;;)
+	{
+		MeshAsync* async;
+
+		{
+			bx::MutexScope scope(pool.m_mutex);
+
+			if (pool.m_queue.empty() )
+			{
+				pool.m_active[slot] = false;
+				return 0;
+			}
+
+			async = pool.m_queue[0];
+			pool.m_queue.erase(pool.m_queue.begin() );
+		}
+
+		meshAsyncLoad(async);
+	}
+}
+
+MeshAsync* meshLoadAsync(const char* _filePath, bool _ramcopy)
+{
+	MeshFile* file = new MeshFile;
+	file->m_refCount = 1;
+
+	// File is memory mapped on calling thread, pages are read by worker while decoding. On
+	// platforms without memory mapping file is read here.
+	if (!mapFile(file->m_file, _filePath) )
+	{
+		delete file;
+		return NULL;
+	}
+
+	MeshAsync* async = new MeshAsync;
+	async->m_file    = file;
+	async->m_ramcopy = _ramcopy;
+	async->m_mesh    = NULL;
+
+	MeshAsyncPool& pool = s_meshAsyncPool;
+	bx::MutexScope scope(pool.m_mutex);
+
+	if (0 == pool.m_numThreads)
+	{
+		pool.m_numThreads = bx::clamp<uint32_t>(std::thread::hardware_concurrency(), 1, BGFX_UTILS_MESH_ASYNC_MAX_THREADS);
+	}
+
+	pool.m_queue.push_back(async);
+
+	for (uint32_t ii = 0; ii < pool.m_numThreads; ++ii)
+	{
+		if (!pool.m_active[ii])
+		{
+			bx::Thread& thread = pool.m_thread[ii];
+			if (thread.isRunning() )
+			{
+				// Thread already returned, slot was marked inactive before it exited.
+				thread.shutdown();
+			}
+
+			pool.m_active[ii] = true;
+			thread.init(meshAsyncThreadFunc, (void*)uintptr_t(ii), 0, "meshLoad");
+			break;
+		}
+	}
+
+	return async;
+}
+
+static Mesh* meshAsyncFinish(MeshAsync* _async)
+{
+	Mesh* mesh = _async->m_mesh;
+	createDeferredBuffers(*mesh, _async->m_deferred);
+	delete _async;
+
+	return mesh;
+}
+
+bool meshLoadPoll(MeshAsync* _handle, Mesh** _mesh)
+{
+	if (!_handle->m_done.wait(0) )
+	{
+		return false;
+	}
+
+	*_mesh = meshAsyncFinish(_handle);
+	return true;
+}
+
+Mesh* meshLoadWait(MeshAsync* _handle)
+{
+	_handle->m_done.wait();
+	return meshAsyncFinish(_handle);
 }
 
 void meshUnload(Mesh* _mesh)
@@ -676,6 +1598,16 @@ void meshSubmit(const Mesh* _mesh, const MeshState*const* _state, uint8_t _numPa
 	_mesh->submit(_state, _numPasses, _mtx, _numMatrices);
 }
 
+void meshSubmit(const Mesh* _mesh, bgfx::ViewId _id, bgfx::ProgramHandle _program, const float* _mtx, uint64_t _state, const bx::Vec3& _eye, float _projScale, float _maxError)
+{
+	_mesh->submit(_id, _program, _mtx, _state, _eye, _projScale, _maxError);
+}
+
+float meshLodProjScale(float _fovy, float _height)
+{
+	return _height / (2.0f * bx::tan(bx::toRad(_fovy) * 0.5f) );
+}
+
 Args::Args(int _argc, const char* const* _argv)
 	: m_type(bgfx::RendererType::Count)
 	, m_pciId(BGFX_PCI_ID_NONE)
@@ -28,6 +28,22 @@ bgfx::ShaderHandle loadShader(const char* _name);
 ///
 bgfx::ProgramHandle loadProgram(const char* _vsName, const char* _fsName);
 
+///
+struct ShaderPack;
+
+/// Loads shader pack produced by `shaderc --permutations`, variants are created on first use.
+ShaderPack* shaderPackLoad(const char* _name);
+
+///
+void shaderPackUnload(ShaderPack* _pack);
+
+/// Returns permutation key for semicolon separated defines, or UINT32_MAX if a define is not
+/// part of the pack, or two defines are from the same axis.
+uint32_t shaderPackGetKey(const ShaderPack* _pack, const char* _defines);
+
+/// Returns invalid handle if permutation was excluded from the pack.
+bgfx::ShaderHandle shaderPackGetShader(ShaderPack* _pack, uint32_t _key);
+
 ///
 bgfx::TextureHandle loadTexture(const char* _name, uint64_t _flags = BGFX_TEXTURE_NONE|BGFX_SAMPLER_NONE, uint8_t _skip = 0, bgfx::TextureInfo* _info = NULL, bimg::Orientation::Enum* _orientation = NULL);
 
@@ -98,6 +114,34 @@ struct Primitive
 
 typedef stl::vector<Primitive> PrimitiveArray;
 
+/// Cluster of triangles forming contiguous range in group index buffer, produced by
+/// `geometryc --meshlets`.
+struct Meshlet
+{
+	uint32_t m_startIndex;
+	uint32_t m_numIndices;
+
+	Sphere   m_sphere;
+	bx::Vec3 m_coneApex;
+	bx::Vec3 m_coneAxis;
+	float    m_coneCutoff; //!< Cluster is backfacing if dot(normalize(m_coneApex - eye), m_coneAxis) >= m_coneCutoff.
+};
+
+typedef stl::vector<Meshlet> MeshletArray;
+
+/// Level of detail produced by `geometryc --lod`. Level 0 is original geometry. Each level is
+/// contiguous range of group index buffer, and references only first m_numVertices vertices
+/// of group vertex buffer.
+struct Lod
+{
+	uint32_t m_startIndex;
+	uint32_t m_numIndices;
+	uint32_t m_numVertices;
+	float    m_error; //!< Object space geometric error bound.
+};
+
+typedef stl::vector<Lod> LodArray;
+
 struct Group
 {
 	Group();
@@ -105,23 +149,33 @@ struct Group
 	
 	bgfx::VertexBufferHandle m_vbh;
 	bgfx::IndexBufferHandle m_ibh;
-	uint16_t m_numVertices;
+	uint32_t m_numVertices;
 	uint8_t* m_vertices;
 	uint32_t m_numIndices;
-	uint16_t* m_indices;
+	void* m_indices;
+	bool m_index32; //!< Indices are 32-bit, group has more than 65535 vertices.
+	bool m_quantized; //!< Positions are quantized, position = m_dequantOffset + m_dequantScale*stored.
+	bx::Vec3 m_dequantOffset;
+	float m_dequantScale;
 	Sphere m_sphere;
 	Aabb m_aabb;
 	Obb m_obb;
 	PrimitiveArray m_prims;
+	MeshletArray m_meshlets;
+	LodArray m_lods;
 };
 typedef stl::vector<Group> GroupArray;
 
+struct MeshFile;
+struct MeshDeferredBuffers;
+
 struct Mesh
 {
-	void load(bx::ReaderSeekerI* _reader, bool _ramcopy);
+	void load(bx::ReaderSeekerI* _reader, bool _ramcopy, MeshFile* _file = NULL, MeshDeferredBuffers* _deferred = NULL);
 	void unload();
 	void submit(bgfx::ViewId _id, bgfx::ProgramHandle _program, const float* _mtx, uint64_t _state) const;
 	void submit(const MeshState*const* _state, uint8_t _numPasses, const float* _mtx, uint16_t _numMatrices) const;
+	void submit(bgfx::ViewId _id, bgfx::ProgramHandle _program, const float* _mtx, uint64_t _state, const bx::Vec3& _eye, float _projScale, float _maxError) const;
 
 	bgfx::VertexLayout m_layout;
 	GroupArray m_groups;
@@ -130,6 +184,22 @@ struct Mesh
 ///
 Mesh* meshLoad(const char* _filePath, bool _ramcopy = false);
 
+///
+struct MeshAsync;
+
+/// Starts loading mesh on worker thread. File is read and decoded off calling thread, and
+/// vertex and index buffers are created on API thread by `meshLoadPoll` or `meshLoadWait`.
+/// Returns NULL if file can't be opened.
+MeshAsync* meshLoadAsync(const char* _filePath, bool _ramcopy = false);
+
+/// Returns false while mesh is still loading. Otherwise stores loaded mesh in `_mesh`,
+/// releases `_handle`, and returns true. Must be called from API thread.
+bool meshLoadPoll(MeshAsync* _handle, Mesh** _mesh);
+
+/// Blocks until mesh is loaded, releases `_handle`, and returns loaded mesh. Must be called
+/// from API thread.
+Mesh* meshLoadWait(MeshAsync* _handle);
+
 ///
 void meshUnload(Mesh* _mesh);
 
@@ -145,6 +215,15 @@ void meshSubmit(const Mesh* _mesh, bgfx::ViewId _id, bgfx::ProgramHandle _progra
 ///
 void meshSubmit(const Mesh* _mesh, const MeshState*const* _state, uint8_t _numPasses, const float* _mtx, uint16_t _numMatrices = 1);
 
+/// Submits coarsest LOD level of each group whose geometric error projected to screen is
+/// below `_maxError` pixels. `_eye` is in world space, and `_projScale` is obtained with
+/// `meshLodProjScale`.
+void meshSubmit(const Mesh* _mesh, bgfx::ViewId _id, bgfx::ProgramHandle _program, const float* _mtx, uint64_t _state, const bx::Vec3& _eye, float _projScale, float _maxError = 1.0f);
+
+/// Returns scale converting world space error at unit distance to pixels, for vertical
+/// field of view `_fovy` in degrees and viewport `_height` in pixels.
+float meshLodProjScale(float _fovy, float _height);
+
 ///
 struct Args
 {
@@ -5,6 +5,8 @@
 
 #include <bx/rng.h>
 #include <bx/math.h>
+#include <bx/simd_t.h>
+#include <bx/uint32_t.h>
 #include "bounds.h"
 
 using namespace bx;
@@ -405,6 +407,194 @@ void buildFrustumPlanes(Plane* _result, const float* _viewProj)
 	}
 }
 
+struct CullPlanes
+{
+	void init(const Plane* _planes, uint32_t _num)
+	{
+		BX_ASSERT(_num <= BOUNDS_FRUSTUM_CULL_MAX_PLANES
+			, "Too many culling planes %d (max: %d)."
+			, _num
+			, BOUNDS_FRUSTUM_CULL_MAX_PLANES
+			);
+		num = uint32_min(_num, BOUNDS_FRUSTUM_CULL_MAX_PLANES);
+
+		for (uint32_t ii = 0; ii < num; ++ii)
+		{
+			const Plane& plane = _planes[ii];
+			nx[ii] = simd_splat<simd128_t>(plane.normal.x);
+			ny[ii] = simd_splat<simd128_t>(plane.normal.y);
+			nz[ii] = simd_splat<simd128_t>(plane.normal.z);
+			dd[ii] = simd_splat<simd128_t>(plane.dist);
+
+			positive[ii][0] = 0.0f <= plane.normal.x;
+			positive[ii][1] = 0.0f <= plane.normal.y;
+			positive[ii][2] = 0.0f <= plane.normal.z;
+		}
+	}
+
+	simd128_t nx[BOUNDS_FRUSTUM_CULL_MAX_PLANES];
+	simd128_t ny[BOUNDS_FRUSTUM_CULL_MAX_PLANES];
+	simd128_t nz[BOUNDS_FRUSTUM_CULL_MAX_PLANES];
+	simd128_t dd[BOUNDS_FRUSTUM_CULL_MAX_PLANES];
+	bool positive[BOUNDS_FRUSTUM_CULL_MAX_PLANES][3];
+	uint32_t num;
+};
+
+static uint32_t frustumCull4(const CullPlanes& _planes, const AabbSoA& _aabbs, uint32_t _idx)
+{
+	const simd128_t minX = simd_ld<simd128_t>(&_aabbs.min[0][_idx]);
+	const simd128_t minY = simd_ld<simd128_t>(&_aabbs.min[1][_idx]);
+	const simd128_t minZ = simd_ld<simd128_t>(&_aabbs.min[2][_idx]);
+	const simd128_t maxX = simd_ld<simd128_t>(&_aabbs.max[0][_idx]);
+	const simd128_t maxY = simd_ld<simd128_t>(&_aabbs.max[1][_idx]);
+	const simd128_t maxZ = simd_ld<simd128_t>(&_aabbs.max[2][_idx]);
+	const simd128_t zero = simd_zero<simd128_t>();
+
+	simd128_t outside = zero;
+
+	for (uint32_t ii = 0; ii < _planes.num; ++ii)
+	{
+		// Box is outside when its corner furthest along plane normal is behind the plane.
+		const bool* positive = _planes.positive[ii];
+		const simd128_t px = positive[0] ? maxX : minX;
+		const simd128_t py = positive[1] ? maxY : minY;
+		const simd128_t pz = positive[2] ? maxZ : minZ;
+
+		const simd128_t dist = simd_madd(_planes.nx[ii], px
+			, simd_madd(_planes.ny[ii], py
+			, simd_madd(_planes.nz[ii], pz, _planes.dd[ii]) ) );
+
+		outside = simd_or(outside, simd_cmplt(dist, zero) );
+	}
+
+	return ~simd_signbitsmask(outside) & 0xf;
+}
+
+static uint32_t frustumCull4(const CullPlanes& _planes, const SphereSoA& _spheres, uint32_t _idx)
+{
+	const simd128_t cx     = simd_ld<simd128_t>(&_spheres.center[0][_idx]);
+	const simd128_t cy     = simd_ld<simd128_t>(&_spheres.center[1][_idx]);
+	const simd128_t cz     = simd_ld<simd128_t>(&_spheres.center[2][_idx]);
+	const simd128_t radius = simd_ld<simd128_t>(&_spheres.radius[_idx]);
+	const simd128_t zero   = simd_zero<simd128_t>();
+
+	simd128_t outside = zero;
+
+	for (uint32_t ii = 0; ii < _planes.num; ++ii)
+	{
+		const simd128_t dist = simd_madd(_planes.nx[ii], cx
+			, simd_madd(_planes.ny[ii], cy
+			, simd_madd(_planes.nz[ii], cz, simd_add(_planes.dd[ii], radius) ) ) );
+
+		outside = simd_or(outside, simd_cmplt(dist, zero) );
+	}
+
+	return ~simd_signbitsmask(outside) & 0xf;
+}
+
+static uint32_t frustumCull4(const CullPlanes& _planes, const ObbSoA& _obbs, uint32_t _idx)
+{
+	const simd128_t cx = simd_ld<simd128_t>(&_obbs.center[0][_idx]);
+	const simd128_t cy = simd_ld<simd128_t>(&_obbs.center[1][_idx]);
+	const simd128_t cz = simd_ld<simd128_t>(&_obbs.center[2][_idx]);
+
+	simd128_t axis[3][3];
+	for (uint32_t jj = 0; jj < 3; ++jj)
+	{
+		axis[jj][0] = simd_ld<simd128_t>(&_obbs.axis[jj][0][_idx]);
+		axis[jj][1] = simd_ld<simd128_t>(&_obbs.axis[jj][1][_idx]);
+		axis[jj][2] = simd_ld<simd128_t>(&_obbs.axis[jj][2][_idx]);
+	}
+
+	const simd128_t zero = simd_zero<simd128_t>();
+
+	simd128_t outside = zero;
+
+	for (uint32_t ii = 0; ii < _planes.num; ++ii)
+	{
+		const simd128_t nx = _planes.nx[ii];
+		const simd128_t ny = _planes.ny[ii];
+		const simd128_t nz = _planes.nz[ii];
+
+		// Projected radius is sum of absolute half-axis projections onto plane normal.
+		simd128_t radius = zero;
+		for (uint32_t jj = 0; jj < 3; ++jj)
+		{
+			const simd128_t proj = simd_madd(nx, axis[jj][0]
+				, simd_madd(ny, axis[jj][1]
+				, simd_mul(nz, axis[jj][2]) ) );
+			radius = simd_add(radius, simd_abs(proj) );
+		}
+
+		const simd128_t dist = simd_madd(nx, cx
+			, simd_madd(ny, cy
+			, simd_madd(nz, cz, simd_add(_planes.dd[ii], radius) ) ) );
+
+		outside = simd_or(outside, simd_cmplt(dist, zero) );
+	}
+
+	return ~simd_signbitsmask(outside) & 0xf;
+}
+
+template<typename Ty>
+static void frustumCullT(uint32_t* _outMask, const Plane* _planes, uint32_t _numPlanes, const Ty& _soa, uint32_t _first, uint32_t _num)
+{
+	BX_ASSERT(0 == (_first & 31), "First index %d must be multiple of 32.", _first);
+
+	CullPlanes planes;
+	planes.init(_planes, _numPlanes);
+
+	const uint32_t end = _first + uint32_min(_num, _soa.num - uint32_min(_first, _soa.num) );
+	uint32_t* mask = &_outMask[_first/32];
+
+	for (uint32_t ii = _first; ii < end; ii += 32)
+	{
+		const uint32_t num = uint32_min(end - ii, 32);
+
+		uint32_t bits = 0;
+		for (uint32_t jj = 0; jj < num; jj += 4)
+		{
+			bits |= frustumCull4(planes, _soa, ii+jj) << jj;
+		}
+
+		// Streams are padded to multiple of 4, clear bits past the last element.
+		*mask++ = 32 == num ? bits : bits & ( (1u<<num)-1);
+	}
+}
+
+void frustumCull(uint32_t* _outMask, const Plane* _planes, uint32_t _numPlanes, const AabbSoA& _aabbs, uint32_t _first, uint32_t _num)
+{
+	frustumCullT(_outMask, _planes, _numPlanes, _aabbs, _first, _num);
+}
+
+void frustumCull(uint32_t* _outMask, const Plane* _planes, uint32_t _numPlanes, const SphereSoA& _spheres, uint32_t _first, uint32_t _num)
+{
+	frustumCullT(_outMask, _planes, _numPlanes, _spheres, _first, _num);
+}
+
+void frustumCull(uint32_t* _outMask, const Plane* _planes, uint32_t _numPlanes, const ObbSoA& _obbs, uint32_t _first, uint32_t _num)
+{
+	frustumCullT(_outMask, _planes, _numPlanes, _obbs, _first, _num);
+}
+
+uint32_t frustumCullCompact(uint32_t* _outIndices, const uint32_t* _mask, uint32_t _num)
+{
+	uint32_t count = 0;
+
+	for (uint32_t ii = 0, numWords = (_num+31)/32; ii < numWords; ++ii)
+	{
+		uint32_t bits = _mask[ii];
+
+		while (0 != bits)
+		{
+			_outIndices[count++] = ii*32 + uint32_cnttz(bits);
+			bits &= bits-1;
+		}
+	}
+
+	return count;
+}
+
 Ray makeRay(float _x, float _y, const float* _invVp)
 {
 	Ray ray;
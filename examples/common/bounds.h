@@ -142,6 +142,54 @@ void calcMinBoundingSphere(Sphere& _outSphere, const void* _vertices, uint32_t _
 /// Returns 6 (near, far, left, right, top, bottom) planes representing frustum planes.
 void buildFrustumPlanes(bx::Plane* _outPlanes, const float* _viewProj);
 
+/// Structure of arrays of axis aligned bounding boxes, used by batch frustum culling. Each
+/// stream must be 16-byte aligned and padded to multiple of 4 elements.
+struct AabbSoA
+{
+	const float* min[3];
+	const float* max[3];
+	uint32_t     num;
+};
+
+/// Structure of arrays of spheres, used by batch frustum culling. Each stream must be
+/// 16-byte aligned and padded to multiple of 4 elements.
+struct SphereSoA
+{
+	const float* center[3];
+	const float* radius;
+	uint32_t     num;
+};
+
+/// Structure of arrays of oriented bounding boxes, used by batch frustum culling. `axis[ii]`
+/// is ii-th half-extent axis (`Obb::mtx` column ii), and `center` is translation. Each
+/// stream must be 16-byte aligned and padded to multiple of 4 elements.
+struct ObbSoA
+{
+	const float* center[3];
+	const float* axis[3][3];
+	uint32_t     num;
+};
+
+/// Maximum number of planes accepted by `frustumCull`.
+#define BOUNDS_FRUSTUM_CULL_MAX_PLANES 8
+
+/// Test axis aligned bounding boxes in range [_first, _first+_num) against planes. Bit in
+/// _outMask is set for every box that is inside or intersecting all planes. _first must be
+/// multiple of 32, so that disjoint ranges can be culled from different threads without
+/// sharing mask words. _outMask must hold (_aabbs.num+31)/32 words.
+void frustumCull(uint32_t* _outMask, const bx::Plane* _planes, uint32_t _numPlanes, const AabbSoA& _aabbs, uint32_t _first = 0, uint32_t _num = UINT32_MAX);
+
+/// Test spheres in range [_first, _first+_num) against planes. See `frustumCull` for AABBs.
+void frustumCull(uint32_t* _outMask, const bx::Plane* _planes, uint32_t _numPlanes, const SphereSoA& _spheres, uint32_t _first = 0, uint32_t _num = UINT32_MAX);
+
+/// Test oriented bounding boxes in range [_first, _first+_num) against planes. See
+/// `frustumCull` for AABBs.
+void frustumCull(uint32_t* _outMask, const bx::Plane* _planes, uint32_t _numPlanes, const ObbSoA& _obbs, uint32_t _first = 0, uint32_t _num = UINT32_MAX);
+
+/// Convert visibility bitmask produced by `frustumCull` into list of visible indices.
+/// Returns number of indices written into _outIndices.
+uint32_t frustumCullCompact(uint32_t* _outIndices, const uint32_t* _mask, uint32_t _num);
+
 /// Returns point from 3 intersecting planes.
 bx::Vec3 intersectPlanes(const bx::Plane& _pa, const bx::Plane& _pb, const bx::Plane& _pc);
 
@@ -0,0 +1,835 @@
+/*
+ * Copyright 2011-2020 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx#license-bsd-2-clause
+ */
+
+#include <bx/cpu.h>
+#include <bx/simd_t.h>
+#include <bx/thread.h>
+#include <bx/uint32_t.h>
+#include "bvh.h"
+
+using namespace bx;
+
+static constexpr uint32_t kBvhNumBins      = 16;
+static constexpr uint32_t kBvhMaxLeafSize  = 4;
+static constexpr uint32_t kBvhMaxThreads   = 8;
+static constexpr uint32_t kBvhStackSize    = 64*3;
+static constexpr uint32_t kBvhInvalidChild = UINT32_MAX;
+
+static constexpr Aabb kEmptyAabb =
+{
+	{  kFloatLargest,  kFloatLargest,  kFloatLargest },
+	{ -kFloatLargest, -kFloatLargest, -kFloatLargest },
+};
+
+static void aabbMerge(Aabb& _outAabb, const Aabb& _aabb)
+{
+	_outAabb.min = min(_outAabb.min, _aabb.min);
+	_outAabb.max = max(_outAabb.max, _aabb.max);
+}
+
+static float getAxis(const Vec3& _vec, uint32_t _axis)
+{
+	return 0 == _axis ? _vec.x : 1 == _axis ? _vec.y : _vec.z;
+}
+
+static void toAabb(Aabb& _outAabb, const BvhNode& _node, uint32_t _idx)
+{
+	_outAabb.min = { _node.min[0][_idx], _node.min[1][_idx], _node.min[2][_idx] };
+	_outAabb.max = { _node.max[0][_idx], _node.max[1][_idx], _node.max[2][_idx] };
+}
+
+static void setChild(BvhNode& _node, uint32_t _idx, const Aabb& _aabb)
+{
+	_node.min[0][_idx] = _aabb.min.x;
+	_node.min[1][_idx] = _aabb.min.y;
+	_node.min[2][_idx] = _aabb.min.z;
+	_node.max[0][_idx] = _aabb.max.x;
+	_node.max[1][_idx] = _aabb.max.y;
+	_node.max[2][_idx] = _aabb.max.z;
+}
+
+struct BvhBuildNode
+{
+	Aabb     aabb;
+	uint32_t left;  // Right child is always left+1.
+	uint32_t first;
+	uint32_t num;   // 0 for interior node.
+};
+
+struct BvhBuildTask
+{
+	uint32_t node;
+	uint32_t first;
+	uint32_t num;
+};
+
+struct BvhBuilder
+{
+	void init(const Aabb* _aabbs, uint32_t* _indices, uint32_t _num, uint32_t _numThreads, AllocatorI* _allocator)
+	{
+		m_allocator  = _allocator;
+		m_aabbs      = _aabbs;
+		m_indices    = _indices;
+		m_centers    = (Vec3*)BX_ALLOC(_allocator, _num*sizeof(Vec3) );
+		m_nodes      = (BvhBuildNode*)BX_ALLOC(_allocator, 2*_num*sizeof(BvhBuildNode) );
+		m_numNodes   = 1;
+		m_numThreads = uint32_clamp(_numThreads, 1, kBvhMaxThreads);
+		m_numTasks   = 0;
+		m_nextTask   = 0;
+
+		// Split top of the tree serially into roughly 4 subtrees per thread, and build
+		// subtrees in parallel.
+		m_taskDepth = 1 < m_numThreads
+			? uint32_cntlz(0) - uint32_cntlz(m_numThreads-1) + 2
+			: UINT32_MAX
+			;
+		m_maxTasks = 1 < m_numThreads ? 1u<<m_taskDepth : 0;
+		m_tasks    = 0 < m_maxTasks ? (BvhBuildTask*)BX_ALLOC(_allocator, m_maxTasks*sizeof(BvhBuildTask) ) : NULL;
+
+		for (uint32_t ii = 0; ii < _num; ++ii)
+		{
+			m_centers[ii] = getCenter(_aabbs[ii]);
+		}
+	}
+
+	void shutdown()
+	{
+		BX_FREE(m_allocator, m_tasks);
+		BX_FREE(m_allocator, m_nodes);
+		BX_FREE(m_allocator, m_centers);
+	}
+
+	void build(uint32_t _num)
+	{
+		buildNode(0, 0, _num, 0);
+
+		if (0 < m_numTasks)
+		{
+			Thread thread[kBvhMaxThreads-1];
+
+			for (uint32_t ii = 0, num = m_numThreads-1; ii < num; ++ii)
+			{
+				thread[ii].init(threadFunc, this);
+			}
+
+			runTasks();
+
+			for (uint32_t ii = 0, num = m_numThreads-1; ii < num; ++ii)
+			{
+				thread[ii].shutdown();
+			}
+		}
+	}
+
+	static int32_t threadFunc(Thread* _thread, void* _userData)
+	{
+		BX_UNUSED(_thread);
+		static_cast<BvhBuilder*>(_userData)->runTasks();
+		return kExitSuccess;
+	}
+
+	void runTasks()
+	{
+		for (;;)
+		{
+			const uint32_t idx = atomicFetchAndAdd<uint32_t>(&m_nextTask, 1);
+			if (idx >= m_numTasks)
+			{
+				break;
+			}
+
+			const BvhBuildTask& task = m_tasks[idx];
+			buildNode(task.node, task.first, task.num, UINT32_MAX);
+		}
+	}
+
+	void makeLeaf(BvhBuildNode& _node, uint32_t _first, uint32_t _num)
+	{
+		_node.left  = 0;
+		_node.first = _first;
+		_node.num   = _num;
+	}
+
+	void buildNode(uint32_t _nodeIdx, uint32_t _first, uint32_t _num, uint32_t _depth)
+	{
+		BvhBuildNode& node = m_nodes[_nodeIdx];
+
+		Aabb centerAabb = kEmptyAabb;
+		node.aabb = kEmptyAabb;
+
+		for (uint32_t ii = _first, end = _first+_num; ii < end; ++ii)
+		{
+			const uint32_t idx = m_indices[ii];
+			aabbMerge(node.aabb, m_aabbs[idx]);
+			centerAabb.min = min(centerAabb.min, m_centers[idx]);
+			centerAabb.max = max(centerAabb.max, m_centers[idx]);
+		}
+
+		if (kBvhMaxLeafSize >= _num)
+		{
+			makeLeaf(node, _first, _num);
+			return;
+		}
+
+		if (_depth == m_taskDepth)
+		{
+			BX_ASSERT(m_numTasks < m_maxTasks, "Too many BVH build tasks.");
+			BvhBuildTask& task = m_tasks[m_numTasks++];
+			task.node  = _nodeIdx;
+			task.first = _first;
+			task.num   = _num;
+			return;
+		}
+
+		// Binned surface area heuristic, evaluated on all three axes.
+		float    bestCost  = kFloatLargest;
+		uint32_t bestAxis  = UINT32_MAX;
+		uint32_t bestSplit = 0;
+
+		for (uint32_t axis = 0; axis < 3; ++axis)
+		{
+			const float cmin   = getAxis(centerAabb.min, axis);
+			const float extent = getAxis(centerAabb.max, axis) - cmin;
+
+			if (0.0f >= extent)
+			{
+				continue;
+			}
+
+			Aabb     binAabb[kBvhNumBins];
+			uint32_t binNum[kBvhNumBins];
+
+			for (uint32_t ii = 0; ii < kBvhNumBins; ++ii)
+			{
+				binAabb[ii] = kEmptyAabb;
+				binNum[ii]  = 0;
+			}
+
+			const float scale = float(kBvhNumBins) / extent;
+
+			for (uint32_t ii = _first, end = _first+_num; ii < end; ++ii)
+			{
+				const uint32_t idx = m_indices[ii];
+				const uint32_t bin = uint32_min(uint32_t( (getAxis(m_centers[idx], axis) - cmin)*scale), kBvhNumBins-1);
+				aabbMerge(binAabb[bin], m_aabbs[idx]);
+				++binNum[bin];
+			}
+
+			float rightArea[kBvhNumBins];
+			Aabb  aabb = kEmptyAabb;
+
+			for (uint32_t ii = kBvhNumBins-1; ii > 0; --ii)
+			{
+				aabbMerge(aabb, binAabb[ii]);
+				rightArea[ii] = calcAreaAabb(aabb);
+			}
+
+			aabb = kEmptyAabb;
+			uint32_t numLeft = 0;
+
+			for (uint32_t ii = 1; ii < kBvhNumBins; ++ii)
+			{
+				aabbMerge(aabb, binAabb[ii-1]);
+				numLeft += binNum[ii-1];
+
+				const uint32_t numRight = _num - numLeft;
+				if (0 == numLeft
+				||  0 == numRight)
+				{
+					continue;
+				}
+
+				const float cost = calcAreaAabb(aabb)*numLeft + rightArea[ii]*numRight;
+				if (cost < bestCost)
+				{
+					bestCost  = cost;
+					bestAxis  = axis;
+					bestSplit = ii;
+				}
+			}
+		}
+
+		uint32_t mid = _first + _num/2;
+
+		if (UINT32_MAX != bestAxis)
+		{
+			const float cmin  = getAxis(centerAabb.min, bestAxis);
+			const float scale = float(kBvhNumBins) / (getAxis(centerAabb.max, bestAxis) - cmin);
+
+			uint32_t* left  = &m_indices[_first];
+			uint32_t* right = &m_indices[_first+_num];
+
+			while (left < right)
+			{
+				const uint32_t bin = uint32_min(uint32_t( (getAxis(m_centers[*left], bestAxis) - cmin)*scale), kBvhNumBins-1);
+				if (bin < bestSplit)
+				{
+					++left;
+				}
+				else
+				{
+					swap(*left, *--right);
+				}
+			}
+
+			mid = uint32_t(left - m_indices);
+		}
+
+		const uint32_t leftIdx = atomicFetchAndAdd<uint32_t>(&m_numNodes, 2);
+		node.left  = leftIdx;
+		node.first = 0;
+		node.num   = 0;
+
+		const uint32_t depth = UINT32_MAX == _depth ? _depth : _depth+1;
+		buildNode(leftIdx,   _first, mid - _first,         depth);
+		buildNode(leftIdx+1, mid,    _first + _num - mid,  depth);
+	}
+
+	AllocatorI*   m_allocator;
+	const Aabb*   m_aabbs;
+	Vec3*         m_centers;
+	uint32_t*     m_indices;
+	BvhBuildNode* m_nodes;
+	BvhBuildTask* m_tasks;
+
+	uint32_t m_numNodes;
+	uint32_t m_numThreads;
+	uint32_t m_numTasks;
+	uint32_t m_maxTasks;
+	uint32_t m_nextTask;
+	uint32_t m_taskDepth;
+};
+
+static uint32_t collapse(BvhNode* _nodes, uint32_t& _numNodes, uint32_t& _maxDepth, const BvhBuildNode* _buildNodes, uint32_t _buildIdx, uint32_t _depth)
+{
+	const uint32_t nodeIdx = _numNodes++;
+	_maxDepth = uint32_max(_maxDepth, _depth+1);
+
+	uint32_t slot[4];
+	uint32_t num = 0;
+
+	const BvhBuildNode& root = _buildNodes[_buildIdx];
+	if (0 != root.num)
+	{
+		slot[num++] = _buildIdx;
+	}
+	else
+	{
+		slot[num++] = root.left;
+		slot[num++] = root.left+1;
+	}
+
+	// Pull grandchildren up, always opening interior child with the largest surface area.
+	while (4 > num)
+	{
+		uint32_t best = UINT32_MAX;
+		float bestArea = -1.0f;
+
+		for (uint32_t ii = 0; ii < num; ++ii)
+		{
+			const BvhBuildNode& child = _buildNodes[slot[ii] ];
+			if (0 == child.num)
+			{
+				const float area = calcAreaAabb(child.aabb);
+				if (area > bestArea)
+				{
+					best     = ii;
+					bestArea = area;
+				}
+			}
+		}
+
+		if (UINT32_MAX == best)
+		{
+			break;
+		}
+
+		const uint32_t left = _buildNodes[slot[best] ].left;
+		slot[best]  = left;
+		slot[num++] = left+1;
+	}
+
+	for (uint32_t ii = 0; ii < 4; ++ii)
+	{
+		BvhNode& node = _nodes[nodeIdx];
+
+		if (ii >= num)
+		{
+			setChild(node, ii, kEmptyAabb);
+			node.child[ii] = kBvhInvalidChild;
+			node.num[ii]   = 0;
+			continue;
+		}
+
+		const BvhBuildNode& child = _buildNodes[slot[ii] ];
+		setChild(node, ii, child.aabb);
+
+		if (0 != child.num)
+		{
+			node.child[ii] = child.first;
+			node.num[ii]   = child.num;
+		}
+		else
+		{
+			const uint32_t childIdx = collapse(_nodes, _numNodes, _maxDepth, _buildNodes, slot[ii], _depth+1);
+			_nodes[nodeIdx].child[ii] = childIdx;
+			_nodes[nodeIdx].num[ii]   = 0;
+		}
+	}
+
+	return nodeIdx;
+}
+
+/// Traversal stack, on stack memory unless hierarchy is deeper than it can hold.
+template<typename Ty>
+struct BvhStack
+{
+	BvhStack(AllocatorI* _allocator, uint32_t _size)
+		: m_allocator(_allocator)
+		, m_data(_size <= kBvhStackSize ? m_local : (Ty*)BX_ALLOC(_allocator, _size*sizeof(Ty) ) )
+		, m_size(_size)
+	{
+	}
+
+	~BvhStack()
+	{
+		if (m_local != m_data)
+		{
+			BX_FREE(m_allocator, m_data);
+		}
+	}
+
+	Ty& operator[](uint32_t _idx)
+	{
+		BX_ASSERT(_idx < m_size, "BVH traversal stack overflow.");
+		return m_data[_idx];
+	}
+
+	AllocatorI* m_allocator;
+	Ty          m_local[kBvhStackSize];
+	Ty*         m_data;
+	uint32_t    m_size;
+};
+
+struct BvhRay
+{
+	BvhRay(const Ray& _ray)
+	{
+		const Vec3 invDir = rcp(_ray.dir);
+		pos[0]    = simd_splat<simd128_t>(_ray.pos.x);
+		pos[1]    = simd_splat<simd128_t>(_ray.pos.y);
+		pos[2]    = simd_splat<simd128_t>(_ray.pos.z);
+		invDir4[0] = simd_splat<simd128_t>(invDir.x);
+		invDir4[1] = simd_splat<simd128_t>(invDir.y);
+		invDir4[2] = simd_splat<simd128_t>(invDir.z);
+	}
+
+	/// Returns mask of node children hit closer than _maxDist, and entry distance per child.
+	uint32_t test(const BvhNode& _node, float _maxDist, float* _outDist) const
+	{
+		simd128_t tmin = simd_zero<simd128_t>();
+		simd128_t tmax = simd_splat<simd128_t>(_maxDist);
+
+		for (uint32_t axis = 0; axis < 3; ++axis)
+		{
+			const simd128_t t0 = simd_mul(simd_sub(simd_ld<simd128_t>(_node.min[axis]), pos[axis]), invDir4[axis]);
+			const simd128_t t1 = simd_mul(simd_sub(simd_ld<simd128_t>(_node.max[axis]), pos[axis]), invDir4[axis]);
+			tmin = simd_max(tmin, simd_min(t0, t1) );
+			tmax = simd_min(tmax, simd_max(t0, t1) );
+		}
+
+		simd_st(_outDist, tmin);
+		return simd_signbitsmask(simd_cmple(tmin, tmax) );
+	}
+
+	simd128_t pos[3];
+	simd128_t invDir4[3];
+};
+
+Bvh::Bvh(AllocatorI* _allocator)
+	: m_allocator(_allocator)
+	, m_nodes(NULL)
+	, m_indices(NULL)
+	, m_primitives(NULL)
+	, m_triangles(NULL)
+	, m_aabb(kEmptyAabb)
+	, m_numNodes(0)
+	, m_numPrimitives(0)
+	, m_stackSize(0)
+{
+}
+
+Bvh::~Bvh()
+{
+	reset(0);
+}
+
+void Bvh::reset(uint32_t _num)
+{
+	BX_ALIGNED_FREE(m_allocator, m_nodes, 16);
+	BX_FREE(m_allocator, m_indices);
+	BX_FREE(m_allocator, m_primitives);
+
+	m_nodes         = NULL;
+	m_indices       = NULL;
+	m_primitives    = NULL;
+	m_triangles     = NULL;
+	m_aabb          = kEmptyAabb;
+	m_numNodes      = 0;
+	m_numPrimitives = _num;
+	m_stackSize     = 0;
+
+	if (0 < _num)
+	{
+		m_nodes      = (BvhNode*)BX_ALIGNED_ALLOC(m_allocator, _num*sizeof(BvhNode), 16);
+		m_indices    = (uint32_t*)BX_ALLOC(m_allocator, _num*sizeof(uint32_t) );
+		m_primitives = (Aabb*)BX_ALLOC(m_allocator, _num*sizeof(Aabb) );
+
+		for (uint32_t ii = 0; ii < _num; ++ii)
+		{
+			m_indices[ii] = ii;
+		}
+	}
+}
+
+void Bvh::build(const Aabb* _aabbs, uint32_t _num, uint32_t _numThreads)
+{
+	reset(_num);
+	memCopy(m_primitives, _aabbs, _num*sizeof(Aabb) );
+	build(_numThreads);
+}
+
+void Bvh::build(const Triangle* _triangles, uint32_t _num, uint32_t _numThreads)
+{
+	reset(_num);
+	m_triangles = _triangles;
+
+	for (uint32_t ii = 0; ii < _num; ++ii)
+	{
+		toAabb(m_primitives[ii], _triangles[ii]);
+	}
+
+	build(_numThreads);
+}
+
+void Bvh::build(uint32_t _numThreads)
+{
+	if (0 == m_numPrimitives)
+	{
+		return;
+	}
+
+	BvhBuilder builder;
+	builder.init(m_primitives, m_indices, m_numPrimitives, _numThreads, m_allocator);
+	builder.build(m_numPrimitives);
+
+	uint32_t maxDepth = 0;
+	m_numNodes = 0;
+	collapse(m_nodes, m_numNodes, maxDepth, builder.m_nodes, 0, 0);
+	m_aabb = builder.m_nodes[0].aabb;
+
+	// Each visited interior node replaces itself with at most 4 children on traversal stack.
+	m_stackSize = 3*maxDepth + 1;
+
+	builder.shutdown();
+}
+
+void Bvh::refit(const Aabb* _aabbs)
+{
+	memCopy(m_primitives, _aabbs, m_numPrimitives*sizeof(Aabb) );
+	refitNodes();
+}
+
+void Bvh::refit(const Triangle* _triangles)
+{
+	m_triangles = _triangles;
+
+	for (uint32_t ii = 0; ii < m_numPrimitives; ++ii)
+	{
+		toAabb(m_primitives[ii], _triangles[ii]);
+	}
+
+	refitNodes();
+}
+
+void Bvh::refitNodes()
+{
+	// Children are always stored after their parent, walking backwards updates them first.
+	for (uint32_t ii = m_numNodes; ii > 0; --ii)
+	{
+		BvhNode& node = m_nodes[ii-1];
+
+		for (uint32_t jj = 0; jj < 4; ++jj)
+		{
+			if (kBvhInvalidChild == node.child[jj])
+			{
+				continue;
+			}
+
+			Aabb aabb = kEmptyAabb;
+
+			if (0 != node.num[jj])
+			{
+				for (uint32_t kk = node.child[jj], end = kk + node.num[jj]; kk < end; ++kk)
+				{
+					aabbMerge(aabb, m_primitives[m_indices[kk] ]);
+				}
+			}
+			else
+			{
+				const BvhNode& child = m_nodes[node.child[jj] ];
+
+				for (uint32_t kk = 0; kk < 4; ++kk)
+				{
+					Aabb childAabb;
+					toAabb(childAabb, child, kk);
+					aabbMerge(aabb, childAabb);
+				}
+			}
+
+			setChild(node, jj, aabb);
+		}
+	}
+
+	m_aabb = kEmptyAabb;
+
+	for (uint32_t ii = 0; ii < 4 && 0 < m_numNodes; ++ii)
+	{
+		Aabb aabb;
+		toAabb(aabb, m_nodes[0], ii);
+		aabbMerge(m_aabb, aabb);
+	}
+}
+
+bool Bvh::intersectLeaf(const Ray& _ray, uint32_t _first, uint32_t _num, float _maxDist, Hit* _hit, uint32_t* _outPrimitive) const
+{
+	bool result = false;
+
+	for (uint32_t ii = _first, end = _first+_num; ii < end; ++ii)
+	{
+		const uint32_t idx = m_indices[ii];
+
+		Hit hit;
+		const bool hitPrimitive = NULL != m_triangles
+			? ::intersect(_ray, m_triangles[idx], &hit) && 0.0f <= hit.plane.dist
+			: ::intersect(_ray, m_primitives[idx], &hit)
+			;
+
+		if (hitPrimitive
+		&&  hit.plane.dist < _maxDist)
+		{
+			_maxDist = hit.plane.dist;
+			result   = true;
+
+			if (NULL != _hit)
+			{
+				*_hit = hit;
+			}
+
+			if (NULL != _outPrimitive)
+			{
+				*_outPrimitive = idx;
+			}
+			else if (NULL == _hit)
+			{
+				break;
+			}
+		}
+	}
+
+	return result;
+}
+
+bool Bvh::intersect(const Ray& _ray, Hit* _hit, uint32_t* _outPrimitive) const
+{
+	if (0 == m_numNodes)
+	{
+		return false;
+	}
+
+	const BvhRay ray(_ray);
+
+	struct Entry
+	{
+		uint32_t node;
+		float    dist;
+	};
+
+	BvhStack<Entry> stack(m_allocator, m_stackSize);
+	uint32_t top = 0;
+	stack[top++] = { 0, 0.0f };
+
+	Hit hit;
+	float best = kFloatLargest;
+	bool result = false;
+
+	while (0 < top)
+	{
+		const Entry entry = stack[--top];
+		if (entry.dist > best)
+		{
+			continue;
+		}
+
+		const BvhNode& node = m_nodes[entry.node];
+
+		BX_ALIGN_DECL(16, float) dist[4];
+		uint32_t mask = ray.test(node, best, dist);
+
+		// Push hit interior children far to near, so that nearest one is visited first.
+		Entry children[4];
+		uint32_t numChildren = 0;
+
+		for (; 0 != mask; mask &= mask-1)
+		{
+			const uint32_t ii = uint32_cnttz(mask);
+
+			if (0 != node.num[ii])
+			{
+				uint32_t prim;
+				if (intersectLeaf(_ray, node.child[ii], node.num[ii], best, &hit, &prim) )
+				{
+					best   = hit.plane.dist;
+					result = true;
+
+					if (NULL != _hit)
+					{
+						*_hit = hit;
+					}
+
+					if (NULL != _outPrimitive)
+					{
+						*_outPrimitive = prim;
+					}
+				}
+			}
+			else if (kBvhInvalidChild != node.child[ii])
+			{
+				uint32_t jj = numChildren++;
+				for (; 0 < jj && children[jj-1].dist < dist[ii]; --jj)
+				{
+					children[jj] = children[jj-1];
+				}
+
+				children[jj] = { node.child[ii], dist[ii] };
+			}
+		}
+
+		for (uint32_t ii = 0; ii < numChildren; ++ii)
+		{
+			stack[top++] = children[ii];
+		}
+	}
+
+	return result;
+}
+
+bool Bvh::intersectAny(const Ray& _ray, float _maxDist) const
+{
+	if (0 == m_numNodes)
+	{
+		return false;
+	}
+
+	const BvhRay ray(_ray);
+
+	BvhStack<uint32_t> stack(m_allocator, m_stackSize);
+	uint32_t top = 0;
+	stack[top++] = 0;
+
+	while (0 < top)
+	{
+		const BvhNode& node = m_nodes[stack[--top] ];
+
+		BX_ALIGN_DECL(16, float) dist[4];
+		for (uint32_t mask = ray.test(node, _maxDist, dist); 0 != mask; mask &= mask-1)
+		{
+			const uint32_t ii = uint32_cnttz(mask);
+
+			if (0 != node.num[ii])
+			{
+				if (intersectLeaf(_ray, node.child[ii], node.num[ii], _maxDist, NULL, NULL) )
+				{
+					return true;
+				}
+			}
+			else if (kBvhInvalidChild != node.child[ii])
+			{
+				stack[top++] = node.child[ii];
+			}
+		}
+	}
+
+	return false;
+}
+
+uint32_t Bvh::overlap(uint32_t* _outPrimitives, uint32_t _max, const Aabb& _aabb) const
+{
+	if (0 == m_numNodes)
+	{
+		return 0;
+	}
+
+	const simd128_t qmin[3] =
+	{
+		simd_splat<simd128_t>(_aabb.min.x),
+		simd_splat<simd128_t>(_aabb.min.y),
+		simd_splat<simd128_t>(_aabb.min.z),
+	};
+
+	const simd128_t qmax[3] =
+	{
+		simd_splat<simd128_t>(_aabb.max.x),
+		simd_splat<simd128_t>(_aabb.max.y),
+		simd_splat<simd128_t>(_aabb.max.z),
+	};
+
+	BvhStack<uint32_t> stack(m_allocator, m_stackSize);
+	uint32_t top = 0;
+	stack[top++] = 0;
+
+	uint32_t num = 0;
+
+	while (0 < top)
+	{
+		const BvhNode& node = m_nodes[stack[--top] ];
+
+		simd128_t outside = simd_zero<simd128_t>();
+		for (uint32_t axis = 0; axis < 3; ++axis)
+		{
+			outside = simd_or(outside, simd_cmpgt(simd_ld<simd128_t>(node.min[axis]), qmax[axis]) );
+			outside = simd_or(outside, simd_cmplt(simd_ld<simd128_t>(node.max[axis]), qmin[axis]) );
+		}
+
+		for (uint32_t mask = ~simd_signbitsmask(outside) & 0xf; 0 != mask; mask &= mask-1)
+		{
+			const uint32_t ii = uint32_cnttz(mask);
+
+			if (0 != node.num[ii])
+			{
+				for (uint32_t jj = node.child[ii], end = jj + node.num[ii]; jj < end; ++jj)
+				{
+					const uint32_t idx = m_indices[jj];
+
+					if (::overlap(_aabb, m_primitives[idx]) )
+					{
+						if (num < _max)
+						{
+							_outPrimitives[num] = idx;
+						}
+
+						++num;
+					}
+				}
+			}
+			else if (kBvhInvalidChild != node.child[ii])
+			{
+				stack[top++] = node.child[ii];
+			}
+		}
+	}
+
+	return num;
+}
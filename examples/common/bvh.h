@@ -0,0 +1,96 @@
+/*
+ * Copyright 2011-2020 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx#license-bsd-2-clause
+ */
+
+#ifndef BVH_H_HEADER_GUARD
+#define BVH_H_HEADER_GUARD
+
+#include <bx/allocator.h>
+#include "bounds.h"
+
+/// 4-wide bounding volume hierarchy node. Child bounds are stored as structure of arrays so
+/// that ray and overlap queries test all four children at once.
+struct BvhNode
+{
+	float    min[3][4]; ///< Child bounds minimum, per axis.
+	float    max[3][4]; ///< Child bounds maximum, per axis.
+	uint32_t child[4];  ///< Interior child node index, or first leaf primitive.
+	uint32_t num[4];    ///< Number of primitives in leaf, 0 for interior or empty child.
+};
+
+/// Bounding volume hierarchy over primitive bounding boxes or triangles. Built with binned
+/// surface area heuristic, and collapsed into 4-wide nodes for SIMD traversal.
+class Bvh
+{
+public:
+	///
+	Bvh(bx::AllocatorI* _allocator);
+
+	///
+	~Bvh();
+
+	/// Build hierarchy over primitive bounding boxes. Ray queries report hits against
+	/// primitive bounds. When _numThreads is greater than 1, independent subtrees are built
+	/// in parallel.
+	void build(const Aabb* _aabbs, uint32_t _num, uint32_t _numThreads = 1);
+
+	/// Build hierarchy over triangles. Triangles are referenced, not copied, and must outlive
+	/// hierarchy or next refit.
+	void build(const Triangle* _triangles, uint32_t _num, uint32_t _numThreads = 1);
+
+	/// Update node bounds after primitives moved, without changing topology. Number and order
+	/// of primitives must match the ones hierarchy was built with.
+	void refit(const Aabb* _aabbs);
+
+	/// Update node bounds after triangles moved, without changing topology.
+	void refit(const Triangle* _triangles);
+
+	/// Find closest primitive hit by ray. Returns false if nothing is hit.
+	bool intersect(const Ray& _ray, Hit* _hit = NULL, uint32_t* _outPrimitive = NULL) const;
+
+	/// Returns true if any primitive is hit by ray closer than _maxDist.
+	bool intersectAny(const Ray& _ray, float _maxDist = bx::kFloatLargest) const;
+
+	/// Find primitives whose bounds overlap axis aligned bounding box. Up to _max primitive
+	/// indices are written into _outPrimitives. Returns total number of overlapping primitives.
+	uint32_t overlap(uint32_t* _outPrimitives, uint32_t _max, const Aabb& _aabb) const;
+
+	/// Returns bounds of all primitives.
+	const Aabb& getAabb() const
+	{
+		return m_aabb;
+	}
+
+	///
+	uint32_t getNumNodes() const
+	{
+		return m_numNodes;
+	}
+
+	///
+	const BvhNode* getNodes() const
+	{
+		return m_nodes;
+	}
+
+private:
+	void reset(uint32_t _num);
+	void build(uint32_t _numThreads);
+	void refitNodes();
+	bool intersectLeaf(const Ray& _ray, uint32_t _first, uint32_t _num, float _maxDist, Hit* _hit, uint32_t* _outPrimitive) const;
+
+	bx::AllocatorI* m_allocator;
+
+	BvhNode*        m_nodes;
+	uint32_t*       m_indices;
+	Aabb*           m_primitives;
+	const Triangle* m_triangles;
+
+	Aabb     m_aabb;
+	uint32_t m_numNodes;
+	uint32_t m_numPrimitives;
+	uint32_t m_stackSize; //!< Traversal stack size required by hierarchy depth.
+};
+
+#endif // BVH_H_HEADER_GUARD
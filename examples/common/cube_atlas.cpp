@@ -6,6 +6,8 @@
 #include "common.h"
 #include <bgfx/bgfx.h>
 
+#include <bx/sort.h>
+
 #include <limits.h> // INT_MAX
 #include <vector>
 
@@ -310,11 +312,37 @@ Atlas::~Atlas()
 
 	delete [] m_layers;
 	delete [] m_regions;
+	delete [] m_regionInfo;
+	delete [] m_freeRegions;
 	delete [] m_textureBuffer;
 }
 
+#define ATLAS_FREE_LAYER UINT8_MAX
+
 void Atlas::init()
 {
+	m_layers = NULL;
+
+	m_regionInfo = new RegionInfo[m_maxRegionCount];
+	bx::memSet(m_regionInfo, 0, m_maxRegionCount * sizeof(RegionInfo) );
+	m_freeRegions = new uint16_t[m_maxRegionCount];
+	m_numFreeRegions = 0;
+
+	bx::memSet(m_liveArea, 0, sizeof(m_liveArea) );
+	m_frame = 0;
+
+	m_remapFn = NULL;
+	m_remapUserData = NULL;
+
+	m_batch = false;
+	for (uint32_t ii = 0; ii < BX_COUNTOF(m_dirty); ++ii)
+	{
+		m_dirty[ii].minX = UINT16_MAX;
+		m_dirty[ii].minY = UINT16_MAX;
+		m_dirty[ii].maxX = 0;
+		m_dirty[ii].maxY = 0;
+	}
+
 	m_texelSize = float(UINT16_MAX) / float(m_textureSize);
 	float texelHalf = m_texelSize/2.0f;
 	switch (bgfx::getRendererType() )
@@ -337,55 +365,81 @@ void Atlas::init()
 	}
 }
 
-uint16_t Atlas::addRegion(uint16_t _width, uint16_t _height, const uint8_t* _bitmapBuffer, AtlasRegion::Type _type, uint16_t outline)
+uint32_t Atlas::pack(uint16_t _width, uint16_t _height, AtlasRegion::Type _type, uint16_t& _outX, uint16_t& _outY)
 {
-	if (m_regionCount >= m_maxRegionCount)
-	{
-		return UINT16_MAX;
-	}
-
-	uint16_t xx = 0;
-	uint16_t yy = 0;
 	uint32_t idx = 0;
 	while (idx < m_usedLayers)
 	{
 		if (m_layers[idx].faceRegion.getType() == _type
-		&&  m_layers[idx].packer.addRectangle(_width + 1, _height + 1, xx, yy) )
+		&&  m_layers[idx].packer.addRectangle(_width + 1, _height + 1, _outX, _outY) )
 		{
-			break;
+			return idx;
 		}
 
 		idx++;
 	}
 
-	if (idx >= m_usedLayers)
+	if ( (idx + _type) > 24
+	|| m_usedFaces >= 6)
 	{
-		if ( (idx + _type) > 24
-		|| m_usedFaces >= 6)
-		{
-			return UINT16_MAX;
-		}
+		return UINT32_MAX;
+	}
 
-		for (int ii = 0; ii < _type; ++ii)
-		{
-			AtlasRegion& region = m_layers[idx + ii].faceRegion;
-			region.x = 0;
-			region.y = 0;
-			region.width = m_textureSize;
-			region.height = m_textureSize;
-			region.setMask(_type, m_usedFaces, ii);
-		}
+	for (int ii = 0; ii < _type; ++ii)
+	{
+		AtlasRegion& region = m_layers[idx + ii].faceRegion;
+		region.x = 0;
+		region.y = 0;
+		region.width = m_textureSize;
+		region.height = m_textureSize;
+		region.setMask(_type, m_usedFaces, ii);
+	}
+
+	m_usedLayers += _type;
+	m_usedFaces++;
 
-		m_usedLayers += _type;
-		m_usedFaces++;
+	if (!m_layers[idx].packer.addRectangle(_width + 1, _height + 1, _outX, _outY) )
+	{
+		return UINT32_MAX;
+	}
+
+	return idx;
+}
 
-		if (!m_layers[idx].packer.addRectangle(_width + 1, _height + 1, xx, yy) )
+uint16_t Atlas::addRegion(uint16_t _width, uint16_t _height, const uint8_t* _bitmapBuffer, AtlasRegion::Type _type, uint16_t outline)
+{
+	if (0 == m_numFreeRegions
+	&&  m_regionCount >= m_maxRegionCount)
+	{
+		if (NULL == m_remapFn
+		||  !evict(_type, 0) )
 		{
 			return UINT16_MAX;
 		}
 	}
 
-	AtlasRegion& region = m_regions[m_regionCount];
+	uint16_t xx = 0;
+	uint16_t yy = 0;
+	uint32_t idx = pack(_width, _height, _type, xx, yy);
+
+	while (UINT32_MAX == idx
+	&&     NULL != m_remapFn
+	&&     evict(_type, (_width + 1) * (_height + 1) ) )
+	{
+		idx = pack(_width, _height, _type, xx, yy);
+	}
+
+	if (UINT32_MAX == idx)
+	{
+		return UINT16_MAX;
+	}
+
+	const uint16_t handle = 0 < m_numFreeRegions
+		? m_freeRegions[--m_numFreeRegions]
+		: m_regionCount++
+		;
+
+	AtlasRegion& region = m_regions[handle];
 	region.x = xx;
 	region.y = yy;
 	region.width = _width;
@@ -399,50 +453,441 @@ uint16_t Atlas::addRegion(uint16_t _width, uint16_t _height, const uint8_t* _bit
 	region.width -= (outline * 2);
 	region.height -= (outline * 2);
 
-	return m_regionCount++;
+	RegionInfo& info = m_regionInfo[handle];
+	info.lastUse = m_frame;
+	info.refCount = 0;
+	info.layer = uint8_t(idx);
+	info.outline = uint8_t(outline);
+	m_liveArea[idx] += (_width + 1) * (_height + 1);
+
+	return handle;
 }
 
-void Atlas::updateRegion(const AtlasRegion& _region, const uint8_t* _bitmapBuffer)
+void Atlas::removeRegion(uint16_t _regionHandle)
+{
+	freeRegion(_regionHandle, false);
+}
+
+void Atlas::addRef(uint16_t _regionHandle)
+{
+	++m_regionInfo[_regionHandle].refCount;
+}
+
+void Atlas::release(uint16_t _regionHandle)
 {
-	uint32_t size = _region.width * _region.height * 4;
-	if (0 < size)
+	BX_CHECK(0 < m_regionInfo[_regionHandle].refCount, "Region %d is not referenced.", _regionHandle);
+	--m_regionInfo[_regionHandle].refCount;
+}
+
+void Atlas::touch(uint16_t _regionHandle)
+{
+	m_regionInfo[_regionHandle].lastUse = m_frame;
+}
+
+void Atlas::setRemapCallback(AtlasRemapFn _fn, void* _userData)
+{
+	m_remapFn = _fn;
+	m_remapUserData = _userData;
+}
+
+void Atlas::update(float _maxWaste)
+{
+	++m_frame;
+
+	if (NULL == m_layers)
+	{
+		return;
+	}
+
+	// Removed regions leave holes the skyline packer can't reuse, repack layer with the
+	// most wasted space. Only one layer per call to keep frame time bounded.
+	uint32_t worst = UINT32_MAX;
+	float worstWaste = _maxWaste;
+
+	for (uint32_t ii = 0; ii < m_usedLayers; ++ii)
 	{
-		const bgfx::Memory* mem = bgfx::alloc(size);
-		bx::memSet(mem->data, 0, mem->size);
-		if (_region.getType() == AtlasRegion::TYPE_BGRA8)
+		RectanglePacker& packer = m_layers[ii].packer;
+		const float waste = float(packer.getUsedSurface() - m_liveArea[ii]) / float(packer.getTotalSurface() );
+
+		if (waste > worstWaste)
 		{
-			const uint8_t* inLineBuffer = _bitmapBuffer;
-			uint8_t* outLineBuffer = m_textureBuffer + _region.getFaceIndex() * (m_textureSize * m_textureSize * 4) + ( ( (_region.y * m_textureSize) + _region.x) * 4);
+			worst = ii;
+			worstWaste = waste;
+		}
+	}
 
-			for (int yy = 0; yy < _region.height; ++yy)
-			{
-				bx::memCopy(outLineBuffer, inLineBuffer, _region.width * 4);
-				inLineBuffer += _region.width * 4;
-				outLineBuffer += m_textureSize * 4;
-			}
+	if (UINT32_MAX != worst)
+	{
+		repack(worst);
+	}
+}
+
+void Atlas::freeRegion(uint16_t _regionHandle, bool _evicted)
+{
+	RegionInfo& info = m_regionInfo[_regionHandle];
+	BX_CHECK(ATLAS_FREE_LAYER != info.layer, "Region %d is already free.", _regionHandle);
+
+	AtlasRegion& region = m_regions[_regionHandle];
+	const uint32_t width  = region.width  + info.outline * 2;
+	const uint32_t height = region.height + info.outline * 2;
+	m_liveArea[info.layer] -= (width + 1) * (height + 1);
+
+	region.width = 0;
+	region.height = 0;
+	info.layer = ATLAS_FREE_LAYER;
+	info.refCount = 0;
+	m_freeRegions[m_numFreeRegions++] = _regionHandle;
+
+	if (_evicted
+	&&  NULL != m_remapFn)
+	{
+		m_remapFn(_regionHandle, true, m_remapUserData);
+	}
+}
+
+struct RegionSortKey
+{
+	uint32_t key;
+	uint16_t handle;
+};
+
+static int32_t compareRegionSortKey(const void* _lhs, const void* _rhs)
+{
+	const RegionSortKey& lhs = *(const RegionSortKey*)_lhs;
+	const RegionSortKey& rhs = *(const RegionSortKey*)_rhs;
+	return lhs.key < rhs.key ? -1 : lhs.key > rhs.key ? 1 : 0;
+}
+
+bool Atlas::evict(AtlasRegion::Type _type, uint32_t _area)
+{
+	// Pick layer holding the least recently used region. Regions used in current frame, or
+	// referenced, are never evicted.
+	uint32_t layer = UINT32_MAX;
+	uint32_t oldest = m_frame;
+
+	for (uint16_t ii = 0; ii < m_regionCount; ++ii)
+	{
+		const RegionInfo& info = m_regionInfo[ii];
+		if (ATLAS_FREE_LAYER != info.layer
+		&&  0 == info.refCount
+		&&  info.lastUse < oldest
+		&&  m_layers[info.layer].faceRegion.getType() == _type)
+		{
+			layer = info.layer;
+			oldest = info.lastUse;
+		}
+	}
 
-			bx::memCopy(mem->data, _bitmapBuffer, mem->size);
+	if (UINT32_MAX == layer)
+	{
+		return false;
+	}
+
+	RegionSortKey* candidates = new RegionSortKey[m_regionCount];
+	uint32_t num = 0;
+
+	for (uint16_t ii = 0; ii < m_regionCount; ++ii)
+	{
+		const RegionInfo& info = m_regionInfo[ii];
+		if (layer == info.layer
+		&&  0 == info.refCount
+		&&  info.lastUse < m_frame)
+		{
+			candidates[num].key = info.lastUse;
+			candidates[num].handle = ii;
+			++num;
+		}
+	}
+
+	bx::quickSort(candidates, num, sizeof(RegionSortKey), compareRegionSortKey);
+
+	// Evict more than requested, so that repacking cost is amortized over multiple
+	// additions.
+	const uint32_t target = bx::max(_area, m_layers[layer].packer.getTotalSurface() / 8);
+	const uint32_t liveArea = m_liveArea[layer];
+
+	for (uint32_t ii = 0; ii < num && liveArea - m_liveArea[layer] < target; ++ii)
+	{
+		freeRegion(candidates[ii].handle, true);
+	}
+
+	delete [] candidates;
+
+	repack(layer);
+
+	return true;
+}
+
+void Atlas::repack(uint32_t _layer)
+{
+	PackedLayer& layer = m_layers[_layer];
+	const uint32_t face = layer.faceRegion.getFaceIndex();
+	const uint32_t component = layer.faceRegion.getComponentIndex();
+	const uint32_t bpp = layer.faceRegion.getType() == AtlasRegion::TYPE_BGRA8 ? 4 : 1;
+	const uint32_t faceSize = m_textureSize * m_textureSize;
+	uint8_t* faceBuffer = m_textureBuffer + face * faceSize * 4;
+
+	// Referenced regions first, so that only unreferenced regions can be left out when
+	// repacking in different order doesn't fit everything back. Within each group tallest
+	// regions first, which is what skyline packer handles best.
+	RegionSortKey* regions = new RegionSortKey[m_regionCount];
+	uint32_t num = 0;
+
+	for (uint16_t ii = 0; ii < m_regionCount; ++ii)
+	{
+		const RegionInfo& info = m_regionInfo[ii];
+		if (_layer == info.layer)
+		{
+			regions[num].key = (0 == info.refCount ? UINT32_C(1) << 16 : 0)
+				| (UINT16_MAX - (m_regions[ii].height + info.outline * 2) )
+				;
+			regions[num].handle = ii;
+			++num;
+		}
+	}
+
+	bx::quickSort(regions, num, sizeof(RegionSortKey), compareRegionSortKey);
+
+	// Find new placement before touching the texture. Layer is left as is when any
+	// referenced region doesn't fit.
+	RectanglePacker packer = layer.packer;
+	packer.clear();
+
+	uint32_t* placement = new uint32_t[num];
+
+	for (uint32_t ii = 0; ii < num; ++ii)
+	{
+		const uint16_t handle = regions[ii].handle;
+		const AtlasRegion& region = m_regions[handle];
+		const RegionInfo& info = m_regionInfo[handle];
+		const uint16_t width  = uint16_t(region.width  + info.outline * 2);
+		const uint16_t height = uint16_t(region.height + info.outline * 2);
+
+		uint16_t xx;
+		uint16_t yy;
+		if (packer.addRectangle(width + 1, height + 1, xx, yy) )
+		{
+			placement[ii] = (uint32_t(yy) << 16) | xx;
+		}
+		else if (0 == info.refCount)
+		{
+			placement[ii] = UINT32_MAX;
 		}
 		else
 		{
-			uint32_t layer = _region.getComponentIndex();
-			const uint8_t* inLineBuffer = _bitmapBuffer;
-			uint8_t* outLineBuffer = (m_textureBuffer + _region.getFaceIndex() * (m_textureSize * m_textureSize * 4) + ( ( (_region.y * m_textureSize) + _region.x) * 4) );
+			delete [] placement;
+			delete [] regions;
+			return;
+		}
+	}
+
+	// Unreferenced regions that didn't fit are evicted.
+	for (uint32_t ii = 0; ii < num; ++ii)
+	{
+		if (UINT32_MAX == placement[ii])
+		{
+			freeRegion(regions[ii].handle, true);
+		}
+	}
+
+	// Move live regions out of the texture mirror. Gray regions share texels with regions
+	// in other component layers of the same face, so regions are moved in the mirror one
+	// component at a time instead of blitting whole texels on GPU.
+	uint8_t* scratch = new uint8_t[faceSize * bpp];
+	uint32_t offset = 0;
+
+	for (uint32_t ii = 0; ii < num; ++ii)
+	{
+		if (UINT32_MAX == placement[ii])
+		{
+			continue;
+		}
 
-			for (int yy = 0; yy < _region.height; ++yy)
+		const AtlasRegion& region = m_regions[regions[ii].handle];
+		const uint32_t outline = m_regionInfo[regions[ii].handle].outline;
+		const uint32_t width  = region.width  + outline * 2;
+		const uint32_t height = region.height + outline * 2;
+		const uint8_t* src = faceBuffer + ( (region.y - outline) * m_textureSize + (region.x - outline) ) * 4;
+
+		for (uint32_t yy = 0; yy < height; ++yy)
+		{
+			if (4 == bpp)
+			{
+				bx::memCopy(&scratch[offset], src, width * 4);
+			}
+			else
 			{
-				for (int xx = 0; xx < _region.width; ++xx)
+				for (uint32_t xx = 0; xx < width; ++xx)
 				{
-					outLineBuffer[(xx * 4) + layer] = inLineBuffer[xx];
+					scratch[offset + xx] = src[xx * 4 + component];
 				}
+			}
+
+			offset += width * bpp;
+			src += m_textureSize * 4;
+		}
+	}
+
+	if (4 == bpp)
+	{
+		bx::memSet(faceBuffer, 0, faceSize * 4);
+	}
+	else
+	{
+		for (uint32_t ii = 0; ii < faceSize; ++ii)
+		{
+			faceBuffer[ii * 4 + component] = 0;
+		}
+	}
+
+	const bool batch = m_batch;
+	m_batch = true;
+
+	DirtyRect& dirty = m_dirty[face];
+	dirty.minX = 0;
+	dirty.minY = 0;
+	dirty.maxX = m_textureSize;
+	dirty.maxY = m_textureSize;
+
+	layer.packer = packer;
+	m_liveArea[_layer] = 0;
+	offset = 0;
 
-				bx::memCopy(mem->data + yy * _region.width * 4, outLineBuffer, _region.width * 4);
-				inLineBuffer += _region.width;
-				outLineBuffer += m_textureSize * 4;
+	for (uint32_t ii = 0; ii < num; ++ii)
+	{
+		if (UINT32_MAX == placement[ii])
+		{
+			continue;
+		}
+
+		const uint16_t handle = regions[ii].handle;
+		AtlasRegion& region = m_regions[handle];
+		const uint32_t outline = m_regionInfo[handle].outline;
+		const uint16_t width  = uint16_t(region.width  + outline * 2);
+		const uint16_t height = uint16_t(region.height + outline * 2);
+		const uint8_t* data = &scratch[offset];
+		offset += width * height * bpp;
+
+		const uint16_t xx = uint16_t(placement[ii] & UINT16_MAX);
+		const uint16_t yy = uint16_t(placement[ii] >> 16);
+		const bool moved = xx + outline != region.x || yy + outline != region.y;
+
+		region.x = xx;
+		region.y = yy;
+		region.width = width;
+		region.height = height;
+		updateRegion(region, data);
+
+		region.x += uint16_t(outline);
+		region.y += uint16_t(outline);
+		region.width -= uint16_t(outline * 2);
+		region.height -= uint16_t(outline * 2);
+		m_liveArea[_layer] += (width + 1) * (height + 1);
+
+		if (moved
+		&&  NULL != m_remapFn)
+		{
+			m_remapFn(handle, false, m_remapUserData);
+		}
+	}
+
+	delete [] scratch;
+	delete [] placement;
+	delete [] regions;
+
+	if (!batch)
+	{
+		endBatch();
+	}
+}
+
+void Atlas::updateRegion(const AtlasRegion& _region, const uint8_t* _bitmapBuffer)
+{
+	if (0 == _region.width * _region.height)
+	{
+		return;
+	}
+
+	const uint32_t face = _region.getFaceIndex();
+	uint8_t* outLineBuffer = m_textureBuffer + face * (m_textureSize * m_textureSize * 4) + ( ( (_region.y * m_textureSize) + _region.x) * 4);
+	const uint8_t* inLineBuffer = _bitmapBuffer;
+
+	if (_region.getType() == AtlasRegion::TYPE_BGRA8)
+	{
+		for (int yy = 0; yy < _region.height; ++yy)
+		{
+			bx::memCopy(outLineBuffer, inLineBuffer, _region.width * 4);
+			inLineBuffer += _region.width * 4;
+			outLineBuffer += m_textureSize * 4;
+		}
+	}
+	else
+	{
+		uint32_t layer = _region.getComponentIndex();
+
+		for (int yy = 0; yy < _region.height; ++yy)
+		{
+			for (int xx = 0; xx < _region.width; ++xx)
+			{
+				outLineBuffer[(xx * 4) + layer] = inLineBuffer[xx];
 			}
+
+			inLineBuffer += _region.width;
+			outLineBuffer += m_textureSize * 4;
+		}
+	}
+
+	if (m_batch)
+	{
+		DirtyRect& dirty = m_dirty[face];
+		dirty.minX = bx::min<uint16_t>(dirty.minX, _region.x);
+		dirty.minY = bx::min<uint16_t>(dirty.minY, _region.y);
+		dirty.maxX = bx::max<uint16_t>(dirty.maxX, _region.x + _region.width);
+		dirty.maxY = bx::max<uint16_t>(dirty.maxY, _region.y + _region.height);
+		return;
+	}
+
+	updateTexture(face, _region.x, _region.y, _region.width, _region.height);
+}
+
+void Atlas::updateTexture(uint32_t _face, uint16_t _x, uint16_t _y, uint16_t _width, uint16_t _height)
+{
+	const uint32_t pitch = _width * 4;
+	const bgfx::Memory* mem = bgfx::alloc(pitch * _height);
+
+	const uint8_t* inLineBuffer = m_textureBuffer + _face * (m_textureSize * m_textureSize * 4) + ( ( (_y * m_textureSize) + _x) * 4);
+	for (uint32_t yy = 0; yy < _height; ++yy)
+	{
+		bx::memCopy(mem->data + yy * pitch, inLineBuffer, pitch);
+		inLineBuffer += m_textureSize * 4;
+	}
+
+	bgfx::updateTextureCube(m_textureHandle, 0, (uint8_t)_face, 0, _x, _y, _width, _height, mem);
+}
+
+void Atlas::beginBatch()
+{
+	m_batch = true;
+}
+
+void Atlas::endBatch()
+{
+	m_batch = false;
+
+	for (uint32_t ii = 0; ii < BX_COUNTOF(m_dirty); ++ii)
+	{
+		DirtyRect& dirty = m_dirty[ii];
+
+		if (dirty.minX < dirty.maxX
+		&&  dirty.minY < dirty.maxY)
+		{
+			updateTexture(ii, dirty.minX, dirty.minY, dirty.maxX - dirty.minX, dirty.maxY - dirty.minY);
 		}
 
-		bgfx::updateTextureCube(m_textureHandle, 0, (uint8_t)_region.getFaceIndex(), 0, _region.x, _region.y, _region.width, _region.height, mem);
+		dirty.minX = UINT16_MAX;
+		dirty.minY = UINT16_MAX;
+		dirty.maxX = 0;
+		dirty.maxY = 0;
 	}
 }
 
@@ -50,6 +50,10 @@ struct AtlasRegion
 	}
 };
 
+/// Called when atlas region is moved by defragmentation, and UVs packed for it must be
+/// updated, or when region is evicted to make room for new one, and handle is no longer valid.
+typedef void (*AtlasRemapFn)(uint16_t _regionHandle, bool _evicted, void* _userData);
+
 class Atlas
 {
 public:
@@ -73,6 +77,33 @@ public:
 	/// update a preallocated region
 	void updateRegion(const AtlasRegion& _region, const uint8_t* _bitmapBuffer);
 
+	/// free a region, its space is reclaimed when its layer is defragmented
+	void removeRegion(uint16_t _regionHandle);
+
+	/// increase region reference count, referenced regions are never evicted
+	void addRef(uint16_t _regionHandle);
+
+	/// decrease region reference count
+	void release(uint16_t _regionHandle);
+
+	/// mark region as used in the current frame, least recently used regions are evicted first
+	void touch(uint16_t _regionHandle);
+
+	/// set callback notified about moved and evicted regions. When set, addRegion evicts least
+	/// recently used unreferenced regions instead of failing when the atlas is full
+	void setRemapCallback(AtlasRemapFn _fn, void* _userData);
+
+	/// advance LRU frame and incrementally defragment the atlas, repacking at most one layer
+	/// whose space wasted by removed regions exceeds _maxWaste [0:1]
+	void update(float _maxWaste = 0.25f);
+
+	/// begin batching region updates, texture is not updated until endBatch is called
+	void beginBatch();
+
+	/// end batching region updates, upload all regions changed since beginBatch with one
+	/// texture update per cube face
+	void endBatch();
+
 	/// Pack the UV coordinates of the four corners of a region to a vertex buffer using the supplied vertex format.
 	/// v0 -- v3
 	/// |     |     encoded in that order:  v0,v1,v2,v3
@@ -136,6 +167,25 @@ public:
 
 private:
 	void init();
+	void updateTexture(uint32_t _face, uint16_t _x, uint16_t _y, uint16_t _width, uint16_t _height);
+	uint32_t pack(uint16_t _width, uint16_t _height, AtlasRegion::Type _type, uint16_t& _outX, uint16_t& _outY);
+	bool evict(AtlasRegion::Type _type, uint32_t _area);
+	void freeRegion(uint16_t _regionHandle, bool _evicted);
+	void repack(uint32_t _layer);
+
+	struct RegionInfo
+	{
+		uint32_t lastUse;
+		uint32_t refCount;
+		uint8_t  layer;
+		uint8_t  outline;
+	};
+
+	struct DirtyRect
+	{
+		uint16_t minX, minY;
+		uint16_t maxX, maxY;
+	};
 
 	struct PackedLayer;
 	PackedLayer* m_layers;
@@ -152,6 +202,19 @@ private:
 
 	uint16_t m_regionCount;
 	uint16_t m_maxRegionCount;
+
+	RegionInfo* m_regionInfo;
+	uint16_t* m_freeRegions;
+	uint16_t m_numFreeRegions;
+
+	uint32_t m_liveArea[24];
+	uint32_t m_frame;
+
+	AtlasRemapFn m_remapFn;
+	void* m_remapUserData;
+
+	DirtyRect m_dirty[6];
+	bool m_batch;
 };
 
 #endif // CUBE_ATLAS_H_HEADER_GUARD
@@ -19,6 +19,10 @@
 #	define DEBUG_DRAW_CONFIG_MAX_GEOMETRY 256
 #endif // DEBUG_DRAW_CONFIG_MAX_GEOMETRY
 
+#ifndef DEBUG_DRAW_CONFIG_MAX_INSTANCES
+#	define DEBUG_DRAW_CONFIG_MAX_INSTANCES 1024
+#endif // DEBUG_DRAW_CONFIG_MAX_INSTANCES
+
 struct DebugVertex
 {
 	float m_x;
@@ -333,6 +337,10 @@ bx::Vec3 getPoint(Axis::Enum _axis, float _x, float _y)
 #include "fs_debugdraw_fill_lit.bin.h"
 #include "vs_debugdraw_fill_texture.bin.h"
 #include "fs_debugdraw_fill_texture.bin.h"
+#include "vs_debugdraw_fill_mesh_instanced.bin.h"
+#include "fs_debugdraw_fill_instanced.bin.h"
+#include "vs_debugdraw_fill_lit_mesh_instanced.bin.h"
+#include "fs_debugdraw_fill_lit_instanced.bin.h"
 
 static const bgfx::EmbeddedShader s_embeddedShaders[] =
 {
@@ -348,6 +356,10 @@ static const bgfx::EmbeddedShader s_embeddedShaders[] =
 	BGFX_EMBEDDED_SHADER(fs_debugdraw_fill_lit),
 	BGFX_EMBEDDED_SHADER(vs_debugdraw_fill_texture),
 	BGFX_EMBEDDED_SHADER(fs_debugdraw_fill_texture),
+	BGFX_EMBEDDED_SHADER(vs_debugdraw_fill_mesh_instanced),
+	BGFX_EMBEDDED_SHADER(fs_debugdraw_fill_instanced),
+	BGFX_EMBEDDED_SHADER(vs_debugdraw_fill_lit_mesh_instanced),
+	BGFX_EMBEDDED_SHADER(fs_debugdraw_fill_lit_instanced),
 
 	BGFX_EMBEDDED_SHADER_END()
 };
@@ -523,6 +535,8 @@ struct Program
 		FillLit,
 		FillLitMesh,
 		FillTexture,
+		FillMeshInstanced,
+		FillLitMeshInstanced,
 
 		Count
 	};
@@ -636,6 +650,32 @@ struct DebugDrawShared
 			, true
 			);
 
+		// Without instancing, or instanced shaders for current renderer, shapes are submitted
+		// one by one.
+		m_program[Program::FillMeshInstanced]    = BGFX_INVALID_HANDLE;
+		m_program[Program::FillLitMeshInstanced] = BGFX_INVALID_HANDLE;
+		m_instancing = false;
+
+		if (0 != (bgfx::getCaps()->supported & BGFX_CAPS_INSTANCING) )
+		{
+			m_program[Program::FillMeshInstanced] = bgfx::createProgram(
+				  bgfx::createEmbeddedShader(s_embeddedShaders, type, "vs_debugdraw_fill_mesh_instanced")
+				, bgfx::createEmbeddedShader(s_embeddedShaders, type, "fs_debugdraw_fill_instanced")
+				, true
+				);
+
+			m_program[Program::FillLitMeshInstanced] = bgfx::createProgram(
+				  bgfx::createEmbeddedShader(s_embeddedShaders, type, "vs_debugdraw_fill_lit_mesh_instanced")
+				, bgfx::createEmbeddedShader(s_embeddedShaders, type, "fs_debugdraw_fill_lit_instanced")
+				, true
+				);
+
+			m_instancing = true
+				&& bgfx::isValid(m_program[Program::FillMeshInstanced])
+				&& bgfx::isValid(m_program[Program::FillLitMeshInstanced])
+				;
+		}
+
 		u_params   = bgfx::createUniform("u_params",   bgfx::UniformType::Vec4, 4);
 		s_texColor = bgfx::createUniform("s_texColor", bgfx::UniformType::Sampler);
 		m_texture  = bgfx::createTexture2D(SPRITE_TEXTURE_SIZE, SPRITE_TEXTURE_SIZE, false, 1, bgfx::TextureFormat::BGRA8);
@@ -968,7 +1008,10 @@ struct DebugDrawShared
 		bgfx::destroy(m_vbh);
 		for (uint32_t ii = 0; ii < Program::Count; ++ii)
 		{
-			bgfx::destroy(m_program[ii]);
+			if (bgfx::isValid(m_program[ii]) )
+			{
+				bgfx::destroy(m_program[ii]);
+			}
 		}
 		bgfx::destroy(u_params);
 		bgfx::destroy(s_texColor);
@@ -1024,6 +1067,8 @@ struct DebugDrawShared
 	bgfx::ProgramHandle m_program[Program::Count];
 	bgfx::UniformHandle u_params;
 
+	bool m_instancing;
+
 	bgfx::VertexBufferHandle m_vbh;
 	bgfx::IndexBufferHandle  m_ibh;
 };
@@ -1042,10 +1087,18 @@ struct DebugDrawEncoderImpl
 	void init(bgfx::Encoder* _encoder)
 	{
 		m_defaultEncoder = _encoder;
+
+		m_instances    = NULL;
+		m_numInstances = 0;
 	}
 
 	void shutdown()
 	{
+		if (NULL != m_instances)
+		{
+			BX_FREE(s_dds.m_allocator, m_instances);
+			m_instances = NULL;
+		}
 	}
 
 	void begin(bgfx::ViewId _viewId, bool _depthTestLess, bgfx::Encoder* _encoder)
@@ -1088,6 +1141,7 @@ struct DebugDrawEncoderImpl
 
 		flushQuad();
 		flush();
+		flushBatch();
 
 		m_encoder = NULL;
 		m_state   = State::Count;
@@ -1575,6 +1629,8 @@ struct DebugDrawEncoderImpl
 
 	void draw(GeometryHandle _handle)
 	{
+		flushBatch();
+
 		const Geometry::Geometry& geometry = s_dds.m_geometry.m_geometry[_handle.idx];
 		m_encoder->setVertexBuffer(0, geometry.m_vbh);
 
@@ -1607,6 +1663,7 @@ struct DebugDrawEncoderImpl
 	void draw(bool _lineList, uint32_t _numVertices, const DdVertex* _vertices, uint32_t _numIndices, const uint16_t* _indices)
 	{
 		flush();
+		flushBatch();
 
 		if (_numVertices == bgfx::getAvailTransientVertexBuffer(_numVertices, DebugMeshVertex::ms_layout) )
 		{
@@ -2127,10 +2184,19 @@ struct DebugDrawEncoderImpl
 
 	void draw(DebugMesh::Enum _mesh, const float* _mtx, uint16_t _num, bool _wireframe)
 	{
-		pushTransform(_mtx, _num, false /* flush */);
-
 		const DebugMesh& mesh = s_dds.m_mesh[_mesh];
 
+		if (s_dds.m_instancing
+		&&  0 != mesh.m_numIndices[_wireframe])
+		{
+			drawInstanced(_mesh, _mtx, _num, _wireframe);
+			return;
+		}
+
+		flushBatch();
+
+		pushTransform(_mtx, _num, false /* flush */);
+
 		if (0 != mesh.m_numIndices[_wireframe])
 		{
 			m_encoder->setIndexBuffer(s_dds.m_ibh
@@ -2151,6 +2217,93 @@ struct DebugDrawEncoderImpl
 		popTransform(false /* flush */);
 	}
 
+	// Appends shape instance with its transform and color. Consecutive shapes with same mesh
+	// and state are submitted as single instanced draw call. Second transform of cones,
+	// cylinders and capsules differs from first only in translation, which is stored in
+	// otherwise unused w components of first three columns.
+	void drawInstanced(DebugMesh::Enum _mesh, const float* _mtx, uint16_t _num, bool _wireframe)
+	{
+		const Attrib& attrib = m_attrib[m_stack];
+		const bool blend = (attrib.m_abgr >> 24) < 0xff;
+
+		if (0 != m_numInstances)
+		{
+			if (m_instanceMesh           != _mesh
+			||  m_instanceAttrib.m_state != attrib.m_state
+			||  m_instanceWireframe      != _wireframe
+			||  m_instanceBlend          != blend
+			||  m_numInstances           == kMaxInstances)
+			{
+				flushBatch();
+			}
+		}
+
+		if (NULL == m_instances)
+		{
+			m_instances = (float*)BX_ALLOC(s_dds.m_allocator, kMaxInstances*kInstanceStride);
+		}
+
+		m_instanceMesh      = _mesh;
+		m_instanceWireframe = _wireframe;
+		m_instanceBlend     = blend;
+		m_instanceAttrib    = attrib;
+
+		float mtx[2*16];
+		const MatrixStack& stack = m_mtxStack[m_mtxStackCurrent];
+		for (uint16_t ii = 0; ii < _num; ++ii)
+		{
+			if (NULL == stack.data)
+			{
+				bx::memCopy(&mtx[ii*16], &_mtx[ii*16], 64);
+			}
+			else
+			{
+				bx::mtxMul(&mtx[ii*16], &_mtx[ii*16], stack.data);
+			}
+		}
+
+		const float* to = &mtx[(_num-1)*16];
+
+		float* data = &m_instances[m_numInstances*kInstanceStride/sizeof(float)];
+		bx::memCopy(data, mtx, 64);
+		data[ 3] = to[12];
+		data[ 7] = to[13];
+		data[11] = to[14];
+		data[16] = ( (attrib.m_abgr)       & 0xff) / 255.0f;
+		data[17] = ( (attrib.m_abgr >> 8)  & 0xff) / 255.0f;
+		data[18] = ( (attrib.m_abgr >> 16) & 0xff) / 255.0f;
+		data[19] = ( (attrib.m_abgr >> 24) & 0xff) / 255.0f;
+
+		++m_numInstances;
+	}
+
+	void flushBatch()
+	{
+		if (0 != m_numInstances)
+		{
+			if (m_numInstances == bgfx::getAvailInstanceDataBuffer(m_numInstances, kInstanceStride) )
+			{
+				bgfx::InstanceDataBuffer idb;
+				bgfx::allocInstanceDataBuffer(&idb, m_numInstances, kInstanceStride);
+				bx::memCopy(idb.data, m_instances, m_numInstances*kInstanceStride);
+
+				const DebugMesh& mesh = s_dds.m_mesh[m_instanceMesh];
+
+				setUParams(m_instanceAttrib, m_instanceWireframe);
+
+				m_encoder->setVertexBuffer(0, s_dds.m_vbh, mesh.m_startVertex, mesh.m_numVertices);
+				m_encoder->setIndexBuffer(s_dds.m_ibh
+					, mesh.m_startIndex[m_instanceWireframe]
+					, mesh.m_numIndices[m_instanceWireframe]
+					);
+				m_encoder->setInstanceDataBuffer(&idb);
+				m_encoder->submit(m_viewId, s_dds.m_program[m_instanceWireframe ? Program::FillMeshInstanced : Program::FillLitMeshInstanced]);
+			}
+
+			m_numInstances = 0;
+		}
+	}
+
 	void softFlush()
 	{
 		if (m_pos == uint16_t(BX_COUNTOF(m_cache) ) )
@@ -2163,6 +2316,9 @@ struct DebugDrawEncoderImpl
 	{
 		if (0 != m_pos)
 		{
+			// Keep submission order for views in sequential mode.
+			flushBatch();
+
 			if (checkAvailTransientBuffers(m_pos, DebugVertex::ms_layout, m_indexPos) )
 			{
 				bgfx::TransientVertexBuffer tvb;
@@ -2200,6 +2356,8 @@ struct DebugDrawEncoderImpl
 	{
 		if (0 != m_posQuad)
 		{
+			flushBatch();
+
 			const uint32_t numIndices = m_posQuad/4*6;
 			if (checkAvailTransientBuffers(m_posQuad, DebugUvVertex::ms_layout, numIndices) )
 			{
@@ -2255,9 +2413,19 @@ struct DebugDrawEncoderImpl
 	static const uint32_t kCacheQuadSize = 1024;
 	BX_STATIC_ASSERT(kCacheSize >= 3, "Cache must be at least 3 elements.");
 
+	static const uint32_t kMaxInstances   = DEBUG_DRAW_CONFIG_MAX_INSTANCES;
+	static const uint16_t kInstanceStride = 5*16; // Transform and color.
+
 	DebugVertex   m_cache[kCacheSize+1];
 	DebugUvVertex m_cacheQuad[kCacheQuadSize];
 	uint16_t m_indices[kCacheSize*2];
+
+	float*   m_instances;
+	uint32_t m_numInstances;
+	Attrib   m_instanceAttrib;
+	DebugMesh::Enum m_instanceMesh;
+	bool     m_instanceWireframe;
+	bool     m_instanceBlend;
 	uint16_t m_pos;
 	uint16_t m_posQuad;
 	uint16_t m_indexPos;
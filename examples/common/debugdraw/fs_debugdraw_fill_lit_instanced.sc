@@ -0,0 +1,25 @@
+$input v_view, v_world, v_color0
+
+/*
+ * Copyright 2011-2020 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx#license-bsd-2-clause
+ */
+
+#include <bgfx_shader.sh>
+
+uniform vec4 u_params[4];
+
+#define u_lightDir     u_params[0].xyz
+#define u_shininess    u_params[0].w
+#define u_skyColor     u_params[1].xyz
+#define u_groundColor  u_params[2].xyz
+
+void main()
+{
+	vec3 normal = normalize(cross(dFdx(v_world), dFdy(v_world) ) );
+
+	float ndotl   = dot(normal, u_lightDir);
+	vec3  diffuse = mix(u_groundColor, u_skyColor, ndotl*0.5 + 0.5) * v_color0.xyz;
+
+	gl_FragColor = vec4(diffuse, v_color0.w);
+}
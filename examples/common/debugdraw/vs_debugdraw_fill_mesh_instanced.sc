@@ -0,0 +1,23 @@
+$input a_position, a_indices, i_data0, i_data1, i_data2, i_data3, i_data4
+$output v_color0
+
+/*
+ * Copyright 2011-2020 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx#license-bsd-2-clause
+ */
+
+#include <bgfx_shader.sh>
+
+void main()
+{
+	// Second transform differs only in translation, stored in w of first three columns.
+	mat4 model;
+	model[0] = vec4(i_data0.xyz, 0.0);
+	model[1] = vec4(i_data1.xyz, 0.0);
+	model[2] = vec4(i_data2.xyz, 0.0);
+	model[3] = 0 == int(a_indices.x) ? i_data3 : vec4(i_data0.w, i_data1.w, i_data2.w, 1.0);
+
+	vec4 world = instMul(model, vec4(a_position, 1.0) );
+	gl_Position = mul(u_viewProj, world);
+	v_color0 = i_data4;
+}
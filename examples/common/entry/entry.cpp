@@ -69,6 +69,11 @@ namespace entry
 		s_currentDir.set(_dir);
 	}
 
+	const char* getCurrentDir()
+	{
+		return s_currentDir.getPtr();
+	}
+
 #if ENTRY_CONFIG_IMPLEMENT_DEFAULT_ALLOCATOR
 	bx::AllocatorI* getDefaultAllocator()
 	{
@@ -4,6 +4,7 @@
  */
 
 #include <bx/bx.h>
+#include <bx/os.h>
 
 #include <stb/stb_truetype.h>
 
@@ -18,6 +19,7 @@
 
 #include <tinystl/allocator.h>
 #include <tinystl/unordered_map.h>
+#include <tinystl/vector.h>
 namespace stl = tinystl;
 
 #include "font_manager.h"
@@ -38,6 +40,10 @@ public:
 	/// return the font descriptor of the current font
 	FontInfo getFontInfo();
 
+	/// compute glyph metrics without rastering it, matching the ones produced
+	/// by bakeGlyphAlpha (_padding 0) or bakeGlyphDistance (_padding 6)
+	void getGlyphMetrics(CodePoint _codePoint, GlyphInfo& _outGlyphInfo, uint32_t _padding = 0);
+
 	/// raster a glyph as 8bit alpha to a memory buffer
 	/// update the GlyphInfo according to the raster strategy
 	/// @ remark buffer min size: glyphInfo.m_width * glyphInfo * height * sizeof(char)
@@ -103,14 +109,14 @@ FontInfo TrueTypeFont::getFontInfo()
 	return outFontInfo;
 }
 
-bool TrueTypeFont::bakeGlyphAlpha(CodePoint _codePoint, GlyphInfo& _glyphInfo, uint8_t* _outBuffer)
+void TrueTypeFont::getGlyphMetrics(CodePoint _codePoint, GlyphInfo& _glyphInfo, uint32_t _padding)
 {
 	BX_CHECK(m_font != NULL, "TrueTypeFont not initialized");
 
-	int xx;
-	int yy;
-	int ww;
-	int hh;
+	int x0;
+	int y0;
+	int x1;
+	int y1;
 	int advance;
 	int ascent;
 	int descent;
@@ -121,15 +127,35 @@ bool TrueTypeFont::bakeGlyphAlpha(CodePoint _codePoint, GlyphInfo& _glyphInfo, u
 
 	stbtt_GetFontVMetrics(&m_font, &ascent, &descent, &lineGap);
 	stbtt_GetCodepointHMetrics(&m_font, _codePoint, &advance, &lsb);
-	stbtt_GetCodepointBitmap(&m_font, scale, scale, _codePoint, &ww, &hh, &xx, &yy);
+	stbtt_GetCodepointBitmapBox(&m_font, _codePoint, scale, scale, &x0, &y0, &x1, &y1);
 
-	_glyphInfo.offset_x = (float)xx;
-	_glyphInfo.offset_y = (float)yy;
-	_glyphInfo.width = (float)ww;
-	_glyphInfo.height = (float)hh;
+	_glyphInfo.offset_x = (float)x0;
+	_glyphInfo.offset_y = (float)y0;
+	_glyphInfo.width = (float)(x1 - x0);
+	_glyphInfo.height = (float)(y1 - y0);
 	_glyphInfo.advance_x = bx::round(((float)advance) * scale);
 	_glyphInfo.advance_y = bx::round(((float)(ascent + descent + lineGap)) * scale);
 
+	if (0 < _padding
+	&&  0.0f < _glyphInfo.width * _glyphInfo.height)
+	{
+		_glyphInfo.offset_x -= (float)_padding;
+		_glyphInfo.offset_y -= (float)_padding;
+		_glyphInfo.width  += (float)(_padding * 2);
+		_glyphInfo.height += (float)(_padding * 2);
+	}
+}
+
+bool TrueTypeFont::bakeGlyphAlpha(CodePoint _codePoint, GlyphInfo& _glyphInfo, uint8_t* _outBuffer)
+{
+	BX_CHECK(m_font != NULL, "TrueTypeFont not initialized");
+
+	getGlyphMetrics(_codePoint, _glyphInfo);
+
+	const float scale = m_scale;
+	const int ww = int(_glyphInfo.width);
+	const int hh = int(_glyphInfo.height);
+
 	uint32_t bpp = 1;
 	uint32_t dstPitch = ww * bpp;
 
@@ -142,28 +168,11 @@ bool TrueTypeFont::bakeGlyphDistance(CodePoint _codePoint, GlyphInfo& _glyphInfo
 {
 	BX_CHECK(m_font != NULL, "TrueTypeFont not initialized");
 
-	int32_t xx;
-	int32_t yy;
-	int32_t ww;
-	int32_t hh;
-	int advance;
-	int ascent;
-	int descent;
-	int lineGap;
-	int lsb;
+	getGlyphMetrics(_codePoint, _glyphInfo);
 
-	float scale = m_scale;
-
-	stbtt_GetFontVMetrics(&m_font, &ascent, &descent, &lineGap);
-	stbtt_GetCodepointHMetrics(&m_font, _codePoint, &advance, &lsb);
-	stbtt_GetCodepointBitmap(&m_font, scale, scale, _codePoint, &ww, &hh, &xx, &yy);
-
-	_glyphInfo.offset_x = (float)xx;
-	_glyphInfo.offset_y = (float)yy;
-	_glyphInfo.width = (float)ww;
-	_glyphInfo.height = (float)hh;
-	_glyphInfo.advance_x = bx::round(((float)advance) * scale);
-	_glyphInfo.advance_y = bx::round(((float)(ascent + descent + lineGap)) * scale);
+	const float scale = m_scale;
+	const int32_t ww = int32_t(_glyphInfo.width);
+	const int32_t hh = int32_t(_glyphInfo.height);
 
 	uint32_t bpp = 1;
 	uint32_t dstPitch = ww * bpp;
@@ -210,35 +219,79 @@ struct FontManager::CachedFont
 {
 	CachedFont()
 		: trueTypeFont(NULL)
+		, numPending(0)
 	{
 		masterFontHandle.idx = bx::kInvalidHandle;
 	}
 
 	FontInfo fontInfo;
 	GlyphHashMap cachedGlyphs;
+	// placeholders for glyphs being baked asynchronously
+	GlyphHashMap pendingGlyphs;
 	TrueTypeFont* trueTypeFont;
+	uint32_t numPending;
 	// an handle to a master font in case of sub distance field font
 	FontHandle masterFontHandle;
 	int16_t padding;
 };
 
+struct FontManager::BakeRequest
+{
+	FontHandle handle;
+	CodePoint codePoint;
+	TrueTypeFont* trueTypeFont;
+	int16_t fontType;
+};
+
+struct FontManager::BakeResult
+{
+	FontHandle handle;
+	CodePoint codePoint;
+	GlyphInfo glyphInfo;
+	uint8_t* data;
+};
+
+struct FontManager::GlyphOwnerMap
+{
+	struct Owner
+	{
+		FontHandle handle;
+		CodePoint codePoint;
+	};
+
+	typedef stl::unordered_map<uint16_t, Owner> OwnerMap;
+	OwnerMap owners;
+};
+
+struct FontManager::BakeQueue
+{
+	BakeQueue()
+		: head(0)
+	{
+	}
+
+	stl::vector<BakeRequest> requests;
+	uint32_t head;
+	stl::vector<BakeResult> results;
+};
+
 #define MAX_FONT_BUFFER_SIZE (512 * 512 * 4)
 
-FontManager::FontManager(Atlas* _atlas)
+FontManager::FontManager(Atlas* _atlas, uint32_t _numBakeThreads)
 	: m_ownAtlas(false)
 	, m_atlas(_atlas)
 {
-	init();
+	init(_numBakeThreads);
 }
 
-FontManager::FontManager(uint16_t _textureSideWidth)
+FontManager::FontManager(uint16_t _textureSideWidth, uint32_t _numBakeThreads)
 	: m_ownAtlas(true)
 	, m_atlas(new Atlas(_textureSideWidth) )
 {
-	init();
+	init(_numBakeThreads);
 }
 
-void FontManager::init()
+void FontManager::init(uint32_t _numBakeThreads)
 {
 	m_cachedFiles = new CachedFile[MAX_OPENED_FILES];
 	m_cachedFonts = new CachedFont[MAX_OPENED_FONT];
@@ -254,10 +307,61 @@ void FontManager::init()
 
 	///make sure the black glyph doesn't bleed by using a one pixel inner outline
 	m_blackGlyph.regionIndex = m_atlas->addRegion(W, W, buffer, AtlasRegion::TYPE_GRAY, 1);
+
+	m_atlas->addRef(m_blackGlyph.regionIndex);
+
+	m_glyphOwners = new GlyphOwnerMap;
+	m_numRemapped = 0;
+	m_numRemapListeners = 0;
+	m_atlas->setRemapCallback(remapRegionFunc, this);
+
+	m_bakeQueue = new BakeQueue;
+	m_numBakeThreads = bx::uint32_min(_numBakeThreads, MAX_BAKE_THREADS);
+	m_numPendingGlyphs = 0;
+	m_bakeExit = false;
+
+	if (0 < m_numBakeThreads)
+	{
+		// Glyphs being baked reference transparent region until they are ready.
+		bx::memSet(buffer, 0, W * W * 4);
+		m_emptyGlyph = m_blackGlyph;
+		m_emptyGlyph.regionIndex = m_atlas->addRegion(W, W, buffer, AtlasRegion::TYPE_GRAY, 1);
+		m_atlas->addRef(m_emptyGlyph.regionIndex);
+	}
+
+	for (uint32_t ii = 0; ii < m_numBakeThreads; ++ii)
+	{
+		m_bakeBuffer[ii] = new uint8_t[MAX_FONT_BUFFER_SIZE];
+		m_bakeThread[ii].init(bakeThreadFunc, this, 0, "FontManager bake");
+	}
 }
 
 FontManager::~FontManager()
 {
+	if (0 < m_numBakeThreads)
+	{
+		{
+			bx::MutexScope lock(m_bakeMutex);
+			m_bakeExit = true;
+		}
+
+		m_bakeSem.post(m_numBakeThreads);
+
+		for (uint32_t ii = 0; ii < m_numBakeThreads; ++ii)
+		{
+			m_bakeThread[ii].shutdown();
+			delete [] m_bakeBuffer[ii];
+		}
+
+		for (uint32_t ii = 0, num = uint32_t(m_bakeQueue->results.size() ); ii < num; ++ii)
+		{
+			delete [] m_bakeQueue->results[ii].data;
+		}
+	}
+
+	delete m_bakeQueue;
+	delete m_glyphOwners;
+
 	BX_CHECK(m_fontHandles.getNumHandles() == 0, "All the fonts must be destroyed before destroying the manager");
 	delete [] m_cachedFonts;
 
@@ -270,6 +374,10 @@ FontManager::~FontManager()
 	{
 		delete m_atlas;
 	}
+	else
+	{
+		m_atlas->setRemapCallback(NULL, NULL);
+	}
 }
 
 TrueTypeHandle FontManager::createTtf(const uint8_t* _buffer, uint32_t _size)
@@ -355,6 +463,11 @@ void FontManager::destroyFont(FontHandle _handle)
 
 	CachedFont& font = m_cachedFonts[_handle.idx];
 
+	if (0 < font.numPending)
+	{
+		cancelRequests(_handle);
+	}
+
 	if (font.trueTypeFont != NULL)
 	{
 		delete font.trueTypeFont;
@@ -362,6 +475,7 @@ void FontManager::destroyFont(FontHandle _handle)
 	}
 
 	font.cachedGlyphs.clear();
+	font.pendingGlyphs.clear();
 	m_fontHandles.free(_handle.idx);
 }
 
@@ -399,6 +513,12 @@ bool FontManager::preloadGlyph(FontHandle _handle, CodePoint _codePoint)
 		return true;
 	}
 
+	if (NULL != font.trueTypeFont
+	&&  0 < m_numBakeThreads)
+	{
+		return requestGlyph(_handle, _codePoint);
+	}
+
 	if (NULL != font.trueTypeFont)
 	{
 		GlyphInfo glyphInfo;
@@ -433,13 +553,15 @@ bool FontManager::preloadGlyph(FontHandle _handle, CodePoint _codePoint)
 		glyphInfo.height = (glyphInfo.height * fontInfo.scale);
 		glyphInfo.width = (glyphInfo.width * fontInfo.scale);
 
-		font.cachedGlyphs[_codePoint] = glyphInfo;
+		addGlyph(_handle, _codePoint, glyphInfo);
 		return true;
 	}
 
 	if (isValid(font.masterFontHandle)
 	&&  preloadGlyph(font.masterFontHandle, _codePoint) )
 	{
+		const GlyphHashMap& masterGlyphs = m_cachedFonts[font.masterFontHandle.idx].cachedGlyphs;
+		const bool ready = masterGlyphs.find(_codePoint) != masterGlyphs.end();
 		const GlyphInfo* glyph = getGlyphInfo(font.masterFontHandle, _codePoint);
 
 		GlyphInfo glyphInfo = *glyph;
@@ -450,13 +572,325 @@ bool FontManager::preloadGlyph(FontHandle _handle, CodePoint _codePoint)
 		glyphInfo.height = (glyphInfo.height * fontInfo.scale);
 		glyphInfo.width = (glyphInfo.width * fontInfo.scale);
 
-		font.cachedGlyphs[_codePoint] = glyphInfo;
+		if (ready)
+		{
+			font.cachedGlyphs[_codePoint] = glyphInfo;
+
+			GlyphHashMap::iterator pending = font.pendingGlyphs.find(_codePoint);
+			if (pending != font.pendingGlyphs.end() )
+			{
+				font.pendingGlyphs.erase(pending);
+			}
+		}
+		else
+		{
+			// master glyph is still being baked, keep scaled placeholder
+			font.pendingGlyphs[_codePoint] = glyphInfo;
+		}
+
 		return true;
 	}
 
 	return false;
 }
 
+bool FontManager::requestGlyph(FontHandle _handle, CodePoint _codePoint)
+{
+	CachedFont& font = m_cachedFonts[_handle.idx];
+
+	if (font.pendingGlyphs.find(_codePoint) != font.pendingGlyphs.end() )
+	{
+		return true;
+	}
+
+	// Metrics are cheap to compute, layout uses final metrics right away and
+	// only the atlas region is replaced once the glyph is baked.
+	GlyphInfo glyphInfo;
+	font.trueTypeFont->getGlyphMetrics(_codePoint
+		, glyphInfo
+		, FONT_TYPE_ALPHA == font.fontInfo.fontType ? 0 : 6
+		);
+
+	const FontInfo& fontInfo = font.fontInfo;
+	glyphInfo.advance_x = (glyphInfo.advance_x * fontInfo.scale);
+	glyphInfo.advance_y = (glyphInfo.advance_y * fontInfo.scale);
+	glyphInfo.offset_x = (glyphInfo.offset_x * fontInfo.scale);
+	glyphInfo.offset_y = (glyphInfo.offset_y * fontInfo.scale);
+	glyphInfo.height = (glyphInfo.height * fontInfo.scale);
+	glyphInfo.width = (glyphInfo.width * fontInfo.scale);
+	glyphInfo.regionIndex = m_emptyGlyph.regionIndex;
+	font.pendingGlyphs[_codePoint] = glyphInfo;
+
+	BakeRequest request;
+	request.handle = _handle;
+	request.codePoint = _codePoint;
+	request.trueTypeFont = font.trueTypeFont;
+	request.fontType = font.fontInfo.fontType;
+
+	{
+		bx::MutexScope lock(m_bakeMutex);
+		m_bakeQueue->requests.push_back(request);
+	}
+
+	++font.numPending;
+	++m_numPendingGlyphs;
+	m_bakeSem.post();
+
+	return true;
+}
+
+void FontManager::cancelRequests(FontHandle _handle)
+{
+	CachedFont& font = m_cachedFonts[_handle.idx];
+
+	{
+		bx::MutexScope lock(m_bakeMutex);
+
+		stl::vector<BakeRequest>& requests = m_bakeQueue->requests;
+		for (uint32_t ii = m_bakeQueue->head; ii < uint32_t(requests.size() ); )
+		{
+			if (requests[ii].handle.idx == _handle.idx)
+			{
+				requests.erase(requests.begin() + ii);
+				--font.numPending;
+				--m_numPendingGlyphs;
+			}
+			else
+			{
+				++ii;
+			}
+		}
+	}
+
+	// Wait for glyphs of this font that are already being baked, font data
+	// must stay valid until worker threads are done with it.
+	while (0 < font.numPending)
+	{
+		update();
+		bx::yield();
+	}
+}
+
+int32_t FontManager::bakeThreadFunc(bx::Thread* _thread, void* _userData)
+{
+	return static_cast<FontManager*>(_userData)->bakeThread(_thread);
+}
+
+int32_t FontManager::bakeThread(bx::Thread* _thread)
+{
+	uint8_t* buffer = m_bakeBuffer[_thread - m_bakeThread];
+
+	for (;;)
+	{
+		m_bakeSem.wait();
+
+		BakeRequest request;
+
+		{
+			bx::MutexScope lock(m_bakeMutex);
+
+			if (m_bakeExit)
+			{
+				break;
+			}
+
+			BakeQueue& queue = *m_bakeQueue;
+			if (queue.head == queue.requests.size() )
+			{
+				// request was cancelled
+				continue;
+			}
+
+			request = queue.requests[queue.head++];
+
+			if (queue.head == queue.requests.size() )
+			{
+				queue.requests.clear();
+				queue.head = 0;
+			}
+		}
+
+		BakeResult result;
+		result.handle = request.handle;
+		result.codePoint = request.codePoint;
+
+		switch (request.fontType)
+		{
+		case FONT_TYPE_ALPHA:
+			request.trueTypeFont->bakeGlyphAlpha(request.codePoint, result.glyphInfo, buffer);
+			break;
+
+		case FONT_TYPE_DISTANCE:
+		case FONT_TYPE_DISTANCE_SUBPIXEL:
+			request.trueTypeFont->bakeGlyphDistance(request.codePoint, result.glyphInfo, buffer);
+			break;
+
+		default:
+			BX_CHECK(false, "TextureType not supported yet");
+		}
+
+		const uint32_t size = uint32_t(result.glyphInfo.width * result.glyphInfo.height);
+		result.data = new uint8_t[size > 0 ? size : 1];
+		bx::memCopy(result.data, buffer, size);
+
+		bx::MutexScope lock(m_bakeMutex);
+		m_bakeQueue->results.push_back(result);
+	}
+
+	return bx::kExitSuccess;
+}
+
+uint32_t FontManager::update()
+{
+	if (m_ownAtlas)
+	{
+		m_atlas->update();
+	}
+
+	stl::vector<BakeResult> results;
+
+	if (0 < m_numBakeThreads)
+	{
+		bx::MutexScope lock(m_bakeMutex);
+		results.swap(m_bakeQueue->results);
+	}
+
+	const uint32_t numRemapped = m_numRemapped;
+	m_numRemapped = 0;
+
+	if (results.empty() )
+	{
+		return numRemapped;
+	}
+
+	m_atlas->beginBatch();
+
+	for (uint32_t ii = 0, num = uint32_t(results.size() ); ii < num; ++ii)
+	{
+		BakeResult& result = results[ii];
+		CachedFont& font = m_cachedFonts[result.handle.idx];
+		const FontInfo& fontInfo = font.fontInfo;
+
+		GlyphInfo& glyphInfo = result.glyphInfo;
+		if (addBitmap(glyphInfo, result.data) )
+		{
+			glyphInfo.advance_x = (glyphInfo.advance_x * fontInfo.scale);
+			glyphInfo.advance_y = (glyphInfo.advance_y * fontInfo.scale);
+			glyphInfo.offset_x = (glyphInfo.offset_x * fontInfo.scale);
+			glyphInfo.offset_y = (glyphInfo.offset_y * fontInfo.scale);
+			glyphInfo.height = (glyphInfo.height * fontInfo.scale);
+			glyphInfo.width = (glyphInfo.width * fontInfo.scale);
+
+			addGlyph(result.handle, result.codePoint, glyphInfo);
+		}
+
+		GlyphHashMap::iterator pending = font.pendingGlyphs.find(result.codePoint);
+		if (pending != font.pendingGlyphs.end() )
+		{
+			font.pendingGlyphs.erase(pending);
+		}
+
+		--font.numPending;
+		--m_numPendingGlyphs;
+
+		delete [] result.data;
+	}
+
+	m_atlas->endBatch();
+
+	return uint32_t(results.size() ) + numRemapped;
+}
+
+void FontManager::addGlyph(FontHandle _handle, CodePoint _codePoint, const GlyphInfo& _glyphInfo)
+{
+	m_cachedFonts[_handle.idx].cachedGlyphs[_codePoint] = _glyphInfo;
+
+	GlyphOwnerMap::Owner owner = { _handle, _codePoint };
+	m_glyphOwners->owners[_glyphInfo.regionIndex] = owner;
+}
+
+void FontManager::addRef(uint16_t _regionIndex)
+{
+	m_atlas->addRef(_regionIndex);
+}
+
+void FontManager::release(uint16_t _regionIndex)
+{
+	m_atlas->release(_regionIndex);
+}
+
+void FontManager::addRemapListener(GlyphRemapFn _fn, void* _userData)
+{
+	BX_CHECK(m_numRemapListeners < MAX_REMAP_LISTENERS, "Too many remap listeners.");
+	RemapListener& listener = m_remapListeners[m_numRemapListeners++];
+	listener.fn = _fn;
+	listener.userData = _userData;
+}
+
+void FontManager::removeRemapListener(GlyphRemapFn _fn, void* _userData)
+{
+	for (uint32_t ii = 0; ii < m_numRemapListeners; ++ii)
+	{
+		const RemapListener& listener = m_remapListeners[ii];
+		if (listener.fn == _fn
+		&&  listener.userData == _userData)
+		{
+			m_remapListeners[ii] = m_remapListeners[--m_numRemapListeners];
+			return;
+		}
+	}
+}
+
+void FontManager::remapRegionFunc(uint16_t _regionHandle, bool _evicted, void* _userData)
+{
+	static_cast<FontManager*>(_userData)->remapRegion(_regionHandle, _evicted);
+}
+
+void FontManager::remapRegion(uint16_t _regionHandle, bool _evicted)
+{
+	// Region UVs are packed when text is generated, any change requires
+	// text to be regenerated, or its UVs to be packed again by listeners.
+	++m_numRemapped;
+
+	for (uint32_t ii = 0; ii < m_numRemapListeners; ++ii)
+	{
+		const RemapListener& listener = m_remapListeners[ii];
+		listener.fn(_regionHandle, _evicted, listener.userData);
+	}
+
+	if (!_evicted)
+	{
+		return;
+	}
+
+	GlyphOwnerMap::OwnerMap::iterator it = m_glyphOwners->owners.find(_regionHandle);
+	if (it == m_glyphOwners->owners.end() )
+	{
+		return;
+	}
+
+	const GlyphOwnerMap::Owner owner = it->second;
+	m_glyphOwners->owners.erase(it);
+
+	// Scaled fonts share atlas regions with their master font.
+	for (uint16_t ii = 0, num = m_fontHandles.getNumHandles(); ii < num; ++ii)
+	{
+		const uint16_t idx = m_fontHandles.getHandleAt(ii);
+		CachedFont& font = m_cachedFonts[idx];
+
+		if (idx == owner.handle.idx
+		||  font.masterFontHandle.idx == owner.handle.idx)
+		{
+			GlyphHashMap::iterator glyph = font.cachedGlyphs.find(owner.codePoint);
+			if (glyph != font.cachedGlyphs.end()
+			&&  glyph->second.regionIndex == _regionHandle)
+			{
+				font.cachedGlyphs.erase(glyph);
+			}
+		}
+	}
+}
+
 const FontInfo& FontManager::getFontInfo(FontHandle _handle) const
 {
 	BX_CHECK(bgfx::isValid(_handle), "Invalid handle used");
@@ -476,9 +910,18 @@ const GlyphInfo* FontManager::getGlyphInfo(FontHandle _handle, CodePoint _codePo
 		}
 
 		it = cachedGlyphs.find(_codePoint);
+
+		if (it == cachedGlyphs.end() )
+		{
+			const GlyphHashMap& pendingGlyphs = m_cachedFonts[_handle.idx].pendingGlyphs;
+			GlyphHashMap::const_iterator pending = pendingGlyphs.find(_codePoint);
+			BX_CHECK(pending != pendingGlyphs.end(), "Failed to preload glyph.");
+			return &pending->second;
+		}
 	}
 
 	BX_CHECK(it != cachedGlyphs.end(), "Failed to preload glyph.");
+	m_atlas->touch(it->second.regionIndex);
 	return &it->second;
 }
 
@@ -490,5 +933,5 @@ bool FontManager::addBitmap(GlyphInfo& _glyphInfo, const uint8_t* _data)
 		, _data
 		, AtlasRegion::TYPE_GRAY
 		);
-	return true;
+	return UINT16_MAX != _glyphInfo.regionIndex;
 }
@@ -7,13 +7,18 @@
 #define FONT_MANAGER_H_HEADER_GUARD
 
 #include <bx/handlealloc.h>
+#include <bx/mutex.h>
+#include <bx/semaphore.h>
 #include <bx/string.h>
+#include <bx/thread.h>
 #include <bgfx/bgfx.h>
 
 class Atlas;
 
 #define MAX_OPENED_FILES 64
 #define MAX_OPENED_FONT  64
+#define MAX_BAKE_THREADS 8
+#define MAX_REMAP_LISTENERS 8
 
 #define FONT_TYPE_ALPHA             UINT32_C(0x00000100) // L8
 // #define FONT_TYPE_LCD               UINT32_C(0x00000200) // BGRA8
@@ -117,16 +122,24 @@ struct GlyphInfo
 BGFX_HANDLE(TrueTypeHandle);
 BGFX_HANDLE(FontHandle);
 
+/// Called when glyph atlas region is moved by defragmentation, and UVs packed for it must
+/// be updated, or when region is evicted and glyph is dropped from its font.
+typedef void (*GlyphRemapFn)(uint16_t _regionIndex, bool _evicted, void* _userData);
+
 class FontManager
 {
 public:
 	/// Create the font manager using an external cube atlas (doesn't take
-	/// ownership of the atlas).
-	FontManager(Atlas* _atlas);
+	/// ownership of the atlas). Font manager installs atlas remap callback
+	/// to drop glyphs evicted from the atlas.
+	///
+	/// @param _numBakeThreads When non-zero, glyphs of TrueType fonts are
+	///   baked asynchronously on that many worker threads, see `update`.
+	FontManager(Atlas* _atlas, uint32_t _numBakeThreads = 0);
 
 	/// Create the font manager and create the texture cube as BGRA8 with
 	/// linear filtering.
-	FontManager(uint16_t _textureSideWidth = 512);
+	FontManager(uint16_t _textureSideWidth = 512, uint32_t _numBakeThreads = 0);
 
 	~FontManager();
 
@@ -158,11 +171,28 @@ public:
 	///
 	/// @return True if every glyph could be preloaded, false otherwise if
 	///   the Font is a baked font, this only do validation on the characters.
+	///
+	/// @remark With asynchronous baking glyphs are only queued, and become
+	///   available after `update`.
 	bool preloadGlyph(FontHandle _handle, const wchar_t* _string);
 
 	/// Preload a single glyph, return true on success.
 	bool preloadGlyph(FontHandle _handle, CodePoint _character);
 
+	/// Add glyphs baked on worker threads to the atlas, with one texture
+	/// update per atlas face, and advance atlas LRU and defragmentation
+	/// when the atlas is owned by the font manager. Call once per frame.
+	///
+	/// @return Number of glyphs that became ready, were moved or evicted
+	///   from the atlas. Text should be regenerated when non-zero.
+	uint32_t update();
+
+	/// Return number of glyphs queued or being baked on worker threads.
+	uint32_t getNumPendingGlyphs() const
+	{
+		return m_numPendingGlyphs;
+	}
+
 	/// Return the font descriptor of a font.
 	///
 	/// @remark the handle is required to be valid
@@ -171,6 +201,8 @@ public:
 	/// Return the rendering informations about the glyph region. Load the
 	/// glyph from a TrueType font if possible
 	///
+	/// @remark With asynchronous baking, glyph that is not baked yet has
+	///   final metrics, but references empty atlas region.
 	const GlyphInfo* getGlyphInfo(FontHandle _handle, CodePoint _codePoint);
 
 	const GlyphInfo& getBlackGlyph() const
@@ -178,6 +210,21 @@ public:
 		return m_blackGlyph;
 	}
 
+	/// Reference glyph atlas region, so that it is never evicted while text
+	/// using it exists. Region can still be moved, see `addRemapListener`.
+	void addRef(uint16_t _regionIndex);
+
+	/// Release glyph atlas region referenced with `addRef`.
+	void release(uint16_t _regionIndex);
+
+	/// Register callback notified about moved and evicted glyph regions.
+	/// Font manager owns atlas remap callback and forwards it to every
+	/// registered listener.
+	void addRemapListener(GlyphRemapFn _fn, void* _userData);
+
+	/// Unregister callback registered with `addRemapListener`.
+	void removeRemapListener(GlyphRemapFn _fn, void* _userData);
+
 private:
 	struct CachedFont;
 	struct CachedFile
@@ -186,8 +233,20 @@ private:
 		uint32_t bufferSize;
 	};
 
-	void init();
+	struct BakeRequest;
+	struct BakeResult;
+	struct BakeQueue;
+	struct GlyphOwnerMap;
+
+	void init(uint32_t _numBakeThreads);
 	bool addBitmap(GlyphInfo& _glyphInfo, const uint8_t* _data);
+	bool requestGlyph(FontHandle _handle, CodePoint _codePoint);
+	void cancelRequests(FontHandle _handle);
+	int32_t bakeThread(bx::Thread* _thread);
+	static int32_t bakeThreadFunc(bx::Thread* _thread, void* _userData);
+	void addGlyph(FontHandle _handle, CodePoint _codePoint, const GlyphInfo& _glyphInfo);
+	void remapRegion(uint16_t _regionHandle, bool _evicted);
+	static void remapRegionFunc(uint16_t _regionHandle, bool _evicted, void* _userData);
 
 	bool m_ownAtlas;
 	Atlas* m_atlas;
@@ -199,9 +258,30 @@ private:
 	CachedFile* m_cachedFiles;
 
 	GlyphInfo m_blackGlyph;
+	GlyphInfo m_emptyGlyph;
+
+	struct RemapListener
+	{
+		GlyphRemapFn fn;
+		void* userData;
+	};
+
+	RemapListener m_remapListeners[MAX_REMAP_LISTENERS];
+	uint32_t m_numRemapListeners;
 
 	//temporary buffer to raster glyph
 	uint8_t* m_buffer;
+
+	bx::Thread    m_bakeThread[MAX_BAKE_THREADS];
+	uint8_t*      m_bakeBuffer[MAX_BAKE_THREADS];
+	bx::Mutex     m_bakeMutex;
+	bx::Semaphore m_bakeSem;
+	BakeQueue*    m_bakeQueue;
+	GlyphOwnerMap* m_glyphOwners;
+	uint32_t      m_numRemapped;
+	uint32_t      m_numBakeThreads;
+	uint32_t      m_numPendingGlyphs;
+	bool          m_bakeExit;
 };
 
 #endif // FONT_MANAGER_H_HEADER_GUARD
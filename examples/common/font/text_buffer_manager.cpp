@@ -21,6 +21,7 @@
 #include "fs_font_distance_field.bin.h"
 #include "vs_font_distance_field_subpixel.bin.h"
 #include "fs_font_distance_field_subpixel.bin.h"
+#include "vs_font_instanced.bin.h"
 
 static const bgfx::EmbeddedShader s_embeddedShaders[] =
 {
@@ -30,11 +31,14 @@ static const bgfx::EmbeddedShader s_embeddedShaders[] =
 	BGFX_EMBEDDED_SHADER(fs_font_distance_field),
 	BGFX_EMBEDDED_SHADER(vs_font_distance_field_subpixel),
 	BGFX_EMBEDDED_SHADER(fs_font_distance_field_subpixel),
+	BGFX_EMBEDDED_SHADER(vs_font_instanced),
 
 	BGFX_EMBEDDED_SHADER_END()
 };
 
 #define MAX_BUFFERED_CHARACTERS (8192 - 5)
+#define MAX_DIRTY_RUNS 8
+#define GLYPH_INSTANCE_SIZE uint32_t(16 * sizeof(float) )
 
 class TextBuffer
 {
@@ -95,6 +99,16 @@ public:
 	/// Clear the text buffer and reset its state (pen/color)
 	void clearTextBuffer();
 
+	/// Remember pen and line state to be restored by rewind.
+	void mark();
+
+	/// Remove text appended after the mark, and restore its state.
+	void rewind();
+
+	/// Pack UVs of all quads again after glyph regions were moved in the
+	/// atlas. Return true if any quad changed.
+	bool repackUV();
+
 	/// Get pointer to the vertex buffer to submit it to the graphic card.
 	const uint8_t* getVertexBuffer()
 	{
@@ -113,24 +127,48 @@ public:
 		return sizeof(TextVertex);
 	}
 
-	/// get a pointer to the index buffer to submit it to the graphic
-	const uint16_t* getIndexBuffer() const
+	/// Number of index needed to draw the vertex buffer as quads.
+	uint32_t getIndexCount() const
 	{
-		return m_indexBuffer;
+		return m_vertexCount/4*6;
 	}
 
-	/// number of index in the index buffer
-	uint32_t getIndexCount() const
+	/// Number of disjoint vertex runs modified since the last call to
+	/// setSynced, sorted by first vertex.
+	uint32_t getNumDirtyRuns() const
+	{
+		return m_numDirtyRuns;
+	}
+
+	/// First vertex of dirty run.
+	uint32_t getDirtyBegin(uint32_t _idx) const
+	{
+		return m_dirtyRuns[_idx].begin;
+	}
+
+	/// One past the last vertex of dirty run.
+	uint32_t getDirtyEnd(uint32_t _idx) const
+	{
+		return m_dirtyRuns[_idx].end;
+	}
+
+	/// Number of leading vertices whose content matches the one uploaded
+	/// to the graphic card.
+	uint32_t getSyncedCount() const
 	{
-		return m_indexCount;
+		return m_syncedCount;
 	}
 
-	/// Size in bytes of an index.
-	uint32_t getIndexSize() const
+	/// Mark the first _num vertices as uploaded, and reset dirty runs.
+	void setSynced(uint32_t _num)
 	{
-		return sizeof(uint16_t);
+		m_syncedCount  = _num;
+		m_numDirtyRuns = 0;
 	}
 
+	/// Write one glyph instance per quad of vertices [_begin, _end).
+	void packInstances(float* _dst, uint32_t _begin, uint32_t _end) const;
+
 	uint32_t getTextColor() const
 	{
 		return toABGR(m_textColor);
@@ -178,14 +216,6 @@ private:
 	TextRectangle m_rectangle;
 	FontManager* m_fontManager;
 
-	void setVertex(uint32_t _i, float _x, float _y, uint32_t _rgba, uint8_t _style = STYLE_NORMAL)
-	{
-		m_vertexBuffer[_i].x = _x;
-		m_vertexBuffer[_i].y = _y;
-		m_vertexBuffer[_i].rgba = _rgba;
-		m_styleBuffer[_i] = _style;
-	}
-
 	struct TextVertex
 	{
 		float x, y;
@@ -193,13 +223,51 @@ private:
 		uint32_t rgba;
 	};
 
+	static void setQuad(TextVertex* _quad, float _x0, float _y0, float _x1, float _y1, uint32_t _rgba)
+	{
+		_quad[0].x = _x0; _quad[0].y = _y0; _quad[0].rgba = _rgba;
+		_quad[1].x = _x0; _quad[1].y = _y1; _quad[1].rgba = _rgba;
+		_quad[2].x = _x1; _quad[2].y = _y1; _quad[2].rgba = _rgba;
+		_quad[3].x = _x1; _quad[3].y = _y0; _quad[3].rgba = _rgba;
+	}
+
+	void appendQuad(const TextVertex* _quad, uint8_t _style, uint16_t _regionIndex);
+	void releaseRegions(uint32_t _begin);
+	void markDirty(uint32_t _begin, uint32_t _end);
+
 	TextVertex* m_vertexBuffer;
-	uint16_t* m_indexBuffer;
 	uint8_t* m_styleBuffer;
+	uint16_t* m_regionBuffer;
 
-	uint32_t m_indexCount;
 	uint32_t m_lineStartIndex;
 	uint16_t m_vertexCount;
+
+	struct DirtyRun
+	{
+		uint32_t begin;
+		uint32_t end;
+	};
+
+	// One extra run, which is merged right after it's added.
+	DirtyRun m_dirtyRuns[MAX_DIRTY_RUNS + 1];
+	uint32_t m_numDirtyRuns;
+	uint32_t m_syncedCount;
+
+	struct Mark
+	{
+		float penX;
+		float penY;
+		float originX;
+		float originY;
+		float lineAscender;
+		float lineDescender;
+		float lineGap;
+		TextRectangle rectangle;
+		uint32_t lineStartIndex;
+		uint16_t vertexCount;
+	};
+
+	Mark m_mark;
 };
 
 TextBuffer::TextBuffer(FontManager* _fontManager)
@@ -218,21 +286,26 @@ TextBuffer::TextBuffer(FontManager* _fontManager)
 	, m_lineGap(0)
 	, m_fontManager(_fontManager)
 	, m_vertexBuffer(new TextVertex[MAX_BUFFERED_CHARACTERS * 4])
-	, m_indexBuffer(new uint16_t[MAX_BUFFERED_CHARACTERS * 6])
-	, m_styleBuffer(new uint8_t[MAX_BUFFERED_CHARACTERS * 4])
-	, m_indexCount(0)
+	, m_styleBuffer(new uint8_t[MAX_BUFFERED_CHARACTERS])
+	, m_regionBuffer(new uint16_t[MAX_BUFFERED_CHARACTERS])
 	, m_lineStartIndex(0)
 	, m_vertexCount(0)
+	, m_numDirtyRuns(0)
+	, m_syncedCount(0)
 {
 	m_rectangle.width = 0;
 	m_rectangle.height = 0;
+
+	bx::memSet(&m_mark, 0, sizeof(m_mark) );
 }
 
 TextBuffer::~TextBuffer()
 {
+	releaseRegions(0);
+
 	delete [] m_vertexBuffer;
-	delete [] m_indexBuffer;
 	delete [] m_styleBuffer;
+	delete [] m_regionBuffer;
 }
 
 void TextBuffer::appendText(FontHandle _fontHandle, const char* _string, const char* _end)
@@ -302,42 +375,52 @@ void TextBuffer::appendAtlasFace(uint16_t _faceIndex)
 	float x1 = x0 + (float)m_fontManager->getAtlas()->getTextureSize();
 	float y1 = y0 + (float)m_fontManager->getAtlas()->getTextureSize();
 
+	TextVertex quad[4];
 	m_fontManager->getAtlas()->packFaceLayerUV(_faceIndex
-		, (uint8_t*)m_vertexBuffer
-		, sizeof(TextVertex) * m_vertexCount + offsetof(TextVertex, u)
+		, (uint8_t*)quad
+		, offsetof(TextVertex, u)
 		, sizeof(TextVertex)
 		);
 
-	setVertex(m_vertexCount + 0, x0, y0, m_backgroundColor);
-	setVertex(m_vertexCount + 1, x0, y1, m_backgroundColor);
-	setVertex(m_vertexCount + 2, x1, y1, m_backgroundColor);
-	setVertex(m_vertexCount + 3, x1, y0, m_backgroundColor);
-
-	m_indexBuffer[m_indexCount + 0] = m_vertexCount + 0;
-	m_indexBuffer[m_indexCount + 1] = m_vertexCount + 1;
-	m_indexBuffer[m_indexCount + 2] = m_vertexCount + 2;
-	m_indexBuffer[m_indexCount + 3] = m_vertexCount + 0;
-	m_indexBuffer[m_indexCount + 4] = m_vertexCount + 2;
-	m_indexBuffer[m_indexCount + 5] = m_vertexCount + 3;
-	m_vertexCount += 4;
-	m_indexCount += 6;
+	setQuad(quad, x0, y0, x1, y1, m_backgroundColor);
+	appendQuad(quad, STYLE_NORMAL, UINT16_MAX);
 }
 
 void TextBuffer::clearTextBuffer()
 {
-	m_penX = 0;
-	m_penY = 0;
-	m_originX = 0;
-	m_originY = 0;
-
-	m_vertexCount = 0;
-	m_indexCount = 0;
-	m_lineStartIndex = 0;
-	m_lineAscender = 0;
-	m_lineDescender = 0;
-	m_lineGap = 0;
-	m_rectangle.width = 0;
-	m_rectangle.height = 0;
+	bx::memSet(&m_mark, 0, sizeof(m_mark) );
+	rewind();
+}
+
+void TextBuffer::mark()
+{
+	m_mark.penX = m_penX;
+	m_mark.penY = m_penY;
+	m_mark.originX = m_originX;
+	m_mark.originY = m_originY;
+	m_mark.lineAscender = m_lineAscender;
+	m_mark.lineDescender = m_lineDescender;
+	m_mark.lineGap = m_lineGap;
+	m_mark.rectangle = m_rectangle;
+	m_mark.lineStartIndex = m_lineStartIndex;
+	m_mark.vertexCount = m_vertexCount;
+}
+
+void TextBuffer::rewind()
+{
+	releaseRegions(m_mark.vertexCount);
+
+	m_penX = m_mark.penX;
+	m_penY = m_mark.penY;
+	m_originX = m_mark.originX;
+	m_originY = m_mark.originY;
+
+	m_vertexCount = m_mark.vertexCount;
+	m_lineStartIndex = m_mark.lineStartIndex;
+	m_lineAscender = m_mark.lineAscender;
+	m_lineDescender = m_mark.lineDescender;
+	m_lineGap = m_mark.lineGap;
+	m_rectangle = m_mark.rectangle;
 }
 
 void TextBuffer::appendGlyph(FontHandle _handle, CodePoint _codePoint)
@@ -406,26 +489,15 @@ void TextBuffer::appendGlyph(FontHandle _handle, CodePoint _codePoint)
 		float x1 = ( (float)x0 + (glyph->advance_x) );
 		float y1 = (m_penY + m_lineAscender - m_lineDescender + m_lineGap);
 
+		TextVertex quad[4];
 		atlas->packUV(blackGlyph.regionIndex
-			, (uint8_t*)m_vertexBuffer
-			, sizeof(TextVertex) * m_vertexCount + offsetof(TextVertex, u)
+			, (uint8_t*)quad
+			, offsetof(TextVertex, u)
 			, sizeof(TextVertex)
 			);
 
-		const uint16_t vertexCount = m_vertexCount;
-		setVertex(vertexCount + 0, x0, y0, m_backgroundColor, STYLE_BACKGROUND);
-		setVertex(vertexCount + 1, x0, y1, m_backgroundColor, STYLE_BACKGROUND);
-		setVertex(vertexCount + 2, x1, y1, m_backgroundColor, STYLE_BACKGROUND);
-		setVertex(vertexCount + 3, x1, y0, m_backgroundColor, STYLE_BACKGROUND);
-
-		m_indexBuffer[m_indexCount + 0] = vertexCount + 0;
-		m_indexBuffer[m_indexCount + 1] = vertexCount + 1;
-		m_indexBuffer[m_indexCount + 2] = vertexCount + 2;
-		m_indexBuffer[m_indexCount + 3] = vertexCount + 0;
-		m_indexBuffer[m_indexCount + 4] = vertexCount + 2;
-		m_indexBuffer[m_indexCount + 5] = vertexCount + 3;
-		m_vertexCount += 4;
-		m_indexCount += 6;
+		setQuad(quad, x0, y0, x1, y1, m_backgroundColor);
+		appendQuad(quad, STYLE_BACKGROUND, blackGlyph.regionIndex);
 	}
 
 	if (m_styleFlags & STYLE_UNDERLINE
@@ -436,25 +508,15 @@ void TextBuffer::appendGlyph(FontHandle _handle, CodePoint _codePoint)
 		float x1 = ( (float)x0 + (glyph->advance_x) );
 		float y1 = y0 + font.underlineThickness;
 
+		TextVertex quad[4];
 		atlas->packUV(blackGlyph.regionIndex
-			, (uint8_t*)m_vertexBuffer
-			, sizeof(TextVertex) * m_vertexCount + offsetof(TextVertex, u)
+			, (uint8_t*)quad
+			, offsetof(TextVertex, u)
 			, sizeof(TextVertex)
 			);
 
-		setVertex(m_vertexCount + 0, x0, y0, m_underlineColor, STYLE_UNDERLINE);
-		setVertex(m_vertexCount + 1, x0, y1, m_underlineColor, STYLE_UNDERLINE);
-		setVertex(m_vertexCount + 2, x1, y1, m_underlineColor, STYLE_UNDERLINE);
-		setVertex(m_vertexCount + 3, x1, y0, m_underlineColor, STYLE_UNDERLINE);
-
-		m_indexBuffer[m_indexCount + 0] = m_vertexCount + 0;
-		m_indexBuffer[m_indexCount + 1] = m_vertexCount + 1;
-		m_indexBuffer[m_indexCount + 2] = m_vertexCount + 2;
-		m_indexBuffer[m_indexCount + 3] = m_vertexCount + 0;
-		m_indexBuffer[m_indexCount + 4] = m_vertexCount + 2;
-		m_indexBuffer[m_indexCount + 5] = m_vertexCount + 3;
-		m_vertexCount += 4;
-		m_indexCount += 6;
+		setQuad(quad, x0, y0, x1, y1, m_underlineColor);
+		appendQuad(quad, STYLE_UNDERLINE, blackGlyph.regionIndex);
 	}
 
 	if (m_styleFlags & STYLE_OVERLINE
@@ -465,25 +527,15 @@ void TextBuffer::appendGlyph(FontHandle _handle, CodePoint _codePoint)
 		float x1 = ( (float)x0 + (glyph->advance_x) );
 		float y1 = y0 + font.underlineThickness;
 
-		m_fontManager->getAtlas()->packUV(blackGlyph.regionIndex
-			, (uint8_t*)m_vertexBuffer
-			, sizeof(TextVertex) * m_vertexCount + offsetof(TextVertex, u)
+		TextVertex quad[4];
+		atlas->packUV(blackGlyph.regionIndex
+			, (uint8_t*)quad
+			, offsetof(TextVertex, u)
 			, sizeof(TextVertex)
 			);
 
-		setVertex(m_vertexCount + 0, x0, y0, m_overlineColor, STYLE_OVERLINE);
-		setVertex(m_vertexCount + 1, x0, y1, m_overlineColor, STYLE_OVERLINE);
-		setVertex(m_vertexCount + 2, x1, y1, m_overlineColor, STYLE_OVERLINE);
-		setVertex(m_vertexCount + 3, x1, y0, m_overlineColor, STYLE_OVERLINE);
-
-		m_indexBuffer[m_indexCount + 0] = m_vertexCount + 0;
-		m_indexBuffer[m_indexCount + 1] = m_vertexCount + 1;
-		m_indexBuffer[m_indexCount + 2] = m_vertexCount + 2;
-		m_indexBuffer[m_indexCount + 3] = m_vertexCount + 0;
-		m_indexBuffer[m_indexCount + 4] = m_vertexCount + 2;
-		m_indexBuffer[m_indexCount + 5] = m_vertexCount + 3;
-		m_vertexCount += 4;
-		m_indexCount += 6;
+		setQuad(quad, x0, y0, x1, y1, m_overlineColor);
+		appendQuad(quad, STYLE_OVERLINE, blackGlyph.regionIndex);
 	}
 
 	if (m_styleFlags & STYLE_STRIKE_THROUGH
@@ -494,25 +546,15 @@ void TextBuffer::appendGlyph(FontHandle _handle, CodePoint _codePoint)
 		float x1 = ( (float)x0 + (glyph->advance_x) );
 		float y1 = y0 + font.underlineThickness;
 
+		TextVertex quad[4];
 		atlas->packUV(blackGlyph.regionIndex
-			, (uint8_t*)m_vertexBuffer
-			, sizeof(TextVertex) * m_vertexCount + offsetof(TextVertex, u)
+			, (uint8_t*)quad
+			, offsetof(TextVertex, u)
 			, sizeof(TextVertex)
 			);
 
-		setVertex(m_vertexCount + 0, x0, y0, m_strikeThroughColor, STYLE_STRIKE_THROUGH);
-		setVertex(m_vertexCount + 1, x0, y1, m_strikeThroughColor, STYLE_STRIKE_THROUGH);
-		setVertex(m_vertexCount + 2, x1, y1, m_strikeThroughColor, STYLE_STRIKE_THROUGH);
-		setVertex(m_vertexCount + 3, x1, y0, m_strikeThroughColor, STYLE_STRIKE_THROUGH);
-
-		m_indexBuffer[m_indexCount + 0] = m_vertexCount + 0;
-		m_indexBuffer[m_indexCount + 1] = m_vertexCount + 1;
-		m_indexBuffer[m_indexCount + 2] = m_vertexCount + 2;
-		m_indexBuffer[m_indexCount + 3] = m_vertexCount + 0;
-		m_indexBuffer[m_indexCount + 4] = m_vertexCount + 2;
-		m_indexBuffer[m_indexCount + 5] = m_vertexCount + 3;
-		m_vertexCount += 4;
-		m_indexCount += 6;
+		setQuad(quad, x0, y0, x1, y1, m_strikeThroughColor);
+		appendQuad(quad, STYLE_STRIKE_THROUGH, blackGlyph.regionIndex);
 	}
 
 	float x0 = m_penX + (glyph->offset_x);
@@ -520,25 +562,15 @@ void TextBuffer::appendGlyph(FontHandle _handle, CodePoint _codePoint)
 	float x1 = (x0 + glyph->width);
 	float y1 = (y0 + glyph->height);
 
+	TextVertex quad[4];
 	atlas->packUV(glyph->regionIndex
-		, (uint8_t*)m_vertexBuffer
-		, sizeof(TextVertex) * m_vertexCount + offsetof(TextVertex, u)
+		, (uint8_t*)quad
+		, offsetof(TextVertex, u)
 		, sizeof(TextVertex)
 		);
 
-	setVertex(m_vertexCount + 0, x0, y0, m_textColor);
-	setVertex(m_vertexCount + 1, x0, y1, m_textColor);
-	setVertex(m_vertexCount + 2, x1, y1, m_textColor);
-	setVertex(m_vertexCount + 3, x1, y0, m_textColor);
-
-	m_indexBuffer[m_indexCount + 0] = m_vertexCount + 0;
-	m_indexBuffer[m_indexCount + 1] = m_vertexCount + 1;
-	m_indexBuffer[m_indexCount + 2] = m_vertexCount + 2;
-	m_indexBuffer[m_indexCount + 3] = m_vertexCount + 0;
-	m_indexBuffer[m_indexCount + 4] = m_vertexCount + 2;
-	m_indexBuffer[m_indexCount + 5] = m_vertexCount + 3;
-	m_vertexCount += 4;
-	m_indexCount += 6;
+	setQuad(quad, x0, y0, x1, y1, m_textColor);
+	appendQuad(quad, STYLE_NORMAL, glyph->regionIndex);
 
 	m_penX += glyph->advance_x;
 	if (m_penX > m_rectangle.width)
@@ -552,11 +584,193 @@ void TextBuffer::appendGlyph(FontHandle _handle, CodePoint _codePoint)
 	}
 }
 
+bool TextBuffer::repackUV()
+{
+	const Atlas* atlas = m_fontManager->getAtlas();
+	bool changed = false;
+
+	for (uint32_t ii = 0; ii < m_vertexCount; ii += 4)
+	{
+		const uint16_t regionIndex = m_regionBuffer[ii/4];
+		if (UINT16_MAX == regionIndex)
+		{
+			continue;
+		}
+
+		TextVertex quad[4];
+		bx::memCopy(quad, &m_vertexBuffer[ii], sizeof(quad) );
+		atlas->packUV(regionIndex
+			, (uint8_t*)quad
+			, offsetof(TextVertex, u)
+			, sizeof(TextVertex)
+			);
+
+		if (0 != bx::memCmp(&m_vertexBuffer[ii], quad, sizeof(quad) ) )
+		{
+			bx::memCopy(&m_vertexBuffer[ii], quad, sizeof(quad) );
+			markDirty(ii, ii+4);
+			changed = true;
+		}
+	}
+
+	return changed;
+}
+
+void TextBuffer::releaseRegions(uint32_t _begin)
+{
+	for (uint32_t ii = _begin/4, num = m_vertexCount/4; ii < num; ++ii)
+	{
+		if (UINT16_MAX != m_regionBuffer[ii])
+		{
+			m_fontManager->release(m_regionBuffer[ii]);
+		}
+	}
+}
+
+void TextBuffer::packInstances(float* _dst, uint32_t _begin, uint32_t _end) const
+{
+	const float scale = 1.0f / float(INT16_MAX);
+
+	for (uint32_t ii = _begin; ii < _end; ii += 4, _dst += 16)
+	{
+		const TextVertex* quad = &m_vertexBuffer[ii];
+		const int16_t* uvw0 = &quad[0].u;
+		const int16_t* uvw2 = &quad[2].u;
+
+		// Glyph region spans two axes of the cube face, the third one is
+		// constant and points to the face. Quad x maps to the first
+		// spanned axis, and quad y to the second.
+		uint32_t axis = 2;
+		for (uint32_t jj = 0; jj < 2; ++jj)
+		{
+			if (uvw0[jj] == uvw2[jj]
+			&& (uvw0[jj] == INT16_MAX || uvw0[jj] == INT16_MIN) )
+			{
+				axis = jj;
+				break;
+			}
+		}
+
+		const uint32_t sAxis = 0 == axis ? 2 : 0;
+		const uint32_t tAxis = 1 == axis ? 2 : 1;
+
+		_dst[ 0] = quad[0].x;
+		_dst[ 1] = quad[0].y;
+		_dst[ 2] = quad[2].x;
+		_dst[ 3] = quad[2].y;
+
+		_dst[ 4] = float(uvw0[sAxis]) * scale;
+		_dst[ 5] = float(uvw0[tAxis]) * scale;
+		_dst[ 6] = float(uvw2[sAxis]) * scale;
+		_dst[ 7] = float(uvw2[tAxis]) * scale;
+
+		_dst[ 8] = 0.0f;
+		_dst[ 9] = 0.0f;
+		_dst[10] = 0.0f;
+		_dst[ 8 + axis] = 0 > uvw0[axis] ? -1.0f : 1.0f;
+		_dst[11] = float(quad[0].t) * scale;
+
+		const uint8_t* rgba = (const uint8_t*)&quad[0].rgba;
+		_dst[12] = float(rgba[0]) / 255.0f;
+		_dst[13] = float(rgba[1]) / 255.0f;
+		_dst[14] = float(rgba[2]) / 255.0f;
+		_dst[15] = float(rgba[3]) / 255.0f;
+	}
+}
+
+void TextBuffer::markDirty(uint32_t _begin, uint32_t _end)
+{
+	// Runs are kept sorted and disjoint. Runs touching the new one are
+	// merged into it.
+	uint32_t first = 0;
+	while (first < m_numDirtyRuns
+	&&     m_dirtyRuns[first].end < _begin)
+	{
+		++first;
+	}
+
+	uint32_t last = first;
+	while (last < m_numDirtyRuns
+	&&     m_dirtyRuns[last].begin <= _end)
+	{
+		_begin = bx::min(_begin, m_dirtyRuns[last].begin);
+		_end   = bx::max(_end,   m_dirtyRuns[last].end);
+		++last;
+	}
+
+	if (first == last)
+	{
+		bx::memMove(&m_dirtyRuns[first + 1], &m_dirtyRuns[first], (m_numDirtyRuns - first) * sizeof(DirtyRun) );
+		++m_numDirtyRuns;
+	}
+	else if (last - first > 1)
+	{
+		bx::memMove(&m_dirtyRuns[first + 1], &m_dirtyRuns[last], (m_numDirtyRuns - last) * sizeof(DirtyRun) );
+		m_numDirtyRuns -= last - first - 1;
+	}
+
+	m_dirtyRuns[first].begin = _begin;
+	m_dirtyRuns[first].end   = _end;
+
+	if (m_numDirtyRuns > MAX_DIRTY_RUNS)
+	{
+		// Too many runs, merge two closest ones, uploading the least
+		// amount of unchanged vertices between them.
+		uint32_t closest = 0;
+		uint32_t gap = UINT32_MAX;
+
+		for (uint32_t ii = 0; ii < m_numDirtyRuns - 1; ++ii)
+		{
+			const uint32_t runGap = m_dirtyRuns[ii + 1].begin - m_dirtyRuns[ii].end;
+			if (runGap < gap)
+			{
+				closest = ii;
+				gap = runGap;
+			}
+		}
+
+		m_dirtyRuns[closest].end = m_dirtyRuns[closest + 1].end;
+		bx::memMove(&m_dirtyRuns[closest + 1], &m_dirtyRuns[closest + 2], (m_numDirtyRuns - closest - 2) * sizeof(DirtyRun) );
+		--m_numDirtyRuns;
+	}
+}
+
+void TextBuffer::appendQuad(const TextVertex* _quad, uint8_t _style, uint16_t _regionIndex)
+{
+	const uint32_t first = m_vertexCount;
+	TextVertex* dst = &m_vertexBuffer[first];
+
+	// Text rebuilt with the same content produces the same vertices, only
+	// quads that actually changed need to be uploaded again.
+	if (first >= m_syncedCount
+	||  0 != bx::memCmp(dst, _quad, 4*sizeof(TextVertex) ) )
+	{
+		bx::memCopy(dst, _quad, 4*sizeof(TextVertex) );
+		markDirty(first, first+4);
+	}
+
+	// Glyphs used by text are referenced until the text is cleared, so
+	// they are never evicted from the atlas while they are displayed.
+	if (UINT16_MAX != _regionIndex)
+	{
+		m_fontManager->addRef(_regionIndex);
+	}
+
+	m_styleBuffer[first/4]  = _style;
+	m_regionBuffer[first/4] = _regionIndex;
+	m_vertexCount += 4;
+}
+
 void TextBuffer::verticalCenterLastLine(float _dy, float _top, float _bottom)
 {
+	if (m_lineStartIndex < m_vertexCount)
+	{
+		markDirty(m_lineStartIndex, m_vertexCount);
+	}
+
 	for (uint32_t ii = m_lineStartIndex; ii < m_vertexCount; ii += 4)
 	{
-		if (m_styleBuffer[ii] == STYLE_BACKGROUND)
+		if (m_styleBuffer[ii/4] == STYLE_BACKGROUND)
 		{
 			m_vertexBuffer[ii + 0].y = _top;
 			m_vertexBuffer[ii + 1].y = _bottom;
@@ -573,10 +787,29 @@ void TextBuffer::verticalCenterLastLine(float _dy, float _top, float _bottom)
 	}
 }
 
+static bgfx::ProgramHandle createInstancedProgram(bgfx::ShaderHandle _vsh, const char* _fsName)
+{
+	bgfx::ShaderHandle fsh = bgfx::createEmbeddedShader(s_embeddedShaders, bgfx::getRendererType(), _fsName);
+	bgfx::ProgramHandle program = bgfx::createProgram(_vsh, fsh);
+	bgfx::destroy(fsh);
+	return program;
+}
+
+static void destroyValid(bgfx::ProgramHandle& _handle)
+{
+	if (bgfx::isValid(_handle) )
+	{
+		bgfx::destroy(_handle);
+		_handle.idx = bgfx::kInvalidHandle;
+	}
+}
+
 TextBufferManager::TextBufferManager(FontManager* _fontManager)
 	: m_fontManager(_fontManager)
+	, m_numRemapped(0)
 {
 	m_textBuffers = new BufferCache[MAX_TEXT_BUFFER_COUNT];
+	m_fontManager->addRemapListener(remapRegionFunc, this);
 
 	bgfx::RendererType::Enum type = bgfx::getRendererType();
 
@@ -605,6 +838,84 @@ TextBufferManager::TextBufferManager(FontManager* _fontManager)
 		.add(bgfx::Attrib::Color0,    4, bgfx::AttribType::Uint8, true)
 		.end();
 
+	// Every text buffer is a list of quads, they all share the same index
+	// buffer instead of building and uploading their own.
+	const bgfx::Memory* mem = bgfx::alloc(MAX_BUFFERED_CHARACTERS * 6 * sizeof(uint16_t) );
+	uint16_t* indices = (uint16_t*)mem->data;
+	for (uint32_t ii = 0; ii < MAX_BUFFERED_CHARACTERS; ++ii)
+	{
+		const uint16_t vertex = uint16_t(ii*4);
+		indices[0] = vertex + 0;
+		indices[1] = vertex + 1;
+		indices[2] = vertex + 2;
+		indices[3] = vertex + 0;
+		indices[4] = vertex + 2;
+		indices[5] = vertex + 3;
+		indices += 6;
+	}
+
+	m_indexBuffer = bgfx::createIndexBuffer(mem);
+
+	// Instanced glyph vertex shader shares fragment shaders with vertex glyph programs.
+	// Without instancing, or instanced shader for current renderer, instanced text
+	// buffers are drawn with vertices.
+	m_basicInstancedProgram            = BGFX_INVALID_HANDLE;
+	m_distanceInstancedProgram         = BGFX_INVALID_HANDLE;
+	m_distanceSubpixelInstancedProgram = BGFX_INVALID_HANDLE;
+	m_quadVertexBuffer                 = BGFX_INVALID_HANDLE;
+
+	if (0 != (bgfx::getCaps()->supported & BGFX_CAPS_INSTANCING) )
+	{
+		bgfx::ShaderHandle vsh = bgfx::createEmbeddedShader(s_embeddedShaders, type, "vs_font_instanced");
+
+		if (bgfx::isValid(vsh) )
+		{
+			m_basicInstancedProgram            = createInstancedProgram(vsh, "fs_font_basic");
+			m_distanceInstancedProgram         = createInstancedProgram(vsh, "fs_font_distance_field");
+			m_distanceSubpixelInstancedProgram = createInstancedProgram(vsh, "fs_font_distance_field_subpixel");
+			bgfx::destroy(vsh);
+		}
+
+		if (bgfx::isValid(m_basicInstancedProgram)
+		&&  bgfx::isValid(m_distanceInstancedProgram)
+		&&  bgfx::isValid(m_distanceSubpixelInstancedProgram) )
+		{
+			m_quadLayout
+				.begin()
+				.add(bgfx::Attrib::Position, 2, bgfx::AttribType::Float)
+				.end();
+
+			// Corners in the same order as text buffer quad vertices.
+			static const float s_quadCorners[] =
+			{
+				0.0f, 0.0f,
+				0.0f, 1.0f,
+				1.0f, 1.0f,
+				1.0f, 0.0f,
+			};
+
+			m_quadVertexBuffer = bgfx::createVertexBuffer(
+				  bgfx::makeRef(s_quadCorners, sizeof(s_quadCorners) )
+				, m_quadLayout
+				);
+
+			// Rectangle, region UVs, cube face and color, see TextBuffer::packInstances.
+			m_instanceLayout
+				.begin()
+				.add(bgfx::Attrib::TexCoord7, 4, bgfx::AttribType::Float)
+				.add(bgfx::Attrib::TexCoord6, 4, bgfx::AttribType::Float)
+				.add(bgfx::Attrib::TexCoord5, 4, bgfx::AttribType::Float)
+				.add(bgfx::Attrib::TexCoord4, 4, bgfx::AttribType::Float)
+				.end();
+		}
+		else
+		{
+			destroyValid(m_basicInstancedProgram);
+			destroyValid(m_distanceInstancedProgram);
+			destroyValid(m_distanceSubpixelInstancedProgram);
+		}
+	}
+
 	s_texColor = bgfx::createUniform("s_texColor", bgfx::UniformType::Sampler);
 }
 
@@ -613,14 +924,25 @@ TextBufferManager::~TextBufferManager()
 	BX_CHECK(m_textBufferHandles.getNumHandles() == 0, "All the text buffers must be destroyed before destroying the manager");
 	delete [] m_textBuffers;
 
+	m_fontManager->removeRemapListener(remapRegionFunc, this);
+
 	bgfx::destroy(s_texColor);
+	bgfx::destroy(m_indexBuffer);
 
 	bgfx::destroy(m_basicProgram);
 	bgfx::destroy(m_distanceProgram);
 	bgfx::destroy(m_distanceSubpixelProgram);
+
+	if (bgfx::isValid(m_quadVertexBuffer) )
+	{
+		bgfx::destroy(m_quadVertexBuffer);
+		bgfx::destroy(m_basicInstancedProgram);
+		bgfx::destroy(m_distanceInstancedProgram);
+		bgfx::destroy(m_distanceSubpixelInstancedProgram);
+	}
 }
 
-TextBufferHandle TextBufferManager::createTextBuffer(uint32_t _type, BufferType::Enum _bufferType)
+TextBufferHandle TextBufferManager::createTextBuffer(uint32_t _type, BufferType::Enum _bufferType, bool _instanced)
 {
 	uint16_t textIdx = m_textBufferHandles.alloc();
 	BufferCache& bc = m_textBuffers[textIdx];
@@ -628,8 +950,10 @@ TextBufferHandle TextBufferManager::createTextBuffer(uint32_t _type, BufferType:
 	bc.textBuffer = new TextBuffer(m_fontManager);
 	bc.fontType = _type;
 	bc.bufferType = _bufferType;
-	bc.indexBufferHandleIdx = bgfx::kInvalidHandle;
 	bc.vertexBufferHandleIdx = bgfx::kInvalidHandle;
+	bc.vertexCapacity = 0;
+	bc.numRemapped = m_numRemapped;
+	bc.instanced = _instanced && bgfx::isValid(m_quadVertexBuffer);
 
 	TextBufferHandle ret = {textIdx};
 	return ret;
@@ -653,23 +977,19 @@ void TextBufferManager::destroyTextBuffer(TextBufferHandle _handle)
 	{
 	case BufferType::Static:
 		{
-			bgfx::IndexBufferHandle ibh;
 			bgfx::VertexBufferHandle vbh;
-			ibh.idx = bc.indexBufferHandleIdx;
 			vbh.idx = bc.vertexBufferHandleIdx;
-			bgfx::destroy(ibh);
 			bgfx::destroy(vbh);
 		}
 
 		break;
 
 	case BufferType::Dynamic:
-		bgfx::DynamicIndexBufferHandle ibh;
-		bgfx::DynamicVertexBufferHandle vbh;
-		ibh.idx = bc.indexBufferHandleIdx;
-		vbh.idx = bc.vertexBufferHandleIdx;
-		bgfx::destroy(ibh);
-		bgfx::destroy(vbh);
+		{
+			bgfx::DynamicVertexBufferHandle vbh;
+			vbh.idx = bc.vertexBufferHandleIdx;
+			bgfx::destroy(vbh);
+		}
 
 		break;
 
@@ -684,10 +1004,29 @@ void TextBufferManager::submitTextBuffer(TextBufferHandle _handle, bgfx::ViewId
 
 	BufferCache& bc = m_textBuffers[_handle.idx];
 
-	uint32_t indexSize  = bc.textBuffer->getIndexCount()  * bc.textBuffer->getIndexSize();
-	uint32_t vertexSize = bc.textBuffer->getVertexCount() * bc.textBuffer->getVertexSize();
+	TextBuffer* textBuffer = bc.textBuffer;
 
-	if (0 == indexSize || 0 == vertexSize)
+	// Glyph regions might have been moved in the atlas since UVs were
+	// packed. Static vertex buffer can't be updated, it's created again.
+	if (bc.numRemapped != m_numRemapped)
+	{
+		bc.numRemapped = m_numRemapped;
+
+		if (textBuffer->repackUV()
+		&&  BufferType::Static == bc.bufferType
+		&&  bgfx::kInvalidHandle != bc.vertexBufferHandleIdx)
+		{
+			bgfx::VertexBufferHandle vbh;
+			vbh.idx = bc.vertexBufferHandleIdx;
+			bgfx::destroy(vbh);
+			bc.vertexBufferHandleIdx = bgfx::kInvalidHandle;
+		}
+	}
+
+	const uint32_t vertexCount = textBuffer->getVertexCount();
+	const uint32_t vertexSize  = vertexCount * textBuffer->getVertexSize();
+
+	if (0 == vertexSize)
 	{
 		return;
 	}
@@ -698,7 +1037,7 @@ void TextBufferManager::submitTextBuffer(TextBufferHandle _handle, bgfx::ViewId
 	switch (bc.fontType)
 	{
 	case FONT_TYPE_ALPHA:
-		program = m_basicProgram;
+		program = bc.instanced ? m_basicInstancedProgram : m_basicProgram;
 		bgfx::setState(0
 			| BGFX_STATE_WRITE_RGB
 			| BGFX_STATE_BLEND_FUNC(BGFX_STATE_BLEND_SRC_ALPHA, BGFX_STATE_BLEND_INV_SRC_ALPHA)
@@ -706,7 +1045,7 @@ void TextBufferManager::submitTextBuffer(TextBufferHandle _handle, bgfx::ViewId
 		break;
 
 	case FONT_TYPE_DISTANCE:
-		program = m_distanceProgram;
+		program = bc.instanced ? m_distanceInstancedProgram : m_distanceProgram;
 		bgfx::setState(0
 			| BGFX_STATE_WRITE_RGB
 			| BGFX_STATE_BLEND_FUNC(BGFX_STATE_BLEND_SRC_ALPHA, BGFX_STATE_BLEND_INV_SRC_ALPHA)
@@ -714,106 +1053,177 @@ void TextBufferManager::submitTextBuffer(TextBufferHandle _handle, bgfx::ViewId
 		break;
 
 	case FONT_TYPE_DISTANCE_SUBPIXEL:
-		program = m_distanceSubpixelProgram;
+		program = bc.instanced ? m_distanceSubpixelInstancedProgram : m_distanceSubpixelProgram;
 		bgfx::setState(0
 			| BGFX_STATE_WRITE_RGB
 			| BGFX_STATE_BLEND_FUNC(BGFX_STATE_BLEND_FACTOR, BGFX_STATE_BLEND_INV_SRC_COLOR)
-			, bc.textBuffer->getTextColor()
+			, textBuffer->getTextColor()
 			);
 		break;
 	}
 
+	// Instanced buffers hold one glyph instance per quad of vertices.
+	const uint32_t elementSize  = bc.instanced ? GLYPH_INSTANCE_SIZE : textBuffer->getVertexSize();
+	const uint32_t elementShift = bc.instanced ? 2 : 0;
+	const uint32_t numElements  = vertexCount >> elementShift;
+	const bgfx::VertexLayout& layout = bc.instanced ? m_instanceLayout : m_vertexLayout;
+
 	switch (bc.bufferType)
 	{
 	case BufferType::Static:
 		{
-			bgfx::IndexBufferHandle ibh;
 			bgfx::VertexBufferHandle vbh;
 
 			if (bgfx::kInvalidHandle == bc.vertexBufferHandleIdx)
 			{
-				ibh = bgfx::createIndexBuffer(
-								bgfx::copy(bc.textBuffer->getIndexBuffer(), indexSize)
-								);
-
-				vbh = bgfx::createVertexBuffer(
-								  bgfx::copy(bc.textBuffer->getVertexBuffer(), vertexSize)
-								, m_vertexLayout
-								);
-
+				vbh = bgfx::createVertexBuffer(copyVertices(bc, 0, vertexCount), layout);
 				bc.vertexBufferHandleIdx = vbh.idx;
-				bc.indexBufferHandleIdx = ibh.idx;
 			}
 			else
 			{
 				vbh.idx = bc.vertexBufferHandleIdx;
-				ibh.idx = bc.indexBufferHandleIdx;
 			}
 
-			bgfx::setVertexBuffer(0, vbh, 0, bc.textBuffer->getVertexCount() );
-			bgfx::setIndexBuffer(ibh, 0, bc.textBuffer->getIndexCount() );
+			if (bc.instanced)
+			{
+				bgfx::setInstanceDataBuffer(vbh, 0, numElements);
+			}
+			else
+			{
+				bgfx::setVertexBuffer(0, vbh, 0, vertexCount);
+			}
 		}
 		break;
 
 	case BufferType::Dynamic:
 		{
-			bgfx::DynamicIndexBufferHandle ibh;
 			bgfx::DynamicVertexBufferHandle vbh;
 
-			if (bgfx::kInvalidHandle == bc.vertexBufferHandleIdx )
+			if (numElements > bc.vertexCapacity)
 			{
-				ibh = bgfx::createDynamicIndexBuffer(
-								bgfx::copy(bc.textBuffer->getIndexBuffer(), indexSize)
-								);
-
-				vbh = bgfx::createDynamicVertexBuffer(
-								  bgfx::copy(bc.textBuffer->getVertexBuffer(), vertexSize)
-								, m_vertexLayout
-								);
+				if (bgfx::kInvalidHandle != bc.vertexBufferHandleIdx)
+				{
+					vbh.idx = bc.vertexBufferHandleIdx;
+					bgfx::destroy(vbh);
+				}
+
+				// Grow in power of two steps, so text that keeps changing
+				// length doesn't recreate the buffer every frame.
+				bc.vertexCapacity = bx::min<uint32_t>(
+					  bx::uint32_nextpow2(numElements)
+					, (MAX_BUFFERED_CHARACTERS * 4) >> elementShift
+					);
 
-				bc.indexBufferHandleIdx = ibh.idx;
+				vbh = bgfx::createDynamicVertexBuffer(bc.vertexCapacity, layout);
 				bc.vertexBufferHandleIdx = vbh.idx;
+
+				bgfx::update(vbh, 0, copyVertices(bc, 0, vertexCount) );
+
+				textBuffer->setSynced(vertexCount);
 			}
 			else
 			{
-				ibh.idx = bc.indexBufferHandleIdx;
 				vbh.idx = bc.vertexBufferHandleIdx;
 
-				bgfx::update(
-					  ibh
-					, 0
-					, bgfx::copy(bc.textBuffer->getIndexBuffer(), indexSize)
-					);
-
-				bgfx::update(
-					  vbh
-					, 0
-					, bgfx::copy(bc.textBuffer->getVertexBuffer(), vertexSize)
-					);
+				// Text might have been longer than the buffer before it was
+				// cleared, only the part that exists on the GPU is uploaded.
+				const uint32_t capacity = bc.vertexCapacity << elementShift;
+				uint32_t synced = textBuffer->getSyncedCount();
+
+				for (uint32_t ii = 0, num = textBuffer->getNumDirtyRuns(); ii < num; ++ii)
+				{
+					const uint32_t dirtyBegin = textBuffer->getDirtyBegin(ii);
+					const uint32_t dirtyEnd   = bx::min(textBuffer->getDirtyEnd(ii), capacity);
+
+					if (dirtyBegin < dirtyEnd)
+					{
+						bgfx::update(
+							  vbh
+							, dirtyBegin >> elementShift
+							, copyVertices(bc, dirtyBegin, dirtyEnd)
+							);
+
+						synced = bx::max(synced, dirtyEnd);
+					}
+				}
+
+				textBuffer->setSynced(synced);
 			}
 
-			bgfx::setVertexBuffer(0, vbh, 0, bc.textBuffer->getVertexCount() );
-			bgfx::setIndexBuffer(ibh, 0, bc.textBuffer->getIndexCount() );
+			if (bc.instanced)
+			{
+				bgfx::setInstanceDataBuffer(vbh, 0, numElements);
+			}
+			else
+			{
+				bgfx::setVertexBuffer(0, vbh, 0, vertexCount);
+			}
 		}
 		break;
 
 	case BufferType::Transient:
+		if (bc.instanced)
+		{
+			if (numElements != bgfx::getAvailInstanceDataBuffer(numElements, uint16_t(elementSize) ) )
+			{
+				return;
+			}
+
+			bgfx::InstanceDataBuffer idb;
+			bgfx::allocInstanceDataBuffer(&idb, numElements, uint16_t(elementSize) );
+			textBuffer->packInstances( (float*)idb.data, 0, vertexCount);
+			bgfx::setInstanceDataBuffer(&idb);
+		}
+		else
 		{
-			bgfx::TransientIndexBuffer tib;
 			bgfx::TransientVertexBuffer tvb;
-			bgfx::allocTransientIndexBuffer(&tib, bc.textBuffer->getIndexCount() );
-			bgfx::allocTransientVertexBuffer(&tvb, bc.textBuffer->getVertexCount(), m_vertexLayout);
-			bx::memCopy(tib.data, bc.textBuffer->getIndexBuffer(), indexSize);
-			bx::memCopy(tvb.data, bc.textBuffer->getVertexBuffer(), vertexSize);
-			bgfx::setVertexBuffer(0, &tvb, 0, bc.textBuffer->getVertexCount() );
-			bgfx::setIndexBuffer(&tib, 0, bc.textBuffer->getIndexCount() );
+			bgfx::allocTransientVertexBuffer(&tvb, vertexCount, m_vertexLayout);
+			bx::memCopy(tvb.data, textBuffer->getVertexBuffer(), vertexSize);
+			bgfx::setVertexBuffer(0, &tvb, 0, vertexCount);
 		}
 		break;
 	}
 
+	if (bc.instanced)
+	{
+		bgfx::setVertexBuffer(0, m_quadVertexBuffer);
+		bgfx::setIndexBuffer(m_indexBuffer, 0, 6);
+	}
+	else
+	{
+		bgfx::setIndexBuffer(m_indexBuffer, 0, textBuffer->getIndexCount() );
+	}
+
 	bgfx::submit(_id, program, _depth);
 }
 
+const bgfx::Memory* TextBufferManager::copyVertices(const BufferCache& _bc, uint32_t _begin, uint32_t _end) const
+{
+	TextBuffer* textBuffer = _bc.textBuffer;
+
+	if (_bc.instanced)
+	{
+		const bgfx::Memory* mem = bgfx::alloc( (_end - _begin) / 4 * GLYPH_INSTANCE_SIZE);
+		textBuffer->packInstances( (float*)mem->data, _begin, _end);
+		return mem;
+	}
+
+	const uint32_t stride = textBuffer->getVertexSize();
+	return bgfx::copy(textBuffer->getVertexBuffer() + _begin*stride, (_end - _begin)*stride);
+}
+
+void TextBufferManager::remapRegionFunc(uint16_t _regionIndex, bool _evicted, void* _userData)
+{
+	BX_UNUSED(_regionIndex);
+
+	// Text buffers reference their glyph regions, so only moved regions
+	// can be used by them.
+	if (!_evicted)
+	{
+		++static_cast<TextBufferManager*>(_userData)->m_numRemapped;
+	}
+}
+
 void TextBufferManager::setStyle(TextBufferHandle _handle, uint32_t _flags)
 {
 	BX_CHECK(bgfx::isValid(_handle), "Invalid handle used");
@@ -891,9 +1301,24 @@ void TextBufferManager::clearTextBuffer(TextBufferHandle _handle)
 	bc.textBuffer->clearTextBuffer();
 }
 
+void TextBufferManager::markTextBuffer(TextBufferHandle _handle)
+{
+	BX_CHECK(bgfx::isValid(_handle), "Invalid handle used");
+	BufferCache& bc = m_textBuffers[_handle.idx];
+	bc.textBuffer->mark();
+}
+
+void TextBufferManager::rewindTextBuffer(TextBufferHandle _handle)
+{
+	BX_CHECK(bgfx::isValid(_handle), "Invalid handle used");
+	BufferCache& bc = m_textBuffers[_handle.idx];
+	bc.textBuffer->rewind();
+}
+
 TextRectangle TextBufferManager::getRectangle(TextBufferHandle _handle) const
 {
 	BX_CHECK(bgfx::isValid(_handle), "Invalid handle used");
 	BufferCache& bc = m_textBuffers[_handle.idx];
 	return bc.textBuffer->getRectangle();
 }
+
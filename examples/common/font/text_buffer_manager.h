@@ -45,8 +45,15 @@ public:
 	TextBufferManager(FontManager* _fontManager);
 	~TextBufferManager();
 
-	TextBufferHandle createTextBuffer(uint32_t _type, BufferType::Enum _bufferType);
+	/// Create text buffer. When _instanced is set and instancing is supported,
+	/// every glyph is drawn as one instance of shared quad instead of four
+	/// vertices.
+	TextBufferHandle createTextBuffer(uint32_t _type, BufferType::Enum _bufferType, bool _instanced = false);
 	void destroyTextBuffer(TextBufferHandle _handle);
+
+	/// Submit the text buffer. Dynamic buffers only upload the vertex runs
+	/// that changed since the previous submit, so a buffer cleared and filled
+	/// again with mostly the same text costs little bandwidth.
 	void submitTextBuffer(TextBufferHandle _handle, bgfx::ViewId _id, int32_t _depth = 0);
 
 	void setStyle(TextBufferHandle _handle, uint32_t _flags = STYLE_NORMAL);
@@ -71,27 +78,52 @@ public:
 	/// Clear the text buffer and reset its state (pen/color).
 	void clearTextBuffer(TextBufferHandle _handle);
 
+	/// Remember pen and line state, so that text appended after this point
+	/// can be replaced without generating text before it again.
+	void markTextBuffer(TextBufferHandle _handle);
+
+	/// Remove text appended after the last `markTextBuffer` and restore pen
+	/// and line state. Without mark this is the same as `clearTextBuffer`.
+	///
+	/// @remark Text before the mark is not moved back when removed text
+	///   made its line taller.
+	void rewindTextBuffer(TextBufferHandle _handle);
+
 	/// Return the rectangular size of the current text buffer (including all its content).
 	TextRectangle getRectangle(TextBufferHandle _handle) const;
 
 private:
 	struct BufferCache
 	{
-		uint16_t indexBufferHandleIdx;
 		uint16_t vertexBufferHandleIdx;
+		uint32_t vertexCapacity;
+		uint32_t numRemapped;
 		TextBuffer* textBuffer;
 		BufferType::Enum bufferType;
 		uint32_t fontType;
+		bool instanced;
 	};
 
+	const bgfx::Memory* copyVertices(const BufferCache& _bc, uint32_t _begin, uint32_t _end) const;
+
+	static void remapRegionFunc(uint16_t _regionIndex, bool _evicted, void* _userData);
+
 	BufferCache* m_textBuffers;
 	bx::HandleAllocT<MAX_TEXT_BUFFER_COUNT> m_textBufferHandles;
 	FontManager* m_fontManager;
 	bgfx::VertexLayout m_vertexLayout;
+	bgfx::VertexLayout m_quadLayout;
+	bgfx::VertexLayout m_instanceLayout;
+	bgfx::IndexBufferHandle m_indexBuffer;
+	bgfx::VertexBufferHandle m_quadVertexBuffer;
 	bgfx::UniformHandle s_texColor;
 	bgfx::ProgramHandle m_basicProgram;
 	bgfx::ProgramHandle m_distanceProgram;
 	bgfx::ProgramHandle m_distanceSubpixelProgram;
+	bgfx::ProgramHandle m_basicInstancedProgram;
+	bgfx::ProgramHandle m_distanceInstancedProgram;
+	bgfx::ProgramHandle m_distanceSubpixelInstancedProgram;
+	uint32_t m_numRemapped;
 };
 
 #endif // TEXT_BUFFER_MANAGER_H_HEADER_GUARD
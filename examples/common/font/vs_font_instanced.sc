@@ -0,0 +1,29 @@
+$input a_position, i_data0, i_data1, i_data2, i_data3
+$output v_color0, v_texcoord0
+
+/*
+ * Copyright 2011-2020 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx#license-bsd-2-clause
+ */
+
+#include "../../common/common.sh"
+
+void main()
+{
+	// a_position is quad corner, i_data0 glyph rectangle.
+	vec2 pos = mix(i_data0.xy, i_data0.zw, a_position);
+	gl_Position = mul(u_modelViewProj, vec4(pos, 0.0, 1.0) );
+
+	// Glyph region spans two axes of the cube face pointed by i_data2.xyz,
+	// x axis for +-Y and +-Z faces or z axis for +-X faces, and z axis for
+	// +-Y faces or y axis otherwise.
+	vec2 st = mix(i_data1.xy, i_data1.zw, a_position);
+	vec3 face = abs(i_data2.xyz);
+	vec3 uvw = i_data2.xyz
+		+ st.x * vec3(1.0 - face.x, 0.0, face.x)
+		+ st.y * vec3(0.0, 1.0 - face.y, face.y)
+		;
+
+	v_texcoord0 = vec4(uvw, i_data2.w);
+	v_color0 = i_data3;
+}
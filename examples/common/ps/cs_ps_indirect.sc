@@ -0,0 +1,19 @@
+/*
+ * Copyright 2011-2020 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx#license-bsd-2-clause
+ */
+
+#include "bgfx_compute.sh"
+#include "uniforms.sh"
+
+BUFFER_RW(counter,        uint,  0);
+BUFFER_WR(indirectBuffer, uvec4, 1);
+
+NUM_THREADS(1, 1, 1)
+void main()
+{
+	drawIndexedIndirect(indirectBuffer, 0, 6, counter[0], 0, 0, 0);
+
+	// Reset alive count for next frame.
+	counter[0] = 0u;
+}
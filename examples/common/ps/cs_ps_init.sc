@@ -0,0 +1,27 @@
+/*
+ * Copyright 2011-2020 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx#license-bsd-2-clause
+ */
+
+#include "bgfx_compute.sh"
+#include "uniforms.sh"
+
+BUFFER_WR(particles, vec4, 0);
+BUFFER_WR(counter,   uint, 1);
+
+NUM_THREADS(threadGroupSize, 1, 1)
+void main()
+{
+	uint idx = gl_GlobalInvocationID.x;
+
+	if (idx < u_maxParticles)
+	{
+		// Life above 1 marks slot as dead.
+		particles[idx*PARTICLE_STRIDE] = vec4(0.0, 0.0, 0.0, 2.0);
+	}
+
+	if (0u == idx)
+	{
+		counter[0] = 0u;
+	}
+}
@@ -0,0 +1,739 @@
+static const uint8_t cs_ps_instances_glsl[3186] =
+{
+	0x43, 0x53, 0x48, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x0c, // CSH..........._.
+	0x00, 0x00, 0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x34, 0x33, 0x30, 0x0a, 0x76, // ..#version 430.v
+	0x65, 0x63, 0x33, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x4d, 0x75, 0x6c, 0x28, 0x76, 0x65, 0x63, 0x33, // ec3 instMul(vec3
+	0x20, 0x5f, 0x76, 0x65, 0x63, 0x2c, 0x20, 0x6d, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x6d, 0x74, 0x78, //  _vec, mat3 _mtx
+	0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x28, 0x20, 0x28, 0x5f, 0x76, // ) { return ( (_v
+	0x65, 0x63, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x5f, 0x6d, 0x74, 0x78, 0x29, 0x20, 0x29, 0x3b, 0x20, // ec) * (_mtx) ); 
+	0x7d, 0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x4d, 0x75, 0x6c, 0x28, 0x6d, // }.vec3 instMul(m
+	0x61, 0x74, 0x33, 0x20, 0x5f, 0x6d, 0x74, 0x78, 0x2c, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x5f, // at3 _mtx, vec3 _
+	0x76, 0x65, 0x63, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x28, 0x20, // vec) { return ( 
+	0x28, 0x5f, 0x6d, 0x74, 0x78, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x5f, 0x76, 0x65, 0x63, 0x29, 0x20, // (_mtx) * (_vec) 
+	0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x34, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x4d, 0x75, // ); }.vec4 instMu
+	0x6c, 0x28, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x76, 0x65, 0x63, 0x2c, 0x20, 0x6d, 0x61, 0x74, // l(vec4 _vec, mat
+	0x34, 0x20, 0x5f, 0x6d, 0x74, 0x78, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, // 4 _mtx) { return
+	0x20, 0x28, 0x20, 0x28, 0x5f, 0x76, 0x65, 0x63, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x5f, 0x6d, 0x74, //  ( (_vec) * (_mt
+	0x78, 0x29, 0x20, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x34, 0x20, 0x69, 0x6e, 0x73, // x) ); }.vec4 ins
+	0x74, 0x4d, 0x75, 0x6c, 0x28, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x6d, 0x74, 0x78, 0x2c, 0x20, // tMul(mat4 _mtx, 
+	0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x76, 0x65, 0x63, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, // vec4 _vec) { ret
+	0x75, 0x72, 0x6e, 0x20, 0x28, 0x20, 0x28, 0x5f, 0x6d, 0x74, 0x78, 0x29, 0x20, 0x2a, 0x20, 0x28, // urn ( (_mtx) * (
+	0x5f, 0x76, 0x65, 0x63, 0x29, 0x20, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, // _vec) ); }.float
+	0x20, 0x72, 0x63, 0x70, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x61, 0x29, 0x20, 0x7b, //  rcp(float _a) {
+	0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x31, 0x2e, 0x30, 0x2f, 0x5f, 0x61, 0x3b, 0x20, //  return 1.0/_a; 
+	0x7d, 0x0a, 0x76, 0x65, 0x63, 0x32, 0x20, 0x72, 0x63, 0x70, 0x28, 0x76, 0x65, 0x63, 0x32, 0x20, // }.vec2 rcp(vec2 
+	0x5f, 0x61, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, // _a) { return vec
+	0x32, 0x28, 0x31, 0x2e, 0x30, 0x29, 0x2f, 0x5f, 0x61, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, // 2(1.0)/_a; }.vec
+	0x33, 0x20, 0x72, 0x63, 0x70, 0x28, 0x76, 0x65, 0x63, 0x33, 0x20, 0x5f, 0x61, 0x29, 0x20, 0x7b, // 3 rcp(vec3 _a) {
+	0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x33, 0x28, 0x31, 0x2e, 0x30, //  return vec3(1.0
+	0x29, 0x2f, 0x5f, 0x61, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x34, 0x20, 0x72, 0x63, 0x70, // )/_a; }.vec4 rcp
+	0x28, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x61, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, // (vec4 _a) { retu
+	0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x31, 0x2e, 0x30, 0x29, 0x2f, 0x5f, 0x61, 0x3b, // rn vec4(1.0)/_a;
+	0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x32, 0x20, 0x76, 0x65, 0x63, 0x32, 0x5f, 0x73, 0x70, 0x6c, //  }.vec2 vec2_spl
+	0x61, 0x74, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x78, 0x29, 0x20, 0x7b, 0x20, 0x72, // at(float _x) { r
+	0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x5f, 0x78, 0x2c, 0x20, 0x5f, // eturn vec2(_x, _
+	0x78, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, 0x76, 0x65, 0x63, 0x33, 0x5f, // x); }.vec3 vec3_
+	0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x78, 0x29, 0x20, // splat(float _x) 
+	0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x33, 0x28, 0x5f, 0x78, // { return vec3(_x
+	0x2c, 0x20, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, // , _x, _x); }.vec
+	0x34, 0x20, 0x76, 0x65, 0x63, 0x34, 0x5f, 0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x66, 0x6c, 0x6f, // 4 vec4_splat(flo
+	0x61, 0x74, 0x20, 0x5f, 0x78, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, // at _x) { return 
+	0x76, 0x65, 0x63, 0x34, 0x28, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x2c, // vec4(_x, _x, _x,
+	0x20, 0x5f, 0x78, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x75, 0x76, 0x65, 0x63, 0x32, 0x20, 0x75, 0x76, //  _x); }.uvec2 uv
+	0x65, 0x63, 0x32, 0x5f, 0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, // ec2_splat(uint _
+	0x78, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x75, 0x76, 0x65, 0x63, // x) { return uvec
+	0x32, 0x28, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x75, 0x76, 0x65, // 2(_x, _x); }.uve
+	0x63, 0x33, 0x20, 0x75, 0x76, 0x65, 0x63, 0x33, 0x5f, 0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x75, // c3 uvec3_splat(u
+	0x69, 0x6e, 0x74, 0x20, 0x5f, 0x78, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, // int _x) { return
+	0x20, 0x75, 0x76, 0x65, 0x63, 0x33, 0x28, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x2c, 0x20, 0x5f, //  uvec3(_x, _x, _
+	0x78, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x75, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, 0x76, 0x65, 0x63, // x); }.uvec4 uvec
+	0x34, 0x5f, 0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x78, 0x29, // 4_splat(uint _x)
+	0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x75, 0x76, 0x65, 0x63, 0x34, 0x28, //  { return uvec4(
+	0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x29, 0x3b, // _x, _x, _x, _x);
+	0x20, 0x7d, 0x0a, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x6d, 0x74, 0x78, 0x46, 0x72, 0x6f, 0x6d, 0x52, //  }.mat4 mtxFromR
+	0x6f, 0x77, 0x73, 0x28, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x30, 0x2c, 0x20, 0x76, 0x65, 0x63, // ows(vec4 _0, vec
+	0x34, 0x20, 0x5f, 0x31, 0x2c, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x32, 0x2c, 0x20, 0x76, // 4 _1, vec4 _2, v
+	0x65, 0x63, 0x34, 0x20, 0x5f, 0x33, 0x29, 0x0a, 0x7b, 0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, // ec4 _3).{.return
+	0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x73, 0x65, 0x28, 0x6d, 0x61, 0x74, 0x34, 0x28, //  transpose(mat4(
+	0x5f, 0x30, 0x2c, 0x20, 0x5f, 0x31, 0x2c, 0x20, 0x5f, 0x32, 0x2c, 0x20, 0x5f, 0x33, 0x29, 0x20, // _0, _1, _2, _3) 
+	0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x6d, 0x74, 0x78, 0x46, 0x72, 0x6f, // );.}.mat4 mtxFro
+	0x6d, 0x43, 0x6f, 0x6c, 0x73, 0x28, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x30, 0x2c, 0x20, 0x76, // mCols(vec4 _0, v
+	0x65, 0x63, 0x34, 0x20, 0x5f, 0x31, 0x2c, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x32, 0x2c, // ec4 _1, vec4 _2,
+	0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x33, 0x29, 0x0a, 0x7b, 0x0a, 0x72, 0x65, 0x74, 0x75, //  vec4 _3).{.retu
+	0x72, 0x6e, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x28, 0x5f, 0x30, 0x2c, 0x20, 0x5f, 0x31, 0x2c, 0x20, // rn mat4(_0, _1, 
+	0x5f, 0x32, 0x2c, 0x20, 0x5f, 0x33, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x6d, 0x61, 0x74, 0x33, 0x20, // _2, _3);.}.mat3 
+	0x6d, 0x74, 0x78, 0x46, 0x72, 0x6f, 0x6d, 0x52, 0x6f, 0x77, 0x73, 0x28, 0x76, 0x65, 0x63, 0x33, // mtxFromRows(vec3
+	0x20, 0x5f, 0x30, 0x2c, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x5f, 0x31, 0x2c, 0x20, 0x76, 0x65, //  _0, vec3 _1, ve
+	0x63, 0x33, 0x20, 0x5f, 0x32, 0x29, 0x0a, 0x7b, 0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, // c3 _2).{.return 
+	0x74, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x73, 0x65, 0x28, 0x6d, 0x61, 0x74, 0x33, 0x28, 0x5f, // transpose(mat3(_
+	0x30, 0x2c, 0x20, 0x5f, 0x31, 0x2c, 0x20, 0x5f, 0x32, 0x29, 0x20, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, // 0, _1, _2) );.}.
+	0x6d, 0x61, 0x74, 0x33, 0x20, 0x6d, 0x74, 0x78, 0x46, 0x72, 0x6f, 0x6d, 0x43, 0x6f, 0x6c, 0x73, // mat3 mtxFromCols
+	0x28, 0x76, 0x65, 0x63, 0x33, 0x20, 0x5f, 0x30, 0x2c, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x5f, // (vec3 _0, vec3 _
+	0x31, 0x2c, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x5f, 0x32, 0x29, 0x0a, 0x7b, 0x0a, 0x72, 0x65, // 1, vec3 _2).{.re
+	0x74, 0x75, 0x72, 0x6e, 0x20, 0x6d, 0x61, 0x74, 0x33, 0x28, 0x5f, 0x30, 0x2c, 0x20, 0x5f, 0x31, // turn mat3(_0, _1
+	0x2c, 0x20, 0x5f, 0x32, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, // , _2);.}.uniform
+	0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x52, 0x65, 0x63, 0x74, //  vec4 u_viewRect
+	0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, // ;.uniform vec4 u
+	0x5f, 0x76, 0x69, 0x65, 0x77, 0x54, 0x65, 0x78, 0x65, 0x6c, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, // _viewTexel;.unif
+	0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x3b, // orm mat4 u_view;
+	0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, // .uniform mat4 u_
+	0x69, 0x6e, 0x76, 0x56, 0x69, 0x65, 0x77, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, // invView;.uniform
+	0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x3b, 0x0a, 0x75, 0x6e, //  mat4 u_proj;.un
+	0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x69, 0x6e, 0x76, // iform mat4 u_inv
+	0x50, 0x72, 0x6f, 0x6a, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, // Proj;.uniform ma
+	0x74, 0x34, 0x20, 0x75, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x50, 0x72, 0x6f, 0x6a, 0x3b, 0x0a, 0x75, // t4 u_viewProj;.u
+	0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x69, 0x6e, // niform mat4 u_in
+	0x76, 0x56, 0x69, 0x65, 0x77, 0x50, 0x72, 0x6f, 0x6a, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, // vViewProj;.unifo
+	0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5b, // rm mat4 u_model[
+	0x33, 0x32, 0x5d, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, // 32];.uniform mat
+	0x34, 0x20, 0x75, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x56, 0x69, 0x65, 0x77, 0x3b, 0x0a, 0x75, // 4 u_modelView;.u
+	0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x6d, 0x6f, // niform mat4 u_mo
+	0x64, 0x65, 0x6c, 0x56, 0x69, 0x65, 0x77, 0x50, 0x72, 0x6f, 0x6a, 0x3b, 0x0a, 0x75, 0x6e, 0x69, // delViewProj;.uni
+	0x66, 0x6f, 0x72, 0x6d, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, 0x5f, 0x61, 0x6c, 0x70, 0x68, // form vec4 u_alph
+	0x61, 0x52, 0x65, 0x66, 0x34, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x76, // aRef4;.uniform v
+	0x65, 0x63, 0x34, 0x20, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x34, // ec4 u_psParams[4
+	0x38, 0x5d, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, // 8];.uniform mat4
+	0x20, 0x75, 0x5f, 0x70, 0x73, 0x4d, 0x74, 0x78, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, //  u_psMtx;.unifor
+	0x6d, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, 0x5f, 0x70, 0x73, 0x53, 0x6f, 0x72, 0x74, 0x3b, // m vec4 u_psSort;
+	0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x65, 0x61, 0x73, 0x65, 0x28, 0x69, 0x6e, 0x74, 0x20, // .float ease(int 
+	0x5f, 0x63, 0x75, 0x72, 0x76, 0x65, 0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x74, // _curve, float _t
+	0x74, 0x29, 0x0a, 0x7b, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x70, 0x6f, 0x73, 0x20, 0x3d, // t).{.float pos =
+	0x20, 0x63, 0x6c, 0x61, 0x6d, 0x70, 0x28, 0x5f, 0x74, 0x74, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, //  clamp(_tt, 0.0,
+	0x20, 0x31, 0x2e, 0x30, 0x29, 0x20, 0x2a, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x33, 0x32, //  1.0) * float(32
+	0x2d, 0x31, 0x29, 0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x64, 0x78, 0x30, 0x20, 0x3d, 0x20, // -1);.int idx0 = 
+	0x69, 0x6e, 0x74, 0x28, 0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x28, 0x70, 0x6f, 0x73, 0x29, 0x20, 0x29, // int(floor(pos) )
+	0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x64, 0x78, 0x31, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x6e, // ;.int idx1 = min
+	0x28, 0x69, 0x64, 0x78, 0x30, 0x20, 0x2b, 0x20, 0x31, 0x2c, 0x20, 0x33, 0x32, 0x2d, 0x31, 0x29, // (idx0 + 1, 32-1)
+	0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x62, 0x61, 0x73, 0x65, 0x20, 0x3d, 0x20, 0x31, 0x36, 0x2a, // ;.int base = 16*
+	0x34, 0x20, 0x2b, 0x20, 0x5f, 0x63, 0x75, 0x72, 0x76, 0x65, 0x2a, 0x33, 0x32, 0x3b, 0x0a, 0x69, // 4 + _curve*32;.i
+	0x6e, 0x74, 0x20, 0x6c, 0x75, 0x74, 0x30, 0x20, 0x3d, 0x20, 0x62, 0x61, 0x73, 0x65, 0x20, 0x2b, // nt lut0 = base +
+	0x20, 0x69, 0x64, 0x78, 0x30, 0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x6c, 0x75, 0x74, 0x31, 0x20, //  idx0;.int lut1 
+	0x3d, 0x20, 0x62, 0x61, 0x73, 0x65, 0x20, 0x2b, 0x20, 0x69, 0x64, 0x78, 0x31, 0x3b, 0x0a, 0x66, // = base + idx1;.f
+	0x6c, 0x6f, 0x61, 0x74, 0x20, 0x76, 0x61, 0x6c, 0x30, 0x20, 0x3d, 0x20, 0x75, 0x5f, 0x70, 0x73, // loat val0 = u_ps
+	0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x6c, 0x75, 0x74, 0x30, 0x2f, 0x34, 0x5d, 0x5b, 0x6c, // Params[lut0/4][l
+	0x75, 0x74, 0x30, 0x25, 0x34, 0x5d, 0x3b, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x76, 0x61, // ut0%4];.float va
+	0x6c, 0x31, 0x20, 0x3d, 0x20, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, // l1 = u_psParams[
+	0x6c, 0x75, 0x74, 0x31, 0x2f, 0x34, 0x5d, 0x5b, 0x6c, 0x75, 0x74, 0x31, 0x25, 0x34, 0x5d, 0x3b, // lut1/4][lut1%4];
+	0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x6d, 0x69, 0x78, 0x28, 0x76, 0x61, 0x6c, 0x30, // .return mix(val0
+	0x2c, 0x20, 0x76, 0x61, 0x6c, 0x31, 0x2c, 0x20, 0x66, 0x72, 0x61, 0x63, 0x74, 0x28, 0x70, 0x6f, // , val1, fract(po
+	0x73, 0x29, 0x20, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x28, 0x73, // s) );.}.layout(s
+	0x74, 0x64, 0x34, 0x33, 0x30, 0x2c, 0x20, 0x62, 0x69, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x3d, 0x30, // td430, binding=0
+	0x29, 0x20, 0x72, 0x65, 0x61, 0x64, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, // ) readonly buffe
+	0x72, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, 0x65, 0x73, 0x42, 0x75, 0x66, 0x66, 0x65, // r particlesBuffe
+	0x72, 0x20, 0x7b, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, // r { vec4 particl
+	0x65, 0x73, 0x5b, 0x5d, 0x3b, 0x20, 0x7d, 0x3b, 0x0a, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x28, // es[]; };.layout(
+	0x73, 0x74, 0x64, 0x34, 0x33, 0x30, 0x2c, 0x20, 0x62, 0x69, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x3d, // std430, binding=
+	0x31, 0x29, 0x20, 0x72, 0x65, 0x61, 0x64, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x62, 0x75, 0x66, 0x66, // 1) readonly buff
+	0x65, 0x72, 0x20, 0x73, 0x6f, 0x72, 0x74, 0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x42, 0x75, 0x66, // er sortBufferBuf
+	0x66, 0x65, 0x72, 0x20, 0x7b, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x73, 0x6f, 0x72, 0x74, 0x42, // fer { vec4 sortB
+	0x75, 0x66, 0x66, 0x65, 0x72, 0x5b, 0x5d, 0x3b, 0x20, 0x7d, 0x3b, 0x0a, 0x6c, 0x61, 0x79, 0x6f, // uffer[]; };.layo
+	0x75, 0x74, 0x28, 0x73, 0x74, 0x64, 0x34, 0x33, 0x30, 0x2c, 0x20, 0x62, 0x69, 0x6e, 0x64, 0x69, // ut(std430, bindi
+	0x6e, 0x67, 0x3d, 0x32, 0x29, 0x20, 0x72, 0x65, 0x61, 0x64, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x62, // ng=2) readonly b
+	0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x42, 0x75, 0x66, // uffer counterBuf
+	0x66, 0x65, 0x72, 0x20, 0x7b, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, // fer { uint count
+	0x65, 0x72, 0x5b, 0x5d, 0x3b, 0x20, 0x7d, 0x3b, 0x0a, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x28, // er[]; };.layout(
+	0x73, 0x74, 0x64, 0x34, 0x33, 0x30, 0x2c, 0x20, 0x62, 0x69, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x3d, // std430, binding=
+	0x33, 0x29, 0x20, 0x77, 0x72, 0x69, 0x74, 0x65, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x62, 0x75, 0x66, // 3) writeonly buf
+	0x66, 0x65, 0x72, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x73, 0x42, 0x75, 0x66, // fer instancesBuf
+	0x66, 0x65, 0x72, 0x20, 0x7b, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x61, // fer { vec4 insta
+	0x6e, 0x63, 0x65, 0x73, 0x5b, 0x5d, 0x3b, 0x20, 0x7d, 0x3b, 0x0a, 0x6c, 0x61, 0x79, 0x6f, 0x75, // nces[]; };.layou
+	0x74, 0x20, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x78, 0x20, // t (local_size_x 
+	0x3d, 0x20, 0x32, 0x35, 0x36, 0x2c, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x73, 0x69, 0x7a, // = 256, local_siz
+	0x65, 0x5f, 0x79, 0x20, 0x3d, 0x20, 0x31, 0x2c, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x73, // e_y = 1, local_s
+	0x69, 0x7a, 0x65, 0x5f, 0x7a, 0x20, 0x3d, 0x20, 0x31, 0x29, 0x20, 0x69, 0x6e, 0x3b, 0x0a, 0x76, // ize_z = 1) in;.v
+	0x6f, 0x69, 0x64, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x28, 0x29, 0x0a, 0x7b, 0x0a, 0x75, 0x69, 0x6e, // oid main().{.uin
+	0x74, 0x20, 0x69, 0x69, 0x20, 0x3d, 0x20, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, // t ii = gl_Global
+	0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x2e, 0x78, 0x3b, 0x0a, // InvocationID.x;.
+	0x69, 0x66, 0x20, 0x28, 0x69, 0x69, 0x20, 0x3e, 0x3d, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, // if (ii >= counte
+	0x72, 0x5b, 0x30, 0x5d, 0x29, 0x0a, 0x7b, 0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x0a, // r[0]).{.return;.
+	0x7d, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x64, 0x78, 0x20, 0x3d, 0x20, 0x75, 0x69, 0x6e, // }.uint idx = uin
+	0x74, 0x28, 0x73, 0x6f, 0x72, 0x74, 0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5b, 0x69, 0x69, 0x5d, // t(sortBuffer[ii]
+	0x2e, 0x79, 0x29, 0x3b, 0x0a, 0x76, 0x65, 0x63, 0x34, 0x20, 0x70, 0x30, 0x20, 0x3d, 0x20, 0x70, // .y);.vec4 p0 = p
+	0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, 0x65, 0x73, 0x5b, 0x69, 0x64, 0x78, 0x2a, 0x34, 0x20, 0x2b, // articles[idx*4 +
+	0x20, 0x30, 0x5d, 0x3b, 0x0a, 0x76, 0x65, 0x63, 0x34, 0x20, 0x70, 0x31, 0x20, 0x3d, 0x20, 0x70, //  0];.vec4 p1 = p
+	0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, 0x65, 0x73, 0x5b, 0x69, 0x64, 0x78, 0x2a, 0x34, 0x20, 0x2b, // articles[idx*4 +
+	0x20, 0x31, 0x5d, 0x3b, 0x0a, 0x76, 0x65, 0x63, 0x34, 0x20, 0x70, 0x32, 0x20, 0x3d, 0x20, 0x70, //  1];.vec4 p2 = p
+	0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, 0x65, 0x73, 0x5b, 0x69, 0x64, 0x78, 0x2a, 0x34, 0x20, 0x2b, // articles[idx*4 +
+	0x20, 0x32, 0x5d, 0x3b, 0x0a, 0x76, 0x65, 0x63, 0x34, 0x20, 0x70, 0x33, 0x20, 0x3d, 0x20, 0x70, //  2];.vec4 p3 = p
+	0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, 0x65, 0x73, 0x5b, 0x69, 0x64, 0x78, 0x2a, 0x34, 0x20, 0x2b, // articles[idx*4 +
+	0x20, 0x33, 0x5d, 0x3b, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x6c, 0x69, 0x66, 0x65, 0x20, //  3];.float life 
+	0x3d, 0x20, 0x70, 0x30, 0x2e, 0x77, 0x3b, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x74, // = p0.w;.float tt
+	0x50, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x65, 0x61, 0x73, 0x65, 0x28, 0x30, 0x2c, 0x20, 0x6c, 0x69, // Pos = ease(0, li
+	0x66, 0x65, 0x29, 0x3b, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x74, 0x53, 0x63, 0x61, // fe);.float ttSca
+	0x6c, 0x65, 0x20, 0x3d, 0x20, 0x65, 0x61, 0x73, 0x65, 0x28, 0x31, 0x2c, 0x20, 0x6c, 0x69, 0x66, // le = ease(1, lif
+	0x65, 0x29, 0x3b, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x74, 0x42, 0x6c, 0x65, 0x6e, // e);.float ttBlen
+	0x64, 0x20, 0x3d, 0x20, 0x63, 0x6c, 0x61, 0x6d, 0x70, 0x28, 0x65, 0x61, 0x73, 0x65, 0x28, 0x32, // d = clamp(ease(2
+	0x2c, 0x20, 0x6c, 0x69, 0x66, 0x65, 0x29, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x31, 0x2e, // , life), 0.0, 1.
+	0x30, 0x29, 0x3b, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x74, 0x52, 0x67, 0x62, 0x61, // 0);.float ttRgba
+	0x20, 0x3d, 0x20, 0x63, 0x6c, 0x61, 0x6d, 0x70, 0x28, 0x65, 0x61, 0x73, 0x65, 0x28, 0x33, 0x2c, //  = clamp(ease(3,
+	0x20, 0x6c, 0x69, 0x66, 0x65, 0x29, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x31, 0x2e, 0x30, //  life), 0.0, 1.0
+	0x29, 0x3b, 0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, 0x70, 0x70, 0x30, 0x20, 0x3d, 0x20, 0x6d, 0x69, // );.vec3 pp0 = mi
+	0x78, 0x28, 0x70, 0x30, 0x2e, 0x78, 0x79, 0x7a, 0x2c, 0x20, 0x70, 0x31, 0x2e, 0x78, 0x79, 0x7a, // x(p0.xyz, p1.xyz
+	0x2c, 0x20, 0x74, 0x74, 0x50, 0x6f, 0x73, 0x29, 0x3b, 0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, 0x70, // , ttPos);.vec3 p
+	0x70, 0x31, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x78, 0x28, 0x70, 0x31, 0x2e, 0x78, 0x79, 0x7a, 0x2c, // p1 = mix(p1.xyz,
+	0x20, 0x70, 0x32, 0x2e, 0x78, 0x79, 0x7a, 0x2c, 0x20, 0x74, 0x74, 0x50, 0x6f, 0x73, 0x29, 0x3b, //  p2.xyz, ttPos);
+	0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, 0x70, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x78, 0x28, // .vec3 pos = mix(
+	0x70, 0x70, 0x30, 0x2c, 0x20, 0x70, 0x70, 0x31, 0x2c, 0x20, 0x74, 0x74, 0x50, 0x6f, 0x73, 0x29, // pp0, pp1, ttPos)
+	0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x72, 0x67, 0x62, 0x61, 0x49, 0x64, 0x78, 0x20, 0x3d, 0x20, // ;.int rgbaIdx = 
+	0x6d, 0x69, 0x6e, 0x28, 0x69, 0x6e, 0x74, 0x28, 0x74, 0x74, 0x52, 0x67, 0x62, 0x61, 0x2a, 0x34, // min(int(ttRgba*4
+	0x2e, 0x30, 0x29, 0x2c, 0x20, 0x33, 0x29, 0x3b, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, // .0), 3);.float t
+	0x74, 0x6d, 0x6f, 0x64, 0x20, 0x3d, 0x20, 0x74, 0x74, 0x52, 0x67, 0x62, 0x61, 0x2a, 0x34, 0x2e, // tmod = ttRgba*4.
+	0x30, 0x20, 0x2d, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x72, 0x67, 0x62, 0x61, 0x49, 0x64, // 0 - float(rgbaId
+	0x78, 0x29, 0x3b, 0x0a, 0x76, 0x65, 0x63, 0x34, 0x20, 0x72, 0x67, 0x62, 0x61, 0x20, 0x3d, 0x20, // x);.vec4 rgba = 
+	0x6d, 0x69, 0x78, 0x28, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x38, // mix(u_psParams[8
+	0x20, 0x2b, 0x20, 0x28, 0x72, 0x67, 0x62, 0x61, 0x49, 0x64, 0x78, 0x29, 0x5d, 0x2c, 0x20, 0x75, //  + (rgbaIdx)], u
+	0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x38, 0x20, 0x2b, 0x20, 0x28, 0x72, // _psParams[8 + (r
+	0x67, 0x62, 0x61, 0x49, 0x64, 0x78, 0x2b, 0x31, 0x29, 0x5d, 0x2c, 0x20, 0x74, 0x74, 0x6d, 0x6f, // gbaIdx+1)], ttmo
+	0x64, 0x29, 0x3b, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x62, 0x6c, 0x65, 0x6e, 0x64, 0x20, // d);.float blend 
+	0x3d, 0x20, 0x6d, 0x69, 0x78, 0x28, 0x70, 0x32, 0x2e, 0x77, 0x2c, 0x20, 0x70, 0x33, 0x2e, 0x78, // = mix(p2.w, p3.x
+	0x2c, 0x20, 0x74, 0x74, 0x42, 0x6c, 0x65, 0x6e, 0x64, 0x29, 0x3b, 0x0a, 0x66, 0x6c, 0x6f, 0x61, // , ttBlend);.floa
+	0x74, 0x20, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x78, 0x28, 0x70, 0x33, // t scale = mix(p3
+	0x2e, 0x79, 0x2c, 0x20, 0x70, 0x33, 0x2e, 0x7a, 0x2c, 0x20, 0x74, 0x74, 0x53, 0x63, 0x61, 0x6c, // .y, p3.z, ttScal
+	0x65, 0x29, 0x3b, 0x0a, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x73, 0x5b, 0x69, 0x69, // e);.instances[ii
+	0x2a, 0x34, 0x20, 0x2b, 0x20, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x70, // *4 + 0] = vec4(p
+	0x6f, 0x73, 0x2c, 0x20, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x29, 0x3b, 0x0a, 0x69, 0x6e, 0x73, 0x74, // os, scale);.inst
+	0x61, 0x6e, 0x63, 0x65, 0x73, 0x5b, 0x69, 0x69, 0x2a, 0x34, 0x20, 0x2b, 0x20, 0x31, 0x5d, 0x20, // ances[ii*4 + 1] 
+	0x3d, 0x20, 0x72, 0x67, 0x62, 0x61, 0x3b, 0x0a, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, // = rgba;.instance
+	0x73, 0x5b, 0x69, 0x69, 0x2a, 0x34, 0x20, 0x2b, 0x20, 0x32, 0x5d, 0x20, 0x3d, 0x20, 0x75, 0x5f, // s[ii*4 + 2] = u_
+	0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x37, 0x5d, 0x3b, 0x0a, 0x69, 0x6e, 0x73, // psParams[7];.ins
+	0x74, 0x61, 0x6e, 0x63, 0x65, 0x73, 0x5b, 0x69, 0x69, 0x2a, 0x34, 0x20, 0x2b, 0x20, 0x33, 0x5d, // tances[ii*4 + 3]
+	0x20, 0x3d, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x62, 0x6c, 0x65, 0x6e, 0x64, 0x2c, 0x20, 0x30, //  = vec4(blend, 0
+	0x2e, 0x30, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x29, 0x3b, 0x0a, 0x7d, // .0, 0.0, 0.0);.}
+	0x0a, 0x00,                                                                                     // ..
+};
+static const uint8_t cs_ps_instances_spv[5220] =
+{
+	0x43, 0x53, 0x48, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0a, 0x75, // CSH............u
+	0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x02, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, // _psParams.0..0..
+	0x00, 0x07, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x41, 0x01, 0x12, 0x00, 0x07, 0x00, 0x00, // ..counterA......
+	0x00, 0x0a, 0x73, 0x6f, 0x72, 0x74, 0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x41, 0x00, 0x11, 0x00, // ..sortBufferA...
+	0x07, 0x00, 0x00, 0x00, 0x09, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, 0x65, 0x73, 0x41, 0x00, // .....particlesA.
+	0x10, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x73, // .......instances
+	0x01, 0x00, 0x13, 0x00, 0x07, 0x00, 0x00, 0x00, 0xf4, 0x13, 0x00, 0x00, 0x03, 0x02, 0x23, 0x07, // ..............#.
+	0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x08, 0x00, 0x16, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ................
+	0x11, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, // ................
+	0x47, 0x4c, 0x53, 0x4c, 0x2e, 0x73, 0x74, 0x64, 0x2e, 0x34, 0x35, 0x30, 0x00, 0x00, 0x00, 0x00, // GLSL.std.450....
+	0x0e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x06, 0x00, // ................
+	0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, // ........main....
+	0x44, 0x01, 0x00, 0x00, 0x10, 0x00, 0x06, 0x00, 0x04, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, // D...............
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, // ................
+	0x05, 0x00, 0x00, 0x00, 0xf4, 0x01, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, // ................
+	0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x60, 0x00, 0x00, 0x00, // main........`...
+	0x55, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x00, 0x00, 0x00, 0x00, // UniformBlock....
+	0x06, 0x00, 0x06, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x5f, 0x70, 0x73, // ....`.......u_ps
+	0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00, 0x62, 0x00, 0x00, 0x00, // Params......b...
+	0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x85, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x75, 0x6e, // ............coun
+	0x74, 0x65, 0x72, 0x00, 0x06, 0x00, 0x05, 0x00, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ter.............
+	0x40, 0x64, 0x61, 0x74, 0x61, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x87, 0x00, 0x00, 0x00, // @data...........
+	0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x00, 0x05, 0x00, 0x05, 0x00, 0x92, 0x00, 0x00, 0x00, // counter.........
+	0x73, 0x6f, 0x72, 0x74, 0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x00, 0x00, 0x06, 0x00, 0x05, 0x00, // sortBuffer......
+	0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x64, 0x61, 0x74, 0x61, 0x00, 0x00, 0x00, // ........@data...
+	0x05, 0x00, 0x05, 0x00, 0x94, 0x00, 0x00, 0x00, 0x73, 0x6f, 0x72, 0x74, 0x42, 0x75, 0x66, 0x66, // ........sortBuff
+	0x65, 0x72, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x70, 0x61, 0x72, 0x74, // er..........part
+	0x69, 0x63, 0x6c, 0x65, 0x73, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x23, 0x01, 0x00, 0x00, // icles.......#...
+	0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x73, 0x00, 0x00, 0x00, 0x06, 0x00, 0x05, 0x00, // instances.......
+	0x23, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x64, 0x61, 0x74, 0x61, 0x00, 0x00, 0x00, // #.......@data...
+	0x05, 0x00, 0x05, 0x00, 0x25, 0x01, 0x00, 0x00, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, // ....%...instance
+	0x73, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0x44, 0x01, 0x00, 0x00, 0x67, 0x6c, 0x5f, 0x47, // s.......D...gl_G
+	0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, // lobalInvocationI
+	0x44, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, // D...G..._.......
+	0x10, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ....H...`.......
+	0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x60, 0x00, 0x00, 0x00, // #.......G...`...
+	0x02, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x62, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, // ....G...b..."...
+	0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x62, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, // ....G...b...!...
+	0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x84, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, // ....G...........
+	0x04, 0x00, 0x00, 0x00, 0x48, 0x00, 0x04, 0x00, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ....H...........
+	0x18, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ....H...........
+	0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x85, 0x00, 0x00, 0x00, // #.......G.......
+	0x03, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x87, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, // ....G......."...
+	0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x87, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, // ....G.......!...
+	0x12, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x91, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, // ....G...........
+	0x10, 0x00, 0x00, 0x00, 0x48, 0x00, 0x04, 0x00, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ....H...........
+	0x18, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ....H...........
+	0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x92, 0x00, 0x00, 0x00, // #.......G.......
+	0x03, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x94, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, // ....G......."...
+	0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x94, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, // ....G.......!...
+	0x11, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, // ....G......."...
+	0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, // ....G.......!...
+	0x10, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x22, 0x01, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, // ....G...".......
+	0x10, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x23, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ....H...#.......
+	0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x23, 0x01, 0x00, 0x00, // #.......G...#...
+	0x03, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x25, 0x01, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, // ....G...%..."...
+	0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x25, 0x01, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, // ....G...%...!...
+	0x13, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x44, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, // ....G...D.......
+	0x1c, 0x00, 0x00, 0x00, 0x13, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x21, 0x00, 0x03, 0x00, // ............!...
+	0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x16, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00, // ................
+	0x20, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, //  ...............
+	0x03, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, // ................
+	0x04, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, // ............ ...
+	0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x25, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, // ........%.......
+	0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, // ....+.......?...
+	0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, // ....+.......@...
+	0x00, 0x00, 0x80, 0x3f, 0x2b, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, // ...?+.......B...
+	0x00, 0x00, 0xf8, 0x41, 0x2b, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, // ...A+.......J...
+	0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, // ....+.......L...
+	0x1f, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, // ....+.......O...
+	0x40, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, // @.......]... ...
+	0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, // ....+...]...^...
+	0x30, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x04, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, // 0......._.......
+	0x5e, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00, 0x60, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, // ^.......`..._...
+	0x20, 0x00, 0x04, 0x00, 0x61, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, //  ...a.......`...
+	0x3b, 0x00, 0x04, 0x00, 0x61, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, // ;...a...b.......
+	0x2b, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // +.......c.......
+	0x2b, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, // +.......e.......
+	0x20, 0x00, 0x04, 0x00, 0x69, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, //  ...i...........
+	0x2b, 0x00, 0x04, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // +...]...........
+	0x1d, 0x00, 0x03, 0x00, 0x84, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00, // ........].......
+	0x85, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x86, 0x00, 0x00, 0x00, // ........ .......
+	0x02, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x86, 0x00, 0x00, 0x00, // ........;.......
+	0x87, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x88, 0x00, 0x00, 0x00, // ........ .......
+	0x02, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0x00, 0x8b, 0x00, 0x00, 0x00, // ....]...........
+	0x1d, 0x00, 0x03, 0x00, 0x91, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00, // ................
+	0x92, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x93, 0x00, 0x00, 0x00, // ........ .......
+	0x02, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x93, 0x00, 0x00, 0x00, // ........;.......
+	0x94, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x5d, 0x00, 0x00, 0x00, // ........+...]...
+	0x96, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x93, 0x00, 0x00, 0x00, // ........;.......
+	0x9b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x5d, 0x00, 0x00, 0x00, // ........+...]...
+	0x9d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0xa0, 0x00, 0x00, 0x00, // ........ .......
+	0x02, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x5d, 0x00, 0x00, 0x00, // ........+...]...
+	0xac, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x5d, 0x00, 0x00, 0x00, // ........+...]...
+	0xb3, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, // ........+.......
+	0xcc, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, // ........+.......
+	0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x2b, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, // .......@+.......
+	0xfe, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x03, 0x00, 0x22, 0x01, 0x00, 0x00, // ............"...
+	0x16, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00, 0x23, 0x01, 0x00, 0x00, 0x22, 0x01, 0x00, 0x00, // ........#..."...
+	0x20, 0x00, 0x04, 0x00, 0x24, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x23, 0x01, 0x00, 0x00, //  ...$.......#...
+	0x3b, 0x00, 0x04, 0x00, 0x24, 0x01, 0x00, 0x00, 0x25, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, // ;...$...%.......
+	0x2b, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x38, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, // +.......8.......
+	0x20, 0x00, 0x04, 0x00, 0x43, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, //  ...C.......%...
+	0x3b, 0x00, 0x04, 0x00, 0x43, 0x01, 0x00, 0x00, 0x44, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, // ;...C...D.......
+	0x2b, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x12, 0x03, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, // +...........`...
+	0x2b, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x13, 0x03, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, // +...............
+	0x2b, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x14, 0x03, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, // +...............
+	0x2b, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x15, 0x03, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, // +...............
+	0x36, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 6...............
+	0x03, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x05, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, // ............=...
+	0x25, 0x00, 0x00, 0x00, 0x45, 0x01, 0x00, 0x00, 0x44, 0x01, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, // %...E...D.......
+	0x0f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x03, 0x00, 0x7f, 0x00, 0x00, 0x00, // ................
+	0x92, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x92, 0x01, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, // ............Q...
+	0x1e, 0x00, 0x00, 0x00, 0x94, 0x01, 0x00, 0x00, 0x45, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ........E.......
+	0x7c, 0x00, 0x04, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x95, 0x01, 0x00, 0x00, 0x94, 0x01, 0x00, 0x00, // |...]...........
+	0x41, 0x00, 0x06, 0x00, 0x88, 0x00, 0x00, 0x00, 0x97, 0x01, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, // A...............
+	0x63, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x5d, 0x00, 0x00, 0x00, // c...c...=...]...
+	0x98, 0x01, 0x00, 0x00, 0x97, 0x01, 0x00, 0x00, 0xae, 0x00, 0x05, 0x00, 0x8b, 0x00, 0x00, 0x00, // ................
+	0x99, 0x01, 0x00, 0x00, 0x95, 0x01, 0x00, 0x00, 0x98, 0x01, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, // ................
+	0x9b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x99, 0x01, 0x00, 0x00, // ................
+	0x9a, 0x01, 0x00, 0x00, 0x9b, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x9a, 0x01, 0x00, 0x00, // ................
+	0xf9, 0x00, 0x02, 0x00, 0x0f, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x9b, 0x01, 0x00, 0x00, // ................
+	0x41, 0x00, 0x07, 0x00, 0x69, 0x00, 0x00, 0x00, 0x9d, 0x01, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, // A...i...........
+	0x63, 0x00, 0x00, 0x00, 0x95, 0x01, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, // c...........=...
+	0x06, 0x00, 0x00, 0x00, 0x9e, 0x01, 0x00, 0x00, 0x9d, 0x01, 0x00, 0x00, 0x6d, 0x00, 0x04, 0x00, // ............m...
+	0x5d, 0x00, 0x00, 0x00, 0x9f, 0x01, 0x00, 0x00, 0x9e, 0x01, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, // ]...............
+	0x5d, 0x00, 0x00, 0x00, 0xa1, 0x01, 0x00, 0x00, 0x9f, 0x01, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, // ]...............
+	0x41, 0x00, 0x06, 0x00, 0xa0, 0x00, 0x00, 0x00, 0xa3, 0x01, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00, // A...............
+	0x63, 0x00, 0x00, 0x00, 0xa1, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, // c.......=.......
+	0xa4, 0x01, 0x00, 0x00, 0xa3, 0x01, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x5d, 0x00, 0x00, 0x00, // ............]...
+	0xa6, 0x01, 0x00, 0x00, 0x9f, 0x01, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, // ................
+	0x5d, 0x00, 0x00, 0x00, 0xa7, 0x01, 0x00, 0x00, 0xa6, 0x01, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, // ]...............
+	0x41, 0x00, 0x06, 0x00, 0xa0, 0x00, 0x00, 0x00, 0xa8, 0x01, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00, // A...............
+	0x63, 0x00, 0x00, 0x00, 0xa7, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, // c.......=.......
+	0xa9, 0x01, 0x00, 0x00, 0xa8, 0x01, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x5d, 0x00, 0x00, 0x00, // ............]...
+	0xab, 0x01, 0x00, 0x00, 0x9f, 0x01, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, // ................
+	0x5d, 0x00, 0x00, 0x00, 0xac, 0x01, 0x00, 0x00, 0xab, 0x01, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, // ]...............
+	0x41, 0x00, 0x06, 0x00, 0xa0, 0x00, 0x00, 0x00, 0xad, 0x01, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00, // A...............
+	0x63, 0x00, 0x00, 0x00, 0xac, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, // c.......=.......
+	0xae, 0x01, 0x00, 0x00, 0xad, 0x01, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x5d, 0x00, 0x00, 0x00, // ............]...
+	0xb0, 0x01, 0x00, 0x00, 0x9f, 0x01, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, // ................
+	0x5d, 0x00, 0x00, 0x00, 0xb1, 0x01, 0x00, 0x00, 0xb0, 0x01, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00, // ]...............
+	0x41, 0x00, 0x06, 0x00, 0xa0, 0x00, 0x00, 0x00, 0xb2, 0x01, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00, // A...............
+	0x63, 0x00, 0x00, 0x00, 0xb1, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, // c.......=.......
+	0xb3, 0x01, 0x00, 0x00, 0xb2, 0x01, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, // ........Q.......
+	0xb5, 0x01, 0x00, 0x00, 0xa4, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, // ................
+	0x06, 0x00, 0x00, 0x00, 0x1e, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, // ............+...
+	0xb5, 0x01, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, // ....?...@.......
+	0x06, 0x00, 0x00, 0x00, 0x1f, 0x02, 0x00, 0x00, 0x1e, 0x02, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, // ............B...
+	0x0c, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x21, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, // ........!.......
+	0x08, 0x00, 0x00, 0x00, 0x1f, 0x02, 0x00, 0x00, 0x6e, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, // ........n.......
+	0x22, 0x02, 0x00, 0x00, 0x21, 0x02, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00, // "...!...........
+	0x24, 0x02, 0x00, 0x00, 0x22, 0x02, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, // $..."...J.......
+	0x1e, 0x00, 0x00, 0x00, 0x25, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, // ....%.......'...
+	0x24, 0x02, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00, // $...L...........
+	0x2b, 0x02, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x22, 0x02, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, // +...O...".......
+	0x1e, 0x00, 0x00, 0x00, 0x2e, 0x02, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x25, 0x02, 0x00, 0x00, // ........O...%...
+	0x87, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x30, 0x02, 0x00, 0x00, 0x2b, 0x02, 0x00, 0x00, // ........0...+...
+	0x65, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x32, 0x02, 0x00, 0x00, // e...........2...
+	0x2b, 0x02, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x41, 0x00, 0x07, 0x00, 0x69, 0x00, 0x00, 0x00, // +...e...A...i...
+	0x33, 0x02, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x30, 0x02, 0x00, 0x00, // 3...b...c...0...
+	0x32, 0x02, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x34, 0x02, 0x00, 0x00, // 2...=.......4...
+	0x33, 0x02, 0x00, 0x00, 0x87, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x36, 0x02, 0x00, 0x00, // 3...........6...
+	0x2e, 0x02, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00, // ....e...........
+	0x38, 0x02, 0x00, 0x00, 0x2e, 0x02, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x41, 0x00, 0x07, 0x00, // 8.......e...A...
+	0x69, 0x00, 0x00, 0x00, 0x39, 0x02, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, // i...9...b...c...
+	0x36, 0x02, 0x00, 0x00, 0x38, 0x02, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, // 6...8...=.......
+	0x3a, 0x02, 0x00, 0x00, 0x39, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, // :...9...........
+	0x3c, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x1f, 0x02, 0x00, 0x00, // <...............
+	0x0c, 0x00, 0x08, 0x00, 0x06, 0x00, 0x00, 0x00, 0x45, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, // ........E.......
+	0x2e, 0x00, 0x00, 0x00, 0x34, 0x02, 0x00, 0x00, 0x3a, 0x02, 0x00, 0x00, 0x3c, 0x02, 0x00, 0x00, // ....4...:...<...
+	0x0c, 0x00, 0x08, 0x00, 0x06, 0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, // ........T.......
+	0x2b, 0x00, 0x00, 0x00, 0xb5, 0x01, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, // +.......?...@...
+	0x85, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x55, 0x02, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, // ........U...T...
+	0x42, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x57, 0x02, 0x00, 0x00, // B...........W...
+	0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x55, 0x02, 0x00, 0x00, 0x6e, 0x00, 0x04, 0x00, // ........U...n...
+	0x1e, 0x00, 0x00, 0x00, 0x58, 0x02, 0x00, 0x00, 0x57, 0x02, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, // ....X...W.......
+	0x1e, 0x00, 0x00, 0x00, 0x5a, 0x02, 0x00, 0x00, 0x58, 0x02, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, // ....Z...X...J...
+	0x0c, 0x00, 0x07, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x5b, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, // ........[.......
+	0x27, 0x00, 0x00, 0x00, 0x5a, 0x02, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, // '...Z...L.......
+	0x1e, 0x00, 0x00, 0x00, 0x61, 0x02, 0x00, 0x00, 0x12, 0x03, 0x00, 0x00, 0x58, 0x02, 0x00, 0x00, // ....a.......X...
+	0x80, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x64, 0x02, 0x00, 0x00, 0x12, 0x03, 0x00, 0x00, // ........d.......
+	0x5b, 0x02, 0x00, 0x00, 0x87, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x66, 0x02, 0x00, 0x00, // [...........f...
+	0x61, 0x02, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00, // a...e...........
+	0x68, 0x02, 0x00, 0x00, 0x61, 0x02, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x41, 0x00, 0x07, 0x00, // h...a...e...A...
+	0x69, 0x00, 0x00, 0x00, 0x69, 0x02, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, // i...i...b...c...
+	0x66, 0x02, 0x00, 0x00, 0x68, 0x02, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, // f...h...=.......
+	0x6a, 0x02, 0x00, 0x00, 0x69, 0x02, 0x00, 0x00, 0x87, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00, // j...i...........
+	0x6c, 0x02, 0x00, 0x00, 0x64, 0x02, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x05, 0x00, // l...d...e.......
+	0x1e, 0x00, 0x00, 0x00, 0x6e, 0x02, 0x00, 0x00, 0x64, 0x02, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, // ....n...d...e...
+	0x41, 0x00, 0x07, 0x00, 0x69, 0x00, 0x00, 0x00, 0x6f, 0x02, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, // A...i...o...b...
+	0x63, 0x00, 0x00, 0x00, 0x6c, 0x02, 0x00, 0x00, 0x6e, 0x02, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, // c...l...n...=...
+	0x06, 0x00, 0x00, 0x00, 0x70, 0x02, 0x00, 0x00, 0x6f, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, // ....p...o.......
+	0x06, 0x00, 0x00, 0x00, 0x72, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, // ....r...........
+	0x55, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x06, 0x00, 0x00, 0x00, 0x7b, 0x02, 0x00, 0x00, // U...........{...
+	0x01, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x6a, 0x02, 0x00, 0x00, 0x70, 0x02, 0x00, 0x00, // ........j...p...
+	0x72, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x06, 0x00, 0x00, 0x00, 0x8a, 0x02, 0x00, 0x00, // r...............
+	0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0xb5, 0x01, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, // ....+.......?...
+	0x40, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x8b, 0x02, 0x00, 0x00, // @...............
+	0x8a, 0x02, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, // ....B...........
+	0x8d, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x8b, 0x02, 0x00, 0x00, // ................
+	0x6e, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x8e, 0x02, 0x00, 0x00, 0x8d, 0x02, 0x00, 0x00, // n...............
+	0x80, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x90, 0x02, 0x00, 0x00, 0x8e, 0x02, 0x00, 0x00, // ................
+	0x4a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x91, 0x02, 0x00, 0x00, // J...............
+	0x01, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x90, 0x02, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, // ....'.......L...
+	0x80, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x97, 0x02, 0x00, 0x00, 0x13, 0x03, 0x00, 0x00, // ................
+	0x8e, 0x02, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x9a, 0x02, 0x00, 0x00, // ................
+	0x13, 0x03, 0x00, 0x00, 0x91, 0x02, 0x00, 0x00, 0x87, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00, // ................
+	0x9c, 0x02, 0x00, 0x00, 0x97, 0x02, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x05, 0x00, // ........e.......
+	0x1e, 0x00, 0x00, 0x00, 0x9e, 0x02, 0x00, 0x00, 0x97, 0x02, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, // ............e...
+	0x41, 0x00, 0x07, 0x00, 0x69, 0x00, 0x00, 0x00, 0x9f, 0x02, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, // A...i.......b...
+	0x63, 0x00, 0x00, 0x00, 0x9c, 0x02, 0x00, 0x00, 0x9e, 0x02, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, // c...........=...
+	0x06, 0x00, 0x00, 0x00, 0xa0, 0x02, 0x00, 0x00, 0x9f, 0x02, 0x00, 0x00, 0x87, 0x00, 0x05, 0x00, // ................
+	0x1e, 0x00, 0x00, 0x00, 0xa2, 0x02, 0x00, 0x00, 0x9a, 0x02, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, // ............e...
+	0x8b, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xa4, 0x02, 0x00, 0x00, 0x9a, 0x02, 0x00, 0x00, // ................
+	0x65, 0x00, 0x00, 0x00, 0x41, 0x00, 0x07, 0x00, 0x69, 0x00, 0x00, 0x00, 0xa5, 0x02, 0x00, 0x00, // e...A...i.......
+	0x62, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0xa2, 0x02, 0x00, 0x00, 0xa4, 0x02, 0x00, 0x00, // b...c...........
+	0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0xa6, 0x02, 0x00, 0x00, 0xa5, 0x02, 0x00, 0x00, // =...............
+	0x0c, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0xa8, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, // ................
+	0x0a, 0x00, 0x00, 0x00, 0x8b, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x06, 0x00, 0x00, 0x00, // ................
+	0xb1, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xa0, 0x02, 0x00, 0x00, // ................
+	0xa6, 0x02, 0x00, 0x00, 0xa8, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x06, 0x00, 0x00, 0x00, // ................
+	0xbc, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0xb1, 0x02, 0x00, 0x00, // ........+.......
+	0x3f, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x06, 0x00, 0x00, 0x00, // ?...@...........
+	0xc0, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0xb5, 0x01, 0x00, 0x00, // ........+.......
+	0x3f, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, // ?...@...........
+	0xc1, 0x02, 0x00, 0x00, 0xc0, 0x02, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, // ........B.......
+	0x06, 0x00, 0x00, 0x00, 0xc3, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, // ................
+	0xc1, 0x02, 0x00, 0x00, 0x6e, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, // ....n...........
+	0xc3, 0x02, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xc6, 0x02, 0x00, 0x00, // ................
+	0xc4, 0x02, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x1e, 0x00, 0x00, 0x00, // ....J...........
+	0xc7, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0xc6, 0x02, 0x00, 0x00, // ........'.......
+	0x4c, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xcd, 0x02, 0x00, 0x00, // L...............
+	0x14, 0x03, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00, // ................
+	0xd0, 0x02, 0x00, 0x00, 0x14, 0x03, 0x00, 0x00, 0xc7, 0x02, 0x00, 0x00, 0x87, 0x00, 0x05, 0x00, // ................
+	0x1e, 0x00, 0x00, 0x00, 0xd2, 0x02, 0x00, 0x00, 0xcd, 0x02, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, // ............e...
+	0x8b, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xd4, 0x02, 0x00, 0x00, 0xcd, 0x02, 0x00, 0x00, // ................
+	0x65, 0x00, 0x00, 0x00, 0x41, 0x00, 0x07, 0x00, 0x69, 0x00, 0x00, 0x00, 0xd5, 0x02, 0x00, 0x00, // e...A...i.......
+	0x62, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0xd2, 0x02, 0x00, 0x00, 0xd4, 0x02, 0x00, 0x00, // b...c...........
+	0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0xd6, 0x02, 0x00, 0x00, 0xd5, 0x02, 0x00, 0x00, // =...............
+	0x87, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xd8, 0x02, 0x00, 0x00, 0xd0, 0x02, 0x00, 0x00, // ................
+	0x65, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xda, 0x02, 0x00, 0x00, // e...............
+	0xd0, 0x02, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x41, 0x00, 0x07, 0x00, 0x69, 0x00, 0x00, 0x00, // ....e...A...i...
+	0xdb, 0x02, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0xd8, 0x02, 0x00, 0x00, // ....b...c.......
+	0xda, 0x02, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0xdc, 0x02, 0x00, 0x00, // ....=...........
+	0xdb, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0xde, 0x02, 0x00, 0x00, // ................
+	0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xc1, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, // ................
+	0x06, 0x00, 0x00, 0x00, 0xe7, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, // ................
+	0xd6, 0x02, 0x00, 0x00, 0xdc, 0x02, 0x00, 0x00, 0xde, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, // ................
+	0x06, 0x00, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, // ............+...
+	0xe7, 0x02, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00, // ....?...@...P...
+	0x0e, 0x00, 0x00, 0x00, 0xc1, 0x01, 0x00, 0x00, 0x45, 0x02, 0x00, 0x00, 0x45, 0x02, 0x00, 0x00, // ........E...E...
+	0x45, 0x02, 0x00, 0x00, 0x4f, 0x00, 0x08, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xc3, 0x01, 0x00, 0x00, // E...O...........
+	0xa4, 0x01, 0x00, 0x00, 0xa4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, // ................
+	0x02, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x08, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xc5, 0x01, 0x00, 0x00, // ....O...........
+	0xa9, 0x01, 0x00, 0x00, 0xa9, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, // ................
+	0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xed, 0x02, 0x00, 0x00, // ................
+	0x01, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xc3, 0x01, 0x00, 0x00, 0xc5, 0x01, 0x00, 0x00, // ................
+	0xc1, 0x01, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xc8, 0x01, 0x00, 0x00, // ....P...........
+	0x45, 0x02, 0x00, 0x00, 0x45, 0x02, 0x00, 0x00, 0x45, 0x02, 0x00, 0x00, 0x4f, 0x00, 0x08, 0x00, // E...E...E...O...
+	0x0e, 0x00, 0x00, 0x00, 0xca, 0x01, 0x00, 0x00, 0xa9, 0x01, 0x00, 0x00, 0xa9, 0x01, 0x00, 0x00, // ................
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x08, 0x00, // ............O...
+	0x0e, 0x00, 0x00, 0x00, 0xcc, 0x01, 0x00, 0x00, 0xae, 0x01, 0x00, 0x00, 0xae, 0x01, 0x00, 0x00, // ................
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, // ................
+	0x0e, 0x00, 0x00, 0x00, 0xf3, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, // ................
+	0xca, 0x01, 0x00, 0x00, 0xcc, 0x01, 0x00, 0x00, 0xc8, 0x01, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00, // ............P...
+	0x0e, 0x00, 0x00, 0x00, 0xcf, 0x01, 0x00, 0x00, 0x45, 0x02, 0x00, 0x00, 0x45, 0x02, 0x00, 0x00, // ........E...E...
+	0x45, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xf9, 0x02, 0x00, 0x00, // E...............
+	0x01, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xed, 0x02, 0x00, 0x00, 0xf3, 0x02, 0x00, 0x00, // ................
+	0xcf, 0x01, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0xd4, 0x01, 0x00, 0x00, // ................
+	0xbf, 0x01, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, // ........n.......
+	0xd5, 0x01, 0x00, 0x00, 0xd4, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x1e, 0x00, 0x00, 0x00, // ................
+	0xd6, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0xd5, 0x01, 0x00, 0x00, // ........'.......
+	0xcc, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0xd8, 0x01, 0x00, 0x00, // ................
+	0xbf, 0x01, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, // ........o.......
+	0xda, 0x01, 0x00, 0x00, 0xd6, 0x01, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, // ................
+	0xdb, 0x01, 0x00, 0x00, 0xd8, 0x01, 0x00, 0x00, 0xda, 0x01, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, // ................
+	0x1e, 0x00, 0x00, 0x00, 0xdd, 0x01, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0xd6, 0x01, 0x00, 0x00, // ................
+	0x80, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00, 0xd6, 0x01, 0x00, 0x00, // ................
+	0x15, 0x03, 0x00, 0x00, 0x50, 0x00, 0x07, 0x00, 0x16, 0x00, 0x00, 0x00, 0xe2, 0x01, 0x00, 0x00, // ....P...........
+	0xdb, 0x01, 0x00, 0x00, 0xdb, 0x01, 0x00, 0x00, 0xdb, 0x01, 0x00, 0x00, 0xdb, 0x01, 0x00, 0x00, // ................
+	0x41, 0x00, 0x06, 0x00, 0xa0, 0x00, 0x00, 0x00, 0xe3, 0x01, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, // A...........b...
+	0x63, 0x00, 0x00, 0x00, 0xdd, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, // c.......=.......
+	0xe4, 0x01, 0x00, 0x00, 0xe3, 0x01, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0xa0, 0x00, 0x00, 0x00, // ........A.......
+	0xe5, 0x01, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00, // ....b...c.......
+	0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0xe6, 0x01, 0x00, 0x00, 0xe5, 0x01, 0x00, 0x00, // =...............
+	0x0c, 0x00, 0x08, 0x00, 0x16, 0x00, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, // ................
+	0x2e, 0x00, 0x00, 0x00, 0xe4, 0x01, 0x00, 0x00, 0xe6, 0x01, 0x00, 0x00, 0xe2, 0x01, 0x00, 0x00, // ................
+	0x51, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0xe9, 0x01, 0x00, 0x00, 0xae, 0x01, 0x00, 0x00, // Q...............
+	0x03, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0xeb, 0x01, 0x00, 0x00, // ....Q...........
+	0xb3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x06, 0x00, 0x00, 0x00, // ................
+	0x05, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xe9, 0x01, 0x00, 0x00, // ................
+	0xeb, 0x01, 0x00, 0x00, 0xbc, 0x01, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, // ........Q.......
+	0xef, 0x01, 0x00, 0x00, 0xb3, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, // ............Q...
+	0x06, 0x00, 0x00, 0x00, 0xf1, 0x01, 0x00, 0x00, 0xb3, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, // ................
+	0x0c, 0x00, 0x08, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0b, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, // ................
+	0x2e, 0x00, 0x00, 0x00, 0xef, 0x01, 0x00, 0x00, 0xf1, 0x01, 0x00, 0x00, 0x7b, 0x02, 0x00, 0x00, // ............{...
+	0x84, 0x00, 0x05, 0x00, 0x5d, 0x00, 0x00, 0x00, 0xf5, 0x01, 0x00, 0x00, 0x95, 0x01, 0x00, 0x00, // ....]...........
+	0x9d, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0xf9, 0x01, 0x00, 0x00, // ....Q...........
+	0xf9, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, // ........Q.......
+	0xfa, 0x01, 0x00, 0x00, 0xf9, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, // ............Q...
+	0x06, 0x00, 0x00, 0x00, 0xfb, 0x01, 0x00, 0x00, 0xf9, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, // ................
+	0x50, 0x00, 0x07, 0x00, 0x16, 0x00, 0x00, 0x00, 0xfc, 0x01, 0x00, 0x00, 0xf9, 0x01, 0x00, 0x00, // P...............
+	0xfa, 0x01, 0x00, 0x00, 0xfb, 0x01, 0x00, 0x00, 0x0b, 0x03, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, // ............A...
+	0xa0, 0x00, 0x00, 0x00, 0xfd, 0x01, 0x00, 0x00, 0x25, 0x01, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, // ........%...c...
+	0xf5, 0x01, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0xfd, 0x01, 0x00, 0x00, 0xfc, 0x01, 0x00, 0x00, // ....>...........
+	0x84, 0x00, 0x05, 0x00, 0x5d, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x95, 0x01, 0x00, 0x00, // ....]...........
+	0x9d, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, // ........].......
+	0xff, 0x01, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0xa0, 0x00, 0x00, 0x00, // ........A.......
+	0x02, 0x02, 0x00, 0x00, 0x25, 0x01, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, // ....%...c.......
+	0x3e, 0x00, 0x03, 0x00, 0x02, 0x02, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, // >...............
+	0x5d, 0x00, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x95, 0x01, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, // ]...............
+	0x80, 0x00, 0x05, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, // ....]...........
+	0xac, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x06, 0x02, 0x00, 0x00, // ....A...........
+	0x62, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x38, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, // b...c...8...=...
+	0x16, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0x06, 0x02, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, // ............A...
+	0xa0, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x25, 0x01, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, // ........%...c...
+	0x05, 0x02, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x08, 0x02, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, // ....>...........
+	0x84, 0x00, 0x05, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x0a, 0x02, 0x00, 0x00, 0x95, 0x01, 0x00, 0x00, // ....]...........
+	0x9d, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x0b, 0x02, 0x00, 0x00, // ........].......
+	0x0a, 0x02, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00, 0x50, 0x00, 0x07, 0x00, 0x16, 0x00, 0x00, 0x00, // ........P.......
+	0x0d, 0x02, 0x00, 0x00, 0x05, 0x03, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, // ........?...?...
+	0x3f, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x0e, 0x02, 0x00, 0x00, // ?...A...........
+	0x25, 0x01, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x0b, 0x02, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, // %...c.......>...
+	0x0e, 0x02, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x0f, 0x02, 0x00, 0x00, // ................
+	0xf8, 0x00, 0x02, 0x00, 0x0f, 0x02, 0x00, 0x00, 0xfd, 0x00, 0x01, 0x00, 0x38, 0x00, 0x01, 0x00, // ............8...
+	0x00, 0x00, 0x00, 0x03,                                                                         // ....
+};
+static const uint8_t cs_ps_instances_dx11[1] =
+{
+	0x00,                                                                                           // .
+};
+static const uint8_t cs_ps_instances_mtl[3147] =
+{
+	0x43, 0x53, 0x48, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0a, 0x75, // CSH............u
+	0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x02, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, // _psParams.0..0..
+	0x00, 0x0d, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x2e, 0x40, 0x64, 0x61, 0x74, 0x61, 0x01, // ..counter.@data.
+	0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x73, 0x6f, 0x72, 0x74, 0x42, 0x75, 0x66, 0x66, // ........sortBuff
+	0x65, 0x72, 0x2e, 0x40, 0x64, 0x61, 0x74, 0x61, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // er.@data........
+	0x0f, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, 0x65, 0x73, 0x2e, 0x40, 0x64, 0x61, 0x74, 0x61, // .particles.@data
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, // .........instanc
+	0x65, 0x73, 0x2e, 0x40, 0x64, 0x61, 0x74, 0x61, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // es.@data........
+	0x00, 0x01, 0x01, 0x00, 0x01, 0x00, 0xbd, 0x0b, 0x00, 0x00, 0x23, 0x69, 0x6e, 0x63, 0x6c, 0x75, // ..........#inclu
+	0x64, 0x65, 0x20, 0x3c, 0x6d, 0x65, 0x74, 0x61, 0x6c, 0x5f, 0x73, 0x74, 0x64, 0x6c, 0x69, 0x62, // de <metal_stdlib
+	0x3e, 0x0a, 0x23, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 0x3c, 0x73, 0x69, 0x6d, 0x64, // >.#include <simd
+	0x2f, 0x73, 0x69, 0x6d, 0x64, 0x2e, 0x68, 0x3e, 0x0a, 0x0a, 0x75, 0x73, 0x69, 0x6e, 0x67, 0x20, // /simd.h>..using 
+	0x6e, 0x61, 0x6d, 0x65, 0x73, 0x70, 0x61, 0x63, 0x65, 0x20, 0x6d, 0x65, 0x74, 0x61, 0x6c, 0x3b, // namespace metal;
+	0x0a, 0x0a, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, // ..struct _Global
+	0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, // .{.    float4 u_
+	0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x34, 0x38, 0x5d, 0x3b, 0x0a, 0x7d, 0x3b, // psParams[48];.};
+	0x0a, 0x0a, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, // ..struct counter
+	0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x64, 0x61, 0x74, // .{.    uint _dat
+	0x61, 0x5b, 0x31, 0x5d, 0x3b, 0x0a, 0x7d, 0x3b, 0x0a, 0x0a, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, // a[1];.};..struct
+	0x20, 0x73, 0x6f, 0x72, 0x74, 0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x0a, 0x7b, 0x0a, 0x20, 0x20, //  sortBuffer.{.  
+	0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x31, //   float4 _data[1
+	0x5d, 0x3b, 0x0a, 0x7d, 0x3b, 0x0a, 0x0a, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x69, 0x6e, // ];.};..struct in
+	0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x73, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, // stances.{.    fl
+	0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x31, 0x5d, 0x3b, 0x0a, 0x7d, // oat4 _data[1];.}
+	0x3b, 0x0a, 0x0a, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x78, // ;..kernel void x
+	0x6c, 0x61, 0x74, 0x4d, 0x74, 0x6c, 0x4d, 0x61, 0x69, 0x6e, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, // latMtlMain(const
+	0x61, 0x6e, 0x74, 0x20, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x26, 0x20, 0x5f, 0x6d, 0x74, // ant _Global& _mt
+	0x6c, 0x5f, 0x75, 0x20, 0x5b, 0x5b, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 0x30, 0x29, 0x5d, // l_u [[buffer(0)]
+	0x5d, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x20, // ], const device 
+	0x73, 0x6f, 0x72, 0x74, 0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x26, 0x20, 0x70, 0x61, 0x72, 0x74, // sortBuffer& part
+	0x69, 0x63, 0x6c, 0x65, 0x73, 0x20, 0x5b, 0x5b, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 0x31, // icles [[buffer(1
+	0x29, 0x5d, 0x5d, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x64, 0x65, 0x76, 0x69, 0x63, // )]], const devic
+	0x65, 0x20, 0x73, 0x6f, 0x72, 0x74, 0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x26, 0x20, 0x73, 0x6f, // e sortBuffer& so
+	0x72, 0x74, 0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x31, 0x20, 0x5b, 0x5b, 0x62, 0x75, 0x66, // rtBuffer_1 [[buf
+	0x66, 0x65, 0x72, 0x28, 0x32, 0x29, 0x5d, 0x5d, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, // fer(2)]], const 
+	0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x26, 0x20, // device counter& 
+	0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x5f, 0x31, 0x20, 0x5b, 0x5b, 0x62, 0x75, 0x66, 0x66, // counter_1 [[buff
+	0x65, 0x72, 0x28, 0x33, 0x29, 0x5d, 0x5d, 0x2c, 0x20, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x20, // er(3)]], device 
+	0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x73, 0x26, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x61, // instances& insta
+	0x6e, 0x63, 0x65, 0x73, 0x5f, 0x31, 0x20, 0x5b, 0x5b, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x28, // nces_1 [[buffer(
+	0x34, 0x29, 0x5d, 0x5d, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x20, 0x67, 0x6c, 0x5f, 0x47, // 4)]], uint3 gl_G
+	0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, // lobalInvocationI
+	0x44, 0x20, 0x5b, 0x5b, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x70, 0x6f, 0x73, 0x69, 0x74, // D [[thread_posit
+	0x69, 0x6f, 0x6e, 0x5f, 0x69, 0x6e, 0x5f, 0x67, 0x72, 0x69, 0x64, 0x5d, 0x5d, 0x29, 0x0a, 0x7b, // ion_in_grid]]).{
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x20, 0x28, 0x30, 0x75, 0x29, // .    switch (0u)
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, // .    {.        d
+	0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x3a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // efault:.        
+	0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, // {.            ui
+	0x6e, 0x74, 0x20, 0x5f, 0x34, 0x30, 0x35, 0x20, 0x3d, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x69, // nt _405 = uint(i
+	0x6e, 0x74, 0x33, 0x28, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, // nt3(gl_GlobalInv
+	0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x29, 0x2e, 0x78, 0x29, 0x3b, 0x0a, 0x20, // ocationID).x);. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x5f, //            if (_
+	0x34, 0x30, 0x35, 0x20, 0x3e, 0x3d, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x5f, 0x31, // 405 >= counter_1
+	0x2e, 0x5f, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x30, 0x5d, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, // ._data[0]).     
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //        {.       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, //          break;.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, //             }.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, //           float 
+	0x5f, 0x34, 0x31, 0x34, 0x20, 0x3d, 0x20, 0x73, 0x6f, 0x72, 0x74, 0x42, 0x75, 0x66, 0x66, 0x65, // _414 = sortBuffe
+	0x72, 0x5f, 0x31, 0x2e, 0x5f, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x5f, 0x34, 0x30, 0x35, 0x5d, 0x2e, // r_1._data[_405].
+	0x79, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, // y;.            u
+	0x69, 0x6e, 0x74, 0x20, 0x5f, 0x34, 0x31, 0x35, 0x20, 0x3d, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, // int _415 = uint(
+	0x5f, 0x34, 0x31, 0x34, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // _414);.         
+	0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x34, 0x31, 0x37, 0x20, 0x3d, 0x20, 0x5f, //    uint _417 = _
+	0x34, 0x31, 0x35, 0x20, 0x2a, 0x20, 0x34, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 415 * 4u;.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x34, 0x32, //       float4 _42
+	0x30, 0x20, 0x3d, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, 0x65, 0x73, 0x2e, 0x5f, 0x64, // 0 = particles._d
+	0x61, 0x74, 0x61, 0x5b, 0x5f, 0x34, 0x31, 0x37, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, // ata[_417];.     
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x34, 0x32, 0x33, //        uint _423
+	0x20, 0x3d, 0x20, 0x28, 0x5f, 0x34, 0x31, 0x35, 0x20, 0x2a, 0x20, 0x34, 0x75, 0x29, 0x20, 0x2b, //  = (_415 * 4u) +
+	0x20, 0x31, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  1u;.           
+	0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x34, 0x32, 0x38, 0x20, 0x3d, 0x20, 0x28, 0x5f, 0x34, //  uint _428 = (_4
+	0x31, 0x35, 0x20, 0x2a, 0x20, 0x34, 0x75, 0x29, 0x20, 0x2b, 0x20, 0x32, 0x75, 0x3b, 0x0a, 0x20, // 15 * 4u) + 2u;. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, //            float
+	0x34, 0x20, 0x5f, 0x34, 0x33, 0x30, 0x20, 0x3d, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, // 4 _430 = particl
+	0x65, 0x73, 0x2e, 0x5f, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x5f, 0x34, 0x32, 0x38, 0x5d, 0x3b, 0x0a, // es._data[_428];.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, //             uint
+	0x20, 0x5f, 0x34, 0x33, 0x33, 0x20, 0x3d, 0x20, 0x28, 0x5f, 0x34, 0x31, 0x35, 0x20, 0x2a, 0x20, //  _433 = (_415 * 
+	0x34, 0x75, 0x29, 0x20, 0x2b, 0x20, 0x33, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 4u) + 3u;.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x34, 0x33, //       float4 _43
+	0x35, 0x20, 0x3d, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, 0x65, 0x73, 0x2e, 0x5f, 0x64, // 5 = particles._d
+	0x61, 0x74, 0x61, 0x5b, 0x5f, 0x34, 0x33, 0x33, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, // ata[_433];.     
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x35, 0x34, //        float _54
+	0x33, 0x20, 0x3d, 0x20, 0x66, 0x61, 0x73, 0x74, 0x3a, 0x3a, 0x63, 0x6c, 0x61, 0x6d, 0x70, 0x28, // 3 = fast::clamp(
+	0x5f, 0x34, 0x32, 0x30, 0x2e, 0x77, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x31, 0x2e, 0x30, // _420.w, 0.0, 1.0
+	0x29, 0x20, 0x2a, 0x20, 0x33, 0x31, 0x2e, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ) * 31.0;.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x35, 0x34, 0x36, 0x20, 0x3d, //       int _546 =
+	0x20, 0x69, 0x6e, 0x74, 0x28, 0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x28, 0x5f, 0x35, 0x34, 0x33, 0x29, //  int(floor(_543)
+	0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, // );.            i
+	0x6e, 0x74, 0x20, 0x5f, 0x35, 0x35, 0x35, 0x20, 0x3d, 0x20, 0x36, 0x34, 0x20, 0x2b, 0x20, 0x5f, // nt _555 = 64 + _
+	0x35, 0x34, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 546;.           
+	0x20, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x35, 0x35, 0x38, 0x20, 0x3d, 0x20, 0x36, 0x34, 0x20, 0x2b, //  int _558 = 64 +
+	0x20, 0x6d, 0x69, 0x6e, 0x28, 0x28, 0x5f, 0x35, 0x34, 0x36, 0x20, 0x2b, 0x20, 0x31, 0x29, 0x2c, //  min((_546 + 1),
+	0x20, 0x33, 0x31, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  31);.          
+	0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x35, 0x38, 0x31, 0x20, 0x3d, 0x20, 0x6d, //   float _581 = m
+	0x69, 0x78, 0x28, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, // ix(_mtl_u.u_psPa
+	0x72, 0x61, 0x6d, 0x73, 0x5b, 0x5f, 0x35, 0x35, 0x35, 0x20, 0x2f, 0x20, 0x34, 0x5d, 0x5b, 0x5f, // rams[_555 / 4][_
+	0x35, 0x35, 0x35, 0x20, 0x25, 0x20, 0x34, 0x5d, 0x2c, 0x20, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, // 555 % 4], _mtl_u
+	0x2e, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x5f, 0x35, 0x35, 0x38, // .u_psParams[_558
+	0x20, 0x2f, 0x20, 0x34, 0x5d, 0x5b, 0x5f, 0x35, 0x35, 0x38, 0x20, 0x25, 0x20, 0x34, 0x5d, 0x2c, //  / 4][_558 % 4],
+	0x20, 0x66, 0x72, 0x61, 0x63, 0x74, 0x28, 0x5f, 0x35, 0x34, 0x33, 0x29, 0x29, 0x3b, 0x0a, 0x20, //  fract(_543));. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, //            float
+	0x20, 0x5f, 0x35, 0x39, 0x37, 0x20, 0x3d, 0x20, 0x66, 0x61, 0x73, 0x74, 0x3a, 0x3a, 0x63, 0x6c, //  _597 = fast::cl
+	0x61, 0x6d, 0x70, 0x28, 0x5f, 0x34, 0x32, 0x30, 0x2e, 0x77, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, // amp(_420.w, 0.0,
+	0x20, 0x31, 0x2e, 0x30, 0x29, 0x20, 0x2a, 0x20, 0x33, 0x31, 0x2e, 0x30, 0x3b, 0x0a, 0x20, 0x20, //  1.0) * 31.0;.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x36, //           int _6
+	0x30, 0x30, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x74, 0x28, 0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x28, 0x5f, // 00 = int(floor(_
+	0x35, 0x39, 0x37, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 597));.         
+	0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x36, 0x30, 0x39, 0x20, 0x3d, 0x20, 0x39, 0x36, //    int _609 = 96
+	0x20, 0x2b, 0x20, 0x5f, 0x36, 0x30, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  + _600;.       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x36, 0x31, 0x32, 0x20, 0x3d, 0x20, //      int _612 = 
+	0x39, 0x36, 0x20, 0x2b, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x28, 0x5f, 0x36, 0x30, 0x30, 0x20, 0x2b, // 96 + min((_600 +
+	0x20, 0x31, 0x29, 0x2c, 0x20, 0x33, 0x31, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  1), 31);.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x36, 0x35, 0x31, //       float _651
+	0x20, 0x3d, 0x20, 0x66, 0x61, 0x73, 0x74, 0x3a, 0x3a, 0x63, 0x6c, 0x61, 0x6d, 0x70, 0x28, 0x5f, //  = fast::clamp(_
+	0x34, 0x32, 0x30, 0x2e, 0x77, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x29, // 420.w, 0.0, 1.0)
+	0x20, 0x2a, 0x20, 0x33, 0x31, 0x2e, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  * 31.0;.       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x36, 0x35, 0x34, 0x20, 0x3d, 0x20, //      int _654 = 
+	0x69, 0x6e, 0x74, 0x28, 0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x28, 0x5f, 0x36, 0x35, 0x31, 0x29, 0x29, // int(floor(_651))
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, // ;.            in
+	0x74, 0x20, 0x5f, 0x36, 0x36, 0x33, 0x20, 0x3d, 0x20, 0x31, 0x32, 0x38, 0x20, 0x2b, 0x20, 0x5f, // t _663 = 128 + _
+	0x36, 0x35, 0x34, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 654;.           
+	0x20, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x36, 0x36, 0x36, 0x20, 0x3d, 0x20, 0x31, 0x32, 0x38, 0x20, //  int _666 = 128 
+	0x2b, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x28, 0x5f, 0x36, 0x35, 0x34, 0x20, 0x2b, 0x20, 0x31, 0x29, // + min((_654 + 1)
+	0x2c, 0x20, 0x33, 0x31, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // , 31);.         
+	0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x37, 0x30, 0x35, 0x20, 0x3d, 0x20, //    float _705 = 
+	0x66, 0x61, 0x73, 0x74, 0x3a, 0x3a, 0x63, 0x6c, 0x61, 0x6d, 0x70, 0x28, 0x5f, 0x34, 0x32, 0x30, // fast::clamp(_420
+	0x2e, 0x77, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x20, 0x2a, 0x20, // .w, 0.0, 1.0) * 
+	0x33, 0x31, 0x2e, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 31.0;.          
+	0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x37, 0x30, 0x38, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x74, //   int _708 = int
+	0x28, 0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x28, 0x5f, 0x37, 0x30, 0x35, 0x29, 0x29, 0x3b, 0x0a, 0x20, // (floor(_705));. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x5f, //            int _
+	0x37, 0x31, 0x37, 0x20, 0x3d, 0x20, 0x31, 0x36, 0x30, 0x20, 0x2b, 0x20, 0x5f, 0x37, 0x30, 0x38, // 717 = 160 + _708
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, // ;.            in
+	0x74, 0x20, 0x5f, 0x37, 0x32, 0x30, 0x20, 0x3d, 0x20, 0x31, 0x36, 0x30, 0x20, 0x2b, 0x20, 0x6d, // t _720 = 160 + m
+	0x69, 0x6e, 0x28, 0x28, 0x5f, 0x37, 0x30, 0x38, 0x20, 0x2b, 0x20, 0x31, 0x29, 0x2c, 0x20, 0x33, // in((_708 + 1), 3
+	0x31, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 1);.            
+	0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x34, 0x34, 0x37, 0x20, 0x3d, 0x20, 0x66, 0x61, 0x73, // float _447 = fas
+	0x74, 0x3a, 0x3a, 0x63, 0x6c, 0x61, 0x6d, 0x70, 0x28, 0x6d, 0x69, 0x78, 0x28, 0x5f, 0x6d, 0x74, // t::clamp(mix(_mt
+	0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x5f, // l_u.u_psParams[_
+	0x37, 0x31, 0x37, 0x20, 0x2f, 0x20, 0x34, 0x5d, 0x5b, 0x5f, 0x37, 0x31, 0x37, 0x20, 0x25, 0x20, // 717 / 4][_717 % 
+	0x34, 0x5d, 0x2c, 0x20, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x70, 0x73, 0x50, // 4], _mtl_u.u_psP
+	0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x5f, 0x37, 0x32, 0x30, 0x20, 0x2f, 0x20, 0x34, 0x5d, 0x5b, // arams[_720 / 4][
+	0x5f, 0x37, 0x32, 0x30, 0x20, 0x25, 0x20, 0x34, 0x5d, 0x2c, 0x20, 0x66, 0x72, 0x61, 0x63, 0x74, // _720 % 4], fract
+	0x28, 0x5f, 0x37, 0x30, 0x35, 0x29, 0x29, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x31, 0x2e, // (_705)), 0.0, 1.
+	0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 0);.            
+	0x69, 0x6e, 0x74, 0x20, 0x5f, 0x34, 0x37, 0x30, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x69, // int _470 = min(i
+	0x6e, 0x74, 0x28, 0x5f, 0x34, 0x34, 0x37, 0x20, 0x2a, 0x20, 0x34, 0x2e, 0x30, 0x29, 0x2c, 0x20, // nt(_447 * 4.0), 
+	0x33, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 3);.            
+	0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x73, 0x5f, 0x31, 0x2e, 0x5f, 0x64, 0x61, 0x74, // instances_1._dat
+	0x61, 0x5b, 0x5f, 0x34, 0x30, 0x35, 0x20, 0x2a, 0x20, 0x34, 0x75, 0x5d, 0x20, 0x3d, 0x20, 0x66, // a[_405 * 4u] = f
+	0x6c, 0x6f, 0x61, 0x74, 0x34, 0x28, 0x6d, 0x69, 0x78, 0x28, 0x6d, 0x69, 0x78, 0x28, 0x5f, 0x34, // loat4(mix(mix(_4
+	0x32, 0x30, 0x2e, 0x78, 0x79, 0x7a, 0x2c, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, 0x65, // 20.xyz, particle
+	0x73, 0x2e, 0x5f, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x5f, 0x34, 0x32, 0x33, 0x5d, 0x2e, 0x78, 0x79, // s._data[_423].xy
+	0x7a, 0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x5f, 0x35, 0x38, 0x31, 0x29, 0x29, // z, float3(_581))
+	0x2c, 0x20, 0x6d, 0x69, 0x78, 0x28, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, 0x65, 0x73, 0x2e, // , mix(particles.
+	0x5f, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x5f, 0x34, 0x32, 0x33, 0x5d, 0x2e, 0x78, 0x79, 0x7a, 0x2c, // _data[_423].xyz,
+	0x20, 0x5f, 0x34, 0x33, 0x30, 0x2e, 0x78, 0x79, 0x7a, 0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, //  _430.xyz, float
+	0x33, 0x28, 0x5f, 0x35, 0x38, 0x31, 0x29, 0x29, 0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, // 3(_581)), float3
+	0x28, 0x5f, 0x35, 0x38, 0x31, 0x29, 0x29, 0x2c, 0x20, 0x6d, 0x69, 0x78, 0x28, 0x5f, 0x34, 0x33, // (_581)), mix(_43
+	0x35, 0x2e, 0x79, 0x2c, 0x20, 0x5f, 0x34, 0x33, 0x35, 0x2e, 0x7a, 0x2c, 0x20, 0x6d, 0x69, 0x78, // 5.y, _435.z, mix
+	0x28, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, // (_mtl_u.u_psPara
+	0x6d, 0x73, 0x5b, 0x5f, 0x36, 0x30, 0x39, 0x20, 0x2f, 0x20, 0x34, 0x5d, 0x5b, 0x5f, 0x36, 0x30, // ms[_609 / 4][_60
+	0x39, 0x20, 0x25, 0x20, 0x34, 0x5d, 0x2c, 0x20, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, // 9 % 4], _mtl_u.u
+	0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x5f, 0x36, 0x31, 0x32, 0x20, 0x2f, // _psParams[_612 /
+	0x20, 0x34, 0x5d, 0x5b, 0x5f, 0x36, 0x31, 0x32, 0x20, 0x25, 0x20, 0x34, 0x5d, 0x2c, 0x20, 0x66, //  4][_612 % 4], f
+	0x72, 0x61, 0x63, 0x74, 0x28, 0x5f, 0x35, 0x39, 0x37, 0x29, 0x29, 0x29, 0x29, 0x3b, 0x0a, 0x20, // ract(_597))));. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x61, //            insta
+	0x6e, 0x63, 0x65, 0x73, 0x5f, 0x31, 0x2e, 0x5f, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x28, 0x5f, 0x34, // nces_1._data[(_4
+	0x30, 0x35, 0x20, 0x2a, 0x20, 0x34, 0x75, 0x29, 0x20, 0x2b, 0x20, 0x31, 0x75, 0x5d, 0x20, 0x3d, // 05 * 4u) + 1u] =
+	0x20, 0x6d, 0x69, 0x78, 0x28, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x70, 0x73, //  mix(_mtl_u.u_ps
+	0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x38, 0x20, 0x2b, 0x20, 0x5f, 0x34, 0x37, 0x30, 0x5d, // Params[8 + _470]
+	0x2c, 0x20, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, // , _mtl_u.u_psPar
+	0x61, 0x6d, 0x73, 0x5b, 0x5f, 0x34, 0x37, 0x30, 0x20, 0x2b, 0x20, 0x39, 0x5d, 0x2c, 0x20, 0x66, // ams[_470 + 9], f
+	0x6c, 0x6f, 0x61, 0x74, 0x34, 0x28, 0x28, 0x5f, 0x34, 0x34, 0x37, 0x20, 0x2a, 0x20, 0x34, 0x2e, // loat4((_447 * 4.
+	0x30, 0x29, 0x20, 0x2d, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x5f, 0x34, 0x37, 0x30, 0x29, // 0) - float(_470)
+	0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ));.            
+	0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x73, 0x5f, 0x31, 0x2e, 0x5f, 0x64, 0x61, 0x74, // instances_1._dat
+	0x61, 0x5b, 0x28, 0x5f, 0x34, 0x30, 0x35, 0x20, 0x2a, 0x20, 0x34, 0x75, 0x29, 0x20, 0x2b, 0x20, // a[(_405 * 4u) + 
+	0x32, 0x75, 0x5d, 0x20, 0x3d, 0x20, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x70, // 2u] = _mtl_u.u_p
+	0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x37, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, // sParams[7];.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, //         instance
+	0x73, 0x5f, 0x31, 0x2e, 0x5f, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x28, 0x5f, 0x34, 0x30, 0x35, 0x20, // s_1._data[(_405 
+	0x2a, 0x20, 0x34, 0x75, 0x29, 0x20, 0x2b, 0x20, 0x33, 0x75, 0x5d, 0x20, 0x3d, 0x20, 0x66, 0x6c, // * 4u) + 3u] = fl
+	0x6f, 0x61, 0x74, 0x34, 0x28, 0x6d, 0x69, 0x78, 0x28, 0x5f, 0x34, 0x33, 0x30, 0x2e, 0x77, 0x2c, // oat4(mix(_430.w,
+	0x20, 0x5f, 0x34, 0x33, 0x35, 0x2e, 0x78, 0x2c, 0x20, 0x66, 0x61, 0x73, 0x74, 0x3a, 0x3a, 0x63, //  _435.x, fast::c
+	0x6c, 0x61, 0x6d, 0x70, 0x28, 0x6d, 0x69, 0x78, 0x28, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, // lamp(mix(_mtl_u.
+	0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x5f, 0x36, 0x36, 0x33, 0x20, // u_psParams[_663 
+	0x2f, 0x20, 0x34, 0x5d, 0x5b, 0x5f, 0x36, 0x36, 0x33, 0x20, 0x25, 0x20, 0x34, 0x5d, 0x2c, 0x20, // / 4][_663 % 4], 
+	0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, // _mtl_u.u_psParam
+	0x73, 0x5b, 0x5f, 0x36, 0x36, 0x36, 0x20, 0x2f, 0x20, 0x34, 0x5d, 0x5b, 0x5f, 0x36, 0x36, 0x36, // s[_666 / 4][_666
+	0x20, 0x25, 0x20, 0x34, 0x5d, 0x2c, 0x20, 0x66, 0x72, 0x61, 0x63, 0x74, 0x28, 0x5f, 0x36, 0x35, //  % 4], fract(_65
+	0x31, 0x29, 0x29, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x29, 0x2c, // 1)), 0.0, 1.0)),
+	0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x29, 0x3b, //  0.0, 0.0, 0.0);
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, // .            bre
+	0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, // ak;.        }.  
+	0x20, 0x20, 0x7d, 0x0a, 0x7d, 0x0a, 0x0a, 0x00, 0x00, 0x10, 0x03,                               //   }.}......
+};
+extern const uint8_t* cs_ps_instances_pssl;
+extern const uint32_t cs_ps_instances_pssl_size;
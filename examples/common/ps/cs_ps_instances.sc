@@ -0,0 +1,52 @@
+/*
+ * Copyright 2011-2020 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx#license-bsd-2-clause
+ */
+
+#include "bgfx_compute.sh"
+#include "uniforms.sh"
+
+BUFFER_RO(particles,  vec4, 0);
+BUFFER_RO(sortBuffer, vec4, 1);
+BUFFER_RO(counter,    uint, 2);
+BUFFER_WR(instances,  vec4, 3);
+
+NUM_THREADS(threadGroupSize, 1, 1)
+void main()
+{
+	uint ii = gl_GlobalInvocationID.x;
+
+	if (ii >= counter[0])
+	{
+		return;
+	}
+
+	uint idx = uint(sortBuffer[ii].y);
+
+	vec4 p0 = particles[idx*PARTICLE_STRIDE + 0];
+	vec4 p1 = particles[idx*PARTICLE_STRIDE + 1];
+	vec4 p2 = particles[idx*PARTICLE_STRIDE + 2];
+	vec4 p3 = particles[idx*PARTICLE_STRIDE + 3];
+
+	float life    = p0.w;
+	float ttPos   = ease(EASE_POS,   life);
+	float ttScale = ease(EASE_SCALE, life);
+	float ttBlend = clamp(ease(EASE_BLEND, life), 0.0, 1.0);
+	float ttRgba  = clamp(ease(EASE_RGBA,  life), 0.0, 1.0);
+
+	vec3 pp0 = mix(p0.xyz, p1.xyz, ttPos);
+	vec3 pp1 = mix(p1.xyz, p2.xyz, ttPos);
+	vec3 pos = mix(pp0, pp1, ttPos);
+
+	int   rgbaIdx = min(int(ttRgba*4.0), 3);
+	float ttmod   = ttRgba*4.0 - float(rgbaIdx);
+	vec4  rgba    = mix(u_rgba(rgbaIdx), u_rgba(rgbaIdx+1), ttmod);
+
+	float blend = mix(p2.w, p3.x, ttBlend);
+	float scale = mix(p3.y, p3.z, ttScale);
+
+	instances[ii*4 + 0] = vec4(pos, scale);
+	instances[ii*4 + 1] = rgba;
+	instances[ii*4 + 2] = u_uvRect;
+	instances[ii*4 + 3] = vec4(blend, 0.0, 0.0, 0.0);
+}
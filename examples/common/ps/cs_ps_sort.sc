@@ -0,0 +1,34 @@
+/*
+ * Copyright 2011-2020 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx#license-bsd-2-clause
+ */
+
+#include "bgfx_compute.sh"
+#include "uniforms.sh"
+
+BUFFER_RW(sortBuffer, vec4, 0);
+
+// One step of bitonic sort, u_psSort.x is size of sorted sequences being merged, and
+// u_psSort.y is compare distance.
+NUM_THREADS(threadGroupSize, 1, 1)
+void main()
+{
+	uint idx = gl_GlobalInvocationID.x;
+	uint kk  = uint(u_psSort.x);
+	uint jj  = uint(u_psSort.y);
+	uint ixj = idx ^ jj;
+
+	if (ixj > idx)
+	{
+		vec4 lhs = sortBuffer[idx];
+		vec4 rhs = sortBuffer[ixj];
+
+		bool ascending = 0u == (idx & kk);
+
+		if ( (lhs.x > rhs.x) == ascending)
+		{
+			sortBuffer[idx] = rhs;
+			sortBuffer[ixj] = lhs;
+		}
+	}
+}
@@ -0,0 +1,1369 @@
+static const uint8_t cs_ps_spawn_glsl[4365] =
+{
+	0x43, 0x53, 0x48, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x10, // CSH.............
+	0x00, 0x00, 0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x34, 0x33, 0x30, 0x0a, 0x76, // ..#version 430.v
+	0x65, 0x63, 0x33, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x4d, 0x75, 0x6c, 0x28, 0x76, 0x65, 0x63, 0x33, // ec3 instMul(vec3
+	0x20, 0x5f, 0x76, 0x65, 0x63, 0x2c, 0x20, 0x6d, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x6d, 0x74, 0x78, //  _vec, mat3 _mtx
+	0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x28, 0x20, 0x28, 0x5f, 0x76, // ) { return ( (_v
+	0x65, 0x63, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x5f, 0x6d, 0x74, 0x78, 0x29, 0x20, 0x29, 0x3b, 0x20, // ec) * (_mtx) ); 
+	0x7d, 0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x4d, 0x75, 0x6c, 0x28, 0x6d, // }.vec3 instMul(m
+	0x61, 0x74, 0x33, 0x20, 0x5f, 0x6d, 0x74, 0x78, 0x2c, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x5f, // at3 _mtx, vec3 _
+	0x76, 0x65, 0x63, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x28, 0x20, // vec) { return ( 
+	0x28, 0x5f, 0x6d, 0x74, 0x78, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x5f, 0x76, 0x65, 0x63, 0x29, 0x20, // (_mtx) * (_vec) 
+	0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x34, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x4d, 0x75, // ); }.vec4 instMu
+	0x6c, 0x28, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x76, 0x65, 0x63, 0x2c, 0x20, 0x6d, 0x61, 0x74, // l(vec4 _vec, mat
+	0x34, 0x20, 0x5f, 0x6d, 0x74, 0x78, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, // 4 _mtx) { return
+	0x20, 0x28, 0x20, 0x28, 0x5f, 0x76, 0x65, 0x63, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x5f, 0x6d, 0x74, //  ( (_vec) * (_mt
+	0x78, 0x29, 0x20, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x34, 0x20, 0x69, 0x6e, 0x73, // x) ); }.vec4 ins
+	0x74, 0x4d, 0x75, 0x6c, 0x28, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x6d, 0x74, 0x78, 0x2c, 0x20, // tMul(mat4 _mtx, 
+	0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x76, 0x65, 0x63, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, // vec4 _vec) { ret
+	0x75, 0x72, 0x6e, 0x20, 0x28, 0x20, 0x28, 0x5f, 0x6d, 0x74, 0x78, 0x29, 0x20, 0x2a, 0x20, 0x28, // urn ( (_mtx) * (
+	0x5f, 0x76, 0x65, 0x63, 0x29, 0x20, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, // _vec) ); }.float
+	0x20, 0x72, 0x63, 0x70, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x61, 0x29, 0x20, 0x7b, //  rcp(float _a) {
+	0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x31, 0x2e, 0x30, 0x2f, 0x5f, 0x61, 0x3b, 0x20, //  return 1.0/_a; 
+	0x7d, 0x0a, 0x76, 0x65, 0x63, 0x32, 0x20, 0x72, 0x63, 0x70, 0x28, 0x76, 0x65, 0x63, 0x32, 0x20, // }.vec2 rcp(vec2 
+	0x5f, 0x61, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, // _a) { return vec
+	0x32, 0x28, 0x31, 0x2e, 0x30, 0x29, 0x2f, 0x5f, 0x61, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, // 2(1.0)/_a; }.vec
+	0x33, 0x20, 0x72, 0x63, 0x70, 0x28, 0x76, 0x65, 0x63, 0x33, 0x20, 0x5f, 0x61, 0x29, 0x20, 0x7b, // 3 rcp(vec3 _a) {
+	0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x33, 0x28, 0x31, 0x2e, 0x30, //  return vec3(1.0
+	0x29, 0x2f, 0x5f, 0x61, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x34, 0x20, 0x72, 0x63, 0x70, // )/_a; }.vec4 rcp
+	0x28, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x61, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, // (vec4 _a) { retu
+	0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x31, 0x2e, 0x30, 0x29, 0x2f, 0x5f, 0x61, 0x3b, // rn vec4(1.0)/_a;
+	0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x32, 0x20, 0x76, 0x65, 0x63, 0x32, 0x5f, 0x73, 0x70, 0x6c, //  }.vec2 vec2_spl
+	0x61, 0x74, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x78, 0x29, 0x20, 0x7b, 0x20, 0x72, // at(float _x) { r
+	0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x5f, 0x78, 0x2c, 0x20, 0x5f, // eturn vec2(_x, _
+	0x78, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, 0x76, 0x65, 0x63, 0x33, 0x5f, // x); }.vec3 vec3_
+	0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x78, 0x29, 0x20, // splat(float _x) 
+	0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x33, 0x28, 0x5f, 0x78, // { return vec3(_x
+	0x2c, 0x20, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, // , _x, _x); }.vec
+	0x34, 0x20, 0x76, 0x65, 0x63, 0x34, 0x5f, 0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x66, 0x6c, 0x6f, // 4 vec4_splat(flo
+	0x61, 0x74, 0x20, 0x5f, 0x78, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, // at _x) { return 
+	0x76, 0x65, 0x63, 0x34, 0x28, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x2c, // vec4(_x, _x, _x,
+	0x20, 0x5f, 0x78, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x75, 0x76, 0x65, 0x63, 0x32, 0x20, 0x75, 0x76, //  _x); }.uvec2 uv
+	0x65, 0x63, 0x32, 0x5f, 0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, // ec2_splat(uint _
+	0x78, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x75, 0x76, 0x65, 0x63, // x) { return uvec
+	0x32, 0x28, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x75, 0x76, 0x65, // 2(_x, _x); }.uve
+	0x63, 0x33, 0x20, 0x75, 0x76, 0x65, 0x63, 0x33, 0x5f, 0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x75, // c3 uvec3_splat(u
+	0x69, 0x6e, 0x74, 0x20, 0x5f, 0x78, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, // int _x) { return
+	0x20, 0x75, 0x76, 0x65, 0x63, 0x33, 0x28, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x2c, 0x20, 0x5f, //  uvec3(_x, _x, _
+	0x78, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x75, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, 0x76, 0x65, 0x63, // x); }.uvec4 uvec
+	0x34, 0x5f, 0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x78, 0x29, // 4_splat(uint _x)
+	0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x75, 0x76, 0x65, 0x63, 0x34, 0x28, //  { return uvec4(
+	0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x29, 0x3b, // _x, _x, _x, _x);
+	0x20, 0x7d, 0x0a, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x6d, 0x74, 0x78, 0x46, 0x72, 0x6f, 0x6d, 0x52, //  }.mat4 mtxFromR
+	0x6f, 0x77, 0x73, 0x28, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x30, 0x2c, 0x20, 0x76, 0x65, 0x63, // ows(vec4 _0, vec
+	0x34, 0x20, 0x5f, 0x31, 0x2c, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x32, 0x2c, 0x20, 0x76, // 4 _1, vec4 _2, v
+	0x65, 0x63, 0x34, 0x20, 0x5f, 0x33, 0x29, 0x0a, 0x7b, 0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, // ec4 _3).{.return
+	0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x73, 0x65, 0x28, 0x6d, 0x61, 0x74, 0x34, 0x28, //  transpose(mat4(
+	0x5f, 0x30, 0x2c, 0x20, 0x5f, 0x31, 0x2c, 0x20, 0x5f, 0x32, 0x2c, 0x20, 0x5f, 0x33, 0x29, 0x20, // _0, _1, _2, _3) 
+	0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x6d, 0x74, 0x78, 0x46, 0x72, 0x6f, // );.}.mat4 mtxFro
+	0x6d, 0x43, 0x6f, 0x6c, 0x73, 0x28, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x30, 0x2c, 0x20, 0x76, // mCols(vec4 _0, v
+	0x65, 0x63, 0x34, 0x20, 0x5f, 0x31, 0x2c, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x32, 0x2c, // ec4 _1, vec4 _2,
+	0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x33, 0x29, 0x0a, 0x7b, 0x0a, 0x72, 0x65, 0x74, 0x75, //  vec4 _3).{.retu
+	0x72, 0x6e, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x28, 0x5f, 0x30, 0x2c, 0x20, 0x5f, 0x31, 0x2c, 0x20, // rn mat4(_0, _1, 
+	0x5f, 0x32, 0x2c, 0x20, 0x5f, 0x33, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x6d, 0x61, 0x74, 0x33, 0x20, // _2, _3);.}.mat3 
+	0x6d, 0x74, 0x78, 0x46, 0x72, 0x6f, 0x6d, 0x52, 0x6f, 0x77, 0x73, 0x28, 0x76, 0x65, 0x63, 0x33, // mtxFromRows(vec3
+	0x20, 0x5f, 0x30, 0x2c, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x5f, 0x31, 0x2c, 0x20, 0x76, 0x65, //  _0, vec3 _1, ve
+	0x63, 0x33, 0x20, 0x5f, 0x32, 0x29, 0x0a, 0x7b, 0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, // c3 _2).{.return 
+	0x74, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x73, 0x65, 0x28, 0x6d, 0x61, 0x74, 0x33, 0x28, 0x5f, // transpose(mat3(_
+	0x30, 0x2c, 0x20, 0x5f, 0x31, 0x2c, 0x20, 0x5f, 0x32, 0x29, 0x20, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, // 0, _1, _2) );.}.
+	0x6d, 0x61, 0x74, 0x33, 0x20, 0x6d, 0x74, 0x78, 0x46, 0x72, 0x6f, 0x6d, 0x43, 0x6f, 0x6c, 0x73, // mat3 mtxFromCols
+	0x28, 0x76, 0x65, 0x63, 0x33, 0x20, 0x5f, 0x30, 0x2c, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x5f, // (vec3 _0, vec3 _
+	0x31, 0x2c, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x5f, 0x32, 0x29, 0x0a, 0x7b, 0x0a, 0x72, 0x65, // 1, vec3 _2).{.re
+	0x74, 0x75, 0x72, 0x6e, 0x20, 0x6d, 0x61, 0x74, 0x33, 0x28, 0x5f, 0x30, 0x2c, 0x20, 0x5f, 0x31, // turn mat3(_0, _1
+	0x2c, 0x20, 0x5f, 0x32, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, // , _2);.}.uniform
+	0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x52, 0x65, 0x63, 0x74, //  vec4 u_viewRect
+	0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, // ;.uniform vec4 u
+	0x5f, 0x76, 0x69, 0x65, 0x77, 0x54, 0x65, 0x78, 0x65, 0x6c, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, // _viewTexel;.unif
+	0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x3b, // orm mat4 u_view;
+	0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, // .uniform mat4 u_
+	0x69, 0x6e, 0x76, 0x56, 0x69, 0x65, 0x77, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, // invView;.uniform
+	0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x3b, 0x0a, 0x75, 0x6e, //  mat4 u_proj;.un
+	0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x69, 0x6e, 0x76, // iform mat4 u_inv
+	0x50, 0x72, 0x6f, 0x6a, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, // Proj;.uniform ma
+	0x74, 0x34, 0x20, 0x75, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x50, 0x72, 0x6f, 0x6a, 0x3b, 0x0a, 0x75, // t4 u_viewProj;.u
+	0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x69, 0x6e, // niform mat4 u_in
+	0x76, 0x56, 0x69, 0x65, 0x77, 0x50, 0x72, 0x6f, 0x6a, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, // vViewProj;.unifo
+	0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5b, // rm mat4 u_model[
+	0x33, 0x32, 0x5d, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, // 32];.uniform mat
+	0x34, 0x20, 0x75, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x56, 0x69, 0x65, 0x77, 0x3b, 0x0a, 0x75, // 4 u_modelView;.u
+	0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x6d, 0x6f, // niform mat4 u_mo
+	0x64, 0x65, 0x6c, 0x56, 0x69, 0x65, 0x77, 0x50, 0x72, 0x6f, 0x6a, 0x3b, 0x0a, 0x75, 0x6e, 0x69, // delViewProj;.uni
+	0x66, 0x6f, 0x72, 0x6d, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, 0x5f, 0x61, 0x6c, 0x70, 0x68, // form vec4 u_alph
+	0x61, 0x52, 0x65, 0x66, 0x34, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x76, // aRef4;.uniform v
+	0x65, 0x63, 0x34, 0x20, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x34, // ec4 u_psParams[4
+	0x38, 0x5d, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, // 8];.uniform mat4
+	0x20, 0x75, 0x5f, 0x70, 0x73, 0x4d, 0x74, 0x78, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, //  u_psMtx;.unifor
+	0x6d, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, 0x5f, 0x70, 0x73, 0x53, 0x6f, 0x72, 0x74, 0x3b, // m vec4 u_psSort;
+	0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x65, 0x61, 0x73, 0x65, 0x28, 0x69, 0x6e, 0x74, 0x20, // .float ease(int 
+	0x5f, 0x63, 0x75, 0x72, 0x76, 0x65, 0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x74, // _curve, float _t
+	0x74, 0x29, 0x0a, 0x7b, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x70, 0x6f, 0x73, 0x20, 0x3d, // t).{.float pos =
+	0x20, 0x63, 0x6c, 0x61, 0x6d, 0x70, 0x28, 0x5f, 0x74, 0x74, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, //  clamp(_tt, 0.0,
+	0x20, 0x31, 0x2e, 0x30, 0x29, 0x20, 0x2a, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x33, 0x32, //  1.0) * float(32
+	0x2d, 0x31, 0x29, 0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x64, 0x78, 0x30, 0x20, 0x3d, 0x20, // -1);.int idx0 = 
+	0x69, 0x6e, 0x74, 0x28, 0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x28, 0x70, 0x6f, 0x73, 0x29, 0x20, 0x29, // int(floor(pos) )
+	0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x64, 0x78, 0x31, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x6e, // ;.int idx1 = min
+	0x28, 0x69, 0x64, 0x78, 0x30, 0x20, 0x2b, 0x20, 0x31, 0x2c, 0x20, 0x33, 0x32, 0x2d, 0x31, 0x29, // (idx0 + 1, 32-1)
+	0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x62, 0x61, 0x73, 0x65, 0x20, 0x3d, 0x20, 0x31, 0x36, 0x2a, // ;.int base = 16*
+	0x34, 0x20, 0x2b, 0x20, 0x5f, 0x63, 0x75, 0x72, 0x76, 0x65, 0x2a, 0x33, 0x32, 0x3b, 0x0a, 0x69, // 4 + _curve*32;.i
+	0x6e, 0x74, 0x20, 0x6c, 0x75, 0x74, 0x30, 0x20, 0x3d, 0x20, 0x62, 0x61, 0x73, 0x65, 0x20, 0x2b, // nt lut0 = base +
+	0x20, 0x69, 0x64, 0x78, 0x30, 0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x6c, 0x75, 0x74, 0x31, 0x20, //  idx0;.int lut1 
+	0x3d, 0x20, 0x62, 0x61, 0x73, 0x65, 0x20, 0x2b, 0x20, 0x69, 0x64, 0x78, 0x31, 0x3b, 0x0a, 0x66, // = base + idx1;.f
+	0x6c, 0x6f, 0x61, 0x74, 0x20, 0x76, 0x61, 0x6c, 0x30, 0x20, 0x3d, 0x20, 0x75, 0x5f, 0x70, 0x73, // loat val0 = u_ps
+	0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x6c, 0x75, 0x74, 0x30, 0x2f, 0x34, 0x5d, 0x5b, 0x6c, // Params[lut0/4][l
+	0x75, 0x74, 0x30, 0x25, 0x34, 0x5d, 0x3b, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x76, 0x61, // ut0%4];.float va
+	0x6c, 0x31, 0x20, 0x3d, 0x20, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, // l1 = u_psParams[
+	0x6c, 0x75, 0x74, 0x31, 0x2f, 0x34, 0x5d, 0x5b, 0x6c, 0x75, 0x74, 0x31, 0x25, 0x34, 0x5d, 0x3b, // lut1/4][lut1%4];
+	0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x6d, 0x69, 0x78, 0x28, 0x76, 0x61, 0x6c, 0x30, // .return mix(val0
+	0x2c, 0x20, 0x76, 0x61, 0x6c, 0x31, 0x2c, 0x20, 0x66, 0x72, 0x61, 0x63, 0x74, 0x28, 0x70, 0x6f, // , val1, fract(po
+	0x73, 0x29, 0x20, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x28, 0x73, // s) );.}.layout(s
+	0x74, 0x64, 0x34, 0x33, 0x30, 0x2c, 0x20, 0x62, 0x69, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x3d, 0x30, // td430, binding=0
+	0x29, 0x20, 0x77, 0x72, 0x69, 0x74, 0x65, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x62, 0x75, 0x66, 0x66, // ) writeonly buff
+	0x65, 0x72, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, 0x65, 0x73, 0x42, 0x75, 0x66, 0x66, // er particlesBuff
+	0x65, 0x72, 0x20, 0x7b, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, // er { vec4 partic
+	0x6c, 0x65, 0x73, 0x5b, 0x5d, 0x3b, 0x20, 0x7d, 0x3b, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x68, // les[]; };.uint h
+	0x61, 0x73, 0x68, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x78, 0x29, 0x0a, 0x7b, 0x0a, 0x5f, // ash(uint _x).{._
+	0x78, 0x20, 0x5e, 0x3d, 0x20, 0x5f, 0x78, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x36, 0x3b, 0x0a, 0x5f, // x ^= _x >> 16;._
+	0x78, 0x20, 0x2a, 0x3d, 0x20, 0x30, 0x78, 0x37, 0x66, 0x65, 0x62, 0x33, 0x35, 0x32, 0x64, 0x75, // x *= 0x7feb352du
+	0x3b, 0x0a, 0x5f, 0x78, 0x20, 0x5e, 0x3d, 0x20, 0x5f, 0x78, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x35, // ;._x ^= _x >> 15
+	0x3b, 0x0a, 0x5f, 0x78, 0x20, 0x2a, 0x3d, 0x20, 0x30, 0x78, 0x38, 0x34, 0x36, 0x63, 0x61, 0x36, // ;._x *= 0x846ca6
+	0x38, 0x62, 0x75, 0x3b, 0x0a, 0x5f, 0x78, 0x20, 0x5e, 0x3d, 0x20, 0x5f, 0x78, 0x20, 0x3e, 0x3e, // 8bu;._x ^= _x >>
+	0x20, 0x31, 0x36, 0x3b, 0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f, 0x78, 0x3b, 0x0a, //  16;.return _x;.
+	0x7d, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x66, 0x72, 0x6e, 0x64, 0x28, 0x69, 0x6e, 0x6f, // }.float frnd(ino
+	0x75, 0x74, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x0a, // ut uint _state).
+	0x7b, 0x0a, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x3d, 0x20, 0x68, 0x61, 0x73, 0x68, 0x28, // {._state = hash(
+	0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x3b, 0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, // _state);.return 
+	0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x3e, 0x3e, 0x20, // float(_state >> 
+	0x38, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x31, 0x2e, 0x30, 0x2f, 0x31, 0x36, 0x37, 0x37, 0x37, 0x32, // 8) * (1.0/167772
+	0x31, 0x36, 0x2e, 0x30, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x66, // 16.0);.}.float f
+	0x72, 0x6e, 0x64, 0x68, 0x28, 0x69, 0x6e, 0x6f, 0x75, 0x74, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, // rndh(inout uint 
+	0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x0a, 0x7b, 0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, // _state).{.return
+	0x20, 0x66, 0x72, 0x6e, 0x64, 0x28, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x20, 0x2a, 0x20, //  frnd(_state) * 
+	0x32, 0x2e, 0x30, 0x20, 0x2d, 0x20, 0x31, 0x2e, 0x30, 0x3b, 0x0a, 0x7d, 0x0a, 0x76, 0x65, 0x63, // 2.0 - 1.0;.}.vec
+	0x33, 0x20, 0x72, 0x61, 0x6e, 0x64, 0x55, 0x6e, 0x69, 0x74, 0x43, 0x69, 0x72, 0x63, 0x6c, 0x65, // 3 randUnitCircle
+	0x28, 0x69, 0x6e, 0x6f, 0x75, 0x74, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x73, 0x74, 0x61, // (inout uint _sta
+	0x74, 0x65, 0x29, 0x0a, 0x7b, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x61, 0x6e, 0x67, 0x6c, // te).{.float angl
+	0x65, 0x20, 0x3d, 0x20, 0x66, 0x72, 0x6e, 0x64, 0x28, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, // e = frnd(_state)
+	0x20, 0x2a, 0x20, 0x36, 0x2e, 0x32, 0x38, 0x33, 0x31, 0x38, 0x35, 0x33, 0x30, 0x37, 0x31, 0x38, //  * 6.28318530718
+	0x3b, 0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x33, 0x28, 0x63, 0x6f, // ;.return vec3(co
+	0x73, 0x28, 0x61, 0x6e, 0x67, 0x6c, 0x65, 0x29, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x73, // s(angle), 0.0, s
+	0x69, 0x6e, 0x28, 0x61, 0x6e, 0x67, 0x6c, 0x65, 0x29, 0x20, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x76, // in(angle) );.}.v
+	0x65, 0x63, 0x33, 0x20, 0x72, 0x61, 0x6e, 0x64, 0x55, 0x6e, 0x69, 0x74, 0x53, 0x70, 0x68, 0x65, // ec3 randUnitSphe
+	0x72, 0x65, 0x28, 0x69, 0x6e, 0x6f, 0x75, 0x74, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x73, // re(inout uint _s
+	0x74, 0x61, 0x74, 0x65, 0x29, 0x0a, 0x7b, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x72, 0x61, // tate).{.float ra
+	0x6e, 0x64, 0x30, 0x20, 0x3d, 0x20, 0x66, 0x72, 0x6e, 0x64, 0x28, 0x5f, 0x73, 0x74, 0x61, 0x74, // nd0 = frnd(_stat
+	0x65, 0x29, 0x20, 0x2a, 0x20, 0x32, 0x2e, 0x30, 0x20, 0x2d, 0x20, 0x31, 0x2e, 0x30, 0x3b, 0x0a, // e) * 2.0 - 1.0;.
+	0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x72, 0x61, 0x6e, 0x64, 0x31, 0x20, 0x3d, 0x20, 0x66, 0x72, // float rand1 = fr
+	0x6e, 0x64, 0x28, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x20, 0x2a, 0x20, 0x36, 0x2e, 0x32, // nd(_state) * 6.2
+	0x38, 0x33, 0x31, 0x38, 0x35, 0x33, 0x30, 0x37, 0x31, 0x38, 0x3b, 0x0a, 0x66, 0x6c, 0x6f, 0x61, // 8318530718;.floa
+	0x74, 0x20, 0x73, 0x71, 0x72, 0x74, 0x66, 0x20, 0x3d, 0x20, 0x73, 0x71, 0x72, 0x74, 0x28, 0x31, // t sqrtf = sqrt(1
+	0x2e, 0x30, 0x20, 0x2d, 0x20, 0x72, 0x61, 0x6e, 0x64, 0x30, 0x2a, 0x72, 0x61, 0x6e, 0x64, 0x30, // .0 - rand0*rand0
+	0x29, 0x3b, 0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x33, 0x28, 0x73, // );.return vec3(s
+	0x71, 0x72, 0x74, 0x66, 0x20, 0x2a, 0x20, 0x63, 0x6f, 0x73, 0x28, 0x72, 0x61, 0x6e, 0x64, 0x31, // qrtf * cos(rand1
+	0x29, 0x2c, 0x20, 0x73, 0x71, 0x72, 0x74, 0x66, 0x20, 0x2a, 0x20, 0x73, 0x69, 0x6e, 0x28, 0x72, // ), sqrtf * sin(r
+	0x61, 0x6e, 0x64, 0x31, 0x29, 0x2c, 0x20, 0x72, 0x61, 0x6e, 0x64, 0x30, 0x29, 0x3b, 0x0a, 0x7d, // and1), rand0);.}
+	0x0a, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x20, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x73, // .layout (local_s
+	0x69, 0x7a, 0x65, 0x5f, 0x78, 0x20, 0x3d, 0x20, 0x36, 0x34, 0x2c, 0x20, 0x6c, 0x6f, 0x63, 0x61, // ize_x = 64, loca
+	0x6c, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x79, 0x20, 0x3d, 0x20, 0x31, 0x2c, 0x20, 0x6c, 0x6f, // l_size_y = 1, lo
+	0x63, 0x61, 0x6c, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x7a, 0x20, 0x3d, 0x20, 0x31, 0x29, 0x20, // cal_size_z = 1) 
+	0x69, 0x6e, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x28, 0x29, 0x0a, // in;.void main().
+	0x7b, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x64, 0x20, 0x3d, 0x20, 0x67, 0x6c, 0x5f, 0x47, // {.uint id = gl_G
+	0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, // lobalInvocationI
+	0x44, 0x2e, 0x78, 0x3b, 0x0a, 0x69, 0x66, 0x20, 0x28, 0x69, 0x64, 0x20, 0x3e, 0x3d, 0x20, 0x75, // D.x;.if (id >= u
+	0x69, 0x6e, 0x74, 0x28, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x30, // int(u_psParams[0
+	0x5d, 0x2e, 0x79, 0x29, 0x29, 0x0a, 0x7b, 0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x0a, // ].y)).{.return;.
+	0x7d, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x64, 0x78, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x69, // }.uint idx = (ui
+	0x6e, 0x74, 0x28, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x30, 0x5d, // nt(u_psParams[0]
+	0x2e, 0x7a, 0x29, 0x20, 0x2b, 0x20, 0x69, 0x64, 0x29, 0x20, 0x25, 0x20, 0x75, 0x69, 0x6e, 0x74, // .z) + id) % uint
+	0x28, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x30, 0x5d, 0x2e, 0x77, // (u_psParams[0].w
+	0x29, 0x3b, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x3d, 0x20, // );.uint state = 
+	0x68, 0x61, 0x73, 0x68, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, // hash(uint(u_psPa
+	0x72, 0x61, 0x6d, 0x73, 0x5b, 0x32, 0x5d, 0x2e, 0x77, 0x29, 0x20, 0x2b, 0x20, 0x69, 0x64, 0x29, // rams[2].w) + id)
+	0x3b, 0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, 0x70, 0x6f, 0x73, 0x3b, 0x0a, 0x69, 0x66, 0x20, 0x28, // ;.vec3 pos;.if (
+	0x30, 0x20, 0x3d, 0x3d, 0x20, 0x69, 0x6e, 0x74, 0x28, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, // 0 == int(u_psPar
+	0x61, 0x6d, 0x73, 0x5b, 0x35, 0x5d, 0x2e, 0x78, 0x29, 0x29, 0x0a, 0x7b, 0x0a, 0x70, 0x6f, 0x73, // ams[5].x)).{.pos
+	0x20, 0x3d, 0x20, 0x72, 0x61, 0x6e, 0x64, 0x55, 0x6e, 0x69, 0x74, 0x53, 0x70, 0x68, 0x65, 0x72, //  = randUnitSpher
+	0x65, 0x28, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x65, 0x6c, 0x73, 0x65, // e(state);.}.else
+	0x20, 0x69, 0x66, 0x20, 0x28, 0x31, 0x20, 0x3d, 0x3d, 0x20, 0x69, 0x6e, 0x74, 0x28, 0x75, 0x5f, //  if (1 == int(u_
+	0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x35, 0x5d, 0x2e, 0x78, 0x29, 0x29, 0x0a, // psParams[5].x)).
+	0x7b, 0x0a, 0x70, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x72, 0x61, 0x6e, 0x64, 0x55, 0x6e, 0x69, 0x74, // {.pos = randUnit
+	0x53, 0x70, 0x68, 0x65, 0x72, 0x65, 0x28, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x3b, 0x0a, 0x70, // Sphere(state);.p
+	0x6f, 0x73, 0x2e, 0x79, 0x20, 0x3d, 0x20, 0x61, 0x62, 0x73, 0x28, 0x70, 0x6f, 0x73, 0x2e, 0x79, // os.y = abs(pos.y
+	0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x69, 0x66, 0x20, 0x28, 0x32, 0x20, // );.}.else if (2 
+	0x3d, 0x3d, 0x20, 0x69, 0x6e, 0x74, 0x28, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, // == int(u_psParam
+	0x73, 0x5b, 0x35, 0x5d, 0x2e, 0x78, 0x29, 0x29, 0x0a, 0x7b, 0x0a, 0x70, 0x6f, 0x73, 0x20, 0x3d, // s[5].x)).{.pos =
+	0x20, 0x72, 0x61, 0x6e, 0x64, 0x55, 0x6e, 0x69, 0x74, 0x43, 0x69, 0x72, 0x63, 0x6c, 0x65, 0x28, //  randUnitCircle(
+	0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x69, // state);.}.else i
+	0x66, 0x20, 0x28, 0x33, 0x20, 0x3d, 0x3d, 0x20, 0x69, 0x6e, 0x74, 0x28, 0x75, 0x5f, 0x70, 0x73, // f (3 == int(u_ps
+	0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x35, 0x5d, 0x2e, 0x78, 0x29, 0x29, 0x0a, 0x7b, 0x0a, // Params[5].x)).{.
+	0x70, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x72, 0x61, 0x6e, 0x64, 0x55, 0x6e, 0x69, 0x74, 0x43, 0x69, // pos = randUnitCi
+	0x72, 0x63, 0x6c, 0x65, 0x28, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x20, 0x2a, 0x20, 0x66, 0x72, // rcle(state) * fr
+	0x6e, 0x64, 0x28, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x65, 0x6c, 0x73, // nd(state);.}.els
+	0x65, 0x0a, 0x7b, 0x0a, 0x70, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x76, 0x65, 0x63, 0x33, 0x28, 0x66, // e.{.pos = vec3(f
+	0x72, 0x6e, 0x64, 0x68, 0x28, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x2c, 0x20, 0x30, 0x2e, 0x30, // rndh(state), 0.0
+	0x2c, 0x20, 0x66, 0x72, 0x6e, 0x64, 0x68, 0x28, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x20, 0x29, // , frndh(state) )
+	0x3b, 0x0a, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, 0x64, 0x69, 0x72, 0x20, 0x3d, 0x20, 0x30, // ;.}.vec3 dir = 0
+	0x20, 0x3d, 0x3d, 0x20, 0x69, 0x6e, 0x74, 0x28, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, //  == int(u_psPara
+	0x6d, 0x73, 0x5b, 0x35, 0x5d, 0x2e, 0x79, 0x29, 0x0a, 0x3f, 0x20, 0x76, 0x65, 0x63, 0x33, 0x28, // ms[5].y).? vec3(
+	0x30, 0x2e, 0x30, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x29, 0x0a, 0x3a, // 0.0, 1.0, 0.0).:
+	0x20, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x70, 0x6f, 0x73, 0x29, 0x0a, //  normalize(pos).
+	0x3b, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x4f, 0x66, 0x66, // ;.float startOff
+	0x73, 0x65, 0x74, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x78, 0x28, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, // set = mix(u_psPa
+	0x72, 0x61, 0x6d, 0x73, 0x5b, 0x31, 0x5d, 0x2e, 0x78, 0x79, 0x2e, 0x78, 0x2c, 0x20, 0x75, 0x5f, // rams[1].xy.x, u_
+	0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x31, 0x5d, 0x2e, 0x78, 0x79, 0x2e, 0x79, // psParams[1].xy.y
+	0x2c, 0x20, 0x66, 0x72, 0x6e, 0x64, 0x28, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x20, 0x29, 0x3b, // , frnd(state) );
+	0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x3d, 0x20, 0x70, 0x6f, // .vec3 start = po
+	0x73, 0x20, 0x2a, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x4f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3b, // s * startOffset;
+	0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x65, 0x6e, 0x64, 0x4f, 0x66, 0x66, 0x73, 0x65, 0x74, // .float endOffset
+	0x20, 0x3d, 0x20, 0x6d, 0x69, 0x78, 0x28, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, //  = mix(u_psParam
+	0x73, 0x5b, 0x31, 0x5d, 0x2e, 0x7a, 0x77, 0x2e, 0x78, 0x2c, 0x20, 0x75, 0x5f, 0x70, 0x73, 0x50, // s[1].zw.x, u_psP
+	0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x31, 0x5d, 0x2e, 0x7a, 0x77, 0x2e, 0x79, 0x2c, 0x20, 0x66, // arams[1].zw.y, f
+	0x72, 0x6e, 0x64, 0x28, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x20, 0x29, 0x3b, 0x0a, 0x76, 0x65, // rnd(state) );.ve
+	0x63, 0x33, 0x20, 0x65, 0x6e, 0x64, 0x20, 0x3d, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x2b, // c3 end = start +
+	0x20, 0x64, 0x69, 0x72, 0x20, 0x2a, 0x20, 0x65, 0x6e, 0x64, 0x4f, 0x66, 0x66, 0x73, 0x65, 0x74, //  dir * endOffset
+	0x3b, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x6c, 0x69, 0x66, 0x65, 0x53, 0x70, 0x61, 0x6e, // ;.float lifeSpan
+	0x20, 0x3d, 0x20, 0x6d, 0x69, 0x78, 0x28, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, //  = mix(u_psParam
+	0x73, 0x5b, 0x32, 0x5d, 0x2e, 0x78, 0x79, 0x2e, 0x78, 0x2c, 0x20, 0x75, 0x5f, 0x70, 0x73, 0x50, // s[2].xy.x, u_psP
+	0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x32, 0x5d, 0x2e, 0x78, 0x79, 0x2e, 0x79, 0x2c, 0x20, 0x66, // arams[2].xy.y, f
+	0x72, 0x6e, 0x64, 0x28, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x20, 0x29, 0x3b, 0x0a, 0x76, 0x65, // rnd(state) );.ve
+	0x63, 0x33, 0x20, 0x67, 0x72, 0x61, 0x76, 0x69, 0x74, 0x79, 0x20, 0x3d, 0x20, 0x76, 0x65, 0x63, // c3 gravity = vec
+	0x33, 0x28, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x2d, 0x39, 0x2e, 0x38, 0x31, 0x20, 0x2a, 0x20, 0x75, // 3(0.0, -9.81 * u
+	0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x32, 0x5d, 0x2e, 0x7a, 0x20, 0x2a, // _psParams[2].z *
+	0x20, 0x6c, 0x69, 0x66, 0x65, 0x53, 0x70, 0x61, 0x6e, 0x20, 0x2a, 0x20, 0x6c, 0x69, 0x66, 0x65, //  lifeSpan * life
+	0x53, 0x70, 0x61, 0x6e, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x29, 0x3b, 0x0a, 0x76, 0x65, 0x63, 0x33, // Span, 0.0);.vec3
+	0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x30, 0x20, 0x3d, 0x20, 0x28, 0x20, 0x28, 0x75, 0x5f, 0x70, //  start0 = ( (u_p
+	0x73, 0x4d, 0x74, 0x78, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x76, 0x65, 0x63, 0x34, 0x28, 0x73, 0x74, // sMtx) * (vec4(st
+	0x61, 0x72, 0x74, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x20, 0x29, 0x20, 0x29, 0x2e, 0x78, 0x79, // art, 1.0) ) ).xy
+	0x7a, 0x3b, 0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, 0x65, 0x6e, 0x64, 0x30, 0x20, 0x3d, 0x20, 0x28, // z;.vec3 end0 = (
+	0x20, 0x28, 0x75, 0x5f, 0x70, 0x73, 0x4d, 0x74, 0x78, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x76, 0x65, //  (u_psMtx) * (ve
+	0x63, 0x34, 0x28, 0x65, 0x6e, 0x64, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x20, 0x29, 0x20, 0x29, // c4(end, 1.0) ) )
+	0x2e, 0x78, 0x79, 0x7a, 0x3b, 0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, 0x65, 0x6e, 0x64, 0x31, 0x20, // .xyz;.vec3 end1 
+	0x3d, 0x20, 0x65, 0x6e, 0x64, 0x30, 0x20, 0x2b, 0x20, 0x67, 0x72, 0x61, 0x76, 0x69, 0x74, 0x79, // = end0 + gravity
+	0x3b, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x62, 0x6c, 0x65, 0x6e, 0x64, 0x53, 0x74, 0x61, // ;.float blendSta
+	0x72, 0x74, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x78, 0x28, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, // rt = mix(u_psPar
+	0x61, 0x6d, 0x73, 0x5b, 0x33, 0x5d, 0x2e, 0x78, 0x79, 0x2e, 0x78, 0x2c, 0x20, 0x75, 0x5f, 0x70, // ams[3].xy.x, u_p
+	0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x33, 0x5d, 0x2e, 0x78, 0x79, 0x2e, 0x79, 0x2c, // sParams[3].xy.y,
+	0x20, 0x66, 0x72, 0x6e, 0x64, 0x28, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x20, 0x29, 0x3b, 0x0a, //  frnd(state) );.
+	0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x62, 0x6c, 0x65, 0x6e, 0x64, 0x45, 0x6e, 0x64, 0x20, 0x3d, // float blendEnd =
+	0x20, 0x6d, 0x69, 0x78, 0x28, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, //  mix(u_psParams[
+	0x33, 0x5d, 0x2e, 0x7a, 0x77, 0x2e, 0x78, 0x2c, 0x20, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, // 3].zw.x, u_psPar
+	0x61, 0x6d, 0x73, 0x5b, 0x33, 0x5d, 0x2e, 0x7a, 0x77, 0x2e, 0x79, 0x2c, 0x20, 0x66, 0x72, 0x6e, // ams[3].zw.y, frn
+	0x64, 0x28, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x20, 0x29, 0x3b, 0x0a, 0x66, 0x6c, 0x6f, 0x61, // d(state) );.floa
+	0x74, 0x20, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x53, 0x74, 0x61, 0x72, 0x74, 0x20, 0x3d, 0x20, 0x6d, // t scaleStart = m
+	0x69, 0x78, 0x28, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x34, 0x5d, // ix(u_psParams[4]
+	0x2e, 0x78, 0x79, 0x2e, 0x78, 0x2c, 0x20, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, // .xy.x, u_psParam
+	0x73, 0x5b, 0x34, 0x5d, 0x2e, 0x78, 0x79, 0x2e, 0x79, 0x2c, 0x20, 0x66, 0x72, 0x6e, 0x64, 0x28, // s[4].xy.y, frnd(
+	0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x20, 0x29, 0x3b, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, // state) );.float 
+	0x73, 0x63, 0x61, 0x6c, 0x65, 0x45, 0x6e, 0x64, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x78, 0x28, 0x75, // scaleEnd = mix(u
+	0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x34, 0x5d, 0x2e, 0x7a, 0x77, 0x2e, // _psParams[4].zw.
+	0x78, 0x2c, 0x20, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x34, 0x5d, // x, u_psParams[4]
+	0x2e, 0x7a, 0x77, 0x2e, 0x79, 0x2c, 0x20, 0x66, 0x72, 0x6e, 0x64, 0x28, 0x73, 0x74, 0x61, 0x74, // .zw.y, frnd(stat
+	0x65, 0x29, 0x20, 0x29, 0x3b, 0x0a, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, 0x65, 0x73, 0x5b, // e) );.particles[
+	0x69, 0x64, 0x78, 0x2a, 0x34, 0x20, 0x2b, 0x20, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x76, 0x65, 0x63, // idx*4 + 0] = vec
+	0x34, 0x28, 0x73, 0x74, 0x61, 0x72, 0x74, 0x30, 0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, // 4(start0, float(
+	0x69, 0x64, 0x29, 0x20, 0x2a, 0x20, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, // id) * u_psParams
+	0x5b, 0x35, 0x5d, 0x2e, 0x7a, 0x29, 0x3b, 0x0a, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, 0x65, // [5].z);.particle
+	0x73, 0x5b, 0x69, 0x64, 0x78, 0x2a, 0x34, 0x20, 0x2b, 0x20, 0x31, 0x5d, 0x20, 0x3d, 0x20, 0x76, // s[idx*4 + 1] = v
+	0x65, 0x63, 0x34, 0x28, 0x65, 0x6e, 0x64, 0x30, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x2f, 0x6c, 0x69, // ec4(end0, 1.0/li
+	0x66, 0x65, 0x53, 0x70, 0x61, 0x6e, 0x29, 0x3b, 0x0a, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, // feSpan);.particl
+	0x65, 0x73, 0x5b, 0x69, 0x64, 0x78, 0x2a, 0x34, 0x20, 0x2b, 0x20, 0x32, 0x5d, 0x20, 0x3d, 0x20, // es[idx*4 + 2] = 
+	0x76, 0x65, 0x63, 0x34, 0x28, 0x65, 0x6e, 0x64, 0x31, 0x2c, 0x20, 0x62, 0x6c, 0x65, 0x6e, 0x64, // vec4(end1, blend
+	0x53, 0x74, 0x61, 0x72, 0x74, 0x29, 0x3b, 0x0a, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, 0x65, // Start);.particle
+	0x73, 0x5b, 0x69, 0x64, 0x78, 0x2a, 0x34, 0x20, 0x2b, 0x20, 0x33, 0x5d, 0x20, 0x3d, 0x20, 0x76, // s[idx*4 + 3] = v
+	0x65, 0x63, 0x34, 0x28, 0x62, 0x6c, 0x65, 0x6e, 0x64, 0x45, 0x6e, 0x64, 0x2c, 0x20, 0x73, 0x63, // ec4(blendEnd, sc
+	0x61, 0x6c, 0x65, 0x53, 0x74, 0x61, 0x72, 0x74, 0x2c, 0x20, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x45, // aleStart, scaleE
+	0x6e, 0x64, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x00,                   // nd, 0.0);.}..
+};
+static const uint8_t cs_ps_spawn_spv[9139] =
+{
+	0x43, 0x53, 0x48, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0a, 0x75, // CSH............u
+	0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x02, 0x06, 0x00, 0x00, 0x06, 0x00, 0xba, // _psParams.......
+	0xda, 0x07, 0x75, 0x5f, 0x70, 0x73, 0x4d, 0x74, 0x78, 0x04, 0x01, 0x00, 0x03, 0x04, 0x00, 0xba, // ..u_psMtx.......
+	0xda, 0x09, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, 0x65, 0x73, 0x01, 0x00, 0x10, 0x00, 0x07, // ..particles.....
+	0x00, 0xba, 0xda, 0x68, 0x23, 0x00, 0x00, 0x03, 0x02, 0x23, 0x07, 0x00, 0x00, 0x01, 0x00, 0x08, // ...h#....#......
+	0x00, 0x08, 0x00, 0x6c, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00, 0x01, // ...l............
+	0x00, 0x00, 0x00, 0x0b, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x47, 0x4c, 0x53, 0x4c, 0x2e, // ...........GLSL.
+	0x73, 0x74, 0x64, 0x2e, 0x34, 0x35, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x03, 0x00, 0x00, // std.450.........
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x06, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, // ................
+	0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x01, 0x00, 0x00, 0x10, // ...main.........
+	0x00, 0x06, 0x00, 0x04, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, // ...........@....
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x00, 0xf4, // ................
+	0x01, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, // ...........main.
+	0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x95, 0x00, 0x00, 0x00, 0x55, 0x6e, 0x69, 0x66, 0x6f, // ...........Unifo
+	0x72, 0x6d, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x95, // rmBlock.........
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, // .......u_psParam
+	0x73, 0x00, 0x00, 0x06, 0x00, 0x05, 0x00, 0x95, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x75, // s..............u
+	0x5f, 0x70, 0x73, 0x4d, 0x74, 0x78, 0x00, 0x05, 0x00, 0x03, 0x00, 0x97, 0x00, 0x00, 0x00, 0x00, // _psMtx..........
+	0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x91, 0x01, 0x00, 0x00, 0x70, 0x61, 0x72, 0x74, 0x69, // ...........parti
+	0x63, 0x6c, 0x65, 0x73, 0x00, 0x00, 0x00, 0x06, 0x00, 0x05, 0x00, 0x91, 0x01, 0x00, 0x00, 0x00, // cles............
+	0x00, 0x00, 0x00, 0x40, 0x64, 0x61, 0x74, 0x61, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x93, // ...@data........
+	0x01, 0x00, 0x00, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, 0x65, 0x73, 0x00, 0x00, 0x00, 0x05, // ...particles....
+	0x00, 0x08, 0x00, 0xc3, 0x01, 0x00, 0x00, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, // .......gl_Global
+	0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x00, 0x00, 0x00, 0x47, // InvocationID...G
+	0x00, 0x04, 0x00, 0x93, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x48, // ...............H
+	0x00, 0x05, 0x00, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, // ...........#....
+	0x00, 0x00, 0x00, 0x48, 0x00, 0x04, 0x00, 0x95, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, // ...H............
+	0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x95, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x23, // ...H...........#
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x95, 0x00, 0x00, 0x00, 0x01, // .......H........
+	0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x95, // ...........G....
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x97, 0x00, 0x00, 0x00, 0x22, // .......G......."
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x97, 0x00, 0x00, 0x00, 0x21, // .......G.......!
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x90, 0x01, 0x00, 0x00, 0x06, // .......G........
+	0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x91, 0x01, 0x00, 0x00, 0x00, // .......H........
+	0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x91, // ...#.......G....
+	0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x93, 0x01, 0x00, 0x00, 0x22, // .......G......."
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x93, 0x01, 0x00, 0x00, 0x21, // .......G.......!
+	0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0xc3, 0x01, 0x00, 0x00, 0x0b, // .......G........
+	0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x13, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x21, // ...............!
+	0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x16, 0x00, 0x03, 0x00, 0x06, // ................
+	0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x20, // ... ........... 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x06, // ................
+	0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00, 0x23, 0x00, 0x00, 0x00, 0x20, // ...........#... 
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x24, 0x00, 0x00, 0x00, 0x23, // ...........$...#
+	0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x23, 0x00, 0x00, 0x00, 0x31, // .......+...#...1
+	0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x35, // .......+.......5
+	0x00, 0x00, 0x00, 0x2d, 0x35, 0xeb, 0x7f, 0x2b, 0x00, 0x04, 0x00, 0x23, 0x00, 0x00, 0x00, 0x39, // ...-5..+...#...9
+	0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x3d, // .......+.......=
+	0x00, 0x00, 0x00, 0x8b, 0xa6, 0x6c, 0x84, 0x2b, 0x00, 0x04, 0x00, 0x23, 0x00, 0x00, 0x00, 0x4b, // .....l.+...#...K
+	0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x4e, // .......+.......N
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x33, 0x2b, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x58, // ......3+.......X
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x2b, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x65, // ......?+.......e
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x8b, // .......+........
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x91, 0x00, 0x00, 0x00, 0x06, // ................
+	0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x92, // .......+........
+	0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x04, 0x00, 0x93, 0x00, 0x00, 0x00, 0x91, // ...0............
+	0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x18, 0x00, 0x04, 0x00, 0x94, 0x00, 0x00, 0x00, 0x91, // ................
+	0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x04, 0x00, 0x95, 0x00, 0x00, 0x00, 0x93, // ................
+	0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x96, 0x00, 0x00, 0x00, 0x02, // ....... ........
+	0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x96, 0x00, 0x00, 0x00, 0x97, // .......;........
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x23, 0x00, 0x00, 0x00, 0x98, // .......+...#....
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x99, // .......+........
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x02, // ....... ........
+	0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x2b, // ...............+
+	0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2b, // ...............+
+	0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2b, // ...............+
+	0x00, 0x04, 0x00, 0x23, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2b, // ...#...........+
+	0x00, 0x04, 0x00, 0x23, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x2b, // ...#...........+
+	0x00, 0x04, 0x00, 0x23, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, // ...#...........+
+	0x00, 0x04, 0x00, 0x23, 0x00, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2c, // ...#...........,
+	0x00, 0x06, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x58, // ...........e...X
+	0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x03, 0x01, 0x00, 0x00, 0x9e, // ...e............
+	0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x39, // .......+.......9
+	0x01, 0x00, 0x00, 0xc3, 0xf5, 0x1c, 0xc1, 0x20, 0x00, 0x04, 0x00, 0x48, 0x01, 0x00, 0x00, 0x02, // ....... ...H....
+	0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x23, 0x00, 0x00, 0x00, 0x76, // .......+...#...v
+	0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x03, 0x00, 0x90, 0x01, 0x00, 0x00, 0x91, // ................
+	0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00, 0x91, 0x01, 0x00, 0x00, 0x90, 0x01, 0x00, 0x00, 0x20, // ............... 
+	0x00, 0x04, 0x00, 0x92, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x91, 0x01, 0x00, 0x00, 0x3b, // ...............;
+	0x00, 0x04, 0x00, 0x92, 0x01, 0x00, 0x00, 0x93, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2b, // ...............+
+	0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x95, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, // ............... 
+	0x00, 0x04, 0x00, 0xa2, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x20, // ............... 
+	0x00, 0x04, 0x00, 0xc2, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x3b, // ...........$...;
+	0x00, 0x04, 0x00, 0xc2, 0x01, 0x00, 0x00, 0xc3, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, // ...............+
+	0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x63, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x2b, // .......c......4+
+	0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x64, 0x05, 0x00, 0x00, 0xdb, 0x0f, 0xc9, 0x34, 0x36, // .......d......46
+	0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, // ................
+	0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x05, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x24, // ...........=...$
+	0x00, 0x00, 0x00, 0xc4, 0x01, 0x00, 0x00, 0xc3, 0x01, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0xf9, // ................
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x03, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x18, // ................
+	0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x18, 0x02, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x23, // ...........Q...#
+	0x00, 0x00, 0x00, 0x1a, 0x02, 0x00, 0x00, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, // ...............|
+	0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x1b, 0x02, 0x00, 0x00, 0x1a, 0x02, 0x00, 0x00, 0x41, // ...............A
+	0x00, 0x07, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x1d, 0x02, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x98, // ................
+	0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, // ...........=....
+	0x00, 0x00, 0x00, 0x1e, 0x02, 0x00, 0x00, 0x1d, 0x02, 0x00, 0x00, 0x6d, 0x00, 0x04, 0x00, 0x0e, // ...........m....
+	0x00, 0x00, 0x00, 0x1f, 0x02, 0x00, 0x00, 0x1e, 0x02, 0x00, 0x00, 0xae, 0x00, 0x05, 0x00, 0x9e, // ................
+	0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x1b, 0x02, 0x00, 0x00, 0x1f, 0x02, 0x00, 0x00, 0xf7, // ... ............
+	0x00, 0x03, 0x00, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x20, // ..."........... 
+	0x02, 0x00, 0x00, 0x21, 0x02, 0x00, 0x00, 0x22, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x21, // ...!...".......!
+	0x02, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xf9, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x22, // ..............."
+	0x02, 0x00, 0x00, 0x41, 0x00, 0x07, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x23, 0x02, 0x00, 0x00, 0x97, // ...A.......#....
+	0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x3d, // ...............=
+	0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x24, 0x02, 0x00, 0x00, 0x23, 0x02, 0x00, 0x00, 0x6d, // .......$...#...m
+	0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x25, 0x02, 0x00, 0x00, 0x24, 0x02, 0x00, 0x00, 0x80, // .......%...$....
+	0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x27, 0x02, 0x00, 0x00, 0x25, 0x02, 0x00, 0x00, 0x1b, // .......'...%....
+	0x02, 0x00, 0x00, 0x41, 0x00, 0x07, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x28, 0x02, 0x00, 0x00, 0x97, // ...A.......(....
+	0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x3d, // ...............=
+	0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x29, 0x02, 0x00, 0x00, 0x28, 0x02, 0x00, 0x00, 0x6d, // .......)...(...m
+	0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x2a, 0x02, 0x00, 0x00, 0x29, 0x02, 0x00, 0x00, 0x89, // .......*...)....
+	0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x2b, 0x02, 0x00, 0x00, 0x27, 0x02, 0x00, 0x00, 0x2a, // .......+...'...*
+	0x02, 0x00, 0x00, 0x41, 0x00, 0x07, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x2c, 0x02, 0x00, 0x00, 0x97, // ...A.......,....
+	0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x3d, // ...............=
+	0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x2d, 0x02, 0x00, 0x00, 0x2c, 0x02, 0x00, 0x00, 0x6d, // .......-...,...m
+	0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x2e, 0x02, 0x00, 0x00, 0x2d, 0x02, 0x00, 0x00, 0x80, // ...........-....
+	0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x30, 0x02, 0x00, 0x00, 0x2e, 0x02, 0x00, 0x00, 0x1b, // .......0........
+	0x02, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xfd, 0x02, 0x00, 0x00, 0x30, // ...............0
+	0x02, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xff, // ...1............
+	0x02, 0x00, 0x00, 0x30, 0x02, 0x00, 0x00, 0xfd, 0x02, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0e, // ...0............
+	0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0xc2, // ...........5....
+	0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x39, // ...............9
+	0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x05, 0x03, 0x00, 0x00, 0x01, // ................
+	0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x07, // ................
+	0x03, 0x00, 0x00, 0x05, 0x03, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, // .......=........
+	0x00, 0x00, 0x00, 0x09, 0x03, 0x00, 0x00, 0x07, 0x03, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xc6, // ...........1....
+	0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x0b, 0x03, 0x00, 0x00, 0x07, 0x03, 0x00, 0x00, 0x09, // ................
+	0x03, 0x00, 0x00, 0x41, 0x00, 0x07, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x32, 0x02, 0x00, 0x00, 0x97, // ...A.......2....
+	0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x3d, // ...............=
+	0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x33, 0x02, 0x00, 0x00, 0x32, 0x02, 0x00, 0x00, 0x6e, // .......3...2...n
+	0x00, 0x04, 0x00, 0x23, 0x00, 0x00, 0x00, 0x34, 0x02, 0x00, 0x00, 0x33, 0x02, 0x00, 0x00, 0xaa, // ...#...4...3....
+	0x00, 0x05, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x35, 0x02, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x34, // .......5.......4
+	0x02, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x68, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, // .......h........
+	0x00, 0x04, 0x00, 0x35, 0x02, 0x00, 0x00, 0x36, 0x02, 0x00, 0x00, 0x3a, 0x02, 0x00, 0x00, 0xf8, // ...5...6...:....
+	0x00, 0x02, 0x00, 0x36, 0x02, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x38, // ...6...........8
+	0x03, 0x00, 0x00, 0x0b, 0x03, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0e, // .......1........
+	0x00, 0x00, 0x00, 0x3a, 0x03, 0x00, 0x00, 0x0b, 0x03, 0x00, 0x00, 0x38, 0x03, 0x00, 0x00, 0x84, // ...:.......8....
+	0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x3c, 0x03, 0x00, 0x00, 0x3a, 0x03, 0x00, 0x00, 0x35, // .......<...:...5
+	0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x3e, 0x03, 0x00, 0x00, 0x3c, // ...........>...<
+	0x03, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x40, // ...9...........@
+	0x03, 0x00, 0x00, 0x3c, 0x03, 0x00, 0x00, 0x3e, 0x03, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0e, // ...<...>........
+	0x00, 0x00, 0x00, 0x42, 0x03, 0x00, 0x00, 0x40, 0x03, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0xc2, // ...B...@...=....
+	0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x44, 0x03, 0x00, 0x00, 0x42, 0x03, 0x00, 0x00, 0x31, // .......D...B...1
+	0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x46, 0x03, 0x00, 0x00, 0x42, // ...........F...B
+	0x03, 0x00, 0x00, 0x44, 0x03, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x32, // ...D...........2
+	0x03, 0x00, 0x00, 0x46, 0x03, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x70, 0x00, 0x04, 0x00, 0x06, // ...F...K...p....
+	0x00, 0x00, 0x00, 0x33, 0x03, 0x00, 0x00, 0x32, 0x03, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x06, // ...3...2........
+	0x00, 0x00, 0x00, 0x17, 0x03, 0x00, 0x00, 0x33, 0x03, 0x00, 0x00, 0x63, 0x05, 0x00, 0x00, 0x83, // .......3...c....
+	0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00, 0x17, 0x03, 0x00, 0x00, 0x58, // ...............X
+	0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x54, 0x03, 0x00, 0x00, 0x46, // ...........T...F
+	0x03, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x56, // ...1...........V
+	0x03, 0x00, 0x00, 0x46, 0x03, 0x00, 0x00, 0x54, 0x03, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0e, // ...F...T........
+	0x00, 0x00, 0x00, 0x58, 0x03, 0x00, 0x00, 0x56, 0x03, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0xc2, // ...X...V...5....
+	0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x5a, 0x03, 0x00, 0x00, 0x58, 0x03, 0x00, 0x00, 0x39, // .......Z...X...9
+	0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x5c, 0x03, 0x00, 0x00, 0x58, // ...............X
+	0x03, 0x00, 0x00, 0x5a, 0x03, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x5e, // ...Z...........^
+	0x03, 0x00, 0x00, 0x5c, 0x03, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, // .......=........
+	0x00, 0x00, 0x00, 0x60, 0x03, 0x00, 0x00, 0x5e, 0x03, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xc6, // ...`...^...1....
+	0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x62, 0x03, 0x00, 0x00, 0x5e, 0x03, 0x00, 0x00, 0x60, // .......b...^...`
+	0x03, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x4e, 0x03, 0x00, 0x00, 0x62, // ...........N...b
+	0x03, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x70, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x4f, // ...K...p.......O
+	0x03, 0x00, 0x00, 0x4e, 0x03, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x1c, // ...N............
+	0x03, 0x00, 0x00, 0x4f, 0x03, 0x00, 0x00, 0x64, 0x05, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x06, // ...O...d........
+	0x00, 0x00, 0x00, 0x1f, 0x03, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00, 0x83, // ................
+	0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x20, 0x03, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x1f, // ....... ...X....
+	0x03, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x21, 0x03, 0x00, 0x00, 0x01, // ...........!....
+	0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x20, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x06, // ....... ........
+	0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x1c, // ...$............
+	0x03, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x25, 0x03, 0x00, 0x00, 0x21, // ...........%...!
+	0x03, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x28, // ...$...........(
+	0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x1c, 0x03, 0x00, 0x00, 0x85, // ................
+	0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x29, 0x03, 0x00, 0x00, 0x21, 0x03, 0x00, 0x00, 0x28, // .......)...!...(
+	0x03, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x2b, 0x03, 0x00, 0x00, 0x25, // ...P.......+...%
+	0x03, 0x00, 0x00, 0x29, 0x03, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x68, // ...)...........h
+	0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x3a, 0x02, 0x00, 0x00, 0x41, 0x00, 0x07, 0x00, 0x9a, // .......:...A....
+	0x00, 0x00, 0x00, 0x3b, 0x02, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0xb8, // ...;............
+	0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x3c, // .......=.......<
+	0x02, 0x00, 0x00, 0x3b, 0x02, 0x00, 0x00, 0x6e, 0x00, 0x04, 0x00, 0x23, 0x00, 0x00, 0x00, 0x3d, // ...;...n...#...=
+	0x02, 0x00, 0x00, 0x3c, 0x02, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x3e, // ...<...........>
+	0x02, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x3d, 0x02, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x67, // .......=.......g
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x3e, 0x02, 0x00, 0x00, 0x3f, // ...........>...?
+	0x02, 0x00, 0x00, 0x47, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x3f, 0x02, 0x00, 0x00, 0xc2, // ...G.......?....
+	0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x8f, 0x03, 0x00, 0x00, 0x0b, 0x03, 0x00, 0x00, 0x31, // ...............1
+	0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x91, 0x03, 0x00, 0x00, 0x0b, // ................
+	0x03, 0x00, 0x00, 0x8f, 0x03, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x93, // ................
+	0x03, 0x00, 0x00, 0x91, 0x03, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, // .......5........
+	0x00, 0x00, 0x00, 0x95, 0x03, 0x00, 0x00, 0x93, 0x03, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0xc6, // ...........9....
+	0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x97, 0x03, 0x00, 0x00, 0x93, 0x03, 0x00, 0x00, 0x95, // ................
+	0x03, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x99, 0x03, 0x00, 0x00, 0x97, // ................
+	0x03, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x9b, // ...=............
+	0x03, 0x00, 0x00, 0x99, 0x03, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0e, // .......1........
+	0x00, 0x00, 0x00, 0x9d, 0x03, 0x00, 0x00, 0x99, 0x03, 0x00, 0x00, 0x9b, 0x03, 0x00, 0x00, 0xc2, // ................
+	0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x89, 0x03, 0x00, 0x00, 0x9d, 0x03, 0x00, 0x00, 0x4b, // ...............K
+	0x00, 0x00, 0x00, 0x70, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x8a, 0x03, 0x00, 0x00, 0x89, // ...p............
+	0x03, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x6e, 0x03, 0x00, 0x00, 0x8a, // ...........n....
+	0x03, 0x00, 0x00, 0x63, 0x05, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x6f, // ...c...........o
+	0x03, 0x00, 0x00, 0x6e, 0x03, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, // ...n...X........
+	0x00, 0x00, 0x00, 0xab, 0x03, 0x00, 0x00, 0x9d, 0x03, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xc6, // ...........1....
+	0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xad, 0x03, 0x00, 0x00, 0x9d, 0x03, 0x00, 0x00, 0xab, // ................
+	0x03, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xaf, 0x03, 0x00, 0x00, 0xad, // ................
+	0x03, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xb1, // ...5............
+	0x03, 0x00, 0x00, 0xaf, 0x03, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0e, // .......9........
+	0x00, 0x00, 0x00, 0xb3, 0x03, 0x00, 0x00, 0xaf, 0x03, 0x00, 0x00, 0xb1, 0x03, 0x00, 0x00, 0x84, // ................
+	0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xb5, 0x03, 0x00, 0x00, 0xb3, 0x03, 0x00, 0x00, 0x3d, // ...............=
+	0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xb7, 0x03, 0x00, 0x00, 0xb5, // ................
+	0x03, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xb9, // ...1............
+	0x03, 0x00, 0x00, 0xb5, 0x03, 0x00, 0x00, 0xb7, 0x03, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, // ................
+	0x00, 0x00, 0x00, 0xa5, 0x03, 0x00, 0x00, 0xb9, 0x03, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x70, // ...........K...p
+	0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0xa6, 0x03, 0x00, 0x00, 0xa5, 0x03, 0x00, 0x00, 0x85, // ................
+	0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x73, 0x03, 0x00, 0x00, 0xa6, 0x03, 0x00, 0x00, 0x64, // .......s.......d
+	0x05, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x76, 0x03, 0x00, 0x00, 0x6f, // ...........v...o
+	0x03, 0x00, 0x00, 0x6f, 0x03, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x77, // ...o...........w
+	0x03, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x76, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x06, // ...X...v........
+	0x00, 0x00, 0x00, 0x78, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x77, // ...x...........w
+	0x03, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x7b, 0x03, 0x00, 0x00, 0x01, // ...........{....
+	0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x73, 0x03, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x06, // .......s........
+	0x00, 0x00, 0x00, 0x7c, 0x03, 0x00, 0x00, 0x78, 0x03, 0x00, 0x00, 0x7b, 0x03, 0x00, 0x00, 0x0c, // ...|...x...{....
+	0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x7f, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0d, // ................
+	0x00, 0x00, 0x00, 0x73, 0x03, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x80, // ...s............
+	0x03, 0x00, 0x00, 0x78, 0x03, 0x00, 0x00, 0x7f, 0x03, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00, 0x1b, // ...x.......P....
+	0x00, 0x00, 0x00, 0x82, 0x03, 0x00, 0x00, 0x7c, 0x03, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x6f, // .......|.......o
+	0x03, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x45, 0x02, 0x00, 0x00, 0x01, // ...........E....
+	0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x52, 0x00, 0x06, 0x00, 0x1b, // ...........R....
+	0x00, 0x00, 0x00, 0x62, 0x05, 0x00, 0x00, 0x45, 0x02, 0x00, 0x00, 0x82, 0x03, 0x00, 0x00, 0x01, // ...b...E........
+	0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x67, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x47, // .......g.......G
+	0x02, 0x00, 0x00, 0x41, 0x00, 0x07, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x48, 0x02, 0x00, 0x00, 0x97, // ...A.......H....
+	0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x3d, // ...............=
+	0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x49, 0x02, 0x00, 0x00, 0x48, 0x02, 0x00, 0x00, 0x6e, // .......I...H...n
+	0x00, 0x04, 0x00, 0x23, 0x00, 0x00, 0x00, 0x4a, 0x02, 0x00, 0x00, 0x49, 0x02, 0x00, 0x00, 0xaa, // ...#...J...I....
+	0x00, 0x05, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x4b, 0x02, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x4a, // .......K.......J
+	0x02, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x66, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, // .......f........
+	0x00, 0x04, 0x00, 0x4b, 0x02, 0x00, 0x00, 0x4c, 0x02, 0x00, 0x00, 0x50, 0x02, 0x00, 0x00, 0xf8, // ...K...L...P....
+	0x00, 0x02, 0x00, 0x4c, 0x02, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xd4, // ...L............
+	0x03, 0x00, 0x00, 0x0b, 0x03, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0e, // .......1........
+	0x00, 0x00, 0x00, 0xd6, 0x03, 0x00, 0x00, 0x0b, 0x03, 0x00, 0x00, 0xd4, 0x03, 0x00, 0x00, 0x84, // ................
+	0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xd8, 0x03, 0x00, 0x00, 0xd6, 0x03, 0x00, 0x00, 0x35, // ...............5
+	0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xda, 0x03, 0x00, 0x00, 0xd8, // ................
+	0x03, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xdc, // ...9............
+	0x03, 0x00, 0x00, 0xd8, 0x03, 0x00, 0x00, 0xda, 0x03, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0e, // ................
+	0x00, 0x00, 0x00, 0xde, 0x03, 0x00, 0x00, 0xdc, 0x03, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0xc2, // ...........=....
+	0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xe0, 0x03, 0x00, 0x00, 0xde, 0x03, 0x00, 0x00, 0x31, // ...............1
+	0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xe2, 0x03, 0x00, 0x00, 0xde, // ................
+	0x03, 0x00, 0x00, 0xe0, 0x03, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xce, // ................
+	0x03, 0x00, 0x00, 0xe2, 0x03, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x70, 0x00, 0x04, 0x00, 0x06, // .......K...p....
+	0x00, 0x00, 0x00, 0xcf, 0x03, 0x00, 0x00, 0xce, 0x03, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x06, // ................
+	0x00, 0x00, 0x00, 0xc2, 0x03, 0x00, 0x00, 0xcf, 0x03, 0x00, 0x00, 0x64, 0x05, 0x00, 0x00, 0x0c, // ...........d....
+	0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0xc4, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0e, // ................
+	0x00, 0x00, 0x00, 0xc2, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0xc6, // ................
+	0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xc2, 0x03, 0x00, 0x00, 0x50, // ...............P
+	0x00, 0x06, 0x00, 0x1b, 0x00, 0x00, 0x00, 0xc7, 0x03, 0x00, 0x00, 0xc4, 0x03, 0x00, 0x00, 0x65, // ...............e
+	0x00, 0x00, 0x00, 0xc6, 0x03, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x66, 0x02, 0x00, 0x00, 0xf8, // ...........f....
+	0x00, 0x02, 0x00, 0x50, 0x02, 0x00, 0x00, 0x41, 0x00, 0x07, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x51, // ...P...A.......Q
+	0x02, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x8b, // ................
+	0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x52, 0x02, 0x00, 0x00, 0x51, // ...=.......R...Q
+	0x02, 0x00, 0x00, 0x6e, 0x00, 0x04, 0x00, 0x23, 0x00, 0x00, 0x00, 0x53, 0x02, 0x00, 0x00, 0x52, // ...n...#...S...R
+	0x02, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0xe1, // ...........T....
+	0x00, 0x00, 0x00, 0x53, 0x02, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xfd, // ...S............
+	0x03, 0x00, 0x00, 0x0b, 0x03, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0e, // .......1........
+	0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x0b, 0x03, 0x00, 0x00, 0xfd, 0x03, 0x00, 0x00, 0x84, // ................
+	0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x35, // ...............5
+	0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x01, // ................
+	0x04, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x05, // ...9............
+	0x04, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0e, // ................
+	0x00, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00, 0x05, 0x04, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0xc2, // ...........=....
+	0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x09, 0x04, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00, 0x31, // ...............1
+	0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x0b, 0x04, 0x00, 0x00, 0x07, // ................
+	0x04, 0x00, 0x00, 0x09, 0x04, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x19, // ................
+	0x04, 0x00, 0x00, 0x0b, 0x04, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0e, // .......1........
+	0x00, 0x00, 0x00, 0x1b, 0x04, 0x00, 0x00, 0x0b, 0x04, 0x00, 0x00, 0x19, 0x04, 0x00, 0x00, 0x84, // ................
+	0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x1d, 0x04, 0x00, 0x00, 0x1b, 0x04, 0x00, 0x00, 0x35, // ...............5
+	0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x1f, 0x04, 0x00, 0x00, 0x1d, // ................
+	0x04, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x21, // ...9...........!
+	0x04, 0x00, 0x00, 0x1d, 0x04, 0x00, 0x00, 0x1f, 0x04, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0e, // ................
+	0x00, 0x00, 0x00, 0x23, 0x04, 0x00, 0x00, 0x21, 0x04, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0xc2, // ...#...!...=....
+	0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x25, 0x04, 0x00, 0x00, 0x23, 0x04, 0x00, 0x00, 0x31, // .......%...#...1
+	0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x27, 0x04, 0x00, 0x00, 0x23, // ...........'...#
+	0x04, 0x00, 0x00, 0x25, 0x04, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x65, 0x02, 0x00, 0x00, 0x00, // ...%.......e....
+	0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x54, 0x02, 0x00, 0x00, 0x55, 0x02, 0x00, 0x00, 0x5d, // .......T...U...]
+	0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x55, 0x02, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, // .......U........
+	0x00, 0x00, 0x00, 0xf7, 0x03, 0x00, 0x00, 0x0b, 0x04, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x70, // ...........K...p
+	0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0xf8, 0x03, 0x00, 0x00, 0xf7, 0x03, 0x00, 0x00, 0x85, // ................
+	0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0xeb, 0x03, 0x00, 0x00, 0xf8, 0x03, 0x00, 0x00, 0x64, // ...............d
+	0x05, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0xed, 0x03, 0x00, 0x00, 0x01, // ................
+	0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xeb, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x06, // ................
+	0x00, 0x00, 0x00, 0xef, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xeb, // ................
+	0x03, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00, 0x1b, 0x00, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xed, // ...P............
+	0x03, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0xef, 0x03, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, // ...e............
+	0x00, 0x00, 0x00, 0x13, 0x04, 0x00, 0x00, 0x27, 0x04, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x70, // .......'...K...p
+	0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x14, 0x04, 0x00, 0x00, 0x13, 0x04, 0x00, 0x00, 0x85, // ................
+	0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x15, 0x04, 0x00, 0x00, 0x14, 0x04, 0x00, 0x00, 0x4e, // ...............N
+	0x00, 0x00, 0x00, 0x8e, 0x00, 0x05, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x5c, 0x02, 0x00, 0x00, 0xf0, // ................
+	0x03, 0x00, 0x00, 0x15, 0x04, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x65, 0x02, 0x00, 0x00, 0xf8, // ...........e....
+	0x00, 0x02, 0x00, 0x5d, 0x02, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x3d, // ...]...........=
+	0x04, 0x00, 0x00, 0x0b, 0x03, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0e, // .......1........
+	0x00, 0x00, 0x00, 0x3f, 0x04, 0x00, 0x00, 0x0b, 0x03, 0x00, 0x00, 0x3d, 0x04, 0x00, 0x00, 0x84, // ...?.......=....
+	0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x41, 0x04, 0x00, 0x00, 0x3f, 0x04, 0x00, 0x00, 0x35, // .......A...?...5
+	0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x43, 0x04, 0x00, 0x00, 0x41, // ...........C...A
+	0x04, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x45, // ...9...........E
+	0x04, 0x00, 0x00, 0x41, 0x04, 0x00, 0x00, 0x43, 0x04, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0e, // ...A...C........
+	0x00, 0x00, 0x00, 0x47, 0x04, 0x00, 0x00, 0x45, 0x04, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0xc2, // ...G...E...=....
+	0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x49, 0x04, 0x00, 0x00, 0x47, 0x04, 0x00, 0x00, 0x31, // .......I...G...1
+	0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x4b, 0x04, 0x00, 0x00, 0x47, // ...........K...G
+	0x04, 0x00, 0x00, 0x49, 0x04, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x37, // ...I...........7
+	0x04, 0x00, 0x00, 0x4b, 0x04, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x70, 0x00, 0x04, 0x00, 0x06, // ...K...K...p....
+	0x00, 0x00, 0x00, 0x38, 0x04, 0x00, 0x00, 0x37, 0x04, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x06, // ...8...7........
+	0x00, 0x00, 0x00, 0x2f, 0x04, 0x00, 0x00, 0x38, 0x04, 0x00, 0x00, 0x63, 0x05, 0x00, 0x00, 0x83, // .../...8...c....
+	0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x30, 0x04, 0x00, 0x00, 0x2f, 0x04, 0x00, 0x00, 0x58, // .......0.../...X
+	0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x61, 0x04, 0x00, 0x00, 0x4b, // ...........a...K
+	0x04, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x63, // ...1...........c
+	0x04, 0x00, 0x00, 0x4b, 0x04, 0x00, 0x00, 0x61, 0x04, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0e, // ...K...a........
+	0x00, 0x00, 0x00, 0x65, 0x04, 0x00, 0x00, 0x63, 0x04, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0xc2, // ...e...c...5....
+	0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x67, 0x04, 0x00, 0x00, 0x65, 0x04, 0x00, 0x00, 0x39, // .......g...e...9
+	0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x69, 0x04, 0x00, 0x00, 0x65, // ...........i...e
+	0x04, 0x00, 0x00, 0x67, 0x04, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x6b, // ...g...........k
+	0x04, 0x00, 0x00, 0x69, 0x04, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, // ...i...=........
+	0x00, 0x00, 0x00, 0x6d, 0x04, 0x00, 0x00, 0x6b, 0x04, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xc6, // ...m...k...1....
+	0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x6f, 0x04, 0x00, 0x00, 0x6b, 0x04, 0x00, 0x00, 0x6d, // .......o...k...m
+	0x04, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x5b, 0x04, 0x00, 0x00, 0x6f, // ...........[...o
+	0x04, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x70, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x5c, // ...K...p........
+	0x04, 0x00, 0x00, 0x5b, 0x04, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x53, // ...[...........S
+	0x04, 0x00, 0x00, 0x5c, 0x04, 0x00, 0x00, 0x63, 0x05, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00, 0x06, // .......c........
+	0x00, 0x00, 0x00, 0x54, 0x04, 0x00, 0x00, 0x53, 0x04, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x50, // ...T...S...X...P
+	0x00, 0x06, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x64, 0x02, 0x00, 0x00, 0x30, 0x04, 0x00, 0x00, 0x65, // .......d...0...e
+	0x00, 0x00, 0x00, 0x54, 0x04, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x65, 0x02, 0x00, 0x00, 0xf8, // ...T.......e....
+	0x00, 0x02, 0x00, 0x65, 0x02, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x68, // ...e...........h
+	0x05, 0x00, 0x00, 0x5c, 0x02, 0x00, 0x00, 0x55, 0x02, 0x00, 0x00, 0x64, 0x02, 0x00, 0x00, 0x5d, // .......U...d...]
+	0x02, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x66, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x66, // .......f.......f
+	0x02, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x6b, 0x05, 0x00, 0x00, 0xe2, // ...........k....
+	0x03, 0x00, 0x00, 0x4c, 0x02, 0x00, 0x00, 0x27, 0x04, 0x00, 0x00, 0x65, 0x02, 0x00, 0x00, 0xf5, // ...L...'...e....
+	0x00, 0x07, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x67, 0x05, 0x00, 0x00, 0xc7, 0x03, 0x00, 0x00, 0x4c, // .......g.......L
+	0x02, 0x00, 0x00, 0x68, 0x05, 0x00, 0x00, 0x65, 0x02, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x67, // ...h...e.......g
+	0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x67, 0x02, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x0e, // .......g........
+	0x00, 0x00, 0x00, 0x6a, 0x05, 0x00, 0x00, 0xb9, 0x03, 0x00, 0x00, 0x3f, 0x02, 0x00, 0x00, 0x6b, // ...j.......?...k
+	0x05, 0x00, 0x00, 0x66, 0x02, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x66, // ...f...........f
+	0x05, 0x00, 0x00, 0x62, 0x05, 0x00, 0x00, 0x3f, 0x02, 0x00, 0x00, 0x67, 0x05, 0x00, 0x00, 0x66, // ...b...?...g...f
+	0x02, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x68, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x68, // .......h.......h
+	0x02, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x69, 0x05, 0x00, 0x00, 0x62, // ...........i...b
+	0x03, 0x00, 0x00, 0x36, 0x02, 0x00, 0x00, 0x6a, 0x05, 0x00, 0x00, 0x67, 0x02, 0x00, 0x00, 0xf5, // ...6...j...g....
+	0x00, 0x07, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x65, 0x05, 0x00, 0x00, 0x2b, 0x03, 0x00, 0x00, 0x36, // .......e...+...6
+	0x02, 0x00, 0x00, 0x66, 0x05, 0x00, 0x00, 0x67, 0x02, 0x00, 0x00, 0x41, 0x00, 0x07, 0x00, 0x9a, // ...f...g...A....
+	0x00, 0x00, 0x00, 0x69, 0x02, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0xb8, // ...i............
+	0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x6a, // .......=.......j
+	0x02, 0x00, 0x00, 0x69, 0x02, 0x00, 0x00, 0x6e, 0x00, 0x04, 0x00, 0x23, 0x00, 0x00, 0x00, 0x6b, // ...i...n...#...k
+	0x02, 0x00, 0x00, 0x6a, 0x02, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x6c, // ...j...........l
+	0x02, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x6b, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x1b, // .......k........
+	0x00, 0x00, 0x00, 0x6e, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x65, // ...n.......E...e
+	0x05, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00, 0x03, 0x01, 0x00, 0x00, 0x6f, 0x02, 0x00, 0x00, 0x6c, // ...P.......o...l
+	0x02, 0x00, 0x00, 0x6c, 0x02, 0x00, 0x00, 0x6c, 0x02, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00, 0x1b, // ...l...l........
+	0x00, 0x00, 0x00, 0x70, 0x02, 0x00, 0x00, 0x6f, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x6e, // ...p...o.......n
+	0x02, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x7d, 0x04, 0x00, 0x00, 0x69, // ...........}...i
+	0x05, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x7f, // ...1............
+	0x04, 0x00, 0x00, 0x69, 0x05, 0x00, 0x00, 0x7d, 0x04, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0e, // ...i...}........
+	0x00, 0x00, 0x00, 0x81, 0x04, 0x00, 0x00, 0x7f, 0x04, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0xc2, // ...........5....
+	0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x83, 0x04, 0x00, 0x00, 0x81, 0x04, 0x00, 0x00, 0x39, // ...............9
+	0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x85, 0x04, 0x00, 0x00, 0x81, // ................
+	0x04, 0x00, 0x00, 0x83, 0x04, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x87, // ................
+	0x04, 0x00, 0x00, 0x85, 0x04, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, // .......=........
+	0x00, 0x00, 0x00, 0x89, 0x04, 0x00, 0x00, 0x87, 0x04, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xc6, // ...........1....
+	0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x8b, 0x04, 0x00, 0x00, 0x87, 0x04, 0x00, 0x00, 0x89, // ................
+	0x04, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x77, 0x04, 0x00, 0x00, 0x8b, // ...........w....
+	0x04, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x70, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x78, // ...K...p.......x
+	0x04, 0x00, 0x00, 0x77, 0x04, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x79, // ...w...........y
+	0x04, 0x00, 0x00, 0x78, 0x04, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x41, 0x00, 0x07, 0x00, 0x9a, // ...x...N...A....
+	0x00, 0x00, 0x00, 0x74, 0x02, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0xc6, // ...t............
+	0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x75, // .......=.......u
+	0x02, 0x00, 0x00, 0x74, 0x02, 0x00, 0x00, 0x41, 0x00, 0x07, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x76, // ...t...A.......v
+	0x02, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x99, // ................
+	0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x77, 0x02, 0x00, 0x00, 0x76, // ...=.......w...v
+	0x02, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x06, 0x00, 0x00, 0x00, 0x92, 0x04, 0x00, 0x00, 0x01, // ................
+	0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x75, 0x02, 0x00, 0x00, 0x77, 0x02, 0x00, 0x00, 0x79, // .......u...w...y
+	0x04, 0x00, 0x00, 0x8e, 0x00, 0x05, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x7b, 0x02, 0x00, 0x00, 0x65, // ...........{...e
+	0x05, 0x00, 0x00, 0x92, 0x04, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x9f, // ................
+	0x04, 0x00, 0x00, 0x8b, 0x04, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0e, // .......1........
+	0x00, 0x00, 0x00, 0xa1, 0x04, 0x00, 0x00, 0x8b, 0x04, 0x00, 0x00, 0x9f, 0x04, 0x00, 0x00, 0x84, // ................
+	0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xa3, 0x04, 0x00, 0x00, 0xa1, 0x04, 0x00, 0x00, 0x35, // ...............5
+	0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xa5, 0x04, 0x00, 0x00, 0xa3, // ................
+	0x04, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xa7, // ...9............
+	0x04, 0x00, 0x00, 0xa3, 0x04, 0x00, 0x00, 0xa5, 0x04, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0e, // ................
+	0x00, 0x00, 0x00, 0xa9, 0x04, 0x00, 0x00, 0xa7, 0x04, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0xc2, // ...........=....
+	0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xab, 0x04, 0x00, 0x00, 0xa9, 0x04, 0x00, 0x00, 0x31, // ...............1
+	0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xad, 0x04, 0x00, 0x00, 0xa9, // ................
+	0x04, 0x00, 0x00, 0xab, 0x04, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x99, // ................
+	0x04, 0x00, 0x00, 0xad, 0x04, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x70, 0x00, 0x04, 0x00, 0x06, // .......K...p....
+	0x00, 0x00, 0x00, 0x9a, 0x04, 0x00, 0x00, 0x99, 0x04, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x06, // ................
+	0x00, 0x00, 0x00, 0x9b, 0x04, 0x00, 0x00, 0x9a, 0x04, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x41, // ...........N...A
+	0x00, 0x07, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x7f, 0x02, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x98, // ................
+	0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, // ...........=....
+	0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x7f, 0x02, 0x00, 0x00, 0x41, 0x00, 0x07, 0x00, 0x9a, // ...........A....
+	0x00, 0x00, 0x00, 0x81, 0x02, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0xc6, // ................
+	0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x82, // .......=........
+	0x02, 0x00, 0x00, 0x81, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x06, 0x00, 0x00, 0x00, 0xb4, // ................
+	0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x82, // ................
+	0x02, 0x00, 0x00, 0x9b, 0x04, 0x00, 0x00, 0x8e, 0x00, 0x05, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x87, // ................
+	0x02, 0x00, 0x00, 0x70, 0x02, 0x00, 0x00, 0xb4, 0x04, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x1b, // ...p............
+	0x00, 0x00, 0x00, 0x88, 0x02, 0x00, 0x00, 0x7b, 0x02, 0x00, 0x00, 0x87, 0x02, 0x00, 0x00, 0xc2, // .......{........
+	0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xc1, 0x04, 0x00, 0x00, 0xad, 0x04, 0x00, 0x00, 0x31, // ...............1
+	0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xc3, 0x04, 0x00, 0x00, 0xad, // ................
+	0x04, 0x00, 0x00, 0xc1, 0x04, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xc5, // ................
+	0x04, 0x00, 0x00, 0xc3, 0x04, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, // .......5........
+	0x00, 0x00, 0x00, 0xc7, 0x04, 0x00, 0x00, 0xc5, 0x04, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0xc6, // ...........9....
+	0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xc9, 0x04, 0x00, 0x00, 0xc5, 0x04, 0x00, 0x00, 0xc7, // ................
+	0x04, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xcb, 0x04, 0x00, 0x00, 0xc9, // ................
+	0x04, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xcd, // ...=............
+	0x04, 0x00, 0x00, 0xcb, 0x04, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0e, // .......1........
+	0x00, 0x00, 0x00, 0xcf, 0x04, 0x00, 0x00, 0xcb, 0x04, 0x00, 0x00, 0xcd, 0x04, 0x00, 0x00, 0xc2, // ................
+	0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xbb, 0x04, 0x00, 0x00, 0xcf, 0x04, 0x00, 0x00, 0x4b, // ...............K
+	0x00, 0x00, 0x00, 0x70, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0xbc, 0x04, 0x00, 0x00, 0xbb, // ...p............
+	0x04, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0xbd, 0x04, 0x00, 0x00, 0xbc, // ................
+	0x04, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x41, 0x00, 0x07, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x8c, // ...N...A........
+	0x02, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x8b, // ................
+	0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x8d, 0x02, 0x00, 0x00, 0x8c, // ...=............
+	0x02, 0x00, 0x00, 0x41, 0x00, 0x07, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x8e, 0x02, 0x00, 0x00, 0x97, // ...A............
+	0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x3d, // ...............=
+	0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x8f, 0x02, 0x00, 0x00, 0x8e, 0x02, 0x00, 0x00, 0x0c, // ................
+	0x00, 0x08, 0x00, 0x06, 0x00, 0x00, 0x00, 0xd6, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2e, // ................
+	0x00, 0x00, 0x00, 0x8d, 0x02, 0x00, 0x00, 0x8f, 0x02, 0x00, 0x00, 0xbd, 0x04, 0x00, 0x00, 0x41, // ...............A
+	0x00, 0x07, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x91, 0x02, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x98, // ................
+	0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, // ...........=....
+	0x00, 0x00, 0x00, 0x92, 0x02, 0x00, 0x00, 0x91, 0x02, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x06, // ................
+	0x00, 0x00, 0x00, 0x93, 0x02, 0x00, 0x00, 0x39, 0x01, 0x00, 0x00, 0x92, 0x02, 0x00, 0x00, 0x85, // .......9........
+	0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x95, 0x02, 0x00, 0x00, 0x93, 0x02, 0x00, 0x00, 0xd6, // ................
+	0x04, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x97, 0x02, 0x00, 0x00, 0x95, // ................
+	0x02, 0x00, 0x00, 0xd6, 0x04, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x98, // .......P........
+	0x02, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x97, 0x02, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x51, // ...e.......e...Q
+	0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x9a, 0x02, 0x00, 0x00, 0x7b, 0x02, 0x00, 0x00, 0x00, // ...........{....
+	0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x9b, 0x02, 0x00, 0x00, 0x7b, // ...Q...........{
+	0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x9c, // .......Q........
+	0x02, 0x00, 0x00, 0x7b, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x50, 0x00, 0x07, 0x00, 0x91, // ...{.......P....
+	0x00, 0x00, 0x00, 0x9d, 0x02, 0x00, 0x00, 0x9a, 0x02, 0x00, 0x00, 0x9b, 0x02, 0x00, 0x00, 0x9c, // ................
+	0x02, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x48, 0x01, 0x00, 0x00, 0x9e, // ...X...A...H....
+	0x02, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x94, // ...........=....
+	0x00, 0x00, 0x00, 0x9f, 0x02, 0x00, 0x00, 0x9e, 0x02, 0x00, 0x00, 0x90, 0x00, 0x05, 0x00, 0x91, // ................
+	0x00, 0x00, 0x00, 0xa0, 0x02, 0x00, 0x00, 0x9d, 0x02, 0x00, 0x00, 0x9f, 0x02, 0x00, 0x00, 0x51, // ...............Q
+	0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0xa3, 0x02, 0x00, 0x00, 0x88, 0x02, 0x00, 0x00, 0x00, // ................
+	0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0xa4, 0x02, 0x00, 0x00, 0x88, // ...Q............
+	0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0xa5, // .......Q........
+	0x02, 0x00, 0x00, 0x88, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x50, 0x00, 0x07, 0x00, 0x91, // ...........P....
+	0x00, 0x00, 0x00, 0xa6, 0x02, 0x00, 0x00, 0xa3, 0x02, 0x00, 0x00, 0xa4, 0x02, 0x00, 0x00, 0xa5, // ................
+	0x02, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x48, 0x01, 0x00, 0x00, 0xa7, // ...X...A...H....
+	0x02, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x94, // ...........=....
+	0x00, 0x00, 0x00, 0xa8, 0x02, 0x00, 0x00, 0xa7, 0x02, 0x00, 0x00, 0x90, 0x00, 0x05, 0x00, 0x91, // ................
+	0x00, 0x00, 0x00, 0xa9, 0x02, 0x00, 0x00, 0xa6, 0x02, 0x00, 0x00, 0xa8, 0x02, 0x00, 0x00, 0x4f, // ...............O
+	0x00, 0x08, 0x00, 0x1b, 0x00, 0x00, 0x00, 0xaa, 0x02, 0x00, 0x00, 0xa9, 0x02, 0x00, 0x00, 0xa9, // ................
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x81, // ................
+	0x00, 0x05, 0x00, 0x1b, 0x00, 0x00, 0x00, 0xad, 0x02, 0x00, 0x00, 0xaa, 0x02, 0x00, 0x00, 0x98, // ................
+	0x02, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xe3, 0x04, 0x00, 0x00, 0xcf, // ................
+	0x04, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xe5, // ...1............
+	0x04, 0x00, 0x00, 0xcf, 0x04, 0x00, 0x00, 0xe3, 0x04, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0e, // ................
+	0x00, 0x00, 0x00, 0xe7, 0x04, 0x00, 0x00, 0xe5, 0x04, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0xc2, // ...........5....
+	0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xe9, 0x04, 0x00, 0x00, 0xe7, 0x04, 0x00, 0x00, 0x39, // ...............9
+	0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xeb, 0x04, 0x00, 0x00, 0xe7, // ................
+	0x04, 0x00, 0x00, 0xe9, 0x04, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xed, // ................
+	0x04, 0x00, 0x00, 0xeb, 0x04, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, // .......=........
+	0x00, 0x00, 0x00, 0xef, 0x04, 0x00, 0x00, 0xed, 0x04, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xc6, // ...........1....
+	0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xf1, 0x04, 0x00, 0x00, 0xed, 0x04, 0x00, 0x00, 0xef, // ................
+	0x04, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xdd, 0x04, 0x00, 0x00, 0xf1, // ................
+	0x04, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x70, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0xde, // ...K...p........
+	0x04, 0x00, 0x00, 0xdd, 0x04, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0xdf, // ................
+	0x04, 0x00, 0x00, 0xde, 0x04, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x41, 0x00, 0x07, 0x00, 0x9a, // .......N...A....
+	0x00, 0x00, 0x00, 0xb1, 0x02, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0xe1, // ................
+	0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0xb2, // .......=........
+	0x02, 0x00, 0x00, 0xb1, 0x02, 0x00, 0x00, 0x41, 0x00, 0x07, 0x00, 0x9a, 0x00, 0x00, 0x00, 0xb3, // .......A........
+	0x02, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x00, 0x99, // ................
+	0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0xb4, 0x02, 0x00, 0x00, 0xb3, // ...=............
+	0x02, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x06, 0x00, 0x00, 0x00, 0xf8, 0x04, 0x00, 0x00, 0x01, // ................
+	0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xb2, 0x02, 0x00, 0x00, 0xb4, 0x02, 0x00, 0x00, 0xdf, // ................
+	0x04, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x05, 0x05, 0x00, 0x00, 0xf1, // ................
+	0x04, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x07, // ...1............
+	0x05, 0x00, 0x00, 0xf1, 0x04, 0x00, 0x00, 0x05, 0x05, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0e, // ................
+	0x00, 0x00, 0x00, 0x09, 0x05, 0x00, 0x00, 0x07, 0x05, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0xc2, // ...........5....
+	0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x0b, 0x05, 0x00, 0x00, 0x09, 0x05, 0x00, 0x00, 0x39, // ...............9
+	0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x0d, 0x05, 0x00, 0x00, 0x09, // ................
+	0x05, 0x00, 0x00, 0x0b, 0x05, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x0f, // ................
+	0x05, 0x00, 0x00, 0x0d, 0x05, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, // .......=........
+	0x00, 0x00, 0x00, 0x11, 0x05, 0x00, 0x00, 0x0f, 0x05, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xc6, // ...........1....
+	0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x13, 0x05, 0x00, 0x00, 0x0f, 0x05, 0x00, 0x00, 0x11, // ................
+	0x05, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x13, // ................
+	0x05, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x70, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, // ...K...p........
+	0x05, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, // ................
+	0x05, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x41, 0x00, 0x07, 0x00, 0x9a, // .......N...A....
+	0x00, 0x00, 0x00, 0xb9, 0x02, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0xe1, // ................
+	0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0xba, // .......=........
+	0x02, 0x00, 0x00, 0xb9, 0x02, 0x00, 0x00, 0x41, 0x00, 0x07, 0x00, 0x9a, 0x00, 0x00, 0x00, 0xbb, // .......A........
+	0x02, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x00, 0xaa, // ................
+	0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0xbc, 0x02, 0x00, 0x00, 0xbb, // ...=............
+	0x02, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x06, 0x00, 0x00, 0x00, 0x1a, 0x05, 0x00, 0x00, 0x01, // ................
+	0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xba, 0x02, 0x00, 0x00, 0xbc, 0x02, 0x00, 0x00, 0x01, // ................
+	0x05, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x27, 0x05, 0x00, 0x00, 0x13, // ...........'....
+	0x05, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x29, // ...1...........)
+	0x05, 0x00, 0x00, 0x13, 0x05, 0x00, 0x00, 0x27, 0x05, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0e, // .......'........
+	0x00, 0x00, 0x00, 0x2b, 0x05, 0x00, 0x00, 0x29, 0x05, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0xc2, // ...+...)...5....
+	0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x2d, 0x05, 0x00, 0x00, 0x2b, 0x05, 0x00, 0x00, 0x39, // .......-...+...9
+	0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x2f, 0x05, 0x00, 0x00, 0x2b, // .........../...+
+	0x05, 0x00, 0x00, 0x2d, 0x05, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x31, // ...-...........1
+	0x05, 0x00, 0x00, 0x2f, 0x05, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, // .../...=........
+	0x00, 0x00, 0x00, 0x33, 0x05, 0x00, 0x00, 0x31, 0x05, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xc6, // ...3...1...1....
+	0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x35, 0x05, 0x00, 0x00, 0x31, 0x05, 0x00, 0x00, 0x33, // .......5...1...3
+	0x05, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x21, 0x05, 0x00, 0x00, 0x35, // ...........!...5
+	0x05, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x70, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x22, // ...K...p......."
+	0x05, 0x00, 0x00, 0x21, 0x05, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x23, // ...!...........#
+	0x05, 0x00, 0x00, 0x22, 0x05, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x41, 0x00, 0x07, 0x00, 0x9a, // ..."...N...A....
+	0x00, 0x00, 0x00, 0xc1, 0x02, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x76, // ...............v
+	0x01, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0xc2, // .......=........
+	0x02, 0x00, 0x00, 0xc1, 0x02, 0x00, 0x00, 0x41, 0x00, 0x07, 0x00, 0x9a, 0x00, 0x00, 0x00, 0xc3, // .......A........
+	0x02, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x76, 0x01, 0x00, 0x00, 0x99, // ...........v....
+	0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0xc3, // ...=............
+	0x02, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x06, 0x00, 0x00, 0x00, 0x3c, 0x05, 0x00, 0x00, 0x01, // ...........<....
+	0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xc2, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x23, // ...............#
+	0x05, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x49, 0x05, 0x00, 0x00, 0x35, // ...........I...5
+	0x05, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x4b, // ...1...........K
+	0x05, 0x00, 0x00, 0x35, 0x05, 0x00, 0x00, 0x49, 0x05, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0e, // ...5...I........
+	0x00, 0x00, 0x00, 0x4d, 0x05, 0x00, 0x00, 0x4b, 0x05, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0xc2, // ...M...K...5....
+	0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x4f, 0x05, 0x00, 0x00, 0x4d, 0x05, 0x00, 0x00, 0x39, // .......O...M...9
+	0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x51, 0x05, 0x00, 0x00, 0x4d, // ...........Q...M
+	0x05, 0x00, 0x00, 0x4f, 0x05, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x53, // ...O...........S
+	0x05, 0x00, 0x00, 0x51, 0x05, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, // ...Q...=........
+	0x00, 0x00, 0x00, 0x55, 0x05, 0x00, 0x00, 0x53, 0x05, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xc6, // ...U...S...1....
+	0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x57, 0x05, 0x00, 0x00, 0x53, 0x05, 0x00, 0x00, 0x55, // .......W...S...U
+	0x05, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x43, 0x05, 0x00, 0x00, 0x57, // ...........C...W
+	0x05, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x70, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x44, // ...K...p.......D
+	0x05, 0x00, 0x00, 0x43, 0x05, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x45, // ...C...........E
+	0x05, 0x00, 0x00, 0x44, 0x05, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x41, 0x00, 0x07, 0x00, 0x9a, // ...D...N...A....
+	0x00, 0x00, 0x00, 0xc9, 0x02, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x76, // ...............v
+	0x01, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0xca, // .......=........
+	0x02, 0x00, 0x00, 0xc9, 0x02, 0x00, 0x00, 0x41, 0x00, 0x07, 0x00, 0x9a, 0x00, 0x00, 0x00, 0xcb, // .......A........
+	0x02, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x76, 0x01, 0x00, 0x00, 0xaa, // ...........v....
+	0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0xcc, 0x02, 0x00, 0x00, 0xcb, // ...=............
+	0x02, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x06, 0x00, 0x00, 0x00, 0x5e, 0x05, 0x00, 0x00, 0x01, // ...........^....
+	0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xca, 0x02, 0x00, 0x00, 0xcc, 0x02, 0x00, 0x00, 0x45, // ...............E
+	0x05, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xcf, 0x02, 0x00, 0x00, 0x2b, // ...............+
+	0x02, 0x00, 0x00, 0x95, 0x01, 0x00, 0x00, 0x70, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0xd3, // .......p........
+	0x02, 0x00, 0x00, 0x1b, 0x02, 0x00, 0x00, 0x41, 0x00, 0x07, 0x00, 0x9a, 0x00, 0x00, 0x00, 0xd4, // .......A........
+	0x02, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0xa4, // ................
+	0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0xd5, 0x02, 0x00, 0x00, 0xd4, // ...=............
+	0x02, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0xd6, 0x02, 0x00, 0x00, 0xd3, // ................
+	0x02, 0x00, 0x00, 0xd5, 0x02, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0xd7, // .......Q........
+	0x02, 0x00, 0x00, 0xa0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x06, // ...........Q....
+	0x00, 0x00, 0x00, 0xd8, 0x02, 0x00, 0x00, 0xa0, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x51, // ...............Q
+	0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0xd9, 0x02, 0x00, 0x00, 0xa0, 0x02, 0x00, 0x00, 0x02, // ................
+	0x00, 0x00, 0x00, 0x50, 0x00, 0x07, 0x00, 0x91, 0x00, 0x00, 0x00, 0xda, 0x02, 0x00, 0x00, 0xd7, // ...P............
+	0x02, 0x00, 0x00, 0xd8, 0x02, 0x00, 0x00, 0xd9, 0x02, 0x00, 0x00, 0xd6, 0x02, 0x00, 0x00, 0x41, // ...............A
+	0x00, 0x06, 0x00, 0xa2, 0x01, 0x00, 0x00, 0xdb, 0x02, 0x00, 0x00, 0x93, 0x01, 0x00, 0x00, 0x98, // ................
+	0x00, 0x00, 0x00, 0xcf, 0x02, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0xdb, 0x02, 0x00, 0x00, 0xda, // .......>........
+	0x02, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xdd, 0x02, 0x00, 0x00, 0x2b, // ...............+
+	0x02, 0x00, 0x00, 0x95, 0x01, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xde, // ................
+	0x02, 0x00, 0x00, 0xdd, 0x02, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x88, 0x00, 0x05, 0x00, 0x06, // ................
+	0x00, 0x00, 0x00, 0xe1, 0x02, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0xd6, 0x04, 0x00, 0x00, 0x51, // .......X.......Q
+	0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0xe2, 0x02, 0x00, 0x00, 0xa9, 0x02, 0x00, 0x00, 0x00, // ................
+	0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0xe3, 0x02, 0x00, 0x00, 0xa9, // ...Q............
+	0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0xe4, // .......Q........
+	0x02, 0x00, 0x00, 0xa9, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x50, 0x00, 0x07, 0x00, 0x91, // ...........P....
+	0x00, 0x00, 0x00, 0xe5, 0x02, 0x00, 0x00, 0xe2, 0x02, 0x00, 0x00, 0xe3, 0x02, 0x00, 0x00, 0xe4, // ................
+	0x02, 0x00, 0x00, 0xe1, 0x02, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0xa2, 0x01, 0x00, 0x00, 0xe6, // .......A........
+	0x02, 0x00, 0x00, 0x93, 0x01, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0xde, 0x02, 0x00, 0x00, 0x3e, // ...............>
+	0x00, 0x03, 0x00, 0xe6, 0x02, 0x00, 0x00, 0xe5, 0x02, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0e, // ................
+	0x00, 0x00, 0x00, 0xe8, 0x02, 0x00, 0x00, 0x2b, 0x02, 0x00, 0x00, 0x95, 0x01, 0x00, 0x00, 0x80, // .......+........
+	0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xe9, 0x02, 0x00, 0x00, 0xe8, 0x02, 0x00, 0x00, 0xa4, // ................
+	0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0xec, 0x02, 0x00, 0x00, 0xad, // ...Q............
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0xed, // .......Q........
+	0x02, 0x00, 0x00, 0xad, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x06, // ...........Q....
+	0x00, 0x00, 0x00, 0xee, 0x02, 0x00, 0x00, 0xad, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x50, // ...............P
+	0x00, 0x07, 0x00, 0x91, 0x00, 0x00, 0x00, 0xef, 0x02, 0x00, 0x00, 0xec, 0x02, 0x00, 0x00, 0xed, // ................
+	0x02, 0x00, 0x00, 0xee, 0x02, 0x00, 0x00, 0xf8, 0x04, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0xa2, // ...........A....
+	0x01, 0x00, 0x00, 0xf0, 0x02, 0x00, 0x00, 0x93, 0x01, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0xe9, // ................
+	0x02, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0xf0, 0x02, 0x00, 0x00, 0xef, 0x02, 0x00, 0x00, 0x84, // ...>............
+	0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xf2, 0x02, 0x00, 0x00, 0x2b, 0x02, 0x00, 0x00, 0x95, // ...........+....
+	0x01, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xf3, 0x02, 0x00, 0x00, 0xf2, // ................
+	0x02, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x50, 0x00, 0x07, 0x00, 0x91, 0x00, 0x00, 0x00, 0xf7, // .......P........
+	0x02, 0x00, 0x00, 0x1a, 0x05, 0x00, 0x00, 0x3c, 0x05, 0x00, 0x00, 0x5e, 0x05, 0x00, 0x00, 0x65, // .......<...^...e
+	0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0xa2, 0x01, 0x00, 0x00, 0xf8, 0x02, 0x00, 0x00, 0x93, // ...A............
+	0x01, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0xf3, 0x02, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0xf8, // ...........>....
+	0x02, 0x00, 0x00, 0xf7, 0x02, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xf9, 0x02, 0x00, 0x00, 0xf8, // ................
+	0x00, 0x02, 0x00, 0xf9, 0x02, 0x00, 0x00, 0xfd, 0x00, 0x01, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, // ...........8....
+	0x00, 0x40, 0x03,                                                                               // .@.
+};
+static const uint8_t cs_ps_spawn_dx11[1] =
+{
+	0x00,                                                                                           // .
+};
+static const uint8_t cs_ps_spawn_mtl[8142] =
+{
+	0x43, 0x53, 0x48, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0a, 0x75, // CSH............u
+	0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x02, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, // _psParams.......
+	0xae, 0x07, 0x75, 0x5f, 0x70, 0x73, 0x4d, 0x74, 0x78, 0x04, 0x01, 0x00, 0x03, 0x04, 0x00, 0x00, // ..u_psMtx.......
+	0xae, 0x0f, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, 0x65, 0x73, 0x2e, 0x40, 0x64, 0x61, 0x74, // ..particles.@dat
+	0x61, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x40, 0x00, 0x01, 0x00, 0x01, 0x00, 0x77, // a........@.....w
+	0x1f, 0x00, 0x00, 0x23, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 0x3c, 0x6d, 0x65, 0x74, // ...#include <met
+	0x61, 0x6c, 0x5f, 0x73, 0x74, 0x64, 0x6c, 0x69, 0x62, 0x3e, 0x0a, 0x23, 0x69, 0x6e, 0x63, 0x6c, // al_stdlib>.#incl
+	0x75, 0x64, 0x65, 0x20, 0x3c, 0x73, 0x69, 0x6d, 0x64, 0x2f, 0x73, 0x69, 0x6d, 0x64, 0x2e, 0x68, // ude <simd/simd.h
+	0x3e, 0x0a, 0x0a, 0x75, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x70, 0x61, // >..using namespa
+	0x63, 0x65, 0x20, 0x6d, 0x65, 0x74, 0x61, 0x6c, 0x3b, 0x0a, 0x0a, 0x73, 0x74, 0x72, 0x75, 0x63, // ce metal;..struc
+	0x74, 0x20, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, // t _Global.{.    
+	0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, // float4 u_psParam
+	0x73, 0x5b, 0x34, 0x38, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, // s[48];.    float
+	0x34, 0x78, 0x34, 0x20, 0x75, 0x5f, 0x70, 0x73, 0x4d, 0x74, 0x78, 0x3b, 0x0a, 0x7d, 0x3b, 0x0a, // 4x4 u_psMtx;.};.
+	0x0a, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, 0x65, // .struct particle
+	0x73, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, // s.{.    float4 _
+	0x64, 0x61, 0x74, 0x61, 0x5b, 0x31, 0x5d, 0x3b, 0x0a, 0x7d, 0x3b, 0x0a, 0x0a, 0x6b, 0x65, 0x72, // data[1];.};..ker
+	0x6e, 0x65, 0x6c, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x78, 0x6c, 0x61, 0x74, 0x4d, 0x74, 0x6c, // nel void xlatMtl
+	0x4d, 0x61, 0x69, 0x6e, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x20, 0x5f, 0x47, // Main(constant _G
+	0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x26, 0x20, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x20, 0x5b, 0x5b, // lobal& _mtl_u [[
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 0x30, 0x29, 0x5d, 0x5d, 0x2c, 0x20, 0x64, 0x65, 0x76, // buffer(0)]], dev
+	0x69, 0x63, 0x65, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, 0x65, 0x73, 0x26, 0x20, 0x70, // ice particles& p
+	0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, 0x65, 0x73, 0x5f, 0x31, 0x20, 0x5b, 0x5b, 0x62, 0x75, 0x66, // articles_1 [[buf
+	0x66, 0x65, 0x72, 0x28, 0x31, 0x29, 0x5d, 0x5d, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x20, // fer(1)]], uint3 
+	0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, // gl_GlobalInvocat
+	0x69, 0x6f, 0x6e, 0x49, 0x44, 0x20, 0x5b, 0x5b, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x70, // ionID [[thread_p
+	0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x69, 0x6e, 0x5f, 0x67, 0x72, 0x69, 0x64, 0x5d, // osition_in_grid]
+	0x5d, 0x29, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x20, // ]).{.    switch 
+	0x28, 0x30, 0x75, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, // (0u).    {.     
+	0x20, 0x20, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x3a, 0x0a, 0x20, 0x20, 0x20, 0x20, //    default:.    
+	0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //     {.          
+	0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x35, 0x33, 0x39, 0x20, 0x3d, 0x20, 0x75, 0x69, //   uint _539 = ui
+	0x6e, 0x74, 0x28, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, // nt(int3(gl_Globa
+	0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x29, 0x2e, 0x78, // lInvocationID).x
+	0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, // );.            i
+	0x66, 0x20, 0x28, 0x5f, 0x35, 0x33, 0x39, 0x20, 0x3e, 0x3d, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, // f (_539 >= uint(
+	0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, // _mtl_u.u_psParam
+	0x73, 0x5b, 0x30, 0x5d, 0x2e, 0x79, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // s[0].y)).       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //      {.         
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, //        break;.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, //           }.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x35, 0x35, //         uint _55
+	0x35, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, // 5 = (uint(_mtl_u
+	0x2e, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x30, 0x5d, 0x2e, 0x7a, // .u_psParams[0].z
+	0x29, 0x20, 0x2b, 0x20, 0x5f, 0x35, 0x33, 0x39, 0x29, 0x20, 0x25, 0x20, 0x75, 0x69, 0x6e, 0x74, // ) + _539) % uint
+	0x28, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, // (_mtl_u.u_psPara
+	0x6d, 0x73, 0x5b, 0x30, 0x5d, 0x2e, 0x77, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ms[0].w);.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x35, 0x36, 0x30, 0x20, //       uint _560 
+	0x3d, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, // = uint(_mtl_u.u_
+	0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x32, 0x5d, 0x2e, 0x77, 0x29, 0x20, 0x2b, // psParams[2].w) +
+	0x20, 0x5f, 0x35, 0x33, 0x39, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  _539;.         
+	0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x37, 0x36, 0x39, 0x20, 0x3d, 0x20, 0x28, //    uint _769 = (
+	0x5f, 0x35, 0x36, 0x30, 0x20, 0x5e, 0x20, 0x28, 0x5f, 0x35, 0x36, 0x30, 0x20, 0x3e, 0x3e, 0x20, // _560 ^ (_560 >> 
+	0x75, 0x69, 0x6e, 0x74, 0x28, 0x31, 0x36, 0x29, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x32, 0x31, 0x34, // uint(16))) * 214
+	0x36, 0x31, 0x32, 0x31, 0x30, 0x30, 0x35, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 6121005u;.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x37, 0x37, 0x35, 0x20, //       uint _775 
+	0x3d, 0x20, 0x28, 0x5f, 0x37, 0x36, 0x39, 0x20, 0x5e, 0x20, 0x28, 0x5f, 0x37, 0x36, 0x39, 0x20, // = (_769 ^ (_769 
+	0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x31, 0x35, 0x29, 0x29, 0x29, 0x20, 0x2a, 0x20, // >> uint(15))) * 
+	0x32, 0x32, 0x32, 0x31, 0x37, 0x31, 0x33, 0x30, 0x33, 0x35, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, // 2221713035u;.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x37, //          uint _7
+	0x37, 0x39, 0x20, 0x3d, 0x20, 0x5f, 0x37, 0x37, 0x35, 0x20, 0x5e, 0x20, 0x28, 0x5f, 0x37, 0x37, // 79 = _775 ^ (_77
+	0x35, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x31, 0x36, 0x29, 0x29, 0x3b, 0x0a, // 5 >> uint(16));.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, //             floa
+	0x74, 0x33, 0x20, 0x5f, 0x31, 0x33, 0x38, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // t3 _1381;.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x33, 0x38, 0x35, //       uint _1385
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, // ;.            if
+	0x20, 0x28, 0x30, 0x20, 0x3d, 0x3d, 0x20, 0x69, 0x6e, 0x74, 0x28, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, //  (0 == int(_mtl_
+	0x75, 0x2e, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x35, 0x5d, 0x2e, // u.u_psParams[5].
+	0x78, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // x)).            
+	0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // {.              
+	0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x38, 0x32, 0x38, 0x20, 0x3d, 0x20, 0x28, 0x5f, //   uint _828 = (_
+	0x37, 0x37, 0x39, 0x20, 0x5e, 0x20, 0x28, 0x5f, 0x37, 0x37, 0x39, 0x20, 0x3e, 0x3e, 0x20, 0x75, // 779 ^ (_779 >> u
+	0x69, 0x6e, 0x74, 0x28, 0x31, 0x36, 0x29, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x32, 0x31, 0x34, 0x36, // int(16))) * 2146
+	0x31, 0x32, 0x31, 0x30, 0x30, 0x35, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 121005u;.       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x38, //          uint _8
+	0x33, 0x34, 0x20, 0x3d, 0x20, 0x28, 0x5f, 0x38, 0x32, 0x38, 0x20, 0x5e, 0x20, 0x28, 0x5f, 0x38, // 34 = (_828 ^ (_8
+	0x32, 0x38, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x31, 0x35, 0x29, 0x29, 0x29, // 28 >> uint(15)))
+	0x20, 0x2a, 0x20, 0x32, 0x32, 0x32, 0x31, 0x37, 0x31, 0x33, 0x30, 0x33, 0x35, 0x75, 0x3b, 0x0a, //  * 2221713035u;.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x38, 0x33, 0x38, 0x20, 0x3d, 0x20, 0x5f, 0x38, 0x33, 0x34, // uint _838 = _834
+	0x20, 0x5e, 0x20, 0x28, 0x5f, 0x38, 0x33, 0x34, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, //  ^ (_834 >> uint
+	0x28, 0x31, 0x36, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // (16));.         
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x37, 0x39, //        float _79
+	0x32, 0x20, 0x3d, 0x20, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x5f, 0x38, 0x33, 0x38, 0x20, // 2 = (float(_838 
+	0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x38, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x31, 0x2e, // >> uint(8)) * 1.
+	0x31, 0x39, 0x32, 0x30, 0x39, 0x32, 0x38, 0x39, 0x35, 0x35, 0x30, 0x37, 0x38, 0x31, 0x32, 0x35, // 1920928955078125
+	0x65, 0x2d, 0x30, 0x37, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x2e, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, // e-07) - 1.0;.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, //              uin
+	0x74, 0x20, 0x5f, 0x38, 0x35, 0x36, 0x20, 0x3d, 0x20, 0x28, 0x5f, 0x38, 0x33, 0x38, 0x20, 0x5e, // t _856 = (_838 ^
+	0x20, 0x28, 0x5f, 0x38, 0x33, 0x38, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x31, //  (_838 >> uint(1
+	0x36, 0x29, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x32, 0x31, 0x34, 0x36, 0x31, 0x32, 0x31, 0x30, 0x30, // 6))) * 214612100
+	0x35, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 5u;.            
+	0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x38, 0x36, 0x32, 0x20, 0x3d, 0x20, //     uint _862 = 
+	0x28, 0x5f, 0x38, 0x35, 0x36, 0x20, 0x5e, 0x20, 0x28, 0x5f, 0x38, 0x35, 0x36, 0x20, 0x3e, 0x3e, // (_856 ^ (_856 >>
+	0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x31, 0x35, 0x29, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x32, 0x32, //  uint(15))) * 22
+	0x32, 0x31, 0x37, 0x31, 0x33, 0x30, 0x33, 0x35, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, // 21713035u;.     
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, //            uint 
+	0x5f, 0x38, 0x36, 0x36, 0x20, 0x3d, 0x20, 0x5f, 0x38, 0x36, 0x32, 0x20, 0x5e, 0x20, 0x28, 0x5f, // _866 = _862 ^ (_
+	0x38, 0x36, 0x32, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x31, 0x36, 0x29, 0x29, // 862 >> uint(16))
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ;.              
+	0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x37, 0x39, 0x36, 0x20, 0x3d, 0x20, 0x66, //   float _796 = f
+	0x6c, 0x6f, 0x61, 0x74, 0x28, 0x5f, 0x38, 0x36, 0x36, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, // loat(_866 >> uin
+	0x74, 0x28, 0x38, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x33, 0x2e, 0x37, 0x34, 0x35, 0x30, 0x37, 0x30, // t(8)) * 3.745070
+	0x33, 0x38, 0x37, 0x31, 0x34, 0x30, 0x30, 0x30, 0x33, 0x37, 0x33, 0x31, 0x34, 0x37, 0x34, 0x32, // 3871400037314742
+	0x38, 0x30, 0x33, 0x35, 0x37, 0x33, 0x36, 0x30, 0x38, 0x65, 0x2d, 0x30, 0x37, 0x3b, 0x0a, 0x20, // 803573608e-07;. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, //                f
+	0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x38, 0x30, 0x31, 0x20, 0x3d, 0x20, 0x73, 0x71, 0x72, 0x74, // loat _801 = sqrt
+	0x28, 0x31, 0x2e, 0x30, 0x20, 0x2d, 0x20, 0x28, 0x5f, 0x37, 0x39, 0x32, 0x20, 0x2a, 0x20, 0x5f, // (1.0 - (_792 * _
+	0x37, 0x39, 0x32, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 792));.         
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x33, 0x38, 0x35, 0x20, 0x3d, 0x20, 0x5f, //        _1385 = _
+	0x38, 0x36, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 866;.           
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x33, 0x38, 0x31, 0x20, 0x3d, 0x20, 0x66, 0x6c, 0x6f, //      _1381 = flo
+	0x61, 0x74, 0x33, 0x28, 0x5f, 0x38, 0x30, 0x31, 0x20, 0x2a, 0x20, 0x63, 0x6f, 0x73, 0x28, 0x5f, // at3(_801 * cos(_
+	0x37, 0x39, 0x36, 0x29, 0x2c, 0x20, 0x5f, 0x38, 0x30, 0x31, 0x20, 0x2a, 0x20, 0x73, 0x69, 0x6e, // 796), _801 * sin
+	0x28, 0x5f, 0x37, 0x39, 0x36, 0x29, 0x2c, 0x20, 0x5f, 0x37, 0x39, 0x32, 0x29, 0x3b, 0x0a, 0x20, // (_796), _792);. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, //            }.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, //          else.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, //           {.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, //             floa
+	0x74, 0x33, 0x20, 0x5f, 0x31, 0x33, 0x38, 0x32, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // t3 _1382;.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, //           uint _
+	0x31, 0x33, 0x38, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 1386;.          
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x31, 0x20, 0x3d, 0x3d, 0x20, 0x69, //       if (1 == i
+	0x6e, 0x74, 0x28, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, // nt(_mtl_u.u_psPa
+	0x72, 0x61, 0x6d, 0x73, 0x5b, 0x35, 0x5d, 0x2e, 0x78, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, // rams[5].x)).    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, //             {.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x39, 0x31, 0x35, 0x20, 0x3d, 0x20, 0x28, 0x5f, //   uint _915 = (_
+	0x37, 0x37, 0x39, 0x20, 0x5e, 0x20, 0x28, 0x5f, 0x37, 0x37, 0x39, 0x20, 0x3e, 0x3e, 0x20, 0x75, // 779 ^ (_779 >> u
+	0x69, 0x6e, 0x74, 0x28, 0x31, 0x36, 0x29, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x32, 0x31, 0x34, 0x36, // int(16))) * 2146
+	0x31, 0x32, 0x31, 0x30, 0x30, 0x35, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 121005u;.       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, //              uin
+	0x74, 0x20, 0x5f, 0x39, 0x32, 0x31, 0x20, 0x3d, 0x20, 0x28, 0x5f, 0x39, 0x31, 0x35, 0x20, 0x5e, // t _921 = (_915 ^
+	0x20, 0x28, 0x5f, 0x39, 0x31, 0x35, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x31, //  (_915 >> uint(1
+	0x35, 0x29, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x32, 0x32, 0x32, 0x31, 0x37, 0x31, 0x33, 0x30, 0x33, // 5))) * 222171303
+	0x35, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 5u;.            
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x39, 0x32, //         uint _92
+	0x35, 0x20, 0x3d, 0x20, 0x5f, 0x39, 0x32, 0x31, 0x20, 0x5e, 0x20, 0x28, 0x5f, 0x39, 0x32, 0x31, // 5 = _921 ^ (_921
+	0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x31, 0x36, 0x29, 0x29, 0x3b, 0x0a, 0x20, //  >> uint(16));. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x38, 0x37, 0x39, 0x20, 0x3d, 0x20, //    float _879 = 
+	0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x5f, 0x39, 0x32, 0x35, 0x20, 0x3e, 0x3e, 0x20, 0x75, // (float(_925 >> u
+	0x69, 0x6e, 0x74, 0x28, 0x38, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x31, 0x2e, 0x31, 0x39, 0x32, 0x30, // int(8)) * 1.1920
+	0x39, 0x32, 0x38, 0x39, 0x35, 0x35, 0x30, 0x37, 0x38, 0x31, 0x32, 0x35, 0x65, 0x2d, 0x30, 0x37, // 928955078125e-07
+	0x29, 0x20, 0x2d, 0x20, 0x31, 0x2e, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ) - 1.0;.       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, //              uin
+	0x74, 0x20, 0x5f, 0x39, 0x34, 0x33, 0x20, 0x3d, 0x20, 0x28, 0x5f, 0x39, 0x32, 0x35, 0x20, 0x5e, // t _943 = (_925 ^
+	0x20, 0x28, 0x5f, 0x39, 0x32, 0x35, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x31, //  (_925 >> uint(1
+	0x36, 0x29, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x32, 0x31, 0x34, 0x36, 0x31, 0x32, 0x31, 0x30, 0x30, // 6))) * 214612100
+	0x35, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 5u;.            
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x39, 0x34, //         uint _94
+	0x39, 0x20, 0x3d, 0x20, 0x28, 0x5f, 0x39, 0x34, 0x33, 0x20, 0x5e, 0x20, 0x28, 0x5f, 0x39, 0x34, // 9 = (_943 ^ (_94
+	0x33, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x31, 0x35, 0x29, 0x29, 0x29, 0x20, // 3 >> uint(15))) 
+	0x2a, 0x20, 0x32, 0x32, 0x32, 0x31, 0x37, 0x31, 0x33, 0x30, 0x33, 0x35, 0x75, 0x3b, 0x0a, 0x20, // * 2221713035u;. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x39, 0x35, 0x33, 0x20, 0x3d, 0x20, 0x5f, //    uint _953 = _
+	0x39, 0x34, 0x39, 0x20, 0x5e, 0x20, 0x28, 0x5f, 0x39, 0x34, 0x39, 0x20, 0x3e, 0x3e, 0x20, 0x75, // 949 ^ (_949 >> u
+	0x69, 0x6e, 0x74, 0x28, 0x31, 0x36, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // int(16));.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, //               fl
+	0x6f, 0x61, 0x74, 0x20, 0x5f, 0x38, 0x38, 0x33, 0x20, 0x3d, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, // oat _883 = float
+	0x28, 0x5f, 0x39, 0x35, 0x33, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x38, 0x29, // (_953 >> uint(8)
+	0x29, 0x20, 0x2a, 0x20, 0x33, 0x2e, 0x37, 0x34, 0x35, 0x30, 0x37, 0x30, 0x33, 0x38, 0x37, 0x31, // ) * 3.7450703871
+	0x34, 0x30, 0x30, 0x30, 0x33, 0x37, 0x33, 0x31, 0x34, 0x37, 0x34, 0x32, 0x38, 0x30, 0x33, 0x35, // 4000373147428035
+	0x37, 0x33, 0x36, 0x30, 0x38, 0x65, 0x2d, 0x30, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, // 73608e-07;.     
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, //                f
+	0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x38, 0x38, 0x38, 0x20, 0x3d, 0x20, 0x73, 0x71, 0x72, 0x74, // loat _888 = sqrt
+	0x28, 0x31, 0x2e, 0x30, 0x20, 0x2d, 0x20, 0x28, 0x5f, 0x38, 0x37, 0x39, 0x20, 0x2a, 0x20, 0x5f, // (1.0 - (_879 * _
+	0x38, 0x37, 0x39, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 879));.         
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, //            float
+	0x20, 0x5f, 0x38, 0x39, 0x36, 0x20, 0x3d, 0x20, 0x5f, 0x38, 0x38, 0x38, 0x20, 0x2a, 0x20, 0x73, //  _896 = _888 * s
+	0x69, 0x6e, 0x28, 0x5f, 0x38, 0x38, 0x33, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // in(_883);.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, //               fl
+	0x6f, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x31, 0x33, 0x37, 0x38, 0x20, 0x3d, 0x20, 0x66, 0x6c, 0x6f, // oat3 _1378 = flo
+	0x61, 0x74, 0x33, 0x28, 0x5f, 0x38, 0x38, 0x38, 0x20, 0x2a, 0x20, 0x63, 0x6f, 0x73, 0x28, 0x5f, // at3(_888 * cos(_
+	0x38, 0x38, 0x33, 0x29, 0x2c, 0x20, 0x5f, 0x38, 0x39, 0x36, 0x2c, 0x20, 0x5f, 0x38, 0x37, 0x39, // 883), _896, _879
+	0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // );.             
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x33, 0x37, 0x38, 0x2e, 0x79, 0x20, 0x3d, //        _1378.y =
+	0x20, 0x61, 0x62, 0x73, 0x28, 0x5f, 0x38, 0x39, 0x36, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, //  abs(_896);.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x5f, 0x31, 0x33, 0x38, 0x36, 0x20, 0x3d, 0x20, 0x5f, 0x39, 0x35, 0x33, 0x3b, 0x0a, 0x20, 0x20, // _1386 = _953;.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x5f, 0x31, 0x33, 0x38, 0x32, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x33, 0x37, 0x38, 0x3b, //   _1382 = _1378;
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // .               
+	0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  }.             
+	0x20, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //    else.        
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //         {.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, //               fl
+	0x6f, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x31, 0x33, 0x38, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, // oat3 _1383;.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x33, 0x38, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, // uint _1387;.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x69, 0x66, 0x20, 0x28, 0x32, 0x20, 0x3d, 0x3d, 0x20, 0x69, 0x6e, 0x74, 0x28, 0x5f, 0x6d, 0x74, // if (2 == int(_mt
+	0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x35, // l_u.u_psParams[5
+	0x5d, 0x2e, 0x78, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ].x)).          
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, //           {.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x39, 0x38, 0x34, 0x20, 0x3d, 0x20, //     uint _984 = 
+	0x28, 0x5f, 0x37, 0x37, 0x39, 0x20, 0x5e, 0x20, 0x28, 0x5f, 0x37, 0x37, 0x39, 0x20, 0x3e, 0x3e, // (_779 ^ (_779 >>
+	0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x31, 0x36, 0x29, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x32, 0x31, //  uint(16))) * 21
+	0x34, 0x36, 0x31, 0x32, 0x31, 0x30, 0x30, 0x35, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, // 46121005u;.     
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x39, 0x39, 0x30, 0x20, 0x3d, 0x20, 0x28, //    uint _990 = (
+	0x5f, 0x39, 0x38, 0x34, 0x20, 0x5e, 0x20, 0x28, 0x5f, 0x39, 0x38, 0x34, 0x20, 0x3e, 0x3e, 0x20, // _984 ^ (_984 >> 
+	0x75, 0x69, 0x6e, 0x74, 0x28, 0x31, 0x35, 0x29, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x32, 0x32, 0x32, // uint(15))) * 222
+	0x31, 0x37, 0x31, 0x33, 0x30, 0x33, 0x35, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 1713035u;.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x39, 0x39, 0x34, 0x20, 0x3d, 0x20, 0x5f, 0x39, //   uint _994 = _9
+	0x39, 0x30, 0x20, 0x5e, 0x20, 0x28, 0x5f, 0x39, 0x39, 0x30, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, // 90 ^ (_990 >> ui
+	0x6e, 0x74, 0x28, 0x31, 0x36, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // nt(16));.       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x39, 0x36, 0x32, 0x20, 0x3d, 0x20, 0x66, 0x6c, //  float _962 = fl
+	0x6f, 0x61, 0x74, 0x28, 0x5f, 0x39, 0x39, 0x34, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, // oat(_994 >> uint
+	0x28, 0x38, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x33, 0x2e, 0x37, 0x34, 0x35, 0x30, 0x37, 0x30, 0x33, // (8)) * 3.7450703
+	0x38, 0x37, 0x31, 0x34, 0x30, 0x30, 0x30, 0x33, 0x37, 0x33, 0x31, 0x34, 0x37, 0x34, 0x32, 0x38, // 8714000373147428
+	0x30, 0x33, 0x35, 0x37, 0x33, 0x36, 0x30, 0x38, 0x65, 0x2d, 0x30, 0x37, 0x3b, 0x0a, 0x20, 0x20, // 03573608e-07;.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x33, 0x38, 0x37, 0x20, 0x3d, 0x20, 0x5f, 0x39, //       _1387 = _9
+	0x39, 0x34, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 94;.            
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x33, 0x38, //             _138
+	0x33, 0x20, 0x3d, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x63, 0x6f, 0x73, 0x28, 0x5f, // 3 = float3(cos(_
+	0x39, 0x36, 0x32, 0x29, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x73, 0x69, 0x6e, 0x28, 0x5f, // 962), 0.0, sin(_
+	0x39, 0x36, 0x32, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 962));.         
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, //            }.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  else.          
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, //           {.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x30, 0x32, 0x35, 0x20, 0x3d, //     uint _1025 =
+	0x20, 0x28, 0x5f, 0x37, 0x37, 0x39, 0x20, 0x5e, 0x20, 0x28, 0x5f, 0x37, 0x37, 0x39, 0x20, 0x3e, //  (_779 ^ (_779 >
+	0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x31, 0x36, 0x29, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x32, // > uint(16))) * 2
+	0x31, 0x34, 0x36, 0x31, 0x32, 0x31, 0x30, 0x30, 0x35, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, // 146121005u;.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x30, 0x33, 0x31, 0x20, 0x3d, //     uint _1031 =
+	0x20, 0x28, 0x5f, 0x31, 0x30, 0x32, 0x35, 0x20, 0x5e, 0x20, 0x28, 0x5f, 0x31, 0x30, 0x32, 0x35, //  (_1025 ^ (_1025
+	0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x31, 0x35, 0x29, 0x29, 0x29, 0x20, 0x2a, //  >> uint(15))) *
+	0x20, 0x32, 0x32, 0x32, 0x31, 0x37, 0x31, 0x33, 0x30, 0x33, 0x35, 0x75, 0x3b, 0x0a, 0x20, 0x20, //  2221713035u;.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x30, 0x33, 0x35, //       uint _1035
+	0x20, 0x3d, 0x20, 0x5f, 0x31, 0x30, 0x33, 0x31, 0x20, 0x5e, 0x20, 0x28, 0x5f, 0x31, 0x30, 0x33, //  = _1031 ^ (_103
+	0x31, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x31, 0x36, 0x29, 0x29, 0x3b, 0x0a, // 1 >> uint(16));.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x30, //         uint _10
+	0x35, 0x33, 0x20, 0x3d, 0x20, 0x28, 0x5f, 0x31, 0x30, 0x33, 0x35, 0x20, 0x5e, 0x20, 0x28, 0x5f, // 53 = (_1035 ^ (_
+	0x31, 0x30, 0x33, 0x35, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x31, 0x36, 0x29, // 1035 >> uint(16)
+	0x29, 0x29, 0x20, 0x2a, 0x20, 0x32, 0x31, 0x34, 0x36, 0x31, 0x32, 0x31, 0x30, 0x30, 0x35, 0x75, // )) * 2146121005u
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ;.              
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, //           uint _
+	0x31, 0x30, 0x35, 0x39, 0x20, 0x3d, 0x20, 0x28, 0x5f, 0x31, 0x30, 0x35, 0x33, 0x20, 0x5e, 0x20, // 1059 = (_1053 ^ 
+	0x28, 0x5f, 0x31, 0x30, 0x35, 0x33, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x31, // (_1053 >> uint(1
+	0x35, 0x29, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x32, 0x32, 0x32, 0x31, 0x37, 0x31, 0x33, 0x30, 0x33, // 5))) * 222171303
+	0x35, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 5u;.            
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, //             uint
+	0x20, 0x5f, 0x31, 0x30, 0x36, 0x33, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x30, 0x35, 0x39, 0x20, 0x5e, //  _1063 = _1059 ^
+	0x20, 0x28, 0x5f, 0x31, 0x30, 0x35, 0x39, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, //  (_1059 >> uint(
+	0x31, 0x36, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 16));.          
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, //               fl
+	0x6f, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x31, 0x33, 0x38, 0x34, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, // oat3 _1384;.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x33, 0x20, 0x3d, 0x3d, 0x20, 0x69, 0x6e, 0x74, //     if (3 == int
+	0x28, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, // (_mtl_u.u_psPara
+	0x6d, 0x73, 0x5b, 0x35, 0x5d, 0x2e, 0x78, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ms[5].x)).      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //   {.            
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x31, 0x30, 0x30, 0x33, 0x20, 0x3d, 0x20, 0x66, 0x6c, // float _1003 = fl
+	0x6f, 0x61, 0x74, 0x28, 0x5f, 0x31, 0x30, 0x33, 0x35, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, // oat(_1035 >> uin
+	0x74, 0x28, 0x38, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x33, 0x2e, 0x37, 0x34, 0x35, 0x30, 0x37, 0x30, // t(8)) * 3.745070
+	0x33, 0x38, 0x37, 0x31, 0x34, 0x30, 0x30, 0x30, 0x33, 0x37, 0x33, 0x31, 0x34, 0x37, 0x34, 0x32, // 3871400037314742
+	0x38, 0x30, 0x33, 0x35, 0x37, 0x33, 0x36, 0x30, 0x38, 0x65, 0x2d, 0x30, 0x37, 0x3b, 0x0a, 0x20, // 803573608e-07;. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x33, 0x38, 0x34, //            _1384
+	0x20, 0x3d, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x63, 0x6f, 0x73, 0x28, 0x5f, 0x31, //  = float3(cos(_1
+	0x30, 0x30, 0x33, 0x29, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x73, 0x69, 0x6e, 0x28, 0x5f, // 003), 0.0, sin(_
+	0x31, 0x30, 0x30, 0x33, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, // 1003)) * (float(
+	0x5f, 0x31, 0x30, 0x36, 0x33, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x38, 0x29, // _1063 >> uint(8)
+	0x29, 0x20, 0x2a, 0x20, 0x35, 0x2e, 0x39, 0x36, 0x30, 0x34, 0x36, 0x34, 0x34, 0x37, 0x37, 0x35, // ) * 5.9604644775
+	0x33, 0x39, 0x30, 0x36, 0x32, 0x35, 0x65, 0x2d, 0x30, 0x38, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, // 390625e-08);.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //      }.         
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, //                e
+	0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // lse.            
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, //             {.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, //           uint _
+	0x31, 0x30, 0x38, 0x39, 0x20, 0x3d, 0x20, 0x28, 0x5f, 0x37, 0x37, 0x39, 0x20, 0x5e, 0x20, 0x28, // 1089 = (_779 ^ (
+	0x5f, 0x37, 0x37, 0x39, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x31, 0x36, 0x29, // _779 >> uint(16)
+	0x29, 0x29, 0x20, 0x2a, 0x20, 0x32, 0x31, 0x34, 0x36, 0x31, 0x32, 0x31, 0x30, 0x30, 0x35, 0x75, // )) * 2146121005u
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ;.              
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, //               ui
+	0x6e, 0x74, 0x20, 0x5f, 0x31, 0x30, 0x39, 0x35, 0x20, 0x3d, 0x20, 0x28, 0x5f, 0x31, 0x30, 0x38, // nt _1095 = (_108
+	0x39, 0x20, 0x5e, 0x20, 0x28, 0x5f, 0x31, 0x30, 0x38, 0x39, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, // 9 ^ (_1089 >> ui
+	0x6e, 0x74, 0x28, 0x31, 0x35, 0x29, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x32, 0x32, 0x32, 0x31, 0x37, // nt(15))) * 22217
+	0x31, 0x33, 0x30, 0x33, 0x35, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 13035u;.        
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x30, 0x39, 0x39, 0x20, 0x3d, //     uint _1099 =
+	0x20, 0x5f, 0x31, 0x30, 0x39, 0x35, 0x20, 0x5e, 0x20, 0x28, 0x5f, 0x31, 0x30, 0x39, 0x35, 0x20, //  _1095 ^ (_1095 
+	0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x31, 0x36, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, // >> uint(16));.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, //           uint _
+	0x31, 0x31, 0x32, 0x35, 0x20, 0x3d, 0x20, 0x28, 0x5f, 0x31, 0x30, 0x39, 0x39, 0x20, 0x5e, 0x20, // 1125 = (_1099 ^ 
+	0x28, 0x5f, 0x31, 0x30, 0x39, 0x39, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x31, // (_1099 >> uint(1
+	0x36, 0x29, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x32, 0x31, 0x34, 0x36, 0x31, 0x32, 0x31, 0x30, 0x30, // 6))) * 214612100
+	0x35, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 5u;.            
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x31, 0x33, 0x31, 0x20, 0x3d, 0x20, 0x28, 0x5f, 0x31, // uint _1131 = (_1
+	0x31, 0x32, 0x35, 0x20, 0x5e, 0x20, 0x28, 0x5f, 0x31, 0x31, 0x32, 0x35, 0x20, 0x3e, 0x3e, 0x20, // 125 ^ (_1125 >> 
+	0x75, 0x69, 0x6e, 0x74, 0x28, 0x31, 0x35, 0x29, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x32, 0x32, 0x32, // uint(15))) * 222
+	0x31, 0x37, 0x31, 0x33, 0x30, 0x33, 0x35, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 1713035u;.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x33, 0x38, 0x34, 0x20, 0x3d, 0x20, 0x66, 0x6c, //       _1384 = fl
+	0x6f, 0x61, 0x74, 0x33, 0x28, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x5f, 0x31, 0x30, 0x39, // oat3((float(_109
+	0x39, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x38, 0x29, 0x29, 0x20, 0x2a, 0x20, // 9 >> uint(8)) * 
+	0x31, 0x2e, 0x31, 0x39, 0x32, 0x30, 0x39, 0x32, 0x38, 0x39, 0x35, 0x35, 0x30, 0x37, 0x38, 0x31, // 1.19209289550781
+	0x32, 0x35, 0x65, 0x2d, 0x30, 0x37, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x2e, 0x30, 0x2c, 0x20, 0x30, // 25e-07) - 1.0, 0
+	0x2e, 0x30, 0x2c, 0x20, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x28, 0x5f, 0x31, 0x31, 0x33, // .0, (float((_113
+	0x31, 0x20, 0x5e, 0x20, 0x28, 0x5f, 0x31, 0x31, 0x33, 0x31, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, // 1 ^ (_1131 >> ui
+	0x6e, 0x74, 0x28, 0x31, 0x36, 0x29, 0x29, 0x29, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, // nt(16))) >> uint
+	0x28, 0x38, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x31, 0x2e, 0x31, 0x39, 0x32, 0x30, 0x39, 0x32, 0x38, // (8)) * 1.1920928
+	0x39, 0x35, 0x35, 0x30, 0x37, 0x38, 0x31, 0x32, 0x35, 0x65, 0x2d, 0x30, 0x37, 0x29, 0x20, 0x2d, // 955078125e-07) -
+	0x20, 0x31, 0x2e, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  1.0);.         
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, //                }
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // .               
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x33, 0x38, 0x37, 0x20, 0x3d, //          _1387 =
+	0x20, 0x5f, 0x31, 0x30, 0x36, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  _1063;.        
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x5f, 0x31, 0x33, 0x38, 0x33, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x33, 0x38, 0x34, 0x3b, 0x0a, 0x20, // _1383 = _1384;. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //    }.           
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x33, 0x38, 0x36, 0x20, 0x3d, //          _1386 =
+	0x20, 0x5f, 0x31, 0x33, 0x38, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  _1387;.        
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x33, 0x38, //             _138
+	0x32, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x33, 0x38, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, // 2 = _1383;.     
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, //            }.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x33, //              _13
+	0x38, 0x35, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x33, 0x38, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, // 85 = _1386;.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x33, 0x38, //             _138
+	0x31, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x33, 0x38, 0x32, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, // 1 = _1382;.     
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //        }.       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x31, 0x35, 0x33, 0x20, //      uint _1153 
+	0x3d, 0x20, 0x28, 0x5f, 0x31, 0x33, 0x38, 0x35, 0x20, 0x5e, 0x20, 0x28, 0x5f, 0x31, 0x33, 0x38, // = (_1385 ^ (_138
+	0x35, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x31, 0x36, 0x29, 0x29, 0x29, 0x20, // 5 >> uint(16))) 
+	0x2a, 0x20, 0x32, 0x31, 0x34, 0x36, 0x31, 0x32, 0x31, 0x30, 0x30, 0x35, 0x75, 0x3b, 0x0a, 0x20, // * 2146121005u;. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, //            uint 
+	0x5f, 0x31, 0x31, 0x35, 0x39, 0x20, 0x3d, 0x20, 0x28, 0x5f, 0x31, 0x31, 0x35, 0x33, 0x20, 0x5e, // _1159 = (_1153 ^
+	0x20, 0x28, 0x5f, 0x31, 0x31, 0x35, 0x33, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, //  (_1153 >> uint(
+	0x31, 0x35, 0x29, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x32, 0x32, 0x32, 0x31, 0x37, 0x31, 0x33, 0x30, // 15))) * 22217130
+	0x33, 0x35, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 35u;.           
+	0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x31, 0x36, 0x33, 0x20, 0x3d, 0x20, 0x5f, 0x31, //  uint _1163 = _1
+	0x31, 0x35, 0x39, 0x20, 0x5e, 0x20, 0x28, 0x5f, 0x31, 0x31, 0x35, 0x39, 0x20, 0x3e, 0x3e, 0x20, // 159 ^ (_1159 >> 
+	0x75, 0x69, 0x6e, 0x74, 0x28, 0x31, 0x36, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, // uint(16));.     
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x36, //        float3 _6
+	0x33, 0x35, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x33, 0x38, 0x31, 0x20, 0x2a, 0x20, 0x6d, 0x69, 0x78, // 35 = _1381 * mix
+	0x28, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, // (_mtl_u.u_psPara
+	0x6d, 0x73, 0x5b, 0x31, 0x5d, 0x2e, 0x78, 0x2c, 0x20, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, // ms[1].x, _mtl_u.
+	0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x31, 0x5d, 0x2e, 0x79, 0x2c, // u_psParams[1].y,
+	0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x5f, 0x31, 0x31, 0x36, 0x33, 0x20, 0x3e, 0x3e, 0x20, //  float(_1163 >> 
+	0x75, 0x69, 0x6e, 0x74, 0x28, 0x38, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x35, 0x2e, 0x39, 0x36, 0x30, // uint(8)) * 5.960
+	0x34, 0x36, 0x34, 0x34, 0x37, 0x37, 0x35, 0x33, 0x39, 0x30, 0x36, 0x32, 0x35, 0x65, 0x2d, 0x30, // 4644775390625e-0
+	0x38, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 8);.            
+	0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x31, 0x38, 0x37, 0x20, 0x3d, 0x20, 0x28, 0x5f, 0x31, // uint _1187 = (_1
+	0x31, 0x36, 0x33, 0x20, 0x5e, 0x20, 0x28, 0x5f, 0x31, 0x31, 0x36, 0x33, 0x20, 0x3e, 0x3e, 0x20, // 163 ^ (_1163 >> 
+	0x75, 0x69, 0x6e, 0x74, 0x28, 0x31, 0x36, 0x29, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x32, 0x31, 0x34, // uint(16))) * 214
+	0x36, 0x31, 0x32, 0x31, 0x30, 0x30, 0x35, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 6121005u;.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x31, 0x39, 0x33, //       uint _1193
+	0x20, 0x3d, 0x20, 0x28, 0x5f, 0x31, 0x31, 0x38, 0x37, 0x20, 0x5e, 0x20, 0x28, 0x5f, 0x31, 0x31, //  = (_1187 ^ (_11
+	0x38, 0x37, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x31, 0x35, 0x29, 0x29, 0x29, // 87 >> uint(15)))
+	0x20, 0x2a, 0x20, 0x32, 0x32, 0x32, 0x31, 0x37, 0x31, 0x33, 0x30, 0x33, 0x35, 0x75, 0x3b, 0x0a, //  * 2221713035u;.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, //             uint
+	0x20, 0x5f, 0x31, 0x31, 0x39, 0x37, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x31, 0x39, 0x33, 0x20, 0x5e, //  _1197 = _1193 ^
+	0x20, 0x28, 0x5f, 0x31, 0x31, 0x39, 0x33, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, //  (_1193 >> uint(
+	0x31, 0x36, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 16));.          
+	0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x32, 0x32, 0x31, 0x20, 0x3d, 0x20, 0x28, //   uint _1221 = (
+	0x5f, 0x31, 0x31, 0x39, 0x37, 0x20, 0x5e, 0x20, 0x28, 0x5f, 0x31, 0x31, 0x39, 0x37, 0x20, 0x3e, // _1197 ^ (_1197 >
+	0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x31, 0x36, 0x29, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x32, // > uint(16))) * 2
+	0x31, 0x34, 0x36, 0x31, 0x32, 0x31, 0x30, 0x30, 0x35, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, // 146121005u;.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x32, //         uint _12
+	0x32, 0x37, 0x20, 0x3d, 0x20, 0x28, 0x5f, 0x31, 0x32, 0x32, 0x31, 0x20, 0x5e, 0x20, 0x28, 0x5f, // 27 = (_1221 ^ (_
+	0x31, 0x32, 0x32, 0x31, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x31, 0x35, 0x29, // 1221 >> uint(15)
+	0x29, 0x29, 0x20, 0x2a, 0x20, 0x32, 0x32, 0x32, 0x31, 0x37, 0x31, 0x33, 0x30, 0x33, 0x35, 0x75, // )) * 2221713035u
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, // ;.            ui
+	0x6e, 0x74, 0x20, 0x5f, 0x31, 0x32, 0x33, 0x31, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x32, 0x32, 0x37, // nt _1231 = _1227
+	0x20, 0x5e, 0x20, 0x28, 0x5f, 0x31, 0x32, 0x32, 0x37, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, //  ^ (_1227 >> uin
+	0x74, 0x28, 0x31, 0x36, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // t(16));.        
+	0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x31, 0x32, 0x33, 0x38, 0x20, //     float _1238 
+	0x3d, 0x20, 0x6d, 0x69, 0x78, 0x28, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x70, // = mix(_mtl_u.u_p
+	0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x32, 0x5d, 0x2e, 0x78, 0x2c, 0x20, 0x5f, 0x6d, // sParams[2].x, _m
+	0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, // tl_u.u_psParams[
+	0x32, 0x5d, 0x2e, 0x79, 0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x5f, 0x31, 0x32, 0x33, // 2].y, float(_123
+	0x31, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x38, 0x29, 0x29, 0x20, 0x2a, 0x20, // 1 >> uint(8)) * 
+	0x35, 0x2e, 0x39, 0x36, 0x30, 0x34, 0x36, 0x34, 0x34, 0x37, 0x37, 0x35, 0x33, 0x39, 0x30, 0x36, // 5.96046447753906
+	0x32, 0x35, 0x65, 0x2d, 0x30, 0x38, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 25e-08);.       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x36, 0x38, 0x31, //      float4 _681
+	0x20, 0x3d, 0x20, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x70, 0x73, 0x4d, 0x74, //  = _mtl_u.u_psMt
+	0x78, 0x20, 0x2a, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x28, 0x5f, 0x36, 0x33, 0x35, 0x20, // x * float4(_635 
+	0x2b, 0x20, 0x28, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x28, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, // + (select(normal
+	0x69, 0x7a, 0x65, 0x28, 0x5f, 0x31, 0x33, 0x38, 0x31, 0x29, 0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, // ize(_1381), floa
+	0x74, 0x33, 0x28, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x2c, 0x20, 0x30, 0x2e, 0x30, // t3(0.0, 1.0, 0.0
+	0x29, 0x2c, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x33, 0x28, 0x30, 0x20, 0x3d, 0x3d, 0x20, 0x69, 0x6e, // ), bool3(0 == in
+	0x74, 0x28, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, // t(_mtl_u.u_psPar
+	0x61, 0x6d, 0x73, 0x5b, 0x35, 0x5d, 0x2e, 0x79, 0x29, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x6d, 0x69, // ams[5].y))) * mi
+	0x78, 0x28, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, // x(_mtl_u.u_psPar
+	0x61, 0x6d, 0x73, 0x5b, 0x31, 0x5d, 0x2e, 0x7a, 0x2c, 0x20, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, // ams[1].z, _mtl_u
+	0x2e, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x31, 0x5d, 0x2e, 0x77, // .u_psParams[1].w
+	0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x5f, 0x31, 0x31, 0x39, 0x37, 0x20, 0x3e, 0x3e, // , float(_1197 >>
+	0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x38, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x35, 0x2e, 0x39, 0x36, //  uint(8)) * 5.96
+	0x30, 0x34, 0x36, 0x34, 0x34, 0x37, 0x37, 0x35, 0x33, 0x39, 0x30, 0x36, 0x32, 0x35, 0x65, 0x2d, // 04644775390625e-
+	0x30, 0x38, 0x29, 0x29, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, // 08)), 1.0);.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x32, //         uint _12
+	0x35, 0x35, 0x20, 0x3d, 0x20, 0x28, 0x5f, 0x31, 0x32, 0x33, 0x31, 0x20, 0x5e, 0x20, 0x28, 0x5f, // 55 = (_1231 ^ (_
+	0x31, 0x32, 0x33, 0x31, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x31, 0x36, 0x29, // 1231 >> uint(16)
+	0x29, 0x29, 0x20, 0x2a, 0x20, 0x32, 0x31, 0x34, 0x36, 0x31, 0x32, 0x31, 0x30, 0x30, 0x35, 0x75, // )) * 2146121005u
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, // ;.            ui
+	0x6e, 0x74, 0x20, 0x5f, 0x31, 0x32, 0x36, 0x31, 0x20, 0x3d, 0x20, 0x28, 0x5f, 0x31, 0x32, 0x35, // nt _1261 = (_125
+	0x35, 0x20, 0x5e, 0x20, 0x28, 0x5f, 0x31, 0x32, 0x35, 0x35, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, // 5 ^ (_1255 >> ui
+	0x6e, 0x74, 0x28, 0x31, 0x35, 0x29, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x32, 0x32, 0x32, 0x31, 0x37, // nt(15))) * 22217
+	0x31, 0x33, 0x30, 0x33, 0x35, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 13035u;.        
+	0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x32, 0x36, 0x35, 0x20, 0x3d, //     uint _1265 =
+	0x20, 0x5f, 0x31, 0x32, 0x36, 0x31, 0x20, 0x5e, 0x20, 0x28, 0x5f, 0x31, 0x32, 0x36, 0x31, 0x20, //  _1261 ^ (_1261 
+	0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x31, 0x36, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, // >> uint(16));.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, //           uint _
+	0x31, 0x32, 0x38, 0x39, 0x20, 0x3d, 0x20, 0x28, 0x5f, 0x31, 0x32, 0x36, 0x35, 0x20, 0x5e, 0x20, // 1289 = (_1265 ^ 
+	0x28, 0x5f, 0x31, 0x32, 0x36, 0x35, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x31, // (_1265 >> uint(1
+	0x36, 0x29, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x32, 0x31, 0x34, 0x36, 0x31, 0x32, 0x31, 0x30, 0x30, // 6))) * 214612100
+	0x35, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 5u;.            
+	0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x32, 0x39, 0x35, 0x20, 0x3d, 0x20, 0x28, 0x5f, 0x31, // uint _1295 = (_1
+	0x32, 0x38, 0x39, 0x20, 0x5e, 0x20, 0x28, 0x5f, 0x31, 0x32, 0x38, 0x39, 0x20, 0x3e, 0x3e, 0x20, // 289 ^ (_1289 >> 
+	0x75, 0x69, 0x6e, 0x74, 0x28, 0x31, 0x35, 0x29, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x32, 0x32, 0x32, // uint(15))) * 222
+	0x31, 0x37, 0x31, 0x33, 0x30, 0x33, 0x35, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 1713035u;.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x32, 0x39, 0x39, //       uint _1299
+	0x20, 0x3d, 0x20, 0x5f, 0x31, 0x32, 0x39, 0x35, 0x20, 0x5e, 0x20, 0x28, 0x5f, 0x31, 0x32, 0x39, //  = _1295 ^ (_129
+	0x35, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x31, 0x36, 0x29, 0x29, 0x3b, 0x0a, // 5 >> uint(16));.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, //             uint
+	0x20, 0x5f, 0x31, 0x33, 0x32, 0x33, 0x20, 0x3d, 0x20, 0x28, 0x5f, 0x31, 0x32, 0x39, 0x39, 0x20, //  _1323 = (_1299 
+	0x5e, 0x20, 0x28, 0x5f, 0x31, 0x32, 0x39, 0x39, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, // ^ (_1299 >> uint
+	0x28, 0x31, 0x36, 0x29, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x32, 0x31, 0x34, 0x36, 0x31, 0x32, 0x31, // (16))) * 2146121
+	0x30, 0x30, 0x35, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 005u;.          
+	0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x33, 0x32, 0x39, 0x20, 0x3d, 0x20, 0x28, //   uint _1329 = (
+	0x5f, 0x31, 0x33, 0x32, 0x33, 0x20, 0x5e, 0x20, 0x28, 0x5f, 0x31, 0x33, 0x32, 0x33, 0x20, 0x3e, // _1323 ^ (_1323 >
+	0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x31, 0x35, 0x29, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x32, // > uint(15))) * 2
+	0x32, 0x32, 0x31, 0x37, 0x31, 0x33, 0x30, 0x33, 0x35, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, // 221713035u;.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x33, //         uint _13
+	0x33, 0x33, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x33, 0x32, 0x39, 0x20, 0x5e, 0x20, 0x28, 0x5f, 0x31, // 33 = _1329 ^ (_1
+	0x33, 0x32, 0x39, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x31, 0x36, 0x29, 0x29, // 329 >> uint(16))
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, // ;.            ui
+	0x6e, 0x74, 0x20, 0x5f, 0x31, 0x33, 0x35, 0x37, 0x20, 0x3d, 0x20, 0x28, 0x5f, 0x31, 0x33, 0x33, // nt _1357 = (_133
+	0x33, 0x20, 0x5e, 0x20, 0x28, 0x5f, 0x31, 0x33, 0x33, 0x33, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, // 3 ^ (_1333 >> ui
+	0x6e, 0x74, 0x28, 0x31, 0x36, 0x29, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x32, 0x31, 0x34, 0x36, 0x31, // nt(16))) * 21461
+	0x32, 0x31, 0x30, 0x30, 0x35, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 21005u;.        
+	0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x33, 0x36, 0x33, 0x20, 0x3d, //     uint _1363 =
+	0x20, 0x28, 0x5f, 0x31, 0x33, 0x35, 0x37, 0x20, 0x5e, 0x20, 0x28, 0x5f, 0x31, 0x33, 0x35, 0x37, //  (_1357 ^ (_1357
+	0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x31, 0x35, 0x29, 0x29, 0x29, 0x20, 0x2a, //  >> uint(15))) *
+	0x20, 0x32, 0x32, 0x32, 0x31, 0x37, 0x31, 0x33, 0x30, 0x33, 0x35, 0x75, 0x3b, 0x0a, 0x20, 0x20, //  2221713035u;.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, //           partic
+	0x6c, 0x65, 0x73, 0x5f, 0x31, 0x2e, 0x5f, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x5f, 0x35, 0x35, 0x35, // les_1._data[_555
+	0x20, 0x2a, 0x20, 0x34, 0x75, 0x5d, 0x20, 0x3d, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x28, //  * 4u] = float4(
+	0x28, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x70, 0x73, 0x4d, 0x74, 0x78, 0x20, // (_mtl_u.u_psMtx 
+	0x2a, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x28, 0x5f, 0x36, 0x33, 0x35, 0x2c, 0x20, 0x31, // * float4(_635, 1
+	0x2e, 0x30, 0x29, 0x29, 0x2e, 0x78, 0x79, 0x7a, 0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, // .0)).xyz, float(
+	0x5f, 0x35, 0x33, 0x39, 0x29, 0x20, 0x2a, 0x20, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, // _539) * _mtl_u.u
+	0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x35, 0x5d, 0x2e, 0x7a, 0x29, 0x3b, // _psParams[5].z);
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x72, // .            par
+	0x74, 0x69, 0x63, 0x6c, 0x65, 0x73, 0x5f, 0x31, 0x2e, 0x5f, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x28, // ticles_1._data[(
+	0x5f, 0x35, 0x35, 0x35, 0x20, 0x2a, 0x20, 0x34, 0x75, 0x29, 0x20, 0x2b, 0x20, 0x31, 0x75, 0x5d, // _555 * 4u) + 1u]
+	0x20, 0x3d, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x28, 0x5f, 0x36, 0x38, 0x31, 0x2e, 0x78, //  = float4(_681.x
+	0x79, 0x7a, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x2f, 0x20, 0x5f, 0x31, 0x32, 0x33, 0x38, 0x29, // yz, 1.0 / _1238)
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, // ;.            pa
+	0x72, 0x74, 0x69, 0x63, 0x6c, 0x65, 0x73, 0x5f, 0x31, 0x2e, 0x5f, 0x64, 0x61, 0x74, 0x61, 0x5b, // rticles_1._data[
+	0x28, 0x5f, 0x35, 0x35, 0x35, 0x20, 0x2a, 0x20, 0x34, 0x75, 0x29, 0x20, 0x2b, 0x20, 0x32, 0x75, // (_555 * 4u) + 2u
+	0x5d, 0x20, 0x3d, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x28, 0x5f, 0x36, 0x38, 0x31, 0x2e, // ] = float4(_681.
+	0x78, 0x79, 0x7a, 0x20, 0x2b, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x30, 0x2e, 0x30, // xyz + float3(0.0
+	0x2c, 0x20, 0x28, 0x28, 0x28, 0x2d, 0x39, 0x2e, 0x38, 0x31, 0x30, 0x30, 0x30, 0x30, 0x34, 0x31, // , (((-9.81000041
+	0x39, 0x36, 0x31, 0x36, 0x36, 0x39, 0x39, 0x32, 0x31, 0x38, 0x37, 0x35, 0x29, 0x20, 0x2a, 0x20, // 961669921875) * 
+	0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, // _mtl_u.u_psParam
+	0x73, 0x5b, 0x32, 0x5d, 0x2e, 0x7a, 0x29, 0x20, 0x2a, 0x20, 0x5f, 0x31, 0x32, 0x33, 0x38, 0x29, // s[2].z) * _1238)
+	0x20, 0x2a, 0x20, 0x5f, 0x31, 0x32, 0x33, 0x38, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x29, 0x2c, 0x20, //  * _1238, 0.0), 
+	0x6d, 0x69, 0x78, 0x28, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x70, 0x73, 0x50, // mix(_mtl_u.u_psP
+	0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x33, 0x5d, 0x2e, 0x78, 0x2c, 0x20, 0x5f, 0x6d, 0x74, 0x6c, // arams[3].x, _mtl
+	0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x33, 0x5d, // _u.u_psParams[3]
+	0x2e, 0x79, 0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x5f, 0x31, 0x32, 0x36, 0x35, 0x20, // .y, float(_1265 
+	0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x38, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x35, 0x2e, // >> uint(8)) * 5.
+	0x39, 0x36, 0x30, 0x34, 0x36, 0x34, 0x34, 0x37, 0x37, 0x35, 0x33, 0x39, 0x30, 0x36, 0x32, 0x35, // 9604644775390625
+	0x65, 0x2d, 0x30, 0x38, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // e-08));.        
+	0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, 0x65, 0x73, 0x5f, 0x31, 0x2e, //     particles_1.
+	0x5f, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x28, 0x5f, 0x35, 0x35, 0x35, 0x20, 0x2a, 0x20, 0x34, 0x75, // _data[(_555 * 4u
+	0x29, 0x20, 0x2b, 0x20, 0x33, 0x75, 0x5d, 0x20, 0x3d, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, // ) + 3u] = float4
+	0x28, 0x6d, 0x69, 0x78, 0x28, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x70, 0x73, // (mix(_mtl_u.u_ps
+	0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x33, 0x5d, 0x2e, 0x7a, 0x2c, 0x20, 0x5f, 0x6d, 0x74, // Params[3].z, _mt
+	0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x33, // l_u.u_psParams[3
+	0x5d, 0x2e, 0x77, 0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x5f, 0x31, 0x32, 0x39, 0x39, // ].w, float(_1299
+	0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x38, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x35, //  >> uint(8)) * 5
+	0x2e, 0x39, 0x36, 0x30, 0x34, 0x36, 0x34, 0x34, 0x37, 0x37, 0x35, 0x33, 0x39, 0x30, 0x36, 0x32, // .960464477539062
+	0x35, 0x65, 0x2d, 0x30, 0x38, 0x29, 0x2c, 0x20, 0x6d, 0x69, 0x78, 0x28, 0x5f, 0x6d, 0x74, 0x6c, // 5e-08), mix(_mtl
+	0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x34, 0x5d, // _u.u_psParams[4]
+	0x2e, 0x78, 0x2c, 0x20, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x70, 0x73, 0x50, // .x, _mtl_u.u_psP
+	0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x34, 0x5d, 0x2e, 0x79, 0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, // arams[4].y, floa
+	0x74, 0x28, 0x5f, 0x31, 0x33, 0x33, 0x33, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, // t(_1333 >> uint(
+	0x38, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x35, 0x2e, 0x39, 0x36, 0x30, 0x34, 0x36, 0x34, 0x34, 0x37, // 8)) * 5.96046447
+	0x37, 0x35, 0x33, 0x39, 0x30, 0x36, 0x32, 0x35, 0x65, 0x2d, 0x30, 0x38, 0x29, 0x2c, 0x20, 0x6d, // 75390625e-08), m
+	0x69, 0x78, 0x28, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, // ix(_mtl_u.u_psPa
+	0x72, 0x61, 0x6d, 0x73, 0x5b, 0x34, 0x5d, 0x2e, 0x7a, 0x2c, 0x20, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, // rams[4].z, _mtl_
+	0x75, 0x2e, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x34, 0x5d, 0x2e, // u.u_psParams[4].
+	0x77, 0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x28, 0x5f, 0x31, 0x33, 0x36, 0x33, 0x20, // w, float((_1363 
+	0x5e, 0x20, 0x28, 0x5f, 0x31, 0x33, 0x36, 0x33, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, // ^ (_1363 >> uint
+	0x28, 0x31, 0x36, 0x29, 0x29, 0x29, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x38, // (16))) >> uint(8
+	0x29, 0x29, 0x20, 0x2a, 0x20, 0x35, 0x2e, 0x39, 0x36, 0x30, 0x34, 0x36, 0x34, 0x34, 0x37, 0x37, // )) * 5.960464477
+	0x35, 0x33, 0x39, 0x30, 0x36, 0x32, 0x35, 0x65, 0x2d, 0x30, 0x38, 0x29, 0x2c, 0x20, 0x30, 0x2e, // 5390625e-08), 0.
+	0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 0);.            
+	0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, // break;.        }
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x7d, 0x0a, 0x0a, 0x00, 0x00, 0xa0, 0x00,             // .    }.}......
+};
+extern const uint8_t* cs_ps_spawn_pssl;
+extern const uint32_t cs_ps_spawn_pssl_size;
@@ -0,0 +1,109 @@
+/*
+ * Copyright 2011-2020 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx#license-bsd-2-clause
+ */
+
+#include "bgfx_compute.sh"
+#include "uniforms.sh"
+
+BUFFER_WR(particles, vec4, 0);
+
+uint hash(uint _x)
+{
+	_x ^= _x >> 16;
+	_x *= 0x7feb352du;
+	_x ^= _x >> 15;
+	_x *= 0x846ca68bu;
+	_x ^= _x >> 16;
+	return _x;
+}
+
+float frnd(inout uint _state)
+{
+	_state = hash(_state);
+	return float(_state >> 8) * (1.0/16777216.0);
+}
+
+float frndh(inout uint _state)
+{
+	return frnd(_state) * 2.0 - 1.0;
+}
+
+vec3 randUnitCircle(inout uint _state)
+{
+	float angle = frnd(_state) * 6.28318530718;
+	return vec3(cos(angle), 0.0, sin(angle) );
+}
+
+vec3 randUnitSphere(inout uint _state)
+{
+	float rand0 = frnd(_state) * 2.0 - 1.0;
+	float rand1 = frnd(_state) * 6.28318530718;
+	float sqrtf = sqrt(1.0 - rand0*rand0);
+	return vec3(sqrtf * cos(rand1), sqrtf * sin(rand1), rand0);
+}
+
+NUM_THREADS(spawnGroupSize, 1, 1)
+void main()
+{
+	uint id = gl_GlobalInvocationID.x;
+
+	if (id >= u_spawnCount)
+	{
+		return;
+	}
+
+	uint idx   = (u_spawnStart + id) % u_maxParticles;
+	uint state = hash(u_seed + id);
+
+	vec3 pos;
+	if (0 == u_shape)
+	{
+		pos = randUnitSphere(state);
+	}
+	else if (1 == u_shape)
+	{
+		pos = randUnitSphere(state);
+		pos.y = abs(pos.y);
+	}
+	else if (2 == u_shape)
+	{
+		pos = randUnitCircle(state);
+	}
+	else if (3 == u_shape)
+	{
+		pos = randUnitCircle(state) * frnd(state);
+	}
+	else
+	{
+		pos = vec3(frndh(state), 0.0, frndh(state) );
+	}
+
+	vec3 dir = 0 == u_direction
+		? vec3(0.0, 1.0, 0.0)
+		: normalize(pos)
+		;
+
+	float startOffset = mix(u_offsetStart.x, u_offsetStart.y, frnd(state) );
+	vec3  start       = pos * startOffset;
+
+	float endOffset = mix(u_offsetEnd.x, u_offsetEnd.y, frnd(state) );
+	vec3  end       = start + dir * endOffset;
+
+	float lifeSpan = mix(u_lifeSpan.x, u_lifeSpan.y, frnd(state) );
+	vec3  gravity  = vec3(0.0, -9.81 * u_gravityScale * lifeSpan * lifeSpan, 0.0);
+
+	vec3 start0 = mul(u_psMtx, vec4(start, 1.0) ).xyz;
+	vec3 end0   = mul(u_psMtx, vec4(end,   1.0) ).xyz;
+	vec3 end1   = end0 + gravity;
+
+	float blendStart = mix(u_blendStart.x, u_blendStart.y, frnd(state) );
+	float blendEnd   = mix(u_blendEnd.x,   u_blendEnd.y,   frnd(state) );
+	float scaleStart = mix(u_scaleStart.x, u_scaleStart.y, frnd(state) );
+	float scaleEnd   = mix(u_scaleEnd.x,   u_scaleEnd.y,   frnd(state) );
+
+	particles[idx*PARTICLE_STRIDE + 0] = vec4(start0, float(id) * u_timePerParticle);
+	particles[idx*PARTICLE_STRIDE + 1] = vec4(end0,   1.0/lifeSpan);
+	particles[idx*PARTICLE_STRIDE + 2] = vec4(end1,   blendStart);
+	particles[idx*PARTICLE_STRIDE + 3] = vec4(blendEnd, scaleStart, scaleEnd, 0.0);
+}
@@ -0,0 +1,544 @@
+static const uint8_t cs_ps_update_glsl[2788] =
+{
+	0x43, 0x53, 0x48, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x0a, // CSH.............
+	0x00, 0x00, 0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x34, 0x33, 0x30, 0x0a, 0x76, // ..#version 430.v
+	0x65, 0x63, 0x33, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x4d, 0x75, 0x6c, 0x28, 0x76, 0x65, 0x63, 0x33, // ec3 instMul(vec3
+	0x20, 0x5f, 0x76, 0x65, 0x63, 0x2c, 0x20, 0x6d, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x6d, 0x74, 0x78, //  _vec, mat3 _mtx
+	0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x28, 0x20, 0x28, 0x5f, 0x76, // ) { return ( (_v
+	0x65, 0x63, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x5f, 0x6d, 0x74, 0x78, 0x29, 0x20, 0x29, 0x3b, 0x20, // ec) * (_mtx) ); 
+	0x7d, 0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x4d, 0x75, 0x6c, 0x28, 0x6d, // }.vec3 instMul(m
+	0x61, 0x74, 0x33, 0x20, 0x5f, 0x6d, 0x74, 0x78, 0x2c, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x5f, // at3 _mtx, vec3 _
+	0x76, 0x65, 0x63, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x28, 0x20, // vec) { return ( 
+	0x28, 0x5f, 0x6d, 0x74, 0x78, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x5f, 0x76, 0x65, 0x63, 0x29, 0x20, // (_mtx) * (_vec) 
+	0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x34, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x4d, 0x75, // ); }.vec4 instMu
+	0x6c, 0x28, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x76, 0x65, 0x63, 0x2c, 0x20, 0x6d, 0x61, 0x74, // l(vec4 _vec, mat
+	0x34, 0x20, 0x5f, 0x6d, 0x74, 0x78, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, // 4 _mtx) { return
+	0x20, 0x28, 0x20, 0x28, 0x5f, 0x76, 0x65, 0x63, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x5f, 0x6d, 0x74, //  ( (_vec) * (_mt
+	0x78, 0x29, 0x20, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x34, 0x20, 0x69, 0x6e, 0x73, // x) ); }.vec4 ins
+	0x74, 0x4d, 0x75, 0x6c, 0x28, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x6d, 0x74, 0x78, 0x2c, 0x20, // tMul(mat4 _mtx, 
+	0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x76, 0x65, 0x63, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, // vec4 _vec) { ret
+	0x75, 0x72, 0x6e, 0x20, 0x28, 0x20, 0x28, 0x5f, 0x6d, 0x74, 0x78, 0x29, 0x20, 0x2a, 0x20, 0x28, // urn ( (_mtx) * (
+	0x5f, 0x76, 0x65, 0x63, 0x29, 0x20, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, // _vec) ); }.float
+	0x20, 0x72, 0x63, 0x70, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x61, 0x29, 0x20, 0x7b, //  rcp(float _a) {
+	0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x31, 0x2e, 0x30, 0x2f, 0x5f, 0x61, 0x3b, 0x20, //  return 1.0/_a; 
+	0x7d, 0x0a, 0x76, 0x65, 0x63, 0x32, 0x20, 0x72, 0x63, 0x70, 0x28, 0x76, 0x65, 0x63, 0x32, 0x20, // }.vec2 rcp(vec2 
+	0x5f, 0x61, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, // _a) { return vec
+	0x32, 0x28, 0x31, 0x2e, 0x30, 0x29, 0x2f, 0x5f, 0x61, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, // 2(1.0)/_a; }.vec
+	0x33, 0x20, 0x72, 0x63, 0x70, 0x28, 0x76, 0x65, 0x63, 0x33, 0x20, 0x5f, 0x61, 0x29, 0x20, 0x7b, // 3 rcp(vec3 _a) {
+	0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x33, 0x28, 0x31, 0x2e, 0x30, //  return vec3(1.0
+	0x29, 0x2f, 0x5f, 0x61, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x34, 0x20, 0x72, 0x63, 0x70, // )/_a; }.vec4 rcp
+	0x28, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x61, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, // (vec4 _a) { retu
+	0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x31, 0x2e, 0x30, 0x29, 0x2f, 0x5f, 0x61, 0x3b, // rn vec4(1.0)/_a;
+	0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x32, 0x20, 0x76, 0x65, 0x63, 0x32, 0x5f, 0x73, 0x70, 0x6c, //  }.vec2 vec2_spl
+	0x61, 0x74, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x78, 0x29, 0x20, 0x7b, 0x20, 0x72, // at(float _x) { r
+	0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x5f, 0x78, 0x2c, 0x20, 0x5f, // eturn vec2(_x, _
+	0x78, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, 0x76, 0x65, 0x63, 0x33, 0x5f, // x); }.vec3 vec3_
+	0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x78, 0x29, 0x20, // splat(float _x) 
+	0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x33, 0x28, 0x5f, 0x78, // { return vec3(_x
+	0x2c, 0x20, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, // , _x, _x); }.vec
+	0x34, 0x20, 0x76, 0x65, 0x63, 0x34, 0x5f, 0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x66, 0x6c, 0x6f, // 4 vec4_splat(flo
+	0x61, 0x74, 0x20, 0x5f, 0x78, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, // at _x) { return 
+	0x76, 0x65, 0x63, 0x34, 0x28, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x2c, // vec4(_x, _x, _x,
+	0x20, 0x5f, 0x78, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x75, 0x76, 0x65, 0x63, 0x32, 0x20, 0x75, 0x76, //  _x); }.uvec2 uv
+	0x65, 0x63, 0x32, 0x5f, 0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, // ec2_splat(uint _
+	0x78, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x75, 0x76, 0x65, 0x63, // x) { return uvec
+	0x32, 0x28, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x75, 0x76, 0x65, // 2(_x, _x); }.uve
+	0x63, 0x33, 0x20, 0x75, 0x76, 0x65, 0x63, 0x33, 0x5f, 0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x75, // c3 uvec3_splat(u
+	0x69, 0x6e, 0x74, 0x20, 0x5f, 0x78, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, // int _x) { return
+	0x20, 0x75, 0x76, 0x65, 0x63, 0x33, 0x28, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x2c, 0x20, 0x5f, //  uvec3(_x, _x, _
+	0x78, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x75, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, 0x76, 0x65, 0x63, // x); }.uvec4 uvec
+	0x34, 0x5f, 0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x78, 0x29, // 4_splat(uint _x)
+	0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x75, 0x76, 0x65, 0x63, 0x34, 0x28, //  { return uvec4(
+	0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x29, 0x3b, // _x, _x, _x, _x);
+	0x20, 0x7d, 0x0a, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x6d, 0x74, 0x78, 0x46, 0x72, 0x6f, 0x6d, 0x52, //  }.mat4 mtxFromR
+	0x6f, 0x77, 0x73, 0x28, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x30, 0x2c, 0x20, 0x76, 0x65, 0x63, // ows(vec4 _0, vec
+	0x34, 0x20, 0x5f, 0x31, 0x2c, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x32, 0x2c, 0x20, 0x76, // 4 _1, vec4 _2, v
+	0x65, 0x63, 0x34, 0x20, 0x5f, 0x33, 0x29, 0x0a, 0x7b, 0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, // ec4 _3).{.return
+	0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x73, 0x65, 0x28, 0x6d, 0x61, 0x74, 0x34, 0x28, //  transpose(mat4(
+	0x5f, 0x30, 0x2c, 0x20, 0x5f, 0x31, 0x2c, 0x20, 0x5f, 0x32, 0x2c, 0x20, 0x5f, 0x33, 0x29, 0x20, // _0, _1, _2, _3) 
+	0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x6d, 0x74, 0x78, 0x46, 0x72, 0x6f, // );.}.mat4 mtxFro
+	0x6d, 0x43, 0x6f, 0x6c, 0x73, 0x28, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x30, 0x2c, 0x20, 0x76, // mCols(vec4 _0, v
+	0x65, 0x63, 0x34, 0x20, 0x5f, 0x31, 0x2c, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x32, 0x2c, // ec4 _1, vec4 _2,
+	0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x33, 0x29, 0x0a, 0x7b, 0x0a, 0x72, 0x65, 0x74, 0x75, //  vec4 _3).{.retu
+	0x72, 0x6e, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x28, 0x5f, 0x30, 0x2c, 0x20, 0x5f, 0x31, 0x2c, 0x20, // rn mat4(_0, _1, 
+	0x5f, 0x32, 0x2c, 0x20, 0x5f, 0x33, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x6d, 0x61, 0x74, 0x33, 0x20, // _2, _3);.}.mat3 
+	0x6d, 0x74, 0x78, 0x46, 0x72, 0x6f, 0x6d, 0x52, 0x6f, 0x77, 0x73, 0x28, 0x76, 0x65, 0x63, 0x33, // mtxFromRows(vec3
+	0x20, 0x5f, 0x30, 0x2c, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x5f, 0x31, 0x2c, 0x20, 0x76, 0x65, //  _0, vec3 _1, ve
+	0x63, 0x33, 0x20, 0x5f, 0x32, 0x29, 0x0a, 0x7b, 0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, // c3 _2).{.return 
+	0x74, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x73, 0x65, 0x28, 0x6d, 0x61, 0x74, 0x33, 0x28, 0x5f, // transpose(mat3(_
+	0x30, 0x2c, 0x20, 0x5f, 0x31, 0x2c, 0x20, 0x5f, 0x32, 0x29, 0x20, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, // 0, _1, _2) );.}.
+	0x6d, 0x61, 0x74, 0x33, 0x20, 0x6d, 0x74, 0x78, 0x46, 0x72, 0x6f, 0x6d, 0x43, 0x6f, 0x6c, 0x73, // mat3 mtxFromCols
+	0x28, 0x76, 0x65, 0x63, 0x33, 0x20, 0x5f, 0x30, 0x2c, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x5f, // (vec3 _0, vec3 _
+	0x31, 0x2c, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x5f, 0x32, 0x29, 0x0a, 0x7b, 0x0a, 0x72, 0x65, // 1, vec3 _2).{.re
+	0x74, 0x75, 0x72, 0x6e, 0x20, 0x6d, 0x61, 0x74, 0x33, 0x28, 0x5f, 0x30, 0x2c, 0x20, 0x5f, 0x31, // turn mat3(_0, _1
+	0x2c, 0x20, 0x5f, 0x32, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, // , _2);.}.uniform
+	0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x52, 0x65, 0x63, 0x74, //  vec4 u_viewRect
+	0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, // ;.uniform vec4 u
+	0x5f, 0x76, 0x69, 0x65, 0x77, 0x54, 0x65, 0x78, 0x65, 0x6c, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, // _viewTexel;.unif
+	0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x3b, // orm mat4 u_view;
+	0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, // .uniform mat4 u_
+	0x69, 0x6e, 0x76, 0x56, 0x69, 0x65, 0x77, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, // invView;.uniform
+	0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x3b, 0x0a, 0x75, 0x6e, //  mat4 u_proj;.un
+	0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x69, 0x6e, 0x76, // iform mat4 u_inv
+	0x50, 0x72, 0x6f, 0x6a, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, // Proj;.uniform ma
+	0x74, 0x34, 0x20, 0x75, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x50, 0x72, 0x6f, 0x6a, 0x3b, 0x0a, 0x75, // t4 u_viewProj;.u
+	0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x69, 0x6e, // niform mat4 u_in
+	0x76, 0x56, 0x69, 0x65, 0x77, 0x50, 0x72, 0x6f, 0x6a, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, // vViewProj;.unifo
+	0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5b, // rm mat4 u_model[
+	0x33, 0x32, 0x5d, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, // 32];.uniform mat
+	0x34, 0x20, 0x75, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x56, 0x69, 0x65, 0x77, 0x3b, 0x0a, 0x75, // 4 u_modelView;.u
+	0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x6d, 0x6f, // niform mat4 u_mo
+	0x64, 0x65, 0x6c, 0x56, 0x69, 0x65, 0x77, 0x50, 0x72, 0x6f, 0x6a, 0x3b, 0x0a, 0x75, 0x6e, 0x69, // delViewProj;.uni
+	0x66, 0x6f, 0x72, 0x6d, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, 0x5f, 0x61, 0x6c, 0x70, 0x68, // form vec4 u_alph
+	0x61, 0x52, 0x65, 0x66, 0x34, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x76, // aRef4;.uniform v
+	0x65, 0x63, 0x34, 0x20, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x34, // ec4 u_psParams[4
+	0x38, 0x5d, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, // 8];.uniform mat4
+	0x20, 0x75, 0x5f, 0x70, 0x73, 0x4d, 0x74, 0x78, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, //  u_psMtx;.unifor
+	0x6d, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, 0x5f, 0x70, 0x73, 0x53, 0x6f, 0x72, 0x74, 0x3b, // m vec4 u_psSort;
+	0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x65, 0x61, 0x73, 0x65, 0x28, 0x69, 0x6e, 0x74, 0x20, // .float ease(int 
+	0x5f, 0x63, 0x75, 0x72, 0x76, 0x65, 0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x74, // _curve, float _t
+	0x74, 0x29, 0x0a, 0x7b, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x70, 0x6f, 0x73, 0x20, 0x3d, // t).{.float pos =
+	0x20, 0x63, 0x6c, 0x61, 0x6d, 0x70, 0x28, 0x5f, 0x74, 0x74, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, //  clamp(_tt, 0.0,
+	0x20, 0x31, 0x2e, 0x30, 0x29, 0x20, 0x2a, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x33, 0x32, //  1.0) * float(32
+	0x2d, 0x31, 0x29, 0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x64, 0x78, 0x30, 0x20, 0x3d, 0x20, // -1);.int idx0 = 
+	0x69, 0x6e, 0x74, 0x28, 0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x28, 0x70, 0x6f, 0x73, 0x29, 0x20, 0x29, // int(floor(pos) )
+	0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x64, 0x78, 0x31, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x6e, // ;.int idx1 = min
+	0x28, 0x69, 0x64, 0x78, 0x30, 0x20, 0x2b, 0x20, 0x31, 0x2c, 0x20, 0x33, 0x32, 0x2d, 0x31, 0x29, // (idx0 + 1, 32-1)
+	0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x62, 0x61, 0x73, 0x65, 0x20, 0x3d, 0x20, 0x31, 0x36, 0x2a, // ;.int base = 16*
+	0x34, 0x20, 0x2b, 0x20, 0x5f, 0x63, 0x75, 0x72, 0x76, 0x65, 0x2a, 0x33, 0x32, 0x3b, 0x0a, 0x69, // 4 + _curve*32;.i
+	0x6e, 0x74, 0x20, 0x6c, 0x75, 0x74, 0x30, 0x20, 0x3d, 0x20, 0x62, 0x61, 0x73, 0x65, 0x20, 0x2b, // nt lut0 = base +
+	0x20, 0x69, 0x64, 0x78, 0x30, 0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x6c, 0x75, 0x74, 0x31, 0x20, //  idx0;.int lut1 
+	0x3d, 0x20, 0x62, 0x61, 0x73, 0x65, 0x20, 0x2b, 0x20, 0x69, 0x64, 0x78, 0x31, 0x3b, 0x0a, 0x66, // = base + idx1;.f
+	0x6c, 0x6f, 0x61, 0x74, 0x20, 0x76, 0x61, 0x6c, 0x30, 0x20, 0x3d, 0x20, 0x75, 0x5f, 0x70, 0x73, // loat val0 = u_ps
+	0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x6c, 0x75, 0x74, 0x30, 0x2f, 0x34, 0x5d, 0x5b, 0x6c, // Params[lut0/4][l
+	0x75, 0x74, 0x30, 0x25, 0x34, 0x5d, 0x3b, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x76, 0x61, // ut0%4];.float va
+	0x6c, 0x31, 0x20, 0x3d, 0x20, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, // l1 = u_psParams[
+	0x6c, 0x75, 0x74, 0x31, 0x2f, 0x34, 0x5d, 0x5b, 0x6c, 0x75, 0x74, 0x31, 0x25, 0x34, 0x5d, 0x3b, // lut1/4][lut1%4];
+	0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x6d, 0x69, 0x78, 0x28, 0x76, 0x61, 0x6c, 0x30, // .return mix(val0
+	0x2c, 0x20, 0x76, 0x61, 0x6c, 0x31, 0x2c, 0x20, 0x66, 0x72, 0x61, 0x63, 0x74, 0x28, 0x70, 0x6f, // , val1, fract(po
+	0x73, 0x29, 0x20, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x28, 0x73, // s) );.}.layout(s
+	0x74, 0x64, 0x34, 0x33, 0x30, 0x2c, 0x20, 0x62, 0x69, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x3d, 0x30, // td430, binding=0
+	0x29, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, // ) buffer particl
+	0x65, 0x73, 0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x7b, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, // esBuffer { vec4 
+	0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, 0x65, 0x73, 0x5b, 0x5d, 0x3b, 0x20, 0x7d, 0x3b, 0x0a, // particles[]; };.
+	0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x28, 0x73, 0x74, 0x64, 0x34, 0x33, 0x30, 0x2c, 0x20, 0x62, // layout(std430, b
+	0x69, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x3d, 0x31, 0x29, 0x20, 0x77, 0x72, 0x69, 0x74, 0x65, 0x6f, // inding=1) writeo
+	0x6e, 0x6c, 0x79, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x73, 0x6f, 0x72, 0x74, 0x42, // nly buffer sortB
+	0x75, 0x66, 0x66, 0x65, 0x72, 0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x7b, 0x20, 0x76, 0x65, // ufferBuffer { ve
+	0x63, 0x34, 0x20, 0x73, 0x6f, 0x72, 0x74, 0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5b, 0x5d, 0x3b, // c4 sortBuffer[];
+	0x20, 0x7d, 0x3b, 0x0a, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x28, 0x73, 0x74, 0x64, 0x34, 0x33, //  };.layout(std43
+	0x30, 0x2c, 0x20, 0x62, 0x69, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x3d, 0x32, 0x29, 0x20, 0x62, 0x75, // 0, binding=2) bu
+	0x66, 0x66, 0x65, 0x72, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x42, 0x75, 0x66, 0x66, // ffer counterBuff
+	0x65, 0x72, 0x20, 0x7b, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, // er { uint counte
+	0x72, 0x5b, 0x5d, 0x3b, 0x20, 0x7d, 0x3b, 0x0a, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x20, 0x28, // r[]; };.layout (
+	0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x78, 0x20, 0x3d, 0x20, 0x32, // local_size_x = 2
+	0x35, 0x36, 0x2c, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x79, // 56, local_size_y
+	0x20, 0x3d, 0x20, 0x31, 0x2c, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x73, 0x69, 0x7a, 0x65, //  = 1, local_size
+	0x5f, 0x7a, 0x20, 0x3d, 0x20, 0x31, 0x29, 0x20, 0x69, 0x6e, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, // _z = 1) in;.void
+	0x20, 0x6d, 0x61, 0x69, 0x6e, 0x28, 0x29, 0x0a, 0x7b, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, //  main().{.uint i
+	0x64, 0x78, 0x20, 0x3d, 0x20, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, // dx = gl_GlobalIn
+	0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x2e, 0x78, 0x3b, 0x0a, 0x76, 0x65, // vocationID.x;.ve
+	0x63, 0x34, 0x20, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x20, 0x3d, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, // c4 entry = vec4(
+	0x33, 0x2e, 0x34, 0x30, 0x32, 0x38, 0x32, 0x33, 0x65, 0x2b, 0x33, 0x38, 0x2c, 0x20, 0x66, 0x6c, // 3.402823e+38, fl
+	0x6f, 0x61, 0x74, 0x28, 0x69, 0x64, 0x78, 0x29, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x30, // oat(idx), 0.0, 0
+	0x2e, 0x30, 0x29, 0x3b, 0x0a, 0x69, 0x66, 0x20, 0x28, 0x69, 0x64, 0x78, 0x20, 0x3c, 0x20, 0x75, // .0);.if (idx < u
+	0x69, 0x6e, 0x74, 0x28, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x30, // int(u_psParams[0
+	0x5d, 0x2e, 0x77, 0x29, 0x29, 0x0a, 0x7b, 0x0a, 0x76, 0x65, 0x63, 0x34, 0x20, 0x70, 0x30, 0x20, // ].w)).{.vec4 p0 
+	0x3d, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, 0x65, 0x73, 0x5b, 0x69, 0x64, 0x78, 0x2a, // = particles[idx*
+	0x34, 0x20, 0x2b, 0x20, 0x30, 0x5d, 0x3b, 0x0a, 0x76, 0x65, 0x63, 0x34, 0x20, 0x70, 0x31, 0x20, // 4 + 0];.vec4 p1 
+	0x3d, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, 0x65, 0x73, 0x5b, 0x69, 0x64, 0x78, 0x2a, // = particles[idx*
+	0x34, 0x20, 0x2b, 0x20, 0x31, 0x5d, 0x3b, 0x0a, 0x69, 0x66, 0x20, 0x28, 0x70, 0x30, 0x2e, 0x77, // 4 + 1];.if (p0.w
+	0x20, 0x3c, 0x3d, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x0a, 0x7b, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, //  <= 1.0).{.float
+	0x20, 0x6c, 0x69, 0x66, 0x65, 0x20, 0x3d, 0x20, 0x70, 0x30, 0x2e, 0x77, 0x20, 0x2b, 0x20, 0x75, //  life = p0.w + u
+	0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x30, 0x5d, 0x2e, 0x78, 0x20, 0x2a, // _psParams[0].x *
+	0x20, 0x70, 0x31, 0x2e, 0x77, 0x3b, 0x0a, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, 0x65, 0x73, //  p1.w;.particles
+	0x5b, 0x69, 0x64, 0x78, 0x2a, 0x34, 0x5d, 0x20, 0x3d, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x70, // [idx*4] = vec4(p
+	0x30, 0x2e, 0x78, 0x79, 0x7a, 0x2c, 0x20, 0x6c, 0x69, 0x66, 0x65, 0x29, 0x3b, 0x0a, 0x69, 0x66, // 0.xyz, life);.if
+	0x20, 0x28, 0x6c, 0x69, 0x66, 0x65, 0x20, 0x3c, 0x3d, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x0a, 0x7b, //  (life <= 1.0).{
+	0x0a, 0x76, 0x65, 0x63, 0x34, 0x20, 0x70, 0x32, 0x20, 0x3d, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, // .vec4 p2 = parti
+	0x63, 0x6c, 0x65, 0x73, 0x5b, 0x69, 0x64, 0x78, 0x2a, 0x34, 0x20, 0x2b, 0x20, 0x32, 0x5d, 0x3b, // cles[idx*4 + 2];
+	0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x74, 0x20, 0x3d, 0x20, 0x65, 0x61, 0x73, 0x65, // .float tt = ease
+	0x28, 0x30, 0x2c, 0x20, 0x6c, 0x69, 0x66, 0x65, 0x29, 0x3b, 0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, // (0, life);.vec3 
+	0x70, 0x70, 0x30, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x78, 0x28, 0x70, 0x30, 0x2e, 0x78, 0x79, 0x7a, // pp0 = mix(p0.xyz
+	0x2c, 0x20, 0x70, 0x31, 0x2e, 0x78, 0x79, 0x7a, 0x2c, 0x20, 0x74, 0x74, 0x29, 0x3b, 0x0a, 0x76, // , p1.xyz, tt);.v
+	0x65, 0x63, 0x33, 0x20, 0x70, 0x70, 0x31, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x78, 0x28, 0x70, 0x31, // ec3 pp1 = mix(p1
+	0x2e, 0x78, 0x79, 0x7a, 0x2c, 0x20, 0x70, 0x32, 0x2e, 0x78, 0x79, 0x7a, 0x2c, 0x20, 0x74, 0x74, // .xyz, p2.xyz, tt
+	0x29, 0x3b, 0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, 0x70, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x6d, 0x69, // );.vec3 pos = mi
+	0x78, 0x28, 0x70, 0x70, 0x30, 0x2c, 0x20, 0x70, 0x70, 0x31, 0x2c, 0x20, 0x74, 0x74, 0x29, 0x3b, // x(pp0, pp1, tt);
+	0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, 0x64, 0x65, 0x6c, 0x74, 0x61, 0x20, 0x3d, 0x20, 0x75, 0x5f, // .vec3 delta = u_
+	0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x36, 0x5d, 0x2e, 0x78, 0x79, 0x7a, 0x20, // psParams[6].xyz 
+	0x2d, 0x20, 0x70, 0x6f, 0x73, 0x3b, 0x0a, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x2e, 0x78, 0x20, 0x3d, // - pos;.entry.x =
+	0x20, 0x2d, 0x64, 0x6f, 0x74, 0x28, 0x64, 0x65, 0x6c, 0x74, 0x61, 0x2c, 0x20, 0x64, 0x65, 0x6c, //  -dot(delta, del
+	0x74, 0x61, 0x29, 0x3b, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x70, 0x72, 0x65, 0x76, 0x3b, 0x0a, // ta);.uint prev;.
+	0x70, 0x72, 0x65, 0x76, 0x20, 0x3d, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x41, 0x64, 0x64, // prev = atomicAdd
+	0x28, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x31, 0x75, 0x29, // (counter[0], 1u)
+	0x3b, 0x0a, 0x7d, 0x0a, 0x7d, 0x0a, 0x7d, 0x0a, 0x73, 0x6f, 0x72, 0x74, 0x42, 0x75, 0x66, 0x66, // ;.}.}.}.sortBuff
+	0x65, 0x72, 0x5b, 0x69, 0x64, 0x78, 0x5d, 0x20, 0x3d, 0x20, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x3b, // er[idx] = entry;
+	0x0a, 0x7d, 0x0a, 0x00,                                                                         // .}..
+};
+static const uint8_t cs_ps_update_spv[3330] =
+{
+	0x43, 0x53, 0x48, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0a, 0x75, // CSH............u
+	0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x02, 0x30, 0x00, 0x00, 0x30, 0x00, 0xac, // _psParams.0..0..
+	0x9f, 0x09, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, 0x65, 0x73, 0x01, 0x00, 0x10, 0x00, 0x07, // ..particles.....
+	0x00, 0xac, 0x9f, 0x07, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x01, 0x01, 0x12, 0x00, 0x07, // ....counter.....
+	0x00, 0xac, 0x9f, 0x0a, 0x73, 0x6f, 0x72, 0x74, 0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x01, 0x00, // ....sortBuffer..
+	0x11, 0x00, 0x07, 0x00, 0xac, 0x9f, 0xa4, 0x0c, 0x00, 0x00, 0x03, 0x02, 0x23, 0x07, 0x00, 0x00, // ............#...
+	0x01, 0x00, 0x08, 0x00, 0x08, 0x00, 0xd6, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, // ................
+	0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x47, 0x4c, // ..............GL
+	0x53, 0x4c, 0x2e, 0x73, 0x74, 0x64, 0x2e, 0x34, 0x35, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, // SL.std.450......
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x06, 0x00, 0x05, 0x00, // ................
+	0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, // ......main......
+	0x00, 0x00, 0x10, 0x00, 0x06, 0x00, 0x04, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x01, // ................
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x05, 0x00, // ................
+	0x00, 0x00, 0xf4, 0x01, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, // ..............ma
+	0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x53, 0x00, 0x00, 0x00, 0x55, 0x6e, // in........S...Un
+	0x69, 0x66, 0x6f, 0x72, 0x6d, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, // iformBlock......
+	0x06, 0x00, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, // ..S.......u_psPa
+	0x72, 0x61, 0x6d, 0x73, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, // rams......U.....
+	0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x87, 0x00, 0x00, 0x00, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, // ..........partic
+	0x6c, 0x65, 0x73, 0x00, 0x00, 0x00, 0x06, 0x00, 0x05, 0x00, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, // les.............
+	0x00, 0x00, 0x40, 0x64, 0x61, 0x74, 0x61, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x89, 0x00, // ..@data.........
+	0x00, 0x00, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, 0x65, 0x73, 0x00, 0x00, 0x00, 0x05, 0x00, // ..particles.....
+	0x04, 0x00, 0xed, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x00, 0x06, 0x00, // ......counter...
+	0x05, 0x00, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x64, 0x61, 0x74, 0x61, 0x00, // ..........@data.
+	0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0xef, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, // ..........counte
+	0x72, 0x00, 0x05, 0x00, 0x05, 0x00, 0xf3, 0x00, 0x00, 0x00, 0x73, 0x6f, 0x72, 0x74, 0x42, 0x75, // r.........sortBu
+	0x66, 0x66, 0x65, 0x72, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x67, 0x6c, // ffer..........gl
+	0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, // _GlobalInvocatio
+	0x6e, 0x49, 0x44, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x52, 0x00, 0x00, 0x00, 0x06, 0x00, // nID...G...R.....
+	0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, // ......H...S.....
+	0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x53, 0x00, // ..#.......G...S.
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x55, 0x00, 0x00, 0x00, 0x22, 0x00, // ......G...U...".
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x55, 0x00, 0x00, 0x00, 0x21, 0x00, // ......G...U...!.
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x86, 0x00, 0x00, 0x00, 0x06, 0x00, // ......G.........
+	0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, // ......H.........
+	0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x87, 0x00, // ..#.......G.....
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x89, 0x00, 0x00, 0x00, 0x22, 0x00, // ......G.......".
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x89, 0x00, 0x00, 0x00, 0x21, 0x00, // ......G.......!.
+	0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0xec, 0x00, 0x00, 0x00, 0x06, 0x00, // ......G.........
+	0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, // ......H.........
+	0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0xed, 0x00, // ..#.......G.....
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0xef, 0x00, 0x00, 0x00, 0x22, 0x00, // ......G.......".
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0xef, 0x00, 0x00, 0x00, 0x21, 0x00, // ......G.......!.
+	0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0xf3, 0x00, 0x00, 0x00, 0x22, 0x00, // ......G.......".
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0xf3, 0x00, 0x00, 0x00, 0x21, 0x00, // ......G.......!.
+	0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x0b, 0x00, // ......G.........
+	0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x13, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x21, 0x00, // ..............!.
+	0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x16, 0x00, 0x03, 0x00, 0x06, 0x00, // ................
+	0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, // .. .............
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0x20, 0x00, // .............. .
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x16, 0x00, // ................
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x31, 0x00, // ......+.......1.
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x32, 0x00, // ......+.......2.
+	0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x2b, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x34, 0x00, // .....?+.......4.
+	0x00, 0x00, 0x00, 0x00, 0xf8, 0x41, 0x2b, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0x3c, 0x00, // .....A+.......<.
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0x3e, 0x00, // ......+.......>.
+	0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0x41, 0x00, // ......+.......A.
+	0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x06, 0x00, // ..@.......O.....
+	0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00, 0x50, 0x00, 0x00, 0x00, 0x20, 0x00, // ..........P... .
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x50, 0x00, 0x00, 0x00, 0x51, 0x00, // ......+...P...Q.
+	0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x04, 0x00, 0x52, 0x00, 0x00, 0x00, 0x4f, 0x00, // ..0.......R...O.
+	0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00, 0x53, 0x00, 0x00, 0x00, 0x52, 0x00, // ..Q.......S...R.
+	0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x54, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x53, 0x00, // .. ...T.......S.
+	0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x54, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x02, 0x00, // ..;...T...U.....
+	0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, // ..+.......V.....
+	0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x04, 0x00, // ..+.......X.....
+	0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 0x00, // .. .............
+	0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x50, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, // ..+...P...r.....
+	0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xfd, 0xff, // ..+.......x.....
+	0x7f, 0x7f, 0x2b, 0x00, 0x04, 0x00, 0x50, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x03, 0x00, // ..+...P...}.....
+	0x00, 0x00, 0x14, 0x00, 0x02, 0x00, 0x81, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x03, 0x00, 0x86, 0x00, // ................
+	0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00, 0x87, 0x00, 0x00, 0x00, 0x86, 0x00, // ..O.............
+	0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x88, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x87, 0x00, // .. .............
+	0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x88, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x02, 0x00, // ..;.............
+	0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x50, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x04, 0x00, // ..+...P.........
+	0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x4f, 0x00, // .. ...........O.
+	0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x50, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x01, 0x00, // ..+...P.........
+	0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x50, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x02, 0x00, // ..+...P.........
+	0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x06, 0x00, // ..+.............
+	0x00, 0x00, 0x1d, 0x00, 0x03, 0x00, 0xec, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x1e, 0x00, // ..........P.....
+	0x03, 0x00, 0xed, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0xee, 0x00, // .......... .....
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xed, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0xee, 0x00, // ..........;.....
+	0x00, 0x00, 0xef, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0xf0, 0x00, // .......... .....
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x88, 0x00, // ......P...;.....
+	0x00, 0x00, 0xf3, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0xf8, 0x00, // .......... .....
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0xf8, 0x00, // ..........;.....
+	0x00, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x36, 0x00, 0x05, 0x00, 0x02, 0x00, // ..........6.....
+	0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf8, 0x00, // ................
+	0x02, 0x00, 0x05, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1d, 0x00, 0x00, 0x00, 0xfa, 0x00, // ......=.........
+	0x00, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00, 0x2b, 0x01, // ......Q.......+.
+	0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x04, 0x00, 0x50, 0x00, // ..........|...P.
+	0x00, 0x00, 0x2c, 0x01, 0x00, 0x00, 0x2b, 0x01, 0x00, 0x00, 0x70, 0x00, 0x04, 0x00, 0x06, 0x00, // ..,...+...p.....
+	0x00, 0x00, 0x2e, 0x01, 0x00, 0x00, 0x2c, 0x01, 0x00, 0x00, 0x50, 0x00, 0x07, 0x00, 0x4f, 0x00, // ......,...P...O.
+	0x00, 0x00, 0x2f, 0x01, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x2e, 0x01, 0x00, 0x00, 0x31, 0x00, // ../...x.......1.
+	0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x41, 0x00, 0x07, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x31, 0x01, // ..1...A.......1.
+	0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x7d, 0x00, // ..U...V...V...}.
+	0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x32, 0x01, 0x00, 0x00, 0x31, 0x01, // ..=.......2...1.
+	0x00, 0x00, 0x6d, 0x00, 0x04, 0x00, 0x50, 0x00, 0x00, 0x00, 0x33, 0x01, 0x00, 0x00, 0x32, 0x01, // ..m...P...3...2.
+	0x00, 0x00, 0xb0, 0x00, 0x05, 0x00, 0x81, 0x00, 0x00, 0x00, 0x34, 0x01, 0x00, 0x00, 0x2c, 0x01, // ..........4...,.
+	0x00, 0x00, 0x33, 0x01, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x81, 0x01, 0x00, 0x00, 0x00, 0x00, // ..3.............
+	0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x34, 0x01, 0x00, 0x00, 0x35, 0x01, 0x00, 0x00, 0x81, 0x01, // ......4...5.....
+	0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x35, 0x01, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x50, 0x00, // ......5.......P.
+	0x00, 0x00, 0x37, 0x01, 0x00, 0x00, 0x2c, 0x01, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x41, 0x00, // ..7...,.......A.
+	0x06, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x39, 0x01, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x56, 0x00, // ......9.......V.
+	0x00, 0x00, 0x37, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x3a, 0x01, // ..7...=...O...:.
+	0x00, 0x00, 0x39, 0x01, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x50, 0x00, 0x00, 0x00, 0x3c, 0x01, // ..9.......P...<.
+	0x00, 0x00, 0x2c, 0x01, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x50, 0x00, // ..,...........P.
+	0x00, 0x00, 0x3d, 0x01, 0x00, 0x00, 0x3c, 0x01, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x41, 0x00, // ..=...<.......A.
+	0x06, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x3e, 0x01, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x56, 0x00, // ......>.......V.
+	0x00, 0x00, 0x3d, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x3f, 0x01, // ..=...=...O...?.
+	0x00, 0x00, 0x3e, 0x01, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x41, 0x01, // ..>...Q.......A.
+	0x00, 0x00, 0x3a, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x05, 0x00, 0x81, 0x00, // ..:.............
+	0x00, 0x00, 0x42, 0x01, 0x00, 0x00, 0x41, 0x01, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0xf7, 0x00, // ..B...A...2.....
+	0x03, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x42, 0x01, // ..............B.
+	0x00, 0x00, 0x43, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x43, 0x01, // ..C...........C.
+	0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x45, 0x01, 0x00, 0x00, 0x3a, 0x01, // ..Q.......E...:.
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x41, 0x00, 0x07, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x46, 0x01, // ......A.......F.
+	0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x72, 0x00, // ..U...V...V...r.
+	0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x47, 0x01, 0x00, 0x00, 0x46, 0x01, // ..=.......G...F.
+	0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x49, 0x01, 0x00, 0x00, 0x3f, 0x01, // ..Q.......I...?.
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x4a, 0x01, // ..............J.
+	0x00, 0x00, 0x47, 0x01, 0x00, 0x00, 0x49, 0x01, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x06, 0x00, // ..G...I.........
+	0x00, 0x00, 0x4b, 0x01, 0x00, 0x00, 0x45, 0x01, 0x00, 0x00, 0x4a, 0x01, 0x00, 0x00, 0x84, 0x00, // ..K...E...J.....
+	0x05, 0x00, 0x50, 0x00, 0x00, 0x00, 0x4d, 0x01, 0x00, 0x00, 0x2c, 0x01, 0x00, 0x00, 0x8b, 0x00, // ..P...M...,.....
+	0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x51, 0x01, 0x00, 0x00, 0x3a, 0x01, // ..Q.......Q...:.
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x52, 0x01, // ......Q.......R.
+	0x00, 0x00, 0x3a, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x06, 0x00, // ..:.......Q.....
+	0x00, 0x00, 0x53, 0x01, 0x00, 0x00, 0x3a, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x50, 0x00, // ..S...:.......P.
+	0x07, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x54, 0x01, 0x00, 0x00, 0x51, 0x01, 0x00, 0x00, 0x52, 0x01, // ..O...T...Q...R.
+	0x00, 0x00, 0x53, 0x01, 0x00, 0x00, 0x4b, 0x01, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x8e, 0x00, // ..S...K...A.....
+	0x00, 0x00, 0x55, 0x01, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x4d, 0x01, // ..U.......V...M.
+	0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x55, 0x01, 0x00, 0x00, 0x54, 0x01, 0x00, 0x00, 0xbc, 0x00, // ..>...U...T.....
+	0x05, 0x00, 0x81, 0x00, 0x00, 0x00, 0x57, 0x01, 0x00, 0x00, 0x4b, 0x01, 0x00, 0x00, 0x32, 0x00, // ......W...K...2.
+	0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x7f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, // ................
+	0x04, 0x00, 0x57, 0x01, 0x00, 0x00, 0x58, 0x01, 0x00, 0x00, 0x7f, 0x01, 0x00, 0x00, 0xf8, 0x00, // ..W...X.........
+	0x02, 0x00, 0x58, 0x01, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x50, 0x00, 0x00, 0x00, 0x5a, 0x01, // ..X.......P...Z.
+	0x00, 0x00, 0x2c, 0x01, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x50, 0x00, // ..,...........P.
+	0x00, 0x00, 0x5b, 0x01, 0x00, 0x00, 0x5a, 0x01, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x41, 0x00, // ..[...Z.......A.
+	0x06, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x5c, 0x01, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x56, 0x00, // ..............V.
+	0x00, 0x00, 0x5b, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x5d, 0x01, // ..[...=...O...].
+	0x00, 0x00, 0x5c, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x06, 0x00, 0x00, 0x00, 0x93, 0x01, // ................
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x4b, 0x01, 0x00, 0x00, 0x31, 0x00, // ......+...K...1.
+	0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x94, 0x01, // ..2.............
+	0x00, 0x00, 0x93, 0x01, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x06, 0x00, // ......4.........
+	0x00, 0x00, 0x96, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x94, 0x01, // ................
+	0x00, 0x00, 0x6e, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0x97, 0x01, 0x00, 0x00, 0x96, 0x01, // ..n.............
+	0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00, 0x99, 0x01, 0x00, 0x00, 0x97, 0x01, // ................
+	0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x16, 0x00, 0x00, 0x00, 0x9a, 0x01, // ..<.............
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x99, 0x01, 0x00, 0x00, 0x3e, 0x00, // ......'.......>.
+	0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00, 0xa0, 0x01, 0x00, 0x00, 0x41, 0x00, // ..............A.
+	0x00, 0x00, 0x97, 0x01, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00, 0xa3, 0x01, // ................
+	0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x9a, 0x01, 0x00, 0x00, 0x87, 0x00, 0x05, 0x00, 0x16, 0x00, // ..A.............
+	0x00, 0x00, 0xa5, 0x01, 0x00, 0x00, 0xa0, 0x01, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x8b, 0x00, // ..........X.....
+	0x05, 0x00, 0x16, 0x00, 0x00, 0x00, 0xa7, 0x01, 0x00, 0x00, 0xa0, 0x01, 0x00, 0x00, 0x58, 0x00, // ..............X.
+	0x00, 0x00, 0x41, 0x00, 0x07, 0x00, 0x5c, 0x00, 0x00, 0x00, 0xa8, 0x01, 0x00, 0x00, 0x55, 0x00, // ..A...........U.
+	0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0xa5, 0x01, 0x00, 0x00, 0xa7, 0x01, 0x00, 0x00, 0x3d, 0x00, // ..V...........=.
+	0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0xa9, 0x01, 0x00, 0x00, 0xa8, 0x01, 0x00, 0x00, 0x87, 0x00, // ................
+	0x05, 0x00, 0x16, 0x00, 0x00, 0x00, 0xab, 0x01, 0x00, 0x00, 0xa3, 0x01, 0x00, 0x00, 0x58, 0x00, // ..............X.
+	0x00, 0x00, 0x8b, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00, 0xad, 0x01, 0x00, 0x00, 0xa3, 0x01, // ................
+	0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x41, 0x00, 0x07, 0x00, 0x5c, 0x00, 0x00, 0x00, 0xae, 0x01, // ..X...A.........
+	0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0xab, 0x01, 0x00, 0x00, 0xad, 0x01, // ..U...V.........
+	0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x00, 0x00, 0xae, 0x01, // ..=.............
+	0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0xb1, 0x01, 0x00, 0x00, 0x01, 0x00, // ................
+	0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x94, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x06, 0x00, // ................
+	0x00, 0x00, 0xba, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xa9, 0x01, // ................
+	0x00, 0x00, 0xaf, 0x01, 0x00, 0x00, 0xb1, 0x01, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00, 0x0e, 0x00, // ..........P.....
+	0x00, 0x00, 0x61, 0x01, 0x00, 0x00, 0xba, 0x01, 0x00, 0x00, 0xba, 0x01, 0x00, 0x00, 0xba, 0x01, // ..a.............
+	0x00, 0x00, 0x4f, 0x00, 0x08, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x63, 0x01, 0x00, 0x00, 0x3a, 0x01, // ..O.......c...:.
+	0x00, 0x00, 0x3a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, // ..:.............
+	0x00, 0x00, 0x4f, 0x00, 0x08, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x65, 0x01, 0x00, 0x00, 0x3f, 0x01, // ..O.......e...?.
+	0x00, 0x00, 0x3f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, // ..?.............
+	0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xc0, 0x01, 0x00, 0x00, 0x01, 0x00, // ................
+	0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x63, 0x01, 0x00, 0x00, 0x65, 0x01, 0x00, 0x00, 0x61, 0x01, // ......c...e...a.
+	0x00, 0x00, 0x50, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x68, 0x01, 0x00, 0x00, 0xba, 0x01, // ..P.......h.....
+	0x00, 0x00, 0xba, 0x01, 0x00, 0x00, 0xba, 0x01, 0x00, 0x00, 0x4f, 0x00, 0x08, 0x00, 0x0e, 0x00, // ..........O.....
+	0x00, 0x00, 0x6a, 0x01, 0x00, 0x00, 0x3f, 0x01, 0x00, 0x00, 0x3f, 0x01, 0x00, 0x00, 0x00, 0x00, // ..j...?...?.....
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x08, 0x00, 0x0e, 0x00, // ..........O.....
+	0x00, 0x00, 0x6c, 0x01, 0x00, 0x00, 0x5d, 0x01, 0x00, 0x00, 0x5d, 0x01, 0x00, 0x00, 0x00, 0x00, // ..l...]...].....
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x0e, 0x00, // ................
+	0x00, 0x00, 0xc6, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x6a, 0x01, // ..............j.
+	0x00, 0x00, 0x6c, 0x01, 0x00, 0x00, 0x68, 0x01, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00, 0x0e, 0x00, // ..l...h...P.....
+	0x00, 0x00, 0x6f, 0x01, 0x00, 0x00, 0xba, 0x01, 0x00, 0x00, 0xba, 0x01, 0x00, 0x00, 0xba, 0x01, // ..o.............
+	0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xcc, 0x01, 0x00, 0x00, 0x01, 0x00, // ................
+	0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xc0, 0x01, 0x00, 0x00, 0xc6, 0x01, 0x00, 0x00, 0x6f, 0x01, // ..............o.
+	0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x73, 0x01, 0x00, 0x00, 0x55, 0x00, // ..A.......s...U.
+	0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x4f, 0x00, // ..V.......=...O.
+	0x00, 0x00, 0x74, 0x01, 0x00, 0x00, 0x73, 0x01, 0x00, 0x00, 0x4f, 0x00, 0x08, 0x00, 0x0e, 0x00, // ..t...s...O.....
+	0x00, 0x00, 0x75, 0x01, 0x00, 0x00, 0x74, 0x01, 0x00, 0x00, 0x74, 0x01, 0x00, 0x00, 0x00, 0x00, // ..u...t...t.....
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00, 0x0e, 0x00, // ................
+	0x00, 0x00, 0x77, 0x01, 0x00, 0x00, 0x75, 0x01, 0x00, 0x00, 0xcc, 0x01, 0x00, 0x00, 0x94, 0x00, // ..w...u.........
+	0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x7a, 0x01, 0x00, 0x00, 0x77, 0x01, 0x00, 0x00, 0x77, 0x01, // ......z...w...w.
+	0x00, 0x00, 0x7f, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x7b, 0x01, 0x00, 0x00, 0x7a, 0x01, // ..........{...z.
+	0x00, 0x00, 0x52, 0x00, 0x06, 0x00, 0x4f, 0x00, 0x00, 0x00, 0xd2, 0x01, 0x00, 0x00, 0x7b, 0x01, // ..R...O.......{.
+	0x00, 0x00, 0x2f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0xf0, 0x00, // ../.......A.....
+	0x00, 0x00, 0x7d, 0x01, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x56, 0x00, // ..}.......V...V.
+	0x00, 0x00, 0xea, 0x00, 0x07, 0x00, 0x50, 0x00, 0x00, 0x00, 0x7e, 0x01, 0x00, 0x00, 0x7d, 0x01, // ......P...~...}.
+	0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0xf9, 0x00, // ......r.........
+	0x02, 0x00, 0x7f, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x7f, 0x01, 0x00, 0x00, 0xf5, 0x00, // ................
+	0x07, 0x00, 0x4f, 0x00, 0x00, 0x00, 0xd5, 0x01, 0x00, 0x00, 0x2f, 0x01, 0x00, 0x00, 0x43, 0x01, // ..O......./...C.
+	0x00, 0x00, 0xd2, 0x01, 0x00, 0x00, 0x58, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x80, 0x01, // ......X.........
+	0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x80, 0x01, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x4f, 0x00, // ..............O.
+	0x00, 0x00, 0xd4, 0x01, 0x00, 0x00, 0x2f, 0x01, 0x00, 0x00, 0x35, 0x01, 0x00, 0x00, 0xd5, 0x01, // ....../...5.....
+	0x00, 0x00, 0x7f, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x81, 0x01, 0x00, 0x00, 0xf8, 0x00, // ................
+	0x02, 0x00, 0x81, 0x01, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x4f, 0x00, 0x00, 0x00, 0xd3, 0x01, // ..........O.....
+	0x00, 0x00, 0x2f, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xd4, 0x01, 0x00, 0x00, 0x80, 0x01, // ../.............
+	0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x84, 0x01, 0x00, 0x00, 0xf3, 0x00, // ..A.............
+	0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x2c, 0x01, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x84, 0x01, // ..V...,...>.....
+	0x00, 0x00, 0xd3, 0x01, 0x00, 0x00, 0xfd, 0x00, 0x01, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x00, // ..........8.....
+	0x00, 0x03,                                                                                     // ..
+};
+static const uint8_t cs_ps_update_dx11[1] =
+{
+	0x00,                                                                                           // .
+};
+static const uint8_t cs_ps_update_mtl[2317] =
+{
+	0x43, 0x53, 0x48, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0a, 0x75, // CSH............u
+	0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x02, 0x30, 0x00, 0x00, 0x30, 0x00, 0xdc, // _psParams.0..0..
+	0x1b, 0x0f, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, 0x65, 0x73, 0x2e, 0x40, 0x64, 0x61, 0x74, // ..particles.@dat
+	0x61, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x1b, 0x0d, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, // a.........counte
+	0x72, 0x2e, 0x40, 0x64, 0x61, 0x74, 0x61, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0xdc, 0x1b, 0x10, // r.@data.........
+	0x73, 0x6f, 0x72, 0x74, 0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2e, 0x40, 0x64, 0x61, 0x74, 0x61, // sortBuffer.@data
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x1b, 0x00, 0x01, 0x01, 0x00, 0x01, 0x00, 0x97, 0x08, // ................
+	0x00, 0x00, 0x23, 0x70, 0x72, 0x61, 0x67, 0x6d, 0x61, 0x20, 0x63, 0x6c, 0x61, 0x6e, 0x67, 0x20, // ..#pragma clang 
+	0x64, 0x69, 0x61, 0x67, 0x6e, 0x6f, 0x73, 0x74, 0x69, 0x63, 0x20, 0x69, 0x67, 0x6e, 0x6f, 0x72, // diagnostic ignor
+	0x65, 0x64, 0x20, 0x22, 0x2d, 0x57, 0x75, 0x6e, 0x75, 0x73, 0x65, 0x64, 0x2d, 0x76, 0x61, 0x72, // ed "-Wunused-var
+	0x69, 0x61, 0x62, 0x6c, 0x65, 0x22, 0x0a, 0x0a, 0x23, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, // iable"..#include
+	0x20, 0x3c, 0x6d, 0x65, 0x74, 0x61, 0x6c, 0x5f, 0x73, 0x74, 0x64, 0x6c, 0x69, 0x62, 0x3e, 0x0a, //  <metal_stdlib>.
+	0x23, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 0x3c, 0x73, 0x69, 0x6d, 0x64, 0x2f, 0x73, // #include <simd/s
+	0x69, 0x6d, 0x64, 0x2e, 0x68, 0x3e, 0x0a, 0x23, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, // imd.h>.#include 
+	0x3c, 0x6d, 0x65, 0x74, 0x61, 0x6c, 0x5f, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x3e, 0x0a, 0x0a, // <metal_atomic>..
+	0x75, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x70, 0x61, 0x63, 0x65, 0x20, // using namespace 
+	0x6d, 0x65, 0x74, 0x61, 0x6c, 0x3b, 0x0a, 0x0a, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x5f, // metal;..struct _
+	0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, // Global.{.    flo
+	0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x34, // at4 u_psParams[4
+	0x38, 0x5d, 0x3b, 0x0a, 0x7d, 0x3b, 0x0a, 0x0a, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x70, // 8];.};..struct p
+	0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, 0x65, 0x73, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, // articles.{.    f
+	0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x31, 0x5d, 0x3b, 0x0a, // loat4 _data[1];.
+	0x7d, 0x3b, 0x0a, 0x0a, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, // };..struct count
+	0x65, 0x72, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x64, // er.{.    uint _d
+	0x61, 0x74, 0x61, 0x5b, 0x31, 0x5d, 0x3b, 0x0a, 0x7d, 0x3b, 0x0a, 0x0a, 0x6b, 0x65, 0x72, 0x6e, // ata[1];.};..kern
+	0x65, 0x6c, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x78, 0x6c, 0x61, 0x74, 0x4d, 0x74, 0x6c, 0x4d, // el void xlatMtlM
+	0x61, 0x69, 0x6e, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x20, 0x5f, 0x47, 0x6c, // ain(constant _Gl
+	0x6f, 0x62, 0x61, 0x6c, 0x26, 0x20, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x20, 0x5b, 0x5b, 0x62, // obal& _mtl_u [[b
+	0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 0x30, 0x29, 0x5d, 0x5d, 0x2c, 0x20, 0x64, 0x65, 0x76, 0x69, // uffer(0)]], devi
+	0x63, 0x65, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, 0x65, 0x73, 0x26, 0x20, 0x70, 0x61, // ce particles& pa
+	0x72, 0x74, 0x69, 0x63, 0x6c, 0x65, 0x73, 0x5f, 0x31, 0x20, 0x5b, 0x5b, 0x62, 0x75, 0x66, 0x66, // rticles_1 [[buff
+	0x65, 0x72, 0x28, 0x31, 0x29, 0x5d, 0x5d, 0x2c, 0x20, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x20, // er(1)]], device 
+	0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, 0x65, 0x73, 0x26, 0x20, 0x73, 0x6f, 0x72, 0x74, 0x42, // particles& sortB
+	0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x5b, 0x5b, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 0x32, // uffer [[buffer(2
+	0x29, 0x5d, 0x5d, 0x2c, 0x20, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x20, 0x63, 0x6f, 0x75, 0x6e, // )]], device coun
+	0x74, 0x65, 0x72, 0x26, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x5f, 0x31, 0x20, 0x5b, // ter& counter_1 [
+	0x5b, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 0x33, 0x29, 0x5d, 0x5d, 0x2c, 0x20, 0x75, 0x69, // [buffer(3)]], ui
+	0x6e, 0x74, 0x33, 0x20, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, // nt3 gl_GlobalInv
+	0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x20, 0x5b, 0x5b, 0x74, 0x68, 0x72, 0x65, // ocationID [[thre
+	0x61, 0x64, 0x5f, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x69, 0x6e, 0x5f, 0x67, // ad_position_in_g
+	0x72, 0x69, 0x64, 0x5d, 0x5d, 0x29, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, // rid]]).{.    uin
+	0x74, 0x20, 0x5f, 0x33, 0x30, 0x30, 0x20, 0x3d, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x69, 0x6e, // t _300 = uint(in
+	0x74, 0x33, 0x28, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, // t3(gl_GlobalInvo
+	0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x29, 0x2e, 0x78, 0x29, 0x3b, 0x0a, 0x20, 0x20, // cationID).x);.  
+	0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x33, 0x30, 0x33, 0x20, 0x3d, 0x20, //   float4 _303 = 
+	0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x28, 0x33, 0x2e, 0x34, 0x30, 0x32, 0x38, 0x32, 0x33, 0x30, // float4(3.4028230
+	0x36, 0x30, 0x37, 0x33, 0x37, 0x30, 0x39, 0x36, 0x35, 0x32, 0x35, 0x30, 0x38, 0x33, 0x36, 0x33, // 6073709652508363
+	0x33, 0x33, 0x35, 0x35, 0x39, 0x30, 0x30, 0x31, 0x65, 0x2b, 0x33, 0x38, 0x2c, 0x20, 0x66, 0x6c, // 33559001e+38, fl
+	0x6f, 0x61, 0x74, 0x28, 0x5f, 0x33, 0x30, 0x30, 0x29, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, // oat(_300), 0.0, 
+	0x30, 0x2e, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, // 0.0);.    float4
+	0x20, 0x5f, 0x34, 0x36, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x5f, //  _467;.    if (_
+	0x33, 0x30, 0x30, 0x20, 0x3c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, // 300 < uint(_mtl_
+	0x75, 0x2e, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x30, 0x5d, 0x2e, // u.u_psParams[0].
+	0x77, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // w)).    {.      
+	0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x33, 0x31, 0x31, 0x20, 0x3d, 0x20, 0x5f, 0x33, //   uint _311 = _3
+	0x30, 0x30, 0x20, 0x2a, 0x20, 0x34, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 00 * 4u;.       
+	0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x33, 0x31, 0x34, 0x20, 0x3d, 0x20, 0x70, //  float4 _314 = p
+	0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, 0x65, 0x73, 0x5f, 0x31, 0x2e, 0x5f, 0x64, 0x61, 0x74, 0x61, // articles_1._data
+	0x5b, 0x5f, 0x33, 0x31, 0x31, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // [_311];.        
+	0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x33, 0x31, 0x37, 0x20, 0x3d, 0x20, 0x28, 0x5f, 0x33, 0x30, // uint _317 = (_30
+	0x30, 0x20, 0x2a, 0x20, 0x34, 0x75, 0x29, 0x20, 0x2b, 0x20, 0x31, 0x75, 0x3b, 0x0a, 0x20, 0x20, // 0 * 4u) + 1u;.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x33, 0x31, //       float4 _31
+	0x39, 0x20, 0x3d, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, 0x65, 0x73, 0x5f, 0x31, 0x2e, // 9 = particles_1.
+	0x5f, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x5f, 0x33, 0x31, 0x37, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, // _data[_317];.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x34, 0x36, 0x38, //      float4 _468
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x5f, 0x33, // ;.        if (_3
+	0x31, 0x34, 0x2e, 0x77, 0x20, 0x3c, 0x3d, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, // 14.w <= 1.0).   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //      {.         
+	0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x33, 0x33, 0x31, 0x20, 0x3d, 0x20, //    float _331 = 
+	0x5f, 0x33, 0x31, 0x34, 0x2e, 0x77, 0x20, 0x2b, 0x20, 0x28, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, // _314.w + (_mtl_u
+	0x2e, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x30, 0x5d, 0x2e, 0x78, // .u_psParams[0].x
+	0x20, 0x2a, 0x20, 0x5f, 0x33, 0x31, 0x39, 0x2e, 0x77, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, //  * _319.w);.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, 0x65, //         particle
+	0x73, 0x5f, 0x31, 0x2e, 0x5f, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x5f, 0x33, 0x30, 0x30, 0x20, 0x2a, // s_1._data[_300 *
+	0x20, 0x34, 0x75, 0x5d, 0x20, 0x3d, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x28, 0x5f, 0x33, //  4u] = float4(_3
+	0x31, 0x34, 0x2e, 0x78, 0x79, 0x7a, 0x2c, 0x20, 0x5f, 0x33, 0x33, 0x31, 0x29, 0x3b, 0x0a, 0x20, // 14.xyz, _331);. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, //            float
+	0x34, 0x20, 0x5f, 0x34, 0x36, 0x39, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 4 _469;.        
+	0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x5f, 0x33, 0x33, 0x31, 0x20, 0x3c, 0x3d, 0x20, //     if (_331 <= 
+	0x31, 0x2e, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 1.0).           
+	0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  {.             
+	0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x34, 0x30, 0x34, 0x20, 0x3d, 0x20, //    float _404 = 
+	0x66, 0x61, 0x73, 0x74, 0x3a, 0x3a, 0x63, 0x6c, 0x61, 0x6d, 0x70, 0x28, 0x5f, 0x33, 0x33, 0x31, // fast::clamp(_331
+	0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x20, 0x2a, 0x20, 0x33, 0x31, // , 0.0, 1.0) * 31
+	0x2e, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // .0;.            
+	0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x34, 0x30, 0x37, 0x20, 0x3d, 0x20, 0x69, //     int _407 = i
+	0x6e, 0x74, 0x28, 0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x28, 0x5f, 0x34, 0x30, 0x34, 0x29, 0x29, 0x3b, // nt(floor(_404));
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // .               
+	0x20, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x34, 0x31, 0x36, 0x20, 0x3d, 0x20, 0x36, 0x34, 0x20, 0x2b, //  int _416 = 64 +
+	0x20, 0x5f, 0x34, 0x30, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  _407;.         
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x34, 0x31, 0x39, 0x20, //        int _419 
+	0x3d, 0x20, 0x36, 0x34, 0x20, 0x2b, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x28, 0x5f, 0x34, 0x30, 0x37, // = 64 + min((_407
+	0x20, 0x2b, 0x20, 0x31, 0x29, 0x2c, 0x20, 0x33, 0x31, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, //  + 1), 31);.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, //             floa
+	0x74, 0x20, 0x5f, 0x34, 0x34, 0x32, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x78, 0x28, 0x5f, 0x6d, 0x74, // t _442 = mix(_mt
+	0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x5f, // l_u.u_psParams[_
+	0x34, 0x31, 0x36, 0x20, 0x2f, 0x20, 0x34, 0x5d, 0x5b, 0x5f, 0x34, 0x31, 0x36, 0x20, 0x25, 0x20, // 416 / 4][_416 % 
+	0x34, 0x5d, 0x2c, 0x20, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x70, 0x73, 0x50, // 4], _mtl_u.u_psP
+	0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x5f, 0x34, 0x31, 0x39, 0x20, 0x2f, 0x20, 0x34, 0x5d, 0x5b, // arams[_419 / 4][
+	0x5f, 0x34, 0x31, 0x39, 0x20, 0x25, 0x20, 0x34, 0x5d, 0x2c, 0x20, 0x66, 0x72, 0x61, 0x63, 0x74, // _419 % 4], fract
+	0x28, 0x5f, 0x34, 0x30, 0x34, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // (_404));.       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x20, //          float3 
+	0x5f, 0x33, 0x37, 0x35, 0x20, 0x3d, 0x20, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, // _375 = _mtl_u.u_
+	0x70, 0x73, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x5b, 0x36, 0x5d, 0x2e, 0x78, 0x79, 0x7a, 0x20, // psParams[6].xyz 
+	0x2d, 0x20, 0x6d, 0x69, 0x78, 0x28, 0x6d, 0x69, 0x78, 0x28, 0x5f, 0x33, 0x31, 0x34, 0x2e, 0x78, // - mix(mix(_314.x
+	0x79, 0x7a, 0x2c, 0x20, 0x5f, 0x33, 0x31, 0x39, 0x2e, 0x78, 0x79, 0x7a, 0x2c, 0x20, 0x66, 0x6c, // yz, _319.xyz, fl
+	0x6f, 0x61, 0x74, 0x33, 0x28, 0x5f, 0x34, 0x34, 0x32, 0x29, 0x29, 0x2c, 0x20, 0x6d, 0x69, 0x78, // oat3(_442)), mix
+	0x28, 0x5f, 0x33, 0x31, 0x39, 0x2e, 0x78, 0x79, 0x7a, 0x2c, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, // (_319.xyz, parti
+	0x63, 0x6c, 0x65, 0x73, 0x5f, 0x31, 0x2e, 0x5f, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x28, 0x5f, 0x33, // cles_1._data[(_3
+	0x30, 0x30, 0x20, 0x2a, 0x20, 0x34, 0x75, 0x29, 0x20, 0x2b, 0x20, 0x32, 0x75, 0x5d, 0x2e, 0x78, // 00 * 4u) + 2u].x
+	0x79, 0x7a, 0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x5f, 0x34, 0x34, 0x32, 0x29, // yz, float3(_442)
+	0x29, 0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x5f, 0x34, 0x34, 0x32, 0x29, 0x29, // ), float3(_442))
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ;.              
+	0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x34, 0x36, 0x36, 0x20, 0x3d, 0x20, //   float4 _466 = 
+	0x5f, 0x33, 0x30, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // _303;.          
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x34, 0x36, 0x36, 0x2e, 0x78, 0x20, 0x3d, 0x20, 0x2d, //       _466.x = -
+	0x64, 0x6f, 0x74, 0x28, 0x5f, 0x33, 0x37, 0x35, 0x2c, 0x20, 0x5f, 0x33, 0x37, 0x35, 0x29, 0x3b, // dot(_375, _375);
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // .               
+	0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x33, 0x38, 0x32, 0x20, 0x3d, 0x20, 0x61, 0x74, 0x6f, //  uint _382 = ato
+	0x6d, 0x69, 0x63, 0x5f, 0x66, 0x65, 0x74, 0x63, 0x68, 0x5f, 0x61, 0x64, 0x64, 0x5f, 0x65, 0x78, // mic_fetch_add_ex
+	0x70, 0x6c, 0x69, 0x63, 0x69, 0x74, 0x28, 0x28, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x20, 0x61, // plicit((device a
+	0x74, 0x6f, 0x6d, 0x69, 0x63, 0x5f, 0x75, 0x69, 0x6e, 0x74, 0x2a, 0x29, 0x26, 0x63, 0x6f, 0x75, // tomic_uint*)&cou
+	0x6e, 0x74, 0x65, 0x72, 0x5f, 0x31, 0x2e, 0x5f, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x30, 0x5d, 0x2c, // nter_1._data[0],
+	0x20, 0x31, 0x75, 0x2c, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x5f, 0x6f, 0x72, 0x64, 0x65, //  1u, memory_orde
+	0x72, 0x5f, 0x72, 0x65, 0x6c, 0x61, 0x78, 0x65, 0x64, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, // r_relaxed);.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x34, 0x36, 0x39, //             _469
+	0x20, 0x3d, 0x20, 0x5f, 0x34, 0x36, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  = _466;.       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //      }.         
+	0x20, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //    else.        
+	0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //     {.          
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x34, 0x36, 0x39, 0x20, 0x3d, 0x20, 0x5f, 0x33, 0x30, //       _469 = _30
+	0x33, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, // 3;.            }
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x34, 0x36, // .            _46
+	0x38, 0x20, 0x3d, 0x20, 0x5f, 0x34, 0x36, 0x39, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 8 = _469;.      
+	0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, //   }.        else
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, // .        {.     
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x34, 0x36, 0x38, 0x20, 0x3d, 0x20, 0x5f, 0x33, //        _468 = _3
+	0x30, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, // 03;.        }.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x34, 0x36, 0x37, 0x20, 0x3d, 0x20, 0x5f, 0x34, 0x36, //       _467 = _46
+	0x38, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x73, // 8;.    }.    els
+	0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // e.    {.        
+	0x5f, 0x34, 0x36, 0x37, 0x20, 0x3d, 0x20, 0x5f, 0x33, 0x30, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x20, // _467 = _303;.   
+	0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x6f, 0x72, 0x74, 0x42, 0x75, 0x66, 0x66, 0x65, //  }.    sortBuffe
+	0x72, 0x2e, 0x5f, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x5f, 0x33, 0x30, 0x30, 0x5d, 0x20, 0x3d, 0x20, // r._data[_300] = 
+	0x5f, 0x34, 0x36, 0x37, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x00, 0x00, 0x10, 0x03,                   // _467;.}......
+};
+extern const uint8_t* cs_ps_update_pssl;
+extern const uint32_t cs_ps_update_pssl_size;
@@ -0,0 +1,52 @@
+/*
+ * Copyright 2011-2020 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx#license-bsd-2-clause
+ */
+
+#include "bgfx_compute.sh"
+#include "uniforms.sh"
+
+BUFFER_RW(particles,  vec4, 0);
+BUFFER_WR(sortBuffer, vec4, 1);
+BUFFER_RW(counter,    uint, 2);
+
+NUM_THREADS(threadGroupSize, 1, 1)
+void main()
+{
+	uint idx = gl_GlobalInvocationID.x;
+
+	// Dead particles and padding up to power of two sort to the end.
+	vec4 entry = vec4(3.402823e+38, float(idx), 0.0, 0.0);
+
+	if (idx < u_maxParticles)
+	{
+		vec4 p0 = particles[idx*PARTICLE_STRIDE + 0];
+		vec4 p1 = particles[idx*PARTICLE_STRIDE + 1];
+
+		if (p0.w <= 1.0)
+		{
+			float life = p0.w + u_dt * p1.w;
+			particles[idx*PARTICLE_STRIDE] = vec4(p0.xyz, life);
+
+			if (life <= 1.0)
+			{
+				vec4 p2 = particles[idx*PARTICLE_STRIDE + 2];
+
+				float tt  = ease(EASE_POS, life);
+				vec3  pp0 = mix(p0.xyz, p1.xyz, tt);
+				vec3  pp1 = mix(p1.xyz, p2.xyz, tt);
+				vec3  pos = mix(pp0, pp1, tt);
+
+				vec3 delta = u_eye - pos;
+
+				// Negated squared distance sorts particles back to front.
+				entry.x = -dot(delta, delta);
+
+				uint prev;
+				atomicFetchAndAdd(counter[0], 1u, prev);
+			}
+		}
+	}
+
+	sortBuffer[idx] = entry;
+}
@@ -12,14 +12,52 @@
 
 #include <bx/easing.h>
 #include <bx/handlealloc.h>
+#include <bx/semaphore.h>
+#include <bx/simd_t.h>
+#include <bx/sort.h>
+#include <bx/thread.h>
+#include <bx/timer.h>
+
+#include <thread> // std::thread::hardware_concurrency
 
 #include "vs_particle.bin.h"
 #include "fs_particle.bin.h"
+#include "vs_ps_instance.bin.h"
+#include "cs_ps_init.bin.h"
+#include "cs_ps_spawn.bin.h"
+#include "cs_ps_update.bin.h"
+#include "cs_ps_sort.bin.h"
+#include "cs_ps_instances.bin.h"
+#include "cs_ps_indirect.bin.h"
+
+// Same as BGFX_EMBEDDED_SHADER, without Direct3D 9 which has no compute shaders.
+#define PS_EMBEDDED_COMPUTE_SHADER(_name)                                                          \
+			{                                                                                      \
+				#_name,                                                                            \
+				{                                                                                  \
+					BGFX_EMBEDDED_SHADER_DXBC (bgfx::RendererType::Direct3D11, _name)              \
+					BGFX_EMBEDDED_SHADER_DXBC (bgfx::RendererType::Direct3D12, _name)              \
+					BGFX_EMBEDDED_SHADER_METAL(bgfx::RendererType::Metal,      _name)              \
+					BGFX_EMBEDDED_SHADER_ESSL (bgfx::RendererType::OpenGLES,   _name)              \
+					BGFX_EMBEDDED_SHADER_GLSL (bgfx::RendererType::OpenGL,     _name)              \
+					BGFX_EMBEDDED_SHADER_SPIRV(bgfx::RendererType::Vulkan,     _name)              \
+					BGFX_EMBEDDED_SHADER_SPIRV(bgfx::RendererType::WebGPU,     _name)              \
+					{ bgfx::RendererType::Noop,  (const uint8_t*)"CSH\x5\x0\x0\x0\x0\x0\x0", 10 }, \
+					{ bgfx::RendererType::Count, NULL, 0 }                                         \
+				}                                                                                  \
+			}
 
 static const bgfx::EmbeddedShader s_embeddedShaders[] =
 {
 	BGFX_EMBEDDED_SHADER(vs_particle),
 	BGFX_EMBEDDED_SHADER(fs_particle),
+	BGFX_EMBEDDED_SHADER(vs_ps_instance),
+	PS_EMBEDDED_COMPUTE_SHADER(cs_ps_init),
+	PS_EMBEDDED_COMPUTE_SHADER(cs_ps_spawn),
+	PS_EMBEDDED_COMPUTE_SHADER(cs_ps_update),
+	PS_EMBEDDED_COMPUTE_SHADER(cs_ps_sort),
+	PS_EMBEDDED_COMPUTE_SHADER(cs_ps_instances),
+	PS_EMBEDDED_COMPUTE_SHADER(cs_ps_indirect),
 
 	BGFX_EMBEDDED_SHADER_END()
 };
@@ -96,6 +134,15 @@ void EmitterUniforms::reset()
 
 namespace ps
 {
+#define PS_MAX_THREADS 8
+
+#define PS_GPU_NUM_PARAMS       48
+#define PS_GPU_EASE_LUT_OFFSET  16
+#define PS_GPU_EASE_LUT_SIZE    32
+#define PS_GPU_GROUP_SIZE       256
+#define PS_GPU_SPAWN_GROUP_SIZE 64
+
+	// Array of structures particle, used only by scalar reference path in benchmark mode.
 	struct Particle
 	{
 		bx::Vec3 start;
@@ -117,6 +164,106 @@ namespace ps
 		uint32_t idx;
 	};
 
+	static int32_t particleSortFn(const void* _lhs, const void* _rhs)
+	{
+		const ParticleSort& lhs = *(const ParticleSort*)_lhs;
+		const ParticleSort& rhs = *(const ParticleSort*)_rhs;
+		return lhs.dist > rhs.dist ? -1 : 1;
+	}
+
+	typedef void (*JobFn)(void* _userData, uint32_t _idx);
+
+	// Runs jobs on worker threads, calling thread picks jobs too.
+	struct JobPool
+	{
+		void init(uint32_t _numThreads)
+		{
+			m_numThreads = bx::uint32_min(_numThreads, PS_MAX_THREADS);
+			m_exit = false;
+
+			for (uint32_t ii = 0; ii < m_numThreads; ++ii)
+			{
+				m_thread[ii].init(threadFunc, this, 0, "ps");
+			}
+		}
+
+		void shutdown()
+		{
+			m_exit = true;
+			m_start.post(m_numThreads);
+
+			for (uint32_t ii = 0; ii < m_numThreads; ++ii)
+			{
+				m_thread[ii].shutdown();
+			}
+
+			m_numThreads = 0;
+		}
+
+		void run(JobFn _fn, void* _userData, uint32_t _num)
+		{
+			const uint32_t numWorkers = bx::uint32_min(m_numThreads, _num > 0 ? _num-1 : 0);
+
+			m_fn       = _fn;
+			m_userData = _userData;
+			m_num      = _num;
+			m_next     = 0;
+
+			m_start.post(numWorkers);
+
+			work();
+
+			for (uint32_t ii = 0; ii < numWorkers; ++ii)
+			{
+				m_done.wait();
+			}
+		}
+
+		void work()
+		{
+			for (;;)
+			{
+				const uint32_t idx = bx::atomicFetchAndAdd<uint32_t>(&m_next, 1);
+				if (idx >= m_num)
+				{
+					break;
+				}
+
+				m_fn(m_userData, idx);
+			}
+		}
+
+		static int32_t threadFunc(bx::Thread* _thread, void* _userData)
+		{
+			BX_UNUSED(_thread);
+			JobPool* pool = (JobPool*)_userData;
+
+			for (;;)
+			{
+				pool->m_start.wait();
+
+				if (pool->m_exit)
+				{
+					return 0;
+				}
+
+				pool->work();
+				pool->m_done.post();
+			}
+		}
+
+		bx::Thread    m_thread[PS_MAX_THREADS];
+		bx::Semaphore m_start;
+		bx::Semaphore m_done;
+
+		JobFn    m_fn;
+		void*    m_userData;
+		uint32_t m_num;
+		uint32_t m_next;
+		uint32_t m_numThreads;
+		bool     m_exit;
+	};
+
 	inline uint32_t toAbgr(const float* _rgba)
 	{
 		return 0
@@ -182,7 +329,7 @@ namespace ps
 
 	struct Emitter
 	{
-		void create(EmitterShape::Enum _shape, EmitterDirection::Enum _direction, uint32_t _maxParticles);
+		void create(EmitterShape::Enum _shape, EmitterDirection::Enum _direction, uint32_t _maxParticles, EmitterSimulation::Enum _simulation);
 		void destroy();
 
 		void reset()
@@ -193,10 +340,108 @@ namespace ps
 			bx::memSet(&m_aabb, 0, sizeof(Aabb) );
 
 			m_rng.reset();
+
+			m_gpuSpawnStart = 0;
+			m_gpuSpawnCount = 0;
+			m_gpuSeed       = 0;
+			m_gpuDt         = 0.0f;
+			m_gpuInit       = false;
+		}
+
+		uint32_t calcNumToSpawn(float _dt)
+		{
+			const float timePerParticle = 1.0f/m_uniforms.m_particlesPerSecond;
+			m_dt += _dt;
+			const uint32_t numParticles = uint32_t(m_dt / timePerParticle);
+			m_dt -= numParticles * timePerParticle;
+
+			return numParticles;
+		}
+
+		void updateGpu(float _dt)
+		{
+			// Simulation is dispatched by render, here only time and number of particles to spawn
+			// are accumulated.
+			m_gpuDt += _dt;
+
+			if (0 < m_uniforms.m_particlesPerSecond)
+			{
+				m_gpuSpawnCount = bx::uint32_min(m_gpuSpawnCount + calcNumToSpawn(_dt), m_max);
+			}
+
+			// Particles are not read back, bounds are estimated from emitter uniforms.
+			const float gravity = 9.81f * bx::abs(m_uniforms.m_gravityScale) * bx::square(m_uniforms.m_lifeSpan[1]);
+			const float extent  = 0.0f
+				+ bx::max(m_uniforms.m_offsetStart[1], 0.0f)
+				+ bx::max(m_uniforms.m_offsetEnd[1],   0.0f)
+				+ bx::max(m_uniforms.m_scaleStart[1],  m_uniforms.m_scaleEnd[1])
+				;
+			const bx::Vec3 pos = bx::load<bx::Vec3>(m_uniforms.m_position);
+
+			m_aabb.min = bx::sub(pos, { extent, extent + gravity, extent });
+			m_aabb.max = bx::add(pos, extent);
 		}
 
 		void update(float _dt)
 		{
+			if (EmitterSimulation::Gpu == m_simulation)
+			{
+				updateGpu(_dt);
+				return;
+			}
+
+			// Particle streams are padded to multiple of 4, life is advanced four at a time.
+			const bx::simd128_t dt = bx::simd_splat<bx::simd128_t>(_dt);
+
+			for (uint32_t ii = 0, num = m_num; ii < num; ii += 4)
+			{
+				const bx::simd128_t life        = bx::simd_ld<bx::simd128_t>(&m_life[ii]);
+				const bx::simd128_t invLifeSpan = bx::simd_ld<bx::simd128_t>(&m_invLifeSpan[ii]);
+				bx::simd_st(&m_life[ii], bx::simd_madd(dt, invLifeSpan, life) );
+			}
+
+			uint32_t num = m_num;
+			for (uint32_t ii = 0; ii < num;)
+			{
+				if (m_life[ii] > 1.0f)
+				{
+					--num;
+					move(ii, num);
+				}
+				else
+				{
+					++ii;
+				}
+			}
+
+			m_num = num;
+
+			if (0 < m_uniforms.m_particlesPerSecond)
+			{
+				spawn(_dt, m_num, NULL);
+			}
+		}
+
+		// Runs scalar update, as it was done before particles were stored as structure of
+		// arrays, on array of structures copy of particles. Emitter state is not modified, only
+		// time spent updating copy is returned.
+		int64_t updateReference(float _dt, bx::AllocatorI* _allocator)
+		{
+			if (NULL == m_particles)
+			{
+				m_particles = (Particle*)BX_ALLOC(_allocator, m_max*sizeof(Particle) );
+			}
+
+			for (uint32_t ii = 0, num = m_num; ii < num; ++ii)
+			{
+				load(ii, m_particles[ii]);
+			}
+
+			const float      dt  = m_dt;
+			const bx::RngMwc rng = m_rng;
+
+			const int64_t start = bx::getHPCounter();
+
 			uint32_t num = m_num;
 			for (uint32_t ii = 0; ii < num; ++ii)
 			{
@@ -215,15 +460,68 @@ namespace ps
 				}
 			}
 
-			m_num = num;
-
 			if (0 < m_uniforms.m_particlesPerSecond)
 			{
-				spawn(_dt);
+				spawn(_dt, num, m_particles);
 			}
+
+			const int64_t elapsed = bx::getHPCounter() - start;
+
+			m_dt  = dt;
+			m_rng = rng;
+
+			return elapsed;
 		}
 
-		void spawn(float _dt)
+		void load(uint32_t _idx, Particle& _outParticle) const
+		{
+			_outParticle.start  = { m_start[0][_idx], m_start[1][_idx], m_start[2][_idx] };
+			_outParticle.end[0] = { m_end0[0][_idx],  m_end0[1][_idx],  m_end0[2][_idx]  };
+			_outParticle.end[1] = { m_end1[0][_idx],  m_end1[1][_idx],  m_end1[2][_idx]  };
+			_outParticle.blendStart = m_blendStart[_idx];
+			_outParticle.blendEnd   = m_blendEnd[_idx];
+			_outParticle.scaleStart = m_scaleStart[_idx];
+			_outParticle.scaleEnd   = m_scaleEnd[_idx];
+			bx::memCopy(_outParticle.rgba, &m_rgba[_idx*5], 5*sizeof(uint32_t) );
+			_outParticle.life     = m_life[_idx];
+			_outParticle.lifeSpan = 1.0f/m_invLifeSpan[_idx];
+		}
+
+		void store(uint32_t _idx, const Particle& _particle)
+		{
+			m_start[0][_idx] = _particle.start.x;
+			m_start[1][_idx] = _particle.start.y;
+			m_start[2][_idx] = _particle.start.z;
+			m_end0[0][_idx]  = _particle.end[0].x;
+			m_end0[1][_idx]  = _particle.end[0].y;
+			m_end0[2][_idx]  = _particle.end[0].z;
+			m_end1[0][_idx]  = _particle.end[1].x;
+			m_end1[1][_idx]  = _particle.end[1].y;
+			m_end1[2][_idx]  = _particle.end[1].z;
+			m_blendStart[_idx] = _particle.blendStart;
+			m_blendEnd[_idx]   = _particle.blendEnd;
+			m_scaleStart[_idx] = _particle.scaleStart;
+			m_scaleEnd[_idx]   = _particle.scaleEnd;
+			bx::memCopy(&m_rgba[_idx*5], _particle.rgba, 5*sizeof(uint32_t) );
+			m_life[_idx]        = _particle.life;
+			m_invLifeSpan[_idx] = 1.0f/_particle.lifeSpan;
+		}
+
+		void move(uint32_t _dst, uint32_t _src)
+		{
+			if (_dst != _src)
+			{
+				for (uint32_t ii = 0; ii < BX_COUNTOF(m_stream); ++ii)
+				{
+					m_stream[ii][_dst] = m_stream[ii][_src];
+				}
+
+				bx::memCopy(&m_rgba[_dst*5], &m_rgba[_src*5], 5*sizeof(uint32_t) );
+			}
+		}
+
+		// Spawns into structure of arrays streams, or into _aos when it's not NULL.
+		void spawn(float _dt, uint32_t& _num, Particle* _aos)
 		{
 			float mtx[16];
 			bx::mtxSRT(mtx
@@ -233,20 +531,19 @@ namespace ps
 				);
 
 			const float timePerParticle = 1.0f/m_uniforms.m_particlesPerSecond;
-			m_dt += _dt;
-			const uint32_t numParticles = uint32_t(m_dt / timePerParticle);
-			m_dt -= numParticles * timePerParticle;
+			const uint32_t numParticles = calcNumToSpawn(_dt);
 
 			constexpr bx::Vec3 up = { 0.0f, 1.0f, 0.0f };
 
 			float time = 0.0f;
 			for (uint32_t ii = 0
-				; ii < numParticles && m_num < m_max
+				; ii < numParticles && _num < m_max
 				; ++ii
 				)
 			{
-				Particle& particle = m_particles[m_num];
-				m_num++;
+				Particle particle;
+				const uint32_t idx = _num;
+				_num++;
 
 				bx::Vec3 pos;
 				switch (m_shape)
@@ -318,11 +615,20 @@ namespace ps
 				particle.scaleStart = bx::lerp(m_uniforms.m_scaleStart[0], m_uniforms.m_scaleStart[1], bx::frnd(&m_rng) );
 				particle.scaleEnd   = bx::lerp(m_uniforms.m_scaleEnd[0],   m_uniforms.m_scaleEnd[1],   bx::frnd(&m_rng) );
 
+				if (NULL != _aos)
+				{
+					_aos[idx] = particle;
+				}
+				else
+				{
+					store(idx, particle);
+				}
+
 				time += timePerParticle;
 			}
 		}
 
-		uint32_t render(const float _uv[4], const float* _mtxView, const bx::Vec3& _eye, uint32_t _first, uint32_t _max, ParticleSort* _outSort, PosColorTexCoord0Vertex* _outVertices)
+		uint32_t render(const float _uv[4], const float* _mtxView, const bx::Vec3& _eye, uint32_t _first, uint32_t _max, uint32_t* _outKeys, uint32_t* _outValues, PosColorTexCoord0Vertex* _outVertices)
 		{
 			bx::EaseFn easeRgba  = bx::getEaseFunc(m_uniforms.m_easeRgba);
 			bx::EaseFn easePos   = bx::getEaseFunc(m_uniforms.m_easePos);
@@ -335,91 +641,203 @@ namespace ps
 				{ -bx::kInfinity, -bx::kInfinity, -bx::kInfinity },
 			};
 
-			for (uint32_t jj = 0, num = m_num, current = _first
-				; jj < num && current < _max
-				; ++jj, ++current
-				)
+			const bx::simd128_t eye[3] =
 			{
-				const Particle& particle = m_particles[jj];
-
-				const float ttPos   = easePos(particle.life);
-				const float ttScale = easeScale(particle.life);
-				const float ttBlend = bx::clamp(easeBlend(particle.life), 0.0f, 1.0f);
-				const float ttRgba  = bx::clamp(easeRgba(particle.life),  0.0f, 1.0f);
-
-				const bx::Vec3 p0  = bx::lerp(particle.start,  particle.end[0], ttPos);
-				const bx::Vec3 p1  = bx::lerp(particle.end[0], particle.end[1], ttPos);
-				const bx::Vec3 pos = bx::lerp(p0, p1, ttPos);
-
-				ParticleSort& sort = _outSort[current];
-				const bx::Vec3 tmp0 = bx::sub(_eye, pos);
-				sort.dist = bx::length(tmp0);
-				sort.idx  = current;
-
-				uint32_t idx = uint32_t(ttRgba*4);
-				float ttmod = bx::mod(ttRgba, 0.25f)/0.25f;
-				uint32_t rgbaStart = particle.rgba[idx];
-				uint32_t rgbaEnd   = particle.rgba[idx+1];
-
-				float rr = bx::lerp( ( (uint8_t*)&rgbaStart)[0], ( (uint8_t*)&rgbaEnd)[0], ttmod)/255.0f;
-				float gg = bx::lerp( ( (uint8_t*)&rgbaStart)[1], ( (uint8_t*)&rgbaEnd)[1], ttmod)/255.0f;
-				float bb = bx::lerp( ( (uint8_t*)&rgbaStart)[2], ( (uint8_t*)&rgbaEnd)[2], ttmod)/255.0f;
-				float aa = bx::lerp( ( (uint8_t*)&rgbaStart)[3], ( (uint8_t*)&rgbaEnd)[3], ttmod)/255.0f;
-
-				float blend = bx::lerp(particle.blendStart, particle.blendEnd, ttBlend);
-				float scale = bx::lerp(particle.scaleStart, particle.scaleEnd, ttScale);
-
-				uint32_t abgr = toAbgr(rr, gg, bb, aa);
-
-				const bx::Vec3 udir = { _mtxView[0]*scale, _mtxView[4]*scale, _mtxView[8]*scale };
-				const bx::Vec3 vdir = { _mtxView[1]*scale, _mtxView[5]*scale, _mtxView[9]*scale };
-
-				PosColorTexCoord0Vertex* vertex = &_outVertices[current*4];
-
-				const bx::Vec3 ul = bx::sub(bx::sub(pos, udir), vdir);
-				bx::store(&vertex->m_x, ul);
-				aabbExpand(aabb, ul);
-				vertex->m_abgr  = abgr;
-				vertex->m_u     = _uv[0];
-				vertex->m_v     = _uv[1];
-				vertex->m_blend = blend;
-				++vertex;
-
-				const bx::Vec3 ur = bx::sub(bx::add(pos, udir), vdir);
-				bx::store(&vertex->m_x, ur);
-				aabbExpand(aabb, ur);
-				vertex->m_abgr  = abgr;
-				vertex->m_u     = _uv[2];
-				vertex->m_v     = _uv[1];
-				vertex->m_blend = blend;
-				++vertex;
-
-				const bx::Vec3 br = bx::add(bx::add(pos, udir), vdir);
-				bx::store(&vertex->m_x, br);
-				aabbExpand(aabb, br);
-				vertex->m_abgr  = abgr;
-				vertex->m_u     = _uv[2];
-				vertex->m_v     = _uv[3];
-				vertex->m_blend = blend;
-				++vertex;
-
-				const bx::Vec3 bl = bx::add(bx::sub(pos, udir), vdir);
-				bx::store(&vertex->m_x, bl);
-				aabbExpand(aabb, bl);
-				vertex->m_abgr  = abgr;
-				vertex->m_u     = _uv[0];
-				vertex->m_v     = _uv[3];
-				vertex->m_blend = blend;
-				++vertex;
+				bx::simd_splat<bx::simd128_t>(_eye.x),
+				bx::simd_splat<bx::simd128_t>(_eye.y),
+				bx::simd_splat<bx::simd128_t>(_eye.z),
+			};
+
+			BX_ALIGN_DECL_16(float ttPos[4]);
+			BX_ALIGN_DECL_16(float position[3][4]);
+			BX_ALIGN_DECL_16(float distSq[4]);
+
+			const uint32_t num = bx::uint32_min(m_num, _max - _first);
+
+			for (uint32_t ii = 0; ii < num; ii += 4)
+			{
+				const uint32_t count = bx::uint32_min(num - ii, 4);
+
+				for (uint32_t jj = 0; jj < 4; ++jj)
+				{
+					ttPos[jj] = jj < count ? easePos(m_life[ii+jj]) : 0.0f;
+				}
+
+				// Position is evaluated for four particles at a time, and squared distance to eye is
+				// used as depth sort key.
+				const bx::simd128_t tt = bx::simd_ld<bx::simd128_t>(ttPos);
+				bx::simd128_t dist = bx::simd_zero<bx::simd128_t>();
+
+				for (uint32_t axis = 0; axis < 3; ++axis)
+				{
+					const bx::simd128_t start = bx::simd_ld<bx::simd128_t>(&m_start[axis][ii]);
+					const bx::simd128_t end0  = bx::simd_ld<bx::simd128_t>(&m_end0[axis][ii]);
+					const bx::simd128_t end1  = bx::simd_ld<bx::simd128_t>(&m_end1[axis][ii]);
+
+					const bx::simd128_t p0 = bx::simd_madd(bx::simd_sub(end0, start), tt, start);
+					const bx::simd128_t p1 = bx::simd_madd(bx::simd_sub(end1, end0),  tt, end0);
+					const bx::simd128_t pp = bx::simd_madd(bx::simd_sub(p1,   p0),    tt, p0);
+					bx::simd_st(position[axis], pp);
+
+					const bx::simd128_t delta = bx::simd_sub(eye[axis], pp);
+					dist = bx::simd_madd(delta, delta, dist);
+				}
+
+				bx::simd_st(distSq, dist);
+
+				for (uint32_t jj = 0; jj < count; ++jj)
+				{
+					const uint32_t src     = ii + jj;
+					const uint32_t current = _first + src;
+					const float    life    = m_life[src];
+
+					const float ttScale = easeScale(life);
+					const float ttBlend = bx::clamp(easeBlend(life), 0.0f, 1.0f);
+					const float ttRgba  = bx::clamp(easeRgba(life),  0.0f, 1.0f);
+
+					const bx::Vec3 pos = { position[0][jj], position[1][jj], position[2][jj] };
+
+					// Bits of non-negative float sort in same order as float. Inverted key sorts
+					// particles back to front.
+					_outKeys[current]   = ~bx::floatToBits(distSq[jj]);
+					_outValues[current] = current;
+
+					const uint32_t* rgba = &m_rgba[src*5];
+
+					uint32_t idx = uint32_t(ttRgba*4);
+					float ttmod = bx::mod(ttRgba, 0.25f)/0.25f;
+					uint32_t rgbaStart = rgba[idx];
+					uint32_t rgbaEnd   = rgba[idx+1];
+
+					float rr = bx::lerp( ( (uint8_t*)&rgbaStart)[0], ( (uint8_t*)&rgbaEnd)[0], ttmod)/255.0f;
+					float gg = bx::lerp( ( (uint8_t*)&rgbaStart)[1], ( (uint8_t*)&rgbaEnd)[1], ttmod)/255.0f;
+					float bb = bx::lerp( ( (uint8_t*)&rgbaStart)[2], ( (uint8_t*)&rgbaEnd)[2], ttmod)/255.0f;
+					float aa = bx::lerp( ( (uint8_t*)&rgbaStart)[3], ( (uint8_t*)&rgbaEnd)[3], ttmod)/255.0f;
+
+					float blend = bx::lerp(m_blendStart[src], m_blendEnd[src], ttBlend);
+					float scale = bx::lerp(m_scaleStart[src], m_scaleEnd[src], ttScale);
+
+					uint32_t abgr = toAbgr(rr, gg, bb, aa);
+
+					const bx::Vec3 udir = { _mtxView[0]*scale, _mtxView[4]*scale, _mtxView[8]*scale };
+					const bx::Vec3 vdir = { _mtxView[1]*scale, _mtxView[5]*scale, _mtxView[9]*scale };
+
+					PosColorTexCoord0Vertex* vertex = &_outVertices[current*4];
+
+					const bx::Vec3 ul = bx::sub(bx::sub(pos, udir), vdir);
+					bx::store(&vertex->m_x, ul);
+					aabbExpand(aabb, ul);
+					vertex->m_abgr  = abgr;
+					vertex->m_u     = _uv[0];
+					vertex->m_v     = _uv[1];
+					vertex->m_blend = blend;
+					++vertex;
+
+					const bx::Vec3 ur = bx::sub(bx::add(pos, udir), vdir);
+					bx::store(&vertex->m_x, ur);
+					aabbExpand(aabb, ur);
+					vertex->m_abgr  = abgr;
+					vertex->m_u     = _uv[2];
+					vertex->m_v     = _uv[1];
+					vertex->m_blend = blend;
+					++vertex;
+
+					const bx::Vec3 br = bx::add(bx::add(pos, udir), vdir);
+					bx::store(&vertex->m_x, br);
+					aabbExpand(aabb, br);
+					vertex->m_abgr  = abgr;
+					vertex->m_u     = _uv[2];
+					vertex->m_v     = _uv[3];
+					vertex->m_blend = blend;
+					++vertex;
+
+					const bx::Vec3 bl = bx::add(bx::sub(pos, udir), vdir);
+					bx::store(&vertex->m_x, bl);
+					aabbExpand(aabb, bl);
+					vertex->m_abgr  = abgr;
+					vertex->m_u     = _uv[0];
+					vertex->m_v     = _uv[3];
+					vertex->m_blend = blend;
+					++vertex;
+				}
 			}
 
 			m_aabb = aabb;
 
-			return m_num;
+			return num;
+		}
+
+		void getGpuParams(const float _uv[4], const bx::Vec3& _eye, float* _outParams) const
+		{
+			bx::memSet(_outParams, 0, PS_GPU_NUM_PARAMS*4*sizeof(float) );
+
+			float* params = _outParams;
+			params[ 0] = m_gpuDt;
+			params[ 1] = float(m_gpuSpawnCount);
+			params[ 2] = float(m_gpuSpawnStart);
+			params[ 3] = float(m_max);
+
+			params[ 4] = m_uniforms.m_offsetStart[0];
+			params[ 5] = m_uniforms.m_offsetStart[1];
+			params[ 6] = m_uniforms.m_offsetEnd[0];
+			params[ 7] = m_uniforms.m_offsetEnd[1];
+
+			params[ 8] = m_uniforms.m_lifeSpan[0];
+			params[ 9] = m_uniforms.m_lifeSpan[1];
+			params[10] = m_uniforms.m_gravityScale;
+			params[11] = float(m_gpuSeed);
+
+			params[12] = m_uniforms.m_blendStart[0];
+			params[13] = m_uniforms.m_blendStart[1];
+			params[14] = m_uniforms.m_blendEnd[0];
+			params[15] = m_uniforms.m_blendEnd[1];
+
+			params[16] = m_uniforms.m_scaleStart[0];
+			params[17] = m_uniforms.m_scaleStart[1];
+			params[18] = m_uniforms.m_scaleEnd[0];
+			params[19] = m_uniforms.m_scaleEnd[1];
+
+			params[20] = float(m_shape);
+			params[21] = float(m_direction);
+			params[22] = 0 < m_uniforms.m_particlesPerSecond ? 1.0f/m_uniforms.m_particlesPerSecond : 0.0f;
+			params[23] = float(m_gpuSortSize);
+
+			bx::store(&params[24], _eye);
+			bx::memCopy(&params[28], _uv, 4*sizeof(float) );
+
+			for (uint32_t ii = 0; ii < BX_COUNTOF(m_uniforms.m_rgba); ++ii)
+			{
+				const uint8_t* rgba = (const uint8_t*)&m_uniforms.m_rgba[ii];
+				float* color = &params[32 + ii*4];
+				color[0] = rgba[0]/255.0f;
+				color[1] = rgba[1]/255.0f;
+				color[2] = rgba[2]/255.0f;
+				color[3] = rgba[3]/255.0f;
+			}
+
+			// Easing functions are sampled into lookup table, since compute shaders can't call
+			// them.
+			const bx::EaseFn ease[] =
+			{
+				bx::getEaseFunc(m_uniforms.m_easePos),
+				bx::getEaseFunc(m_uniforms.m_easeScale),
+				bx::getEaseFunc(m_uniforms.m_easeBlend),
+				bx::getEaseFunc(m_uniforms.m_easeRgba),
+			};
+
+			float* lut = &params[PS_GPU_EASE_LUT_OFFSET*4];
+			for (uint32_t ii = 0; ii < BX_COUNTOF(ease); ++ii)
+			{
+				for (uint32_t jj = 0; jj < PS_GPU_EASE_LUT_SIZE; ++jj)
+				{
+					lut[ii*PS_GPU_EASE_LUT_SIZE + jj] = ease[ii](float(jj)/float(PS_GPU_EASE_LUT_SIZE-1) );
+				}
+			}
 		}
 
 		EmitterShape::Enum     m_shape;
 		EmitterDirection::Enum m_direction;
+		EmitterSimulation::Enum m_simulation;
 
 		float           m_dt;
 		bx::RngMwc      m_rng;
@@ -427,17 +845,56 @@ namespace ps
 
 		Aabb m_aabb;
 
+		// Particles are stored as structure of arrays, each stream is 16-byte aligned and padded
+		// to multiple of 4 particles.
+		float* m_life;
+		float* m_invLifeSpan;
+		float* m_start[3];
+		float* m_end0[3];
+		float* m_end1[3];
+		float* m_blendStart;
+		float* m_blendEnd;
+		float* m_scaleStart;
+		float* m_scaleEnd;
+		float* m_stream[15];
+		uint32_t* m_rgba;
+
+		void* m_data;
 		Particle* m_particles;
 		uint32_t m_num;
 		uint32_t m_max;
+
+		// Compute simulation state. Particles are spawned into ring buffer, alive particles are
+		// counted and sorted on GPU, and drawn with instance count written by compute shader.
+		bgfx::DynamicVertexBufferHandle m_gpuParticles;
+		bgfx::DynamicVertexBufferHandle m_gpuSort;
+		bgfx::DynamicVertexBufferHandle m_gpuInstances;
+		bgfx::DynamicIndexBufferHandle  m_gpuCounter;
+		bgfx::IndirectBufferHandle      m_gpuIndirect;
+		uint32_t m_gpuSortSize;
+		uint32_t m_gpuSpawnStart;
+		uint32_t m_gpuSpawnCount;
+		uint32_t m_gpuSeed;
+		float    m_gpuDt;
+		bool     m_gpuInit;
 	};
 
-	static int32_t particleSortFn(const void* _lhs, const void* _rhs)
+	struct ParticleSystem;
+
+	struct RenderJob
 	{
-		const ParticleSort& lhs = *(const ParticleSort*)_lhs;
-		const ParticleSort& rhs = *(const ParticleSort*)_rhs;
-		return lhs.dist > rhs.dist ? -1 : 1;
-	}
+		ParticleSystem* m_system;
+		const float* m_mtxView;
+		bx::Vec3 m_eye;
+		uint32_t m_max;
+		uint32_t* m_first;
+		uint32_t* m_keys;
+		uint32_t* m_values;
+		PosColorTexCoord0Vertex* m_vertices;
+	};
+
+	static void updateJob(void* _userData, uint32_t _idx);
+	static void renderJob(void* _userData, uint32_t _idx);
 
 	struct ParticleSystem
 	{
@@ -453,6 +910,13 @@ namespace ps
 
 			m_emitterAlloc = bx::createHandleAlloc(m_allocator, _maxEmitters);
 			m_emitter = (Emitter*)BX_ALLOC(m_allocator, sizeof(Emitter)*_maxEmitters);
+			m_first   = (uint32_t*)BX_ALLOC(m_allocator, sizeof(uint32_t)*_maxEmitters);
+
+			const uint32_t numThreads = std::thread::hardware_concurrency();
+			m_jobPool.init(numThreads > 1 ? numThreads-1 : 0);
+
+			bx::memSet(&m_stats, 0, sizeof(m_stats) );
+			m_benchmark = false;
 
 			PosColorTexCoord0Vertex::init();
 
@@ -467,6 +931,9 @@ namespace ps
 				, bgfx::TextureFormat::BGRA8
 				);
 
+			m_gpuInitialized = false;
+			m_gpuSupported   = false;
+
 			bgfx::RendererType::Enum type = bgfx::getRendererType();
 			m_particleProgram = bgfx::createProgram(
 				  bgfx::createEmbeddedShader(s_embeddedShaders, type, "vs_particle")
@@ -475,14 +942,151 @@ namespace ps
 				);
 		}
 
+		// Compute simulation resources are created when first GPU emitter is created. When any
+		// of embedded shaders is not available for current renderer GPU simulation is reported
+		// as unsupported.
+		bool initGpu()
+		{
+			if (m_gpuInitialized)
+			{
+				return m_gpuSupported;
+			}
+
+			m_gpuInitialized = true;
+
+			const uint64_t required = 0
+				| BGFX_CAPS_COMPUTE
+				| BGFX_CAPS_DRAW_INDIRECT
+				| BGFX_CAPS_INSTANCING
+				;
+			m_gpuSupported = required == (bgfx::getCaps()->supported & required);
+
+			if (!m_gpuSupported)
+			{
+				return false;
+			}
+
+			u_psParams    = bgfx::createUniform("u_psParams",    bgfx::UniformType::Vec4, PS_GPU_NUM_PARAMS);
+			u_psMtx       = bgfx::createUniform("u_psMtx",       bgfx::UniformType::Mat4);
+			u_psSort      = bgfx::createUniform("u_psSort",      bgfx::UniformType::Vec4);
+			u_psBillboard = bgfx::createUniform("u_psBillboard", bgfx::UniformType::Vec4, 2);
+
+			bgfx::RendererType::Enum type = bgfx::getRendererType();
+
+			m_gpuInitProgram      = bgfx::createProgram(bgfx::createEmbeddedShader(s_embeddedShaders, type, "cs_ps_init"),      true);
+			m_gpuSpawnProgram     = bgfx::createProgram(bgfx::createEmbeddedShader(s_embeddedShaders, type, "cs_ps_spawn"),     true);
+			m_gpuUpdateProgram    = bgfx::createProgram(bgfx::createEmbeddedShader(s_embeddedShaders, type, "cs_ps_update"),    true);
+			m_gpuSortProgram      = bgfx::createProgram(bgfx::createEmbeddedShader(s_embeddedShaders, type, "cs_ps_sort"),      true);
+			m_gpuInstancesProgram = bgfx::createProgram(bgfx::createEmbeddedShader(s_embeddedShaders, type, "cs_ps_instances"), true);
+			m_gpuIndirectProgram  = bgfx::createProgram(bgfx::createEmbeddedShader(s_embeddedShaders, type, "cs_ps_indirect"),  true);
+
+			m_gpuParticleProgram = BGFX_INVALID_HANDLE;
+
+			bgfx::ShaderHandle vsh = bgfx::createEmbeddedShader(s_embeddedShaders, type, "vs_ps_instance");
+			if (bgfx::isValid(vsh) )
+			{
+				m_gpuParticleProgram = bgfx::createProgram(
+					  vsh
+					, bgfx::createEmbeddedShader(s_embeddedShaders, type, "fs_particle")
+					, true
+					);
+			}
+
+			if (!bgfx::isValid(m_gpuInitProgram)
+			||  !bgfx::isValid(m_gpuSpawnProgram)
+			||  !bgfx::isValid(m_gpuUpdateProgram)
+			||  !bgfx::isValid(m_gpuSortProgram)
+			||  !bgfx::isValid(m_gpuInstancesProgram)
+			||  !bgfx::isValid(m_gpuIndirectProgram)
+			||  !bgfx::isValid(m_gpuParticleProgram) )
+			{
+				BX_WARN(false, "Failed to create particle compute shaders.");
+				destroyGpuPrograms();
+				m_gpuSupported = false;
+				return false;
+			}
+
+			bgfx::VertexLayout layout;
+			layout
+				.begin()
+				.add(bgfx::Attrib::Position, 3, bgfx::AttribType::Float)
+				.end();
+
+			static const float s_quadVertices[] =
+			{
+				-1.0f, -1.0f, 0.0f,
+				 1.0f, -1.0f, 0.0f,
+				 1.0f,  1.0f, 0.0f,
+				-1.0f,  1.0f, 0.0f,
+			};
+
+			static const uint16_t s_quadIndices[] =
+			{
+				0, 1, 2,
+				2, 3, 0,
+			};
+
+			m_gpuQuadVb = bgfx::createVertexBuffer(bgfx::makeRef(s_quadVertices, sizeof(s_quadVertices) ), layout);
+			m_gpuQuadIb = bgfx::createIndexBuffer(bgfx::makeRef(s_quadIndices, sizeof(s_quadIndices) ) );
+
+			return true;
+		}
+
+		void destroyGpuPrograms()
+		{
+			bgfx::ProgramHandle* programs[] =
+			{
+				&m_gpuParticleProgram,
+				&m_gpuIndirectProgram,
+				&m_gpuInstancesProgram,
+				&m_gpuSortProgram,
+				&m_gpuUpdateProgram,
+				&m_gpuSpawnProgram,
+				&m_gpuInitProgram,
+			};
+
+			for (uint32_t ii = 0; ii < BX_COUNTOF(programs); ++ii)
+			{
+				if (bgfx::isValid(*programs[ii]) )
+				{
+					bgfx::destroy(*programs[ii]);
+					*programs[ii] = BGFX_INVALID_HANDLE;
+				}
+			}
+
+			bgfx::destroy(u_psBillboard);
+			bgfx::destroy(u_psSort);
+			bgfx::destroy(u_psMtx);
+			bgfx::destroy(u_psParams);
+		}
+
+		void shutdownGpu()
+		{
+			if (m_gpuSupported)
+			{
+				bgfx::destroy(m_gpuQuadIb);
+				bgfx::destroy(m_gpuQuadVb);
+
+				destroyGpuPrograms();
+			}
+
+			m_gpuInitialized = false;
+			m_gpuSupported   = false;
+		}
+
 		void shutdown()
 		{
+			shutdownGpu();
+
 			bgfx::destroy(m_particleProgram);
 			bgfx::destroy(m_texture);
 			bgfx::destroy(s_texColor);
 
+			m_jobPool.shutdown();
+
 			bx::destroyHandleAlloc(m_allocator, m_emitterAlloc);
 			BX_FREE(m_allocator, m_emitter);
+			BX_FREE(m_allocator, m_first);
 
 			m_allocator = NULL;
 		}
@@ -516,28 +1120,186 @@ namespace ps
 
 		void update(float _dt)
 		{
+			// Reference runs first, from the same particles as regular update.
+			m_stats.m_referenceUpdateTime = 0;
+			if (m_benchmark)
+			{
+				for (uint16_t ii = 0, num = m_emitterAlloc->getNumHandles(); ii < num; ++ii)
+				{
+					const uint16_t idx = m_emitterAlloc->getHandleAt(ii);
+					Emitter& emitter = m_emitter[idx];
+
+					if (EmitterSimulation::Cpu == emitter.m_simulation)
+					{
+						m_stats.m_referenceUpdateTime += emitter.updateReference(_dt, m_allocator);
+					}
+				}
+			}
+
+			const int64_t start = bx::getHPCounter();
+
+			m_dt = _dt;
+			m_jobPool.run(updateJob, this, m_emitterAlloc->getNumHandles() );
+
 			uint32_t numParticles = 0;
 			for (uint16_t ii = 0, num = m_emitterAlloc->getNumHandles(); ii < num; ++ii)
 			{
 				const uint16_t idx = m_emitterAlloc->getHandleAt(ii);
-				Emitter& emitter = m_emitter[idx];
-				emitter.update(_dt);
-				numParticles += emitter.m_num;
+				numParticles += m_emitter[idx].m_num;
 			}
 
 			m_num = numParticles;
+
+			m_stats.m_numParticles = numParticles;
+			m_stats.m_updateTime   = bx::getHPCounter() - start;
+		}
+
+		void getUv(const Emitter& _emitter, float* _outUv) const
+		{
+			const Pack2D& pack = m_sprite.get(_emitter.m_uniforms.m_handle);
+			const float invTextureSize = 1.0f/SPRITE_TEXTURE_SIZE;
+			_outUv[0] =  pack.m_x                  * invTextureSize;
+			_outUv[1] =  pack.m_y                  * invTextureSize;
+			_outUv[2] = (pack.m_x + pack.m_width ) * invTextureSize;
+			_outUv[3] = (pack.m_y + pack.m_height) * invTextureSize;
+		}
+
+		void renderEmitter(const RenderJob& _job, uint16_t _ii)
+		{
+			const uint16_t idx = m_emitterAlloc->getHandleAt(_ii);
+			Emitter& emitter = m_emitter[idx];
+
+			if (EmitterSimulation::Gpu == emitter.m_simulation)
+			{
+				return;
+			}
+
+			float uv[4];
+			getUv(emitter, uv);
+
+			emitter.render(uv, _job.m_mtxView, _job.m_eye, _job.m_first[_ii], _job.m_max, _job.m_keys, _job.m_values, _job.m_vertices);
+		}
+
+		void renderGpu(uint8_t _view, const float* _mtxView, const bx::Vec3& _eye, Emitter& _emitter)
+		{
+			float uv[4];
+			getUv(_emitter, uv);
+
+			float params[PS_GPU_NUM_PARAMS*4];
+			_emitter.getGpuParams(uv, _eye, params);
+			bgfx::setUniform(u_psParams, params, PS_GPU_NUM_PARAMS);
+
+			const EmitterUniforms& uniforms = _emitter.m_uniforms;
+
+			float mtx[16];
+			bx::mtxSRT(mtx
+				, 1.0f, 1.0f, 1.0f
+				, uniforms.m_angle[0],    uniforms.m_angle[1],    uniforms.m_angle[2]
+				, uniforms.m_position[0], uniforms.m_position[1], uniforms.m_position[2]
+				);
+			bgfx::setUniform(u_psMtx, mtx);
+
+			const uint32_t numGroups = _emitter.m_gpuSortSize/PS_GPU_GROUP_SIZE;
+
+			if (!_emitter.m_gpuInit)
+			{
+				bgfx::setBuffer(0, _emitter.m_gpuParticles, bgfx::Access::Write);
+				bgfx::setBuffer(1, _emitter.m_gpuCounter,   bgfx::Access::Write);
+				bgfx::dispatch(_view, m_gpuInitProgram, numGroups);
+
+				_emitter.m_gpuInit = true;
+			}
+
+			if (0 < _emitter.m_gpuSpawnCount)
+			{
+				bgfx::setBuffer(0, _emitter.m_gpuParticles, bgfx::Access::Write);
+				bgfx::dispatch(_view
+					, m_gpuSpawnProgram
+					, (_emitter.m_gpuSpawnCount + PS_GPU_SPAWN_GROUP_SIZE - 1)/PS_GPU_SPAWN_GROUP_SIZE
+					);
+
+				_emitter.m_gpuSpawnStart = (_emitter.m_gpuSpawnStart + _emitter.m_gpuSpawnCount) % _emitter.m_max;
+				_emitter.m_gpuSeed       = (_emitter.m_gpuSeed       + _emitter.m_gpuSpawnCount) & 0xffffff;
+				_emitter.m_gpuSpawnCount = 0;
+			}
+
+			_emitter.m_gpuDt = 0.0f;
+
+			bgfx::setBuffer(0, _emitter.m_gpuParticles, bgfx::Access::ReadWrite);
+			bgfx::setBuffer(1, _emitter.m_gpuSort,      bgfx::Access::Write);
+			bgfx::setBuffer(2, _emitter.m_gpuCounter,   bgfx::Access::ReadWrite);
+			bgfx::dispatch(_view, m_gpuUpdateProgram, numGroups);
+
+			// Bitonic sort, O(log^2 n) dispatches per emitter.
+			for (uint32_t kk = 2; kk <= _emitter.m_gpuSortSize; kk <<= 1)
+			{
+				for (uint32_t jj = kk>>1; jj > 0; jj >>= 1)
+				{
+					const float sort[4] = { float(kk), float(jj), 0.0f, 0.0f };
+					bgfx::setUniform(u_psSort, sort);
+					bgfx::setBuffer(0, _emitter.m_gpuSort, bgfx::Access::ReadWrite);
+					bgfx::dispatch(_view, m_gpuSortProgram, numGroups);
+				}
+			}
+
+			bgfx::setBuffer(0, _emitter.m_gpuParticles, bgfx::Access::Read);
+			bgfx::setBuffer(1, _emitter.m_gpuSort,      bgfx::Access::Read);
+			bgfx::setBuffer(2, _emitter.m_gpuCounter,   bgfx::Access::Read);
+			bgfx::setBuffer(3, _emitter.m_gpuInstances, bgfx::Access::Write);
+			bgfx::dispatch(_view, m_gpuInstancesProgram, numGroups);
+
+			bgfx::setBuffer(0, _emitter.m_gpuCounter,  bgfx::Access::ReadWrite);
+			bgfx::setBuffer(1, _emitter.m_gpuIndirect, bgfx::Access::Write);
+			bgfx::dispatch(_view, m_gpuIndirectProgram);
+
+			const float billboard[8] =
+			{
+				_mtxView[0], _mtxView[4], _mtxView[8], 0.0f,
+				_mtxView[1], _mtxView[5], _mtxView[9], 0.0f,
+			};
+			bgfx::setUniform(u_psBillboard, billboard, 2);
+
+			bgfx::setState(0
+				| BGFX_STATE_WRITE_RGB
+				| BGFX_STATE_WRITE_A
+				| BGFX_STATE_DEPTH_TEST_LESS
+				| BGFX_STATE_CULL_CW
+				| BGFX_STATE_BLEND_NORMAL
+				);
+			bgfx::setVertexBuffer(0, m_gpuQuadVb);
+			bgfx::setIndexBuffer(m_gpuQuadIb);
+			bgfx::setInstanceDataBuffer(_emitter.m_gpuInstances, 0, _emitter.m_max);
+			bgfx::setTexture(0, s_texColor, m_texture);
+			bgfx::submit(_view, m_gpuParticleProgram, _emitter.m_gpuIndirect, 0);
 		}
 
 		void render(uint8_t _view, const float* _mtxView, const bx::Vec3& _eye)
 		{
+			for (uint16_t ii = 0, numEmitters = m_emitterAlloc->getNumHandles(); ii < numEmitters; ++ii)
+			{
+				const uint16_t idx = m_emitterAlloc->getHandleAt(ii);
+				Emitter& emitter = m_emitter[idx];
+
+				if (EmitterSimulation::Gpu == emitter.m_simulation)
+				{
+					renderGpu(_view, _mtxView, _eye, emitter);
+				}
+			}
+
 			if (0 != m_num)
 			{
 				bgfx::TransientVertexBuffer tvb;
 				bgfx::TransientIndexBuffer tib;
 
+				// Quads are indexed with 16-bit indices, sorted particles are submitted in batches
+				// of quads the indices can address.
+				const uint32_t maxQuadsPerBatch = (UINT16_MAX+1)/4;
+
 				const uint32_t numVertices = bgfx::getAvailTransientVertexBuffer(m_num*4, PosColorTexCoord0Vertex::ms_layout);
-				const uint32_t numIndices  = bgfx::getAvailTransientIndexBuffer(m_num*6);
-				const uint32_t max = bx::uint32_min(numVertices/4, numIndices/6);
+				const uint32_t numIndices  = bgfx::getAvailTransientIndexBuffer(bx::uint32_min(m_num, maxQuadsPerBatch)*6);
+
+				const uint32_t batch = bx::uint32_min(numIndices/6, maxQuadsPerBatch);
+				const uint32_t max   = 0 < batch ? bx::uint32_min(m_num, numVertices/4) : 0;
 				BX_WARN(m_num == max
 					, "Truncating transient buffer for particles to maximum available (requested %d, available %d)."
 					, m_num
@@ -546,79 +1308,141 @@ namespace ps
 
 				if (0 < max)
 				{
-					bgfx::allocTransientBuffers(&tvb
-						, PosColorTexCoord0Vertex::ms_layout
-						, max*4
-						, &tib
-						, max*6
-						);
-					PosColorTexCoord0Vertex* vertices = (PosColorTexCoord0Vertex*)tvb.data;
+					const int64_t start = bx::getHPCounter();
 
-					ParticleSort* particleSort = (ParticleSort*)BX_ALLOC(m_allocator, max*sizeof(ParticleSort) );
+					bgfx::allocTransientVertexBuffer(&tvb, max*4, PosColorTexCoord0Vertex::ms_layout);
+					bgfx::allocTransientIndexBuffer(&tib, bx::uint32_min(max, batch)*6);
+
+					uint32_t* keys       = (uint32_t*)BX_ALLOC(m_allocator, max*4*sizeof(uint32_t) );
+					uint32_t* values     = &keys[max];
+					uint32_t* tempKeys   = &keys[max*2];
+					uint32_t* tempValues = &keys[max*3];
+
+					PosColorTexCoord0Vertex* vertices = (PosColorTexCoord0Vertex*)BX_ALLOC(m_allocator, max*4*sizeof(PosColorTexCoord0Vertex) );
+
+					const uint16_t numEmitters = m_emitterAlloc->getNumHandles();
 
 					uint32_t pos = 0;
-					for (uint16_t ii = 0, numEmitters = m_emitterAlloc->getNumHandles(); ii < numEmitters; ++ii)
+					for (uint16_t ii = 0; ii < numEmitters; ++ii)
 					{
 						const uint16_t idx = m_emitterAlloc->getHandleAt(ii);
-						Emitter& emitter = m_emitter[idx];
+						m_first[ii] = pos;
+						pos += bx::uint32_min(m_emitter[idx].m_num, max - pos);
+					}
+
+					RenderJob job;
+					job.m_system   = this;
+					job.m_mtxView  = _mtxView;
+					job.m_eye      = _eye;
+					job.m_max      = max;
+					job.m_first    = m_first;
+					job.m_keys     = keys;
+					job.m_values   = values;
+					job.m_vertices = vertices;
+					m_jobPool.run(renderJob, &job, numEmitters);
+
+					m_stats.m_referenceSortTime = 0;
+					int64_t benchmarkTime = 0;
+					if (m_benchmark)
+					{
+						benchmarkTime = -bx::getHPCounter();
 
-						const Pack2D& pack = m_sprite.get(emitter.m_uniforms.m_handle);
-						const float invTextureSize = 1.0f/SPRITE_TEXTURE_SIZE;
-						const float uv[4] =
+						// Depth sort with float distance and qsort, as before radix sort.
+						ParticleSort* particleSort = (ParticleSort*)BX_ALLOC(m_allocator, max*sizeof(ParticleSort) );
+						for (uint32_t ii = 0; ii < max; ++ii)
 						{
-							 pack.m_x                  * invTextureSize,
-							 pack.m_y                  * invTextureSize,
-							(pack.m_x + pack.m_width ) * invTextureSize,
-							(pack.m_y + pack.m_height) * invTextureSize,
-						};
+							particleSort[ii].dist = bx::sqrt(bx::bitsToFloat(~keys[ii]) );
+							particleSort[ii].idx  = values[ii];
+						}
+
+						const int64_t referenceStart = bx::getHPCounter();
+
+						qsort(particleSort
+							, max
+							, sizeof(ParticleSort)
+							, particleSortFn
+							);
+
+						m_stats.m_referenceSortTime = bx::getHPCounter() - referenceStart;
 
-						pos += emitter.render(uv, _mtxView, _eye, pos, max, particleSort, vertices);
+						BX_FREE(m_allocator, particleSort);
+
+						benchmarkTime += bx::getHPCounter();
 					}
 
-					qsort(particleSort
-						, max
-						, sizeof(ParticleSort)
-						, particleSortFn
-						);
+					const int64_t sortStart = bx::getHPCounter();
 
-					uint16_t* indices = (uint16_t*)tib.data;
+					bx::radixSort(keys, tempKeys, values, tempValues, max);
+
+					const int64_t sortEnd = bx::getHPCounter();
+
+					// Quads are copied in sorted order, so every batch is a contiguous vertex range
+					// and all batches share the same indices.
+					PosColorTexCoord0Vertex* sorted = (PosColorTexCoord0Vertex*)tvb.data;
 					for (uint32_t ii = 0; ii < max; ++ii)
 					{
-						const ParticleSort& sort = particleSort[ii];
+						bx::memCopy(&sorted[ii*4], &vertices[values[ii]*4], 4*sizeof(PosColorTexCoord0Vertex) );
+					}
+
+					uint16_t* indices = (uint16_t*)tib.data;
+					for (uint32_t ii = 0, num = bx::uint32_min(max, batch); ii < num; ++ii)
+					{
 						uint16_t* index = &indices[ii*6];
-						uint16_t idx = (uint16_t)sort.idx;
-						index[0] = idx*4+0;
-						index[1] = idx*4+1;
-						index[2] = idx*4+2;
-						index[3] = idx*4+2;
-						index[4] = idx*4+3;
-						index[5] = idx*4+0;
+						uint16_t idx = uint16_t(ii*4);
+						index[0] = idx+0;
+						index[1] = idx+1;
+						index[2] = idx+2;
+						index[3] = idx+2;
+						index[4] = idx+3;
+						index[5] = idx+0;
 					}
 
-					BX_FREE(m_allocator, particleSort);
+					BX_FREE(m_allocator, vertices);
+					BX_FREE(m_allocator, keys);
 
-					bgfx::setState(0
-						| BGFX_STATE_WRITE_RGB
-						| BGFX_STATE_WRITE_A
-						| BGFX_STATE_DEPTH_TEST_LESS
-						| BGFX_STATE_CULL_CW
-						| BGFX_STATE_BLEND_NORMAL
-						);
-					bgfx::setVertexBuffer(0, &tvb);
-					bgfx::setIndexBuffer(&tib);
-					bgfx::setTexture(0, s_texColor, m_texture);
-					bgfx::submit(_view, m_particleProgram);
+					m_stats.m_sortTime   = sortEnd - sortStart;
+					m_stats.m_renderTime = bx::getHPCounter() - start - m_stats.m_sortTime - benchmarkTime;
+
+					// Batches are submitted back to front, draws with same sort key keep submit order.
+					for (uint32_t first = 0; first < max; first += batch)
+					{
+						const uint32_t num = bx::uint32_min(batch, max - first);
+
+						bgfx::setState(0
+							| BGFX_STATE_WRITE_RGB
+							| BGFX_STATE_WRITE_A
+							| BGFX_STATE_DEPTH_TEST_LESS
+							| BGFX_STATE_CULL_CW
+							| BGFX_STATE_BLEND_NORMAL
+							);
+						bgfx::setVertexBuffer(0, &tvb, first*4, num*4);
+						bgfx::setIndexBuffer(&tib, 0, num*6);
+						bgfx::setTexture(0, s_texColor, m_texture);
+						bgfx::submit(_view, m_particleProgram);
+					}
 				}
 			}
 		}
 
-		EmitterHandle createEmitter(EmitterShape::Enum _shape, EmitterDirection::Enum _direction, uint32_t _maxParticles)
+		bool isGpuSupported()
+		{
+			return initGpu();
+		}
+
+		EmitterHandle createEmitter(EmitterShape::Enum _shape, EmitterDirection::Enum _direction, uint32_t _maxParticles, EmitterSimulation::Enum _simulation)
 		{
 			EmitterHandle handle = { m_emitterAlloc->alloc() };
 
+			if (EmitterSimulation::Gpu == _simulation
+			&&  !initGpu() )
+			{
+				BX_WARN(false, "Compute particle simulation is not supported, falling back to CPU.");
+				_simulation = EmitterSimulation::Cpu;
+			}
+
 			if (UINT16_MAX != handle.idx)
 			{
-				m_emitter[handle.idx].create(_shape, _direction, _maxParticles);
+				m_emitter[handle.idx].create(_shape, _direction, _maxParticles, _simulation);
 			}
 
 			return handle;
@@ -675,25 +1499,135 @@ namespace ps
 		bgfx::TextureHandle m_texture;
 		bgfx::ProgramHandle m_particleProgram;
 
+		bgfx::UniformHandle u_psParams;
+		bgfx::UniformHandle u_psMtx;
+		bgfx::UniformHandle u_psSort;
+		bgfx::UniformHandle u_psBillboard;
+		bgfx::ProgramHandle m_gpuInitProgram;
+		bgfx::ProgramHandle m_gpuSpawnProgram;
+		bgfx::ProgramHandle m_gpuUpdateProgram;
+		bgfx::ProgramHandle m_gpuSortProgram;
+		bgfx::ProgramHandle m_gpuInstancesProgram;
+		bgfx::ProgramHandle m_gpuIndirectProgram;
+		bgfx::ProgramHandle m_gpuParticleProgram;
+		bgfx::VertexBufferHandle m_gpuQuadVb;
+		bgfx::IndexBufferHandle  m_gpuQuadIb;
+		bool m_gpuInitialized;
+		bool m_gpuSupported;
+
+		JobPool m_jobPool;
+		uint32_t* m_first;
+		float m_dt;
+
+		PsStats m_stats;
+		bool m_benchmark;
 		uint32_t m_num;
 	};
 
 	static ParticleSystem s_ctx;
 
-	void Emitter::create(EmitterShape::Enum _shape, EmitterDirection::Enum _direction, uint32_t _maxParticles)
+	static void updateJob(void* _userData, uint32_t _idx)
+	{
+		ParticleSystem* ps = (ParticleSystem*)_userData;
+		const uint16_t idx = ps->m_emitterAlloc->getHandleAt(uint16_t(_idx) );
+		ps->m_emitter[idx].update(ps->m_dt);
+	}
+
+	static void renderJob(void* _userData, uint32_t _idx)
+	{
+		const RenderJob& job = *(const RenderJob*)_userData;
+		job.m_system->renderEmitter(job, uint16_t(_idx) );
+	}
+
+	void Emitter::create(EmitterShape::Enum _shape, EmitterDirection::Enum _direction, uint32_t _maxParticles, EmitterSimulation::Enum _simulation)
 	{
 		reset();
 
-		m_shape     = _shape;
-		m_direction = _direction;
-		m_max       = _maxParticles;
-		m_particles = (Particle*)BX_ALLOC(s_ctx.m_allocator, m_max*sizeof(Particle) );
+		m_shape      = _shape;
+		m_direction  = _direction;
+		m_simulation = _simulation;
+		m_max        = _maxParticles;
+		m_data       = NULL;
+		m_particles  = NULL;
+
+		if (EmitterSimulation::Gpu == m_simulation)
+		{
+			bgfx::VertexLayout computeLayout;
+			computeLayout
+				.begin()
+				.add(bgfx::Attrib::TexCoord0, 4, bgfx::AttribType::Float)
+				.end();
+
+			bgfx::VertexLayout instanceLayout;
+			instanceLayout
+				.begin()
+				.add(bgfx::Attrib::TexCoord0, 4, bgfx::AttribType::Float)
+				.add(bgfx::Attrib::TexCoord1, 4, bgfx::AttribType::Float)
+				.add(bgfx::Attrib::TexCoord2, 4, bgfx::AttribType::Float)
+				.add(bgfx::Attrib::TexCoord3, 4, bgfx::AttribType::Float)
+				.end();
+
+			m_gpuSortSize  = bx::uint32_max(bx::uint32_nextpow2(m_max), PS_GPU_GROUP_SIZE);
+			m_gpuParticles = bgfx::createDynamicVertexBuffer(m_max*4,      computeLayout,  BGFX_BUFFER_COMPUTE_READ_WRITE);
+			m_gpuSort      = bgfx::createDynamicVertexBuffer(m_gpuSortSize, computeLayout,  BGFX_BUFFER_COMPUTE_READ_WRITE);
+			m_gpuInstances = bgfx::createDynamicVertexBuffer(m_max,         instanceLayout, BGFX_BUFFER_COMPUTE_WRITE);
+			m_gpuCounter   = bgfx::createDynamicIndexBuffer(1, BGFX_BUFFER_INDEX32 | BGFX_BUFFER_COMPUTE_READ_WRITE);
+			m_gpuIndirect  = bgfx::createIndirectBuffer(1);
+
+			return;
+		}
+
+		const uint32_t numStreams = BX_COUNTOF(m_stream);
+		const uint32_t stride     = bx::strideAlign(m_max, 4);
+		const uint32_t size       = (numStreams*stride + 5*m_max)*sizeof(float);
+
+		m_data = BX_ALIGNED_ALLOC(s_ctx.m_allocator, size, 16);
+		bx::memSet(m_data, 0, size);
+
+		float* data = (float*)m_data;
+		for (uint32_t ii = 0; ii < numStreams; ++ii)
+		{
+			m_stream[ii] = &data[ii*stride];
+		}
+
+		m_life        = m_stream[0];
+		m_invLifeSpan = m_stream[1];
+		m_start[0]    = m_stream[2];
+		m_start[1]    = m_stream[3];
+		m_start[2]    = m_stream[4];
+		m_end0[0]     = m_stream[5];
+		m_end0[1]     = m_stream[6];
+		m_end0[2]     = m_stream[7];
+		m_end1[0]     = m_stream[8];
+		m_end1[1]     = m_stream[9];
+		m_end1[2]     = m_stream[10];
+		m_blendStart  = m_stream[11];
+		m_blendEnd    = m_stream[12];
+		m_scaleStart  = m_stream[13];
+		m_scaleEnd    = m_stream[14];
+		m_rgba        = (uint32_t*)&data[numStreams*stride];
 	}
 
 	void Emitter::destroy()
 	{
-		BX_FREE(s_ctx.m_allocator, m_particles);
-		m_particles = NULL;
+		if (EmitterSimulation::Gpu == m_simulation)
+		{
+			bgfx::destroy(m_gpuIndirect);
+			bgfx::destroy(m_gpuCounter);
+			bgfx::destroy(m_gpuInstances);
+			bgfx::destroy(m_gpuSort);
+			bgfx::destroy(m_gpuParticles);
+			return;
+		}
+
+		BX_ALIGNED_FREE(s_ctx.m_allocator, m_data, 16);
+		m_data = NULL;
+
+		if (NULL != m_particles)
+		{
+			BX_FREE(s_ctx.m_allocator, m_particles);
+			m_particles = NULL;
+		}
 	}
 
 } // namespace ps
@@ -720,9 +1654,9 @@ void psDestroy(EmitterSpriteHandle _handle)
 	s_ctx.destroy(_handle);
 }
 
-EmitterHandle psCreateEmitter(EmitterShape::Enum _shape, EmitterDirection::Enum _direction, uint32_t _maxParticles)
+EmitterHandle psCreateEmitter(EmitterShape::Enum _shape, EmitterDirection::Enum _direction, uint32_t _maxParticles, EmitterSimulation::Enum _simulation)
 {
-	return s_ctx.createEmitter(_shape, _direction, _maxParticles);
+	return s_ctx.createEmitter(_shape, _direction, _maxParticles, _simulation);
 }
 
 void psUpdateEmitter(EmitterHandle _handle, const EmitterUniforms* _uniforms)
@@ -749,3 +1683,18 @@ void psRender(uint8_t _view, const float* _mtxView, const bx::Vec3& _eye)
 {
 	s_ctx.render(_view, _mtxView, _eye);
 }
+
+bool psIsGpuSupported()
+{
+	return s_ctx.isGpuSupported();
+}
+
+void psSetBenchmark(bool _enabled)
+{
+	s_ctx.m_benchmark = _enabled;
+}
+
+void psGetStats(PsStats& _outStats)
+{
+	_outStats = s_ctx.m_stats;
+}
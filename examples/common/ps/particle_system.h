@@ -46,6 +46,19 @@ struct EmitterDirection
 	};
 };
 
+/// Where emitter particles are simulated.
+struct EmitterSimulation
+{
+	enum Enum
+	{
+		Cpu, //!< Simulated and sorted on CPU, drawn from transient buffers.
+		Gpu, //!< Simulated and sorted with compute shaders, drawn indirect. Requires compute,
+		     //!  draw indirect and instancing, otherwise emitter falls back to CPU.
+
+		Count
+	};
+};
+
 struct EmitterUniforms
 {
 	void reset();
@@ -73,6 +86,18 @@ struct EmitterUniforms
 	EmitterSpriteHandle m_handle;
 };
 
+/// Particle system timings, in `bx::getHPCounter` ticks. Only CPU simulated emitters are
+/// accounted. Reference timings are measured only in benchmark mode.
+struct PsStats
+{
+	uint32_t m_numParticles;
+	int64_t  m_updateTime;
+	int64_t  m_renderTime;
+	int64_t  m_sortTime;
+	int64_t  m_referenceUpdateTime; //!< Scalar update of array of structures particles.
+	int64_t  m_referenceSortTime;   //!< Float distance sort with qsort.
+};
+
 ///
 void psInit(uint16_t _maxEmitters = 64, bx::AllocatorI* _allocator = NULL);
 
@@ -86,7 +111,7 @@ EmitterSpriteHandle psCreateSprite(uint16_t _width, uint16_t _height, const void
 void psDestroy(EmitterSpriteHandle _handle);
 
 ///
-EmitterHandle psCreateEmitter(EmitterShape::Enum _shape, EmitterDirection::Enum _direction, uint32_t _maxParticles);
+EmitterHandle psCreateEmitter(EmitterShape::Enum _shape, EmitterDirection::Enum _direction, uint32_t _maxParticles, EmitterSimulation::Enum _simulation = EmitterSimulation::Cpu);
 
 ///
 void psUpdateEmitter(EmitterHandle _handle, const EmitterUniforms* _uniforms = NULL);
@@ -103,4 +128,14 @@ void psUpdate(float _dt);
 ///
 void psRender(uint8_t _view, const float* _mtxView, const bx::Vec3& _eye);
 
+/// Returns true if compute simulation is supported by renderer and its shaders are loaded.
+bool psIsGpuSupported();
+
+/// In benchmark mode scalar array of structures update and qsort depth sort are run on copy of
+/// particles every frame, next to regular update and sort, so both can be compared.
+void psSetBenchmark(bool _enabled);
+
+///
+void psGetStats(PsStats& _outStats);
+
 #endif // PARTICLE_SYSTEM_H_HEADER_GUARD
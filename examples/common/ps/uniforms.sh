@@ -0,0 +1,72 @@
+/*
+ * Copyright 2011-2020 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx#license-bsd-2-clause
+ */
+
+// Must match PS_GPU_NUM_PARAMS and layout written by Emitter::getGpuParams in
+// examples/common/ps/particle_system.cpp.
+uniform vec4 u_psParams[48];
+uniform mat4 u_psMtx;
+uniform vec4 u_psSort;
+
+#define threadGroupSize   256
+#define spawnGroupSize    64
+
+#define u_dt              u_psParams[0].x
+#define u_spawnCount      uint(u_psParams[0].y)
+#define u_spawnStart      uint(u_psParams[0].z)
+#define u_maxParticles    uint(u_psParams[0].w)
+
+#define u_offsetStart     u_psParams[1].xy
+#define u_offsetEnd       u_psParams[1].zw
+
+#define u_lifeSpan        u_psParams[2].xy
+#define u_gravityScale    u_psParams[2].z
+#define u_seed            uint(u_psParams[2].w)
+
+#define u_blendStart      u_psParams[3].xy
+#define u_blendEnd        u_psParams[3].zw
+
+#define u_scaleStart      u_psParams[4].xy
+#define u_scaleEnd        u_psParams[4].zw
+
+#define u_shape           int(u_psParams[5].x)
+#define u_direction       int(u_psParams[5].y)
+#define u_timePerParticle u_psParams[5].z
+#define u_sortSize        uint(u_psParams[5].w)
+
+#define u_eye             u_psParams[6].xyz
+#define u_uvRect          u_psParams[7]
+
+#define u_rgba(_idx)      u_psParams[8 + (_idx)]
+
+#define EASE_POS   0
+#define EASE_SCALE 1
+#define EASE_BLEND 2
+#define EASE_RGBA  3
+
+#define EASE_LUT_OFFSET 16
+#define EASE_LUT_SIZE   32
+
+// Easing functions are sampled on CPU into lookup table, 32 samples per curve.
+float ease(int _curve, float _tt)
+{
+	float pos  = clamp(_tt, 0.0, 1.0) * float(EASE_LUT_SIZE-1);
+	int   idx0 = int(floor(pos) );
+	int   idx1 = min(idx0 + 1, EASE_LUT_SIZE-1);
+
+	int   base = EASE_LUT_OFFSET*4 + _curve*EASE_LUT_SIZE;
+	int   lut0 = base + idx0;
+	int   lut1 = base + idx1;
+	float val0 = u_psParams[lut0/4][lut0%4];
+	float val1 = u_psParams[lut1/4][lut1%4];
+
+	return mix(val0, val1, fract(pos) );
+}
+
+// Particle state, 4 x vec4 per particle:
+//   [0] start.xyz, life
+//   [1] end0.xyz,  invLifeSpan
+//   [2] end1.xyz,  blendStart
+//   [3] blendEnd,  scaleStart, scaleEnd, unused
+#define PARTICLE_STRIDE 4
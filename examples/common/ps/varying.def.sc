@@ -4,3 +4,7 @@ vec4 v_texcoord0 : TEXCOORD0 = vec4(0.0, 0.0, 0.0, 0.0);
 vec3 a_position  : POSITION;
 vec4 a_color0    : COLOR0;
 vec4 a_texcoord0 : TEXCOORD0;
+vec4 i_data0     : TEXCOORD7;
+vec4 i_data1     : TEXCOORD6;
+vec4 i_data2     : TEXCOORD5;
+vec4 i_data3     : TEXCOORD4;
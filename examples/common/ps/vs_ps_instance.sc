@@ -0,0 +1,22 @@
+$input a_position, i_data0, i_data1, i_data2, i_data3
+$output v_color0, v_texcoord0
+
+/*
+ * Copyright 2011-2020 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx#license-bsd-2-clause
+ */
+
+#include "../../common/common.sh"
+
+uniform vec4 u_psBillboard[2];
+
+void main()
+{
+	vec3 udir = u_psBillboard[0].xyz * i_data0.w;
+	vec3 vdir = u_psBillboard[1].xyz * i_data0.w;
+	vec3 pos  = i_data0.xyz + udir * a_position.x + vdir * a_position.y;
+
+	gl_Position = mul(u_viewProj, vec4(pos, 1.0) );
+	v_color0    = i_data1;
+	v_texcoord0 = vec4(mix(i_data2.xy, i_data2.zw, a_position.xy*0.5 + 0.5), i_data3.x, 0.0);
+}
@@ -87,6 +87,12 @@ vec3 decodeNormalOctahedron(vec2 _encodedNormal)
 	return normalize(normal);
 }
 
+vec4 decodeTangentOctahedron(vec4 _encodedTangent)
+{
+	// Octahedral encoded tangent in xy, handedness in z, as written by geometryc --quantize.
+	return vec4(decodeNormalOctahedron(_encodedTangent.xy), _encodedTangent.z * 2.0 - 1.0);
+}
+
 vec3 convertRGB2XYZ(vec3 _rgb)
 {
 	// Reference(s):
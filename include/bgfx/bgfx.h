@@ -933,6 +933,19 @@ namespace bgfx
 		int64_t gpuTimeEnd;     //!< GPU end time.
 	};
 
+	/// Draw stats, aggregated by program and debug marker.
+	///
+	/// @attention C99 equivalent is `bgfx_draw_stats_t`.
+	///
+	struct DrawStats
+	{
+		char          marker[64]; //!< Debug marker active when draw calls were submitted.
+		ProgramHandle program;    //!< Program handle.
+		uint32_t      numDraw;    //!< Number of draw calls aggregated.
+		int64_t       cpuTime;    //!< CPU submit time.
+		int64_t       gpuTime;    //!< GPU time, 0 if not available.
+	};
+
 	/// Encoder stats.
 	///
 	/// @attention C99 equivalent is `bgfx_encoder_stats_t`.
@@ -1001,6 +1014,9 @@ namespace bgfx
 
 		uint8_t       numEncoders;          //!< Number of encoders used during frame.
 		EncoderStats* encoderStats;         //!< Array of encoder stats.
+
+		uint16_t   numDrawStats;            //!< Number of draw stats.
+		DrawStats* drawStats;               //!< Array of draw stats.
 	};
 
 	/// Encoders are used for submitting draw calls from multiple threads. Only one encoder
@@ -810,6 +810,20 @@ typedef struct bgfx_view_stats_s
 
 } bgfx_view_stats_t;
 
+/**
+ * Draw stats, aggregated by program and debug marker.
+ *
+ */
+typedef struct bgfx_draw_stats_s
+{
+    char                 marker[64];         /** Debug marker active when draw calls were submitted. */
+    bgfx_program_handle_t program;           /** Program handle.                          */
+    uint32_t             numDraw;            /** Number of draw calls aggregated.         */
+    int64_t              cpuTime;            /** CPU submit time.                         */
+    int64_t              gpuTime;            /** GPU time, 0 if not available.            */
+
+} bgfx_draw_stats_t;
+
 /**
  * Encoder stats.
  *
@@ -868,6 +882,8 @@ typedef struct bgfx_stats_s
     bgfx_view_stats_t*   viewStats;          /** Array of View stats.                     */
     uint8_t              numEncoders;        /** Number of encoders used during frame.    */
     bgfx_encoder_stats_t* encoderStats;      /** Array of encoder stats.                  */
+    uint16_t             numDrawStats;       /** Number of draw stats.                    */
+    bgfx_draw_stats_t*   drawStats;          /** Array of draw stats.                     */
 
 } bgfx_stats_t;
 
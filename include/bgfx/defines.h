@@ -15,7 +15,7 @@
 #ifndef BGFX_DEFINES_H_HEADER_GUARD
 #define BGFX_DEFINES_H_HEADER_GUARD
 
-#define BGFX_API_VERSION UINT32_C(106)
+#define BGFX_API_VERSION UINT32_C(107)
 
 /**
  * Color RGB/alpha/depth write. When it's not specified write will be disabled.
@@ -275,6 +275,7 @@
 #define BGFX_DEBUG_STATS                    UINT32_C(0x00000004) //!< Enable statistics display.
 #define BGFX_DEBUG_TEXT                     UINT32_C(0x00000008) //!< Enable debug text display.
 #define BGFX_DEBUG_PROFILER                 UINT32_C(0x00000010) //!< Enable profiler.
+#define BGFX_DEBUG_PROFILER_DRAW            UINT32_C(0x00000020) //!< Enable per draw call profiler.
 
 #define BGFX_BUFFER_COMPUTE_FORMAT_8X1      UINT16_C(0x0001) //!< 1 8-bit value
 #define BGFX_BUFFER_COMPUTE_FORMAT_8X2      UINT16_C(0x0002) //!< 2 8-bit values
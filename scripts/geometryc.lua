@@ -38,6 +38,11 @@ project "geometryc"
 			"Cocoa.framework",
 		}
 
+	configuration { "osx or linux*" }
+		links {
+			"pthread",
+		}
+
 	configuration { "vs20*" }
 		links {
 			"psapi",
@@ -2271,6 +2271,7 @@ namespace bgfx
 		m_init.resolution.reset &= ~BGFX_RESET_INTERNAL_FORCE;
 		m_submit->m_debug = m_debug;
 		m_submit->m_perfStats.numViews = 0;
+		m_submit->m_perfStats.numDrawStats = 0;
 
 		bx::memCopy(m_submit->m_viewRemap, m_viewRemap, sizeof(m_viewRemap) );
 		bx::memCopy(m_submit->m_view, m_view, sizeof(m_view) );
@@ -1960,6 +1960,7 @@ constexpr uint64_t kSortKeyComputeProgramMask  = uint64_t(BGFX_CONFIG_MAX_PROGRA
 			bx::memSet(m_occlusion, 0xff, sizeof(m_occlusion) );
 
 			m_perfStats.viewStats = m_viewStats;
+			m_perfStats.drawStats = m_drawStats;
 		}
 
 		~Frame()
@@ -2225,6 +2226,7 @@ constexpr uint64_t kSortKeyComputeProgramMask  = uint64_t(BGFX_CONFIG_MAX_PROGRA
 
 		Stats     m_perfStats;
 		ViewStats m_viewStats[BGFX_CONFIG_MAX_VIEWS];
+		DrawStats m_drawStats[BGFX_CONFIG_MAX_DRAW_STATS];
 
 		int64_t m_waitSubmit;
 		int64_t m_waitRender;
@@ -354,6 +354,12 @@ BX_STATIC_ASSERT(bx::isPowerOf2(BGFX_CONFIG_MAX_VIEWS), "BGFX_CONFIG_MAX_VIEWS m
 #	define BGFX_CONFIG_PROFILER 1
 #endif // BGFX_CONFIG_PROFILER
 
+/// Maximum number of program/marker pairs reported by per draw call profiler.
+#ifndef BGFX_CONFIG_MAX_DRAW_STATS
+#	define BGFX_CONFIG_MAX_DRAW_STATS 256
+#endif // BGFX_CONFIG_MAX_DRAW_STATS
+BX_STATIC_ASSERT(bx::isPowerOf2(BGFX_CONFIG_MAX_DRAW_STATS), "BGFX_CONFIG_MAX_DRAW_STATS must be power of 2.");
+
 #ifndef BGFX_CONFIG_RENDERDOC_LOG_FILEPATH
 #	define BGFX_CONFIG_RENDERDOC_LOG_FILEPATH "../../tmp/bgfx"
 #endif // BGFX_CONFIG_RENDERDOC_LOG_FILEPATH
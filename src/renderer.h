@@ -371,6 +371,27 @@ namespace bgfx
 			}
 		}
 
+		template<typename PredicateT>
+		void invalidateIf(const PredicateT& _predicate)
+		{
+			for (uint16_t ii = 0; ii < m_alloc.getNumHandles();)
+			{
+				uint16_t handle = m_alloc.getHandleAt(ii);
+				Data& data = m_data[handle];
+
+				if (_predicate(data.m_value) )
+				{
+					m_alloc.free(handle);
+					m_hashMap.erase(m_hashMap.find(data.m_hash) );
+					release(data.m_value);
+				}
+				else
+				{
+					++ii;
+				}
+			}
+		}
+
 		void invalidate()
 		{
 			for (uint16_t ii = 0, num = m_alloc.getNumHandles(); ii < num; ++ii)
@@ -538,6 +559,197 @@ namespace bgfx
 		bool     m_enabled;
 	};
 
+	/// GPU timer placeholder for renderers reporting only CPU time per draw.
+	struct DrawTimerNull
+	{
+		uint32_t begin(uint64_t /*_key*/) { return UINT32_MAX; }
+		void end(uint32_t /*_idx*/) {}
+		void update() {}
+		uint64_t consume(uint64_t /*_key*/) { return 0; }
+	};
+
+	/// Per draw call profiler, aggregating CPU submit time and GPU time by
+	/// program and debug marker. Consecutive draws with the same program and
+	/// marker share one GPU timer query.
+	template<typename Ty>
+	struct DrawProfiler
+	{
+		DrawProfiler()
+			: m_frame(NULL)
+			, m_gpuTimer(NULL)
+			, m_cpuBegin(0)
+			, m_groupKey(UINT64_MAX)
+			, m_queryIdx(UINT32_MAX)
+			, m_markerHash(0)
+			, m_slot(UINT16_MAX)
+			, m_enabled(false)
+		{
+			m_marker[0] = '\0';
+		}
+
+		void begin(Frame* _frame, Ty* _gpuTimer)
+		{
+			m_frame      = _frame;
+			m_gpuTimer   = _gpuTimer;
+			m_enabled    = 0 != (_frame->m_debug & BGFX_DEBUG_PROFILER_DRAW);
+			m_groupKey   = UINT64_MAX;
+			m_queryIdx   = UINT32_MAX;
+			m_markerHash = 0;
+			m_slot       = UINT16_MAX;
+			m_marker[0]  = '\0';
+
+			m_frame->m_perfStats.numDrawStats = 0;
+			bx::memSet(m_lookup, 0xff, sizeof(m_lookup) );
+		}
+
+		void end()
+		{
+			if (m_enabled)
+			{
+				endQuery();
+
+				Stats& stats = m_frame->m_perfStats;
+
+				if (NULL != m_gpuTimer)
+				{
+					m_gpuTimer->update();
+
+					for (uint16_t ii = 0; ii < stats.numDrawStats; ++ii)
+					{
+						stats.drawStats[ii].gpuTime = int64_t(m_gpuTimer->consume(m_key[ii]) );
+					}
+				}
+			}
+		}
+
+		bool isEnabled() const
+		{
+			return m_enabled;
+		}
+
+		void setMarker(const char* _marker, uint16_t _len)
+		{
+			if (m_enabled)
+			{
+				bx::strCopy(m_marker, BX_COUNTOF(m_marker), _marker, _len);
+				m_markerHash = bx::hash<bx::HashMurmur2A>(m_marker, uint32_t(bx::strLen(m_marker) ) );
+			}
+		}
+
+		/// Called before draw call state is processed.
+		void beginDraw()
+		{
+			if (m_enabled)
+			{
+				m_cpuBegin = bx::getHPCounter();
+			}
+		}
+
+		/// Called right before draw call is issued to graphics API.
+		void submitDraw(ProgramHandle _program, ViewId _view)
+		{
+			if (m_enabled)
+			{
+				const uint64_t key = (uint64_t(_program.idx)<<32) | m_markerHash;
+				m_slot = findSlot(key, _program);
+
+				const uint64_t groupKey = key | (uint64_t(_view)<<48);
+				if (groupKey != m_groupKey)
+				{
+					endQuery();
+					m_groupKey = groupKey;
+
+					if (NULL != m_gpuTimer
+					&&  UINT16_MAX != m_slot)
+					{
+						m_queryIdx = m_gpuTimer->begin(key);
+					}
+				}
+			}
+		}
+
+		/// Called after draw call is issued, _numDraw is number of render items
+		/// merged into it.
+		void endDraw(uint32_t _numDraw = 1)
+		{
+			if (m_enabled
+			&&  UINT16_MAX != m_slot)
+			{
+				DrawStats& drawStats = m_frame->m_perfStats.drawStats[m_slot];
+				drawStats.cpuTime += bx::getHPCounter() - m_cpuBegin;
+				drawStats.numDraw += _numDraw;
+				m_slot = UINT16_MAX;
+			}
+		}
+
+		/// Closes pending GPU timer query. Must be called before any GPU work
+		/// that is not a draw call (view change, clear, blit, compute).
+		void endQuery()
+		{
+			if (UINT32_MAX != m_queryIdx)
+			{
+				m_gpuTimer->end(m_queryIdx);
+				m_queryIdx = UINT32_MAX;
+			}
+
+			m_groupKey = UINT64_MAX;
+		}
+
+	private:
+		uint16_t findSlot(uint64_t _key, ProgramHandle _program)
+		{
+			Stats& stats = m_frame->m_perfStats;
+
+			const uint32_t mask = BX_COUNTOF(m_lookup)-1;
+			for (uint32_t hash = uint32_t(_key ^ (_key>>29) ) * UINT32_C(0x9e3779b1), ii = 0
+				; ii < BX_COUNTOF(m_lookup)
+				; ++ii
+				)
+			{
+				uint16_t& slot = m_lookup[(hash + ii) & mask];
+
+				if (UINT16_MAX == slot)
+				{
+					if (BGFX_CONFIG_MAX_DRAW_STATS == stats.numDrawStats)
+					{
+						return UINT16_MAX;
+					}
+
+					slot = stats.numDrawStats++;
+					m_key[slot] = _key;
+
+					DrawStats& drawStats = stats.drawStats[slot];
+					bx::strCopy(drawStats.marker, BX_COUNTOF(drawStats.marker), m_marker);
+					drawStats.program = _program;
+					drawStats.numDraw = 0;
+					drawStats.cpuTime = 0;
+					drawStats.gpuTime = 0;
+
+					return slot;
+				}
+
+				if (m_key[slot] == _key)
+				{
+					return slot;
+				}
+			}
+
+			return UINT16_MAX;
+		}
+
+		Frame*   m_frame;
+		Ty*      m_gpuTimer;
+		int64_t  m_cpuBegin;
+		uint64_t m_groupKey;
+		uint32_t m_queryIdx;
+		uint32_t m_markerHash;
+		uint16_t m_slot;
+		bool     m_enabled;
+		char     m_marker[64];
+		uint64_t m_key[BGFX_CONFIG_MAX_DRAW_STATS];
+		uint16_t m_lookup[BGFX_CONFIG_MAX_DRAW_STATS*2];
+	};
+
 } // namespace bgfx
 
 #endif // BGFX_RENDERER_H_HEADER_GUARD
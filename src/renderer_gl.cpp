@@ -90,6 +90,19 @@ namespace bgfx { namespace gl
 	};
 	BX_STATIC_ASSERT(BGFX_CONFIG_MAX_INSTANCE_DATA_COUNT == BX_COUNTOF(s_instanceDataName) );
 
+	struct UniformBlockNameGL
+	{
+		const char* m_block;
+		const char* m_instance;
+	};
+
+	static const UniformBlockNameGL s_uniformBlockName[] =
+	{
+		{ "bgfx_VsUniforms", "bgfx_vs" },
+		{ "bgfx_FsUniforms", "bgfx_fs" },
+	};
+	BX_STATIC_ASSERT(UniformBlockGL::Count == BX_COUNTOF(s_uniformBlockName) );
+
 	static const GLenum s_access[] =
 	{
 		GL_READ_ONLY,
@@ -522,6 +535,7 @@ namespace bgfx { namespace gl
 			ARB_depth_buffer_float,
 			ARB_depth_clamp,
 			ARB_draw_buffers_blend,
+			ARB_draw_elements_base_vertex,
 			ARB_draw_indirect,
 			ARB_draw_instanced,
 			ARB_ES3_compatibility,
@@ -543,6 +557,7 @@ namespace bgfx { namespace gl
 			ARB_sampler_objects,
 			ARB_seamless_cube_map,
 			ARB_shader_bit_encoding,
+			ARB_shader_draw_parameters,
 			ARB_shader_image_load_store,
 			ARB_shader_storage_buffer_object,
 			ARB_shader_texture_lod,
@@ -584,6 +599,7 @@ namespace bgfx { namespace gl
 			EXT_discard_framebuffer,
 			EXT_disjoint_timer_query,
 			EXT_draw_buffers,
+			EXT_draw_elements_base_vertex,
 			EXT_draw_instanced,
 			EXT_instanced_arrays,
 			EXT_frag_depth,
@@ -647,6 +663,7 @@ namespace bgfx { namespace gl
 			OES_depth24,
 			OES_depth32,
 			OES_depth_texture,
+			OES_draw_elements_base_vertex,
 			OES_element_index_uint,
 			OES_fragment_precision_high,
 			OES_get_program_binary,
@@ -733,6 +750,7 @@ namespace bgfx { namespace gl
 		{ "ARB_depth_buffer_float",                   BGFX_CONFIG_RENDERER_OPENGL >= 33, true  },
 		{ "ARB_depth_clamp",                          BGFX_CONFIG_RENDERER_OPENGL >= 32, true  },
 		{ "ARB_draw_buffers_blend",                   BGFX_CONFIG_RENDERER_OPENGL >= 40, true  },
+		{ "ARB_draw_elements_base_vertex",            BGFX_CONFIG_RENDERER_OPENGL >= 32, true  },
 		{ "ARB_draw_indirect",                        BGFX_CONFIG_RENDERER_OPENGL >= 40, true  },
 		{ "ARB_draw_instanced",                       BGFX_CONFIG_RENDERER_OPENGL >= 33, true  },
 		{ "ARB_ES3_compatibility",                    BGFX_CONFIG_RENDERER_OPENGL >= 43, true  },
@@ -754,6 +772,7 @@ namespace bgfx { namespace gl
 		{ "ARB_sampler_objects",                      BGFX_CONFIG_RENDERER_OPENGL >= 33, true  },
 		{ "ARB_seamless_cube_map",                    BGFX_CONFIG_RENDERER_OPENGL >= 32, true  },
 		{ "ARB_shader_bit_encoding",                  BGFX_CONFIG_RENDERER_OPENGL >= 33, true  },
+		{ "ARB_shader_draw_parameters",               BGFX_CONFIG_RENDERER_OPENGL >= 46, true  },
 		{ "ARB_shader_image_load_store",              BGFX_CONFIG_RENDERER_OPENGL >= 42, true  },
 		{ "ARB_shader_storage_buffer_object",         BGFX_CONFIG_RENDERER_OPENGL >= 43, true  },
 		{ "ARB_shader_texture_lod",                   BGFX_CONFIG_RENDERER_OPENGL >= 30, true  },
@@ -795,6 +814,7 @@ namespace bgfx { namespace gl
 		{ "EXT_discard_framebuffer",                  false,                             true  }, // GLES2 extension.
 		{ "EXT_disjoint_timer_query",                 false,                             true  }, // GLES2 extension.
 		{ "EXT_draw_buffers",                         false,                             true  }, // GLES2 extension.
+		{ "EXT_draw_elements_base_vertex",            false,                             true  },
 		{ "EXT_draw_instanced",                       false,                             true  }, // GLES2 extension.
 		{ "EXT_instanced_arrays",                     false,                             true  }, // GLES2 extension.
 		{ "EXT_frag_depth",                           false,                             true  }, // GLES2 extension.
@@ -858,6 +878,7 @@ namespace bgfx { namespace gl
 		{ "OES_depth24",                              false,                             true  },
 		{ "OES_depth32",                              false,                             true  },
 		{ "OES_depth_texture",                        false,                             true  },
+		{ "OES_draw_elements_base_vertex",            false,                             true  },
 		{ "OES_element_index_uint",                   false,                             true  },
 		{ "OES_fragment_precision_high",              false,                             true  },
 		{ "OES_get_program_binary",                   false,                             true  },
@@ -996,6 +1017,15 @@ namespace bgfx { namespace gl
 		NULL
 	};
 
+	// Indexed by matrix position in the draw transform block.
+	static const char* s_modelUniform[] =
+	{
+		"u_model",
+		"u_modelView",
+		"u_modelViewProj",
+		NULL
+	};
+
 	static const char* s_EXT_gpu_shader4[] =
 	{
 		"gl_VertexID",
@@ -2064,9 +2094,25 @@ namespace bgfx { namespace gl
 			, m_maxAnisotropyDefault(0.0f)
 			, m_maxMsaa(0)
 			, m_vao(0)
+			, m_uniformBuffer(0)
+			, m_uniformBufferOffset(0)
+			, m_uniformBufferAlign(256)
+			, m_uniformBufferFrame(0)
+			, m_uniformBlockProgram(NULL)
+			, m_uniformBlockBound(NULL)
+			, m_multiDrawBuffer(0)
+			, m_multiDrawBufferOffset(0)
+			, m_drawTransformMax(0)
+			, m_multiDrawTransform(false)
+			, m_vaoBaseVertex(0)
 			, m_blitSupported(false)
 			, m_readBackSupported(BX_ENABLED(BGFX_CONFIG_RENDERER_OPENGL) )
 			, m_vaoSupport(false)
+			, m_vaoCacheSupport(false)
+			, m_baseVertexSupport(false)
+			, m_uniformBufferSupport(false)
+			, m_multiDrawSupport(false)
+			, m_drawTransformSupport(false)
 			, m_samplerObjectSupport(false)
 			, m_shadowSamplersSupport(false)
 			, m_srgbWriteControlSupport(BX_ENABLED(BGFX_CONFIG_RENDERER_OPENGL) )
@@ -2684,6 +2730,23 @@ namespace bgfx { namespace gl
 					: 0
 					;
 
+				m_multiDrawSupport = BX_ENABLED(BGFX_GL_CONFIG_MULTI_DRAW)
+					&& (false
+						|| s_extension[Extension::AMD_multi_draw_indirect].m_supported
+						|| s_extension[Extension::ARB_multi_draw_indirect].m_supported
+						|| s_extension[Extension::EXT_multi_draw_indirect].m_supported
+						)
+					&& stubMultiDrawElementsIndirect != glMultiDrawElementsIndirect
+					;
+
+				if (m_multiDrawSupport)
+				{
+					GL_CHECK(glGenBuffers(1, &m_multiDrawBuffer) );
+					GL_CHECK(glBindBuffer(GL_DRAW_INDIRECT_BUFFER, m_multiDrawBuffer) );
+					GL_CHECK(glBufferData(GL_DRAW_INDIRECT_BUFFER, BGFX_GL_CONFIG_MULTI_DRAW_BUFFER_SIZE, NULL, GL_STREAM_DRAW) );
+					GL_CHECK(glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0) );
+				}
+
 				if (BX_ENABLED(BX_PLATFORM_EMSCRIPTEN)
 				||  NULL == glPolygonMode)
 				{
@@ -2768,6 +2831,53 @@ namespace bgfx { namespace gl
 					GL_CHECK(glGenVertexArrays(1, &m_vao) );
 				}
 
+				m_vaoCacheSupport = BX_ENABLED(BGFX_GL_CONFIG_VAO_CACHE)
+					&& m_vaoSupport
+					;
+
+				m_baseVertexSupport = m_vaoCacheSupport
+					&& (!!(BGFX_CONFIG_RENDERER_OPENGLES >= 32)
+						|| s_extension[Extension::ARB_draw_elements_base_vertex].m_supported
+						|| s_extension[Extension::EXT_draw_elements_base_vertex].m_supported
+						|| s_extension[Extension::OES_draw_elements_base_vertex].m_supported
+						)
+					&& NULL != glDrawElementsInstancedBaseVertex
+					;
+
+				m_uniformBufferSupport = BX_ENABLED(BGFX_GL_CONFIG_UNIFORM_BUFFER)
+					&& (!!(BGFX_CONFIG_RENDERER_OPENGLES >= 30)
+						|| s_extension[Extension::ARB_uniform_buffer_object].m_supported
+						)
+					&& NULL != glBindBufferRange
+					&& NULL != glGetActiveUniformsiv
+					&& NULL != glGetActiveUniformBlockiv
+					&& NULL != glGetUniformBlockIndex
+					&& NULL != glUniformBlockBinding
+					;
+
+				if (m_uniformBufferSupport)
+				{
+					m_uniformBufferAlign = bx::max<uint32_t>(glGet(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT), 16);
+
+					GL_CHECK(glGenBuffers(1, &m_uniformBuffer) );
+					GL_CHECK(glBindBuffer(GL_UNIFORM_BUFFER, m_uniformBuffer) );
+					GL_CHECK(glBufferData(GL_UNIFORM_BUFFER, BGFX_GL_CONFIG_UNIFORM_BUFFER_SIZE, NULL, GL_STREAM_DRAW) );
+				}
+
+				// Per draw transforms are read from a uniform block indexed by
+				// gl_DrawIDARB, block size limits number of draws per multi draw.
+				m_drawTransformMax = m_uniformBufferSupport
+					? bx::min<uint32_t>(BGFX_GL_CONFIG_MULTI_DRAW_MAX, uint32_t(glGet(GL_MAX_UNIFORM_BLOCK_SIZE) )/kDrawTransformSize)
+					: 0
+					;
+
+				m_drawTransformSupport = BX_ENABLED(BGFX_CONFIG_RENDERER_OPENGL >= 31)
+					&& m_multiDrawSupport
+					&& m_uniformBufferSupport
+					&& s_extension[Extension::ARB_shader_draw_parameters].m_supported
+					&& 1 < m_drawTransformMax
+					;
+
 				m_samplerObjectSupport = !BX_ENABLED(BX_PLATFORM_EMSCRIPTEN)
 					&& (!!(BGFX_CONFIG_RENDERER_OPENGLES >= 30)
 						|| s_extension[Extension::ARB_sampler_objects].m_supported
@@ -2957,6 +3067,7 @@ namespace bgfx { namespace gl
 				if (m_timerQuerySupport)
 				{
 					m_gpuTimer.create();
+					m_drawTimer.create();
 				}
 
 				if (m_occlusionQuerySupport)
@@ -2990,6 +3101,8 @@ namespace bgfx { namespace gl
 
 		void shutdown()
 		{
+			m_vaoCache.invalidate();
+
 			if (m_vaoSupport)
 			{
 				GL_CHECK(glBindVertexArray(0) );
@@ -2997,6 +3110,18 @@ namespace bgfx { namespace gl
 				m_vao = 0;
 			}
 
+			if (0 != m_uniformBuffer)
+			{
+				GL_CHECK(glDeleteBuffers(1, &m_uniformBuffer) );
+				m_uniformBuffer = 0;
+			}
+
+			if (0 != m_multiDrawBuffer)
+			{
+				GL_CHECK(glDeleteBuffers(1, &m_multiDrawBuffer) );
+				m_multiDrawBuffer = 0;
+			}
+
 			captureFinish();
 
 			invalidateCache();
@@ -3004,6 +3129,7 @@ namespace bgfx { namespace gl
 			if (m_timerQuerySupport)
 			{
 				m_gpuTimer.destroy();
+				m_drawTimer.destroy();
 			}
 
 			if (m_occlusionQuerySupport)
@@ -3071,6 +3197,7 @@ namespace bgfx { namespace gl
 
 		void destroyIndexBuffer(IndexBufferHandle _handle) override
 		{
+			invalidateVertexArrays(_handle.idx, kInvalidHandle);
 			m_indexBuffers[_handle.idx].destroy();
 		}
 
@@ -3094,6 +3221,7 @@ namespace bgfx { namespace gl
 
 		void destroyVertexBuffer(VertexBufferHandle _handle) override
 		{
+			invalidateVertexArrays(kInvalidHandle, _handle.idx);
 			m_vertexBuffers[_handle.idx].destroy();
 		}
 
@@ -3109,6 +3237,7 @@ namespace bgfx { namespace gl
 
 		void destroyDynamicIndexBuffer(IndexBufferHandle _handle) override
 		{
+			invalidateVertexArrays(_handle.idx, kInvalidHandle);
 			m_indexBuffers[_handle.idx].destroy();
 		}
 
@@ -3125,6 +3254,7 @@ namespace bgfx { namespace gl
 
 		void destroyDynamicVertexBuffer(VertexBufferHandle _handle) override
 		{
+			invalidateVertexArrays(kInvalidHandle, _handle.idx);
 			m_vertexBuffers[_handle.idx].destroy();
 		}
 
@@ -3146,6 +3276,7 @@ namespace bgfx { namespace gl
 
 		void destroyProgram(ProgramHandle _handle) override
 		{
+			m_vaoCache.invalidateWithParent(_handle.idx);
 			m_program[_handle.idx].destroy();
 		}
 
@@ -3401,6 +3532,7 @@ namespace bgfx { namespace gl
 		void setMarker(const char* _marker, uint16_t _len) override
 		{
 			GL_CHECK(glInsertEventMarker(_len, _marker) );
+			m_drawProfiler.setMarker(_marker, _len);
 		}
 
 		virtual void setName(Handle _handle, const char* _name, uint16_t _len) override
@@ -3467,7 +3599,7 @@ namespace bgfx { namespace gl
 			GL_CHECK(glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE) );
 
 			ProgramGL& program = m_program[_blitter.m_program.idx];
-			setProgram(program.m_id);
+			setProgram(program);
 			setUniform1i(program.m_sampler[0], 0);
 
 			float proj[16];
@@ -3514,6 +3646,8 @@ namespace bgfx { namespace gl
 				program.bindAttributes(_blitter.m_layout, 0);
 				program.bindAttributesEnd();
 
+				commitUniformBlocks();
+
 				GL_CHECK(glDrawElements(GL_TRIANGLES
 					, _numIndices
 					, GL_UNSIGNED_SHORT
@@ -4203,7 +4337,7 @@ namespace bgfx { namespace gl
 				GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, vb.m_id) );
 
 				ProgramGL& program = m_program[_clearQuad.m_program[numMrt-1].idx];
-				setProgram(program.m_id);
+				setProgram(program);
 				program.bindAttributesBegin();
 				program.bindAttributes(layout, 0);
 				program.bindAttributesEnd();
@@ -4254,6 +4388,7 @@ namespace bgfx { namespace gl
 				updateUniform(m_clearQuadColor.idx, mrtClearColor[0], numMrt * sizeof(float) * 4);
 
 				commit(*program.m_constantBuffer);
+				commitUniformBlocks();
 
 				GL_CHECK(glDrawArrays(GL_TRIANGLE_STRIP
 					, 0
@@ -4264,10 +4399,514 @@ namespace bgfx { namespace gl
 
 		void setProgram(GLuint program)
 		{
+			m_uniformBlockProgram = NULL;
 			m_uniformStateCache.saveCurrentProgram(program);
 			GL_CHECK(glUseProgram(program) );
 		}
 
+		void setProgram(ProgramGL& _program)
+		{
+			setProgram(_program.m_id);
+			m_uniformBlockProgram = 0 != _program.m_uniformBlockSize ? &_program : NULL;
+		}
+
+		void resetUniformBuffer()
+		{
+			if (m_uniformBufferSupport)
+			{
+				// Orphan the whole buffer, programs must reupload their blocks.
+				GL_CHECK(glBindBuffer(GL_UNIFORM_BUFFER, m_uniformBuffer) );
+				GL_CHECK(glBufferData(GL_UNIFORM_BUFFER, BGFX_GL_CONFIG_UNIFORM_BUFFER_SIZE, NULL, GL_STREAM_DRAW) );
+				m_uniformBufferOffset = 0;
+				m_uniformBufferFrame++;
+				m_uniformBlockBound = NULL;
+			}
+		}
+
+		// Uploads the current program's uniform blocks if they changed, and
+		// binds their ranges. Must be called before each draw.
+		void commitUniformBlocks()
+		{
+			ProgramGL* program = m_uniformBlockProgram;
+			if (NULL == program)
+			{
+				return;
+			}
+
+			const uint32_t size = program->m_uniformBlockSize;
+
+			if (program->m_uniformBlockDirty
+			||  program->m_uniformBufferFrame != m_uniformBufferFrame)
+			{
+				if (m_uniformBufferOffset + size > BGFX_GL_CONFIG_UNIFORM_BUFFER_SIZE)
+				{
+					resetUniformBuffer();
+				}
+
+				GL_CHECK(glBufferSubData(GL_UNIFORM_BUFFER
+					, m_uniformBufferOffset
+					, size
+					, program->m_uniformBlockData
+					) );
+
+				program->m_uniformBufferOffset = m_uniformBufferOffset;
+				program->m_uniformBufferFrame  = m_uniformBufferFrame;
+				program->m_uniformBlockDirty   = false;
+
+				m_uniformBufferOffset = bx::strideAlign(m_uniformBufferOffset + size, m_uniformBufferAlign);
+				m_uniformBlockBound   = NULL;
+			}
+
+			if (m_uniformBlockBound != program)
+			{
+				m_uniformBlockBound = program;
+
+				for (uint32_t ii = 0; ii < UniformBlockGL::Count; ++ii)
+				{
+					const UniformBlockGL& block = program->m_uniformBlock[ii];
+					if (0 != block.m_size)
+					{
+						GL_CHECK(glBindBufferRange(GL_UNIFORM_BUFFER
+							, ii
+							, m_uniformBuffer
+							, program->m_uniformBufferOffset + block.m_offset
+							, block.m_size
+							) );
+					}
+				}
+			}
+		}
+
+		// Drops cached vertex arrays referencing destroyed index or vertex
+		// buffer, handle might be reused for a different buffer.
+		void invalidateVertexArrays(uint16_t _indexBuffer, uint16_t _vertexBuffer)
+		{
+			VertexArrayRefGL ref;
+			ref.m_indexBuffer  = _indexBuffer;
+			ref.m_vertexBuffer = _vertexBuffer;
+			m_vaoCache.invalidateIf(ref);
+		}
+
+		// Binds vertex array object with _draw vertex streams and index buffer
+		// attached, creating and caching it on first use. Draws without vertex
+		// streams use default vertex array. When base vertex draws are
+		// supported, attributes are bound relative to the lowest stream start
+		// vertex, and the returned base vertex must be applied by the draw call,
+		// so draws that only move through a buffer share one vertex array.
+		uint32_t bindVertexArray(const RenderDraw& _draw, ProgramHandle _program)
+		{
+			const GLuint ib = isValid(_draw.m_indexBuffer)
+				? m_indexBuffers[_draw.m_indexBuffer.idx].m_id
+				: 0
+				;
+
+			if (0 == _draw.m_streamMask
+			||  UINT8_MAX == _draw.m_streamMask)
+			{
+				GL_CHECK(glBindVertexArray(m_vao) );
+				GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ib) );
+				return 0;
+			}
+
+			// Indirect draws carry their own base vertex in arguments.
+			const bool useBaseVertex = m_baseVertexSupport
+				&& !isValid(_draw.m_indirectBuffer)
+				;
+
+			uint32_t baseVertex = 0;
+			if (useBaseVertex)
+			{
+				baseVertex = UINT32_MAX;
+				for (uint32_t idx = 0, streamMask = _draw.m_streamMask
+					; 0 != streamMask
+					; streamMask >>= 1, idx += 1
+					)
+				{
+					const uint32_t ntz = bx::uint32_cnttz(streamMask);
+					streamMask >>= ntz;
+					idx         += ntz;
+
+					baseVertex = bx::min(baseVertex, _draw.m_stream[idx].m_startVertex);
+				}
+			}
+
+			bx::HashMurmur2A murmur;
+			murmur.begin();
+			murmur.add(_program.idx);
+			murmur.add(_draw.m_indexBuffer.idx);
+			murmur.add(_draw.m_streamMask);
+			murmur.add(useBaseVertex);
+
+			for (uint32_t idx = 0, streamMask = _draw.m_streamMask
+				; 0 != streamMask
+				; streamMask >>= 1, idx += 1
+				)
+			{
+				const uint32_t ntz = bx::uint32_cnttz(streamMask);
+				streamMask >>= ntz;
+				idx         += ntz;
+
+				const Stream& stream = _draw.m_stream[idx];
+				murmur.add(stream.m_handle.idx);
+				murmur.add(stream.m_layoutHandle.idx);
+				murmur.add(stream.m_startVertex - baseVertex);
+			}
+
+			const uint32_t hash = murmur.end();
+
+			VertexArrayGL* vao = m_vaoCache.find(hash);
+			if (NULL != vao)
+			{
+				GL_CHECK(glBindVertexArray(vao->m_id) );
+				return baseVertex;
+			}
+
+			VertexArrayGL value;
+			GL_CHECK(glGenVertexArrays(1, &value.m_id) );
+			GL_CHECK(glBindVertexArray(value.m_id) );
+
+			value.m_indexBuffer = _draw.m_indexBuffer.idx;
+			for (uint32_t ii = 0; ii < BX_COUNTOF(value.m_vertexBuffer); ++ii)
+			{
+				value.m_vertexBuffer[ii] = kInvalidHandle;
+			}
+
+			ProgramGL& program = m_program[_program.idx];
+			program.bindAttributesBegin();
+
+			for (uint32_t idx = 0, streamMask = _draw.m_streamMask
+				; 0 != streamMask
+				; streamMask >>= 1, idx += 1
+				)
+			{
+				const uint32_t ntz = bx::uint32_cnttz(streamMask);
+				streamMask >>= ntz;
+				idx         += ntz;
+
+				const Stream& stream = _draw.m_stream[idx];
+				const VertexBufferGL& vb = m_vertexBuffers[stream.m_handle.idx];
+				const uint16_t decl = isValid(stream.m_layoutHandle)
+					? stream.m_layoutHandle.idx
+					: vb.m_layoutHandle.idx;
+				GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, vb.m_id) );
+				program.bindAttributes(m_vertexLayouts[decl], stream.m_startVertex - baseVertex);
+
+				value.m_vertexBuffer[idx] = stream.m_handle.idx;
+			}
+
+			program.bindAttributesEnd();
+
+			GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ib) );
+
+			m_vaoCache.add(hash, value, _program.idx);
+
+			return baseVertex;
+		}
+
+		void drawElementsInstanced(GLenum _mode, uint32_t _count, GLenum _indexFormat, uint32_t _offset, uint32_t _numInstances)
+		{
+			if (0 != m_vaoBaseVertex)
+			{
+				GL_CHECK(glDrawElementsInstancedBaseVertex(_mode
+					, _count
+					, _indexFormat
+					, (void*)uintptr_t(_offset)
+					, _numInstances
+					, m_vaoBaseVertex
+					) );
+			}
+			else
+			{
+				GL_CHECK(glDrawElementsInstanced(_mode
+					, _count
+					, _indexFormat
+					, (void*)uintptr_t(_offset)
+					, _numInstances
+					) );
+			}
+		}
+
+		// Appends indirect command for _draw to the multi draw batch started by
+		// _first. Returns false if _draw can't be merged into the batch.
+		bool addMultiDraw(const RenderDraw& _first, const RenderDraw& _draw, const PrimInfo& _prim, uint32_t& _num)
+		{
+			if (_num == BX_COUNTOF(m_multiDrawCmd)
+			||  0 == _draw.m_streamMask
+			||  UINT8_MAX == _draw.m_streamMask
+			||  _first.m_streamMask != _draw.m_streamMask)
+			{
+				return false;
+			}
+
+			// Attributes are bound with the first draw's start vertex, all
+			// streams must be offset by the same amount to express it as
+			// base vertex.
+			int64_t baseVertex = -1;
+			for (uint32_t idx = 0, streamMask = _draw.m_streamMask
+				; 0 != streamMask
+				; streamMask >>= 1, idx += 1
+				)
+			{
+				const uint32_t ntz = bx::uint32_cnttz(streamMask);
+				streamMask >>= ntz;
+				idx         += ntz;
+
+				const Stream& first  = _first.m_stream[idx];
+				const Stream& stream = _draw.m_stream[idx];
+				const int64_t delta  = int64_t(stream.m_startVertex) - int64_t(first.m_startVertex);
+
+				if (first.m_handle.idx       != stream.m_handle.idx
+				||  first.m_layoutHandle.idx != stream.m_layoutHandle.idx
+				||  delta < 0
+				||  delta > INT32_MAX
+				|| (0 <= baseVertex && baseVertex != delta) )
+				{
+					return false;
+				}
+
+				baseVertex = delta;
+			}
+
+			const IndexBufferGL& ib = m_indexBuffers[_draw.m_indexBuffer.idx];
+			const uint32_t indexSize = 0 == (ib.m_flags & BGFX_BUFFER_INDEX32) ? 2 : 4;
+
+			DrawElementsIndirectCommandGL& cmd = m_multiDrawCmd[_num];
+			if (UINT32_MAX == _draw.m_numIndices)
+			{
+				cmd.m_count      = ib.m_size/indexSize;
+				cmd.m_firstIndex = 0;
+			}
+			else
+			{
+				cmd.m_count      = _draw.m_numIndices;
+				cmd.m_firstIndex = _draw.m_startIndex;
+			}
+
+			if (_prim.m_min > cmd.m_count)
+			{
+				return false;
+			}
+
+			// Base vertex applied to vertex array of the first draw.
+			baseVertex += m_vaoBaseVertex;
+			if (baseVertex > INT32_MAX)
+			{
+				return false;
+			}
+
+			cmd.m_instanceCount = _draw.m_numInstances;
+			cmd.m_baseVertex    = int32_t(baseVertex);
+			cmd.m_baseInstance  = 0;
+
+			++_num;
+
+			return true;
+		}
+
+		// Gathers _draw and following render items that differ from it only in
+		// index range, start vertex, and instance count into indirect commands.
+		// Returns number of gathered commands, or 0 if nothing could be merged.
+		uint32_t gatherMultiDraw(
+			  const Frame* _render
+			, const RenderDraw& _draw
+			, const RenderBind& _bind
+			, const PrimInfo& _prim
+			, uint16_t _view
+			, ProgramHandle _program
+			, int32_t _item
+			, int32_t _numItems
+			)
+		{
+			if (!m_multiDrawSupport
+			||  isValid(_draw.m_instanceDataBuffer)
+			||  isValid(_draw.m_occlusionQuery)
+			||  _item == _numItems)
+			{
+				return 0;
+			}
+
+			// Shaders read model matrices from uniforms, which are set once for
+			// the whole multi draw. Programs with vertex shader patched to the
+			// draw transform block read them per draw instead, other programs
+			// using model matrices merge only draws sharing the same transform.
+			const ProgramGL& program = m_program[_program.idx];
+			bool usesModel = false;
+			for (uint32_t ii = 0, num = program.m_numPredefined; ii < num && !usesModel; ++ii)
+			{
+				const uint8_t type = program.m_predefined[ii].m_type;
+				usesModel = false
+					|| PredefinedUniform::Model         == type
+					|| PredefinedUniform::ModelView     == type
+					|| PredefinedUniform::ModelViewProj == type
+					;
+			}
+
+			const bool drawTransform = usesModel && -1 != program.m_drawTransformLoc;
+			const uint32_t maxNum = drawTransform ? m_drawTransformMax : BX_COUNTOF(m_multiDrawCmd);
+
+			uint32_t num = 0;
+			if (!addMultiDraw(_draw, _draw, _prim, num) )
+			{
+				return 0;
+			}
+
+			m_multiDrawMatrix[0] = _draw.m_startMatrix;
+
+			SortKey key;
+			for (int32_t item = _item; item < _numItems; ++item)
+			{
+				const bool isCompute = key.decode(_render->m_sortKeys[item], _render->m_viewRemap);
+				if (isCompute
+				||  key.m_view != _view
+				||  key.m_program.idx != _program.idx)
+				{
+					break;
+				}
+
+				const uint32_t itemIdx = _render->m_sortValues[item];
+				const RenderDraw& draw = _render->m_renderItem[itemIdx].draw;
+				const RenderBind& bind = _render->m_renderItemBind[itemIdx];
+
+				if (draw.m_stateFlags  != _draw.m_stateFlags
+				||  draw.m_stencil     != _draw.m_stencil
+				||  draw.m_rgba        != _draw.m_rgba
+				||  draw.m_scissor     != _draw.m_scissor
+				||  draw.m_indexBuffer.idx != _draw.m_indexBuffer.idx
+				||  draw.m_uniformBegin != draw.m_uniformEnd
+				||  isValid(draw.m_instanceDataBuffer)
+				||  isValid(draw.m_indirectBuffer)
+				||  isValid(draw.m_occlusionQuery)
+				||  num == maxNum
+				|| (usesModel
+					&& !drawTransform
+					&& (draw.m_startMatrix != _draw.m_startMatrix || draw.m_numMatrices != _draw.m_numMatrices) ) )
+				{
+					break;
+				}
+
+				bool sameBind = true;
+				for (uint32_t stage = 0; stage < BGFX_CONFIG_MAX_TEXTURE_SAMPLERS && sameBind; ++stage)
+				{
+					const Binding& a = bind.m_bind[stage];
+					const Binding& b = _bind.m_bind[stage];
+					sameBind = a.m_idx == b.m_idx
+						&& (kInvalidHandle == a.m_idx
+							|| (true
+								&& a.m_samplerFlags == b.m_samplerFlags
+								&& a.m_type   == b.m_type
+								&& a.m_format == b.m_format
+								&& a.m_access == b.m_access
+								&& a.m_mip    == b.m_mip
+								)
+							)
+						;
+				}
+
+				if (!sameBind
+				||  !addMultiDraw(_draw, draw, _prim, num) )
+				{
+					break;
+				}
+
+				m_multiDrawMatrix[num-1] = draw.m_startMatrix;
+			}
+
+			m_multiDrawTransform = drawTransform;
+
+			return 1 < num ? num : 0;
+		}
+
+		// Uploads model, model view, and model view projection matrices of
+		// gathered draws into the uniform buffer, and binds them to the draw
+		// transform block.
+		void commitDrawTransforms(const Frame* _render, const ViewState& _viewState, uint16_t _view, uint32_t _num)
+		{
+			// Whole block must be backed by the bound range.
+			const uint32_t size = m_drawTransformMax*kDrawTransformSize;
+
+			GL_CHECK(glBindBuffer(GL_UNIFORM_BUFFER, m_uniformBuffer) );
+
+			if (m_uniformBufferOffset + size > BGFX_GL_CONFIG_UNIFORM_BUFFER_SIZE)
+			{
+				resetUniformBuffer();
+
+				// Orphaning dropped the current program's blocks.
+				commitUniformBlocks();
+			}
+
+			const Matrix4* matrixCache = _render->m_frameCache.m_matrixCache.m_cache;
+			const Matrix4& view        = _viewState.m_view[_view];
+			const Matrix4& viewProj    = _viewState.m_viewProj[_view];
+
+			Matrix4* transform = m_drawTransform;
+			for (uint32_t ii = 0; ii < _num; ++ii, transform += 3)
+			{
+				const Matrix4& model = matrixCache[m_multiDrawMatrix[ii] ];
+				transform[0] = model;
+				bx::model4x4_mul(&transform[1].un.f4x4, &model.un.f4x4, &view.un.f4x4);
+				bx::model4x4_mul_viewproj4x4(&transform[2].un.f4x4, &model.un.f4x4, &viewProj.un.f4x4);
+			}
+
+			GL_CHECK(glBufferSubData(GL_UNIFORM_BUFFER
+				, m_uniformBufferOffset
+				, _num*kDrawTransformSize
+				, m_drawTransform
+				) );
+
+			GL_CHECK(glBindBufferRange(GL_UNIFORM_BUFFER
+				, UniformBlockGL::Count
+				, m_uniformBuffer
+				, m_uniformBufferOffset
+				, size
+				) );
+
+			m_uniformBufferOffset = bx::strideAlign(m_uniformBufferOffset + size, m_uniformBufferAlign);
+		}
+
+		// Uploads gathered indirect commands and issues them in one call.
+		void submitMultiDraw(
+			  const Frame* _render
+			, const ViewState& _viewState
+			, uint16_t _view
+			, const ProgramGL& _program
+			, const PrimInfo& _prim
+			, GLenum _indexFormat
+			, uint32_t _num
+			)
+		{
+			if (m_multiDrawTransform)
+			{
+				commitDrawTransforms(_render, _viewState, _view, _num);
+				setUniform1i(_program.m_drawTransformLoc, 1);
+			}
+
+			const uint32_t size = _num*sizeof(DrawElementsIndirectCommandGL);
+
+			GL_CHECK(glBindBuffer(GL_DRAW_INDIRECT_BUFFER, m_multiDrawBuffer) );
+
+			if (m_multiDrawBufferOffset + size > BGFX_GL_CONFIG_MULTI_DRAW_BUFFER_SIZE)
+			{
+				GL_CHECK(glBufferData(GL_DRAW_INDIRECT_BUFFER, BGFX_GL_CONFIG_MULTI_DRAW_BUFFER_SIZE, NULL, GL_STREAM_DRAW) );
+				m_multiDrawBufferOffset = 0;
+			}
+
+			GL_CHECK(glBufferSubData(GL_DRAW_INDIRECT_BUFFER, m_multiDrawBufferOffset, size, m_multiDrawCmd) );
+
+			GL_CHECK(glMultiDrawElementsIndirect(_prim.m_type
+				, _indexFormat
+				, (void*)uintptr_t(m_multiDrawBufferOffset)
+				, _num
+				, sizeof(DrawElementsIndirectCommandGL)
+				) );
+
+			m_multiDrawBufferOffset += size;
+
+			if (m_multiDrawTransform)
+			{
+				setUniform1i(_program.m_drawTransformLoc, 0);
+			}
+		}
+
 		// Cache uniform uploads to avoid redundant uploading of state that is
 		// already set to a shader program
 		void setUniform1i(uint32_t loc, int value)
@@ -4297,6 +4936,12 @@ namespace bgfx { namespace gl
 		void setUniform4f(uint32_t loc, float x, float y, float z, float w)
 		{
 			UniformStateCache::f4 f; f.val[0] = x; f.val[1] = y; f.val[2] = z; f.val[3] = w;
+			if (0 != (loc & kUniformBlockLocBit) )
+			{
+				m_uniformBlockProgram->writeUniformBlock(loc, f.val, sizeof(f.val) );
+				return;
+			}
+
 			if (m_uniformStateCache.updateUniformCache(loc, f))
 			{
 				GL_CHECK(glUniform4f(loc, x, y, z, w));
@@ -4305,6 +4950,12 @@ namespace bgfx { namespace gl
 
 		void setUniform4fv(uint32_t loc, int num, const float *data)
 		{
+			if (0 != (loc & kUniformBlockLocBit) )
+			{
+				m_uniformBlockProgram->writeUniformBlock(loc, data, num*sizeof(float)*4);
+				return;
+			}
+
 			bool changed = false;
 			for(int i = 0; i < num; ++i)
 			{
@@ -4321,6 +4972,22 @@ namespace bgfx { namespace gl
 
 		void setUniformMatrix3fv(uint32_t loc, int num, GLboolean transpose, const float *data)
 		{
+			if (0 != (loc & kUniformBlockLocBit) )
+			{
+				// std140 pads each mat3 column to vec4.
+				for (int i = 0; i < num; ++i)
+				{
+					for (uint32_t col = 0; col < 3; ++col)
+					{
+						m_uniformBlockProgram->writeUniformBlock(loc + (i*3 + col)*sizeof(float)*4
+							, &data[9*i + 3*col]
+							, sizeof(float)*3
+							);
+					}
+				}
+				return;
+			}
+
 			bool changed = false;
 			for(int i = 0; i < num; ++i)
 			{
@@ -4337,6 +5004,12 @@ namespace bgfx { namespace gl
 
 		void setUniformMatrix4fv(uint32_t loc, int num, GLboolean transpose, const float *data)
 		{
+			if (0 != (loc & kUniformBlockLocBit) )
+			{
+				m_uniformBlockProgram->writeUniformBlock(loc, data, num*sizeof(float)*16);
+				return;
+			}
+
 			bool changed = false;
 			for(int i = 0; i < num; ++i)
 			{
@@ -4367,9 +5040,12 @@ namespace bgfx { namespace gl
 		void* m_uniforms[BGFX_CONFIG_MAX_UNIFORMS];
 
 		TimerQueryGL m_gpuTimer;
+		DrawTimerQueryGL m_drawTimer;
+		DrawProfiler<DrawTimerQueryGL> m_drawProfiler;
 		OcclusionQueryGL m_occlusionQuery;
 
 		SamplerStateCache m_samplerStateCache;
+		StateCacheLru<VertexArrayGL, BGFX_GL_CONFIG_VAO_CACHE_SIZE> m_vaoCache;
 		UniformStateCache m_uniformStateCache;
 
 		TextVideoMem m_textVideoMem;
@@ -4385,10 +5061,29 @@ namespace bgfx { namespace gl
 		float m_maxAnisotropyDefault;
 		int32_t m_maxMsaa;
 		GLuint m_vao;
+		GLuint m_uniformBuffer;
+		uint32_t m_uniformBufferOffset;
+		uint32_t m_uniformBufferAlign;
+		uint32_t m_uniformBufferFrame;
+		ProgramGL* m_uniformBlockProgram;
+		const ProgramGL* m_uniformBlockBound;
+		GLuint m_multiDrawBuffer;
+		uint32_t m_multiDrawBufferOffset;
+		DrawElementsIndirectCommandGL m_multiDrawCmd[BGFX_GL_CONFIG_MULTI_DRAW_MAX];
+		uint32_t m_multiDrawMatrix[BGFX_GL_CONFIG_MULTI_DRAW_MAX]; // Start matrix of each gathered draw.
+		Matrix4 m_drawTransform[BGFX_GL_CONFIG_MULTI_DRAW_MAX*3];
+		uint32_t m_drawTransformMax;
+		bool m_multiDrawTransform; // Gathered draws source transforms from the draw transform block.
+		uint32_t m_vaoBaseVertex;
 		uint16_t m_maxLabelLen;
 		bool m_blitSupported;
 		bool m_readBackSupported;
 		bool m_vaoSupport;
+		bool m_vaoCacheSupport;
+		bool m_baseVertexSupport;
+		bool m_uniformBufferSupport;
+		bool m_multiDrawSupport;
+		bool m_drawTransformSupport;
 		bool m_samplerObjectSupport;
 		bool m_shadowSamplersSupport;
 		bool m_srgbWriteControlSupport;
@@ -4668,6 +5363,13 @@ namespace bgfx { namespace gl
 
 		init();
 
+		if (_fsh.m_usesModel)
+		{
+			// Fragment shader would still read model matrices of the first
+			// draw from uniforms.
+			m_drawTransformLoc = -1;
+		}
+
 		if (!cached
 		&&  s_renderGL->m_workaround.m_detachShader)
 		{
@@ -4691,6 +5393,15 @@ namespace bgfx { namespace gl
 		}
 		m_numPredefined = 0;
 
+		if (NULL != m_uniformBlockData)
+		{
+			BX_FREE(g_allocator, m_uniformBlockData);
+			m_uniformBlockData = NULL;
+		}
+		m_uniformBlockSize   = 0;
+		m_uniformBufferFrame = UINT32_MAX;
+		m_uniformBlockDirty  = false;
+
 		if (0 != m_id)
 		{
 			s_renderGL->setProgram(0);
@@ -4775,6 +5486,54 @@ namespace bgfx { namespace gl
 		m_numPredefined = 0;
 		m_numSamplers = 0;
 
+		GLuint blockIndex[UniformBlockGL::Count];
+		m_uniformBlockSize = 0;
+
+		for (uint32_t ii = 0; ii < UniformBlockGL::Count; ++ii)
+		{
+			UniformBlockGL& block = m_uniformBlock[ii];
+			block.m_offset = m_uniformBlockSize;
+			block.m_size   = 0;
+			blockIndex[ii] = GL_INVALID_INDEX;
+
+			if (s_renderGL->m_uniformBufferSupport)
+			{
+				blockIndex[ii] = glGetUniformBlockIndex(m_id, s_uniformBlockName[ii].m_block);
+			}
+
+			if (GL_INVALID_INDEX != blockIndex[ii])
+			{
+				GLint size = 0;
+				GL_CHECK(glGetActiveUniformBlockiv(m_id, blockIndex[ii], GL_UNIFORM_BLOCK_DATA_SIZE, &size) );
+				GL_CHECK(glUniformBlockBinding(m_id, blockIndex[ii], ii) );
+
+				block.m_size       = uint32_t(size);
+				m_uniformBlockSize = bx::strideAlign(m_uniformBlockSize + block.m_size, s_renderGL->m_uniformBufferAlign);
+
+				BX_TRACE("Uniform block %s, size %d, binding %d.", s_uniformBlockName[ii].m_block, size, ii);
+			}
+		}
+
+		m_drawTransformLoc = -1;
+
+		if (s_renderGL->m_drawTransformSupport)
+		{
+			const GLuint index = glGetUniformBlockIndex(m_id, "bgfx_DrawTransform");
+			if (GL_INVALID_INDEX != index)
+			{
+				GL_CHECK(glUniformBlockBinding(m_id, index, UniformBlockGL::Count) );
+				m_drawTransformLoc = glGetUniformLocation(m_id, "bgfx_drawTransformEnabled");
+			}
+		}
+
+		if (0 != m_uniformBlockSize)
+		{
+			m_uniformBlockData = (uint8_t*)BX_REALLOC(g_allocator, m_uniformBlockData, m_uniformBlockSize);
+			bx::memSet(m_uniformBlockData, 0, m_uniformBlockSize);
+			m_uniformBufferFrame = UINT32_MAX;
+			m_uniformBlockDirty  = true;
+		}
+
 		BX_TRACE("Uniforms (%d):", activeUniforms);
 		for (int32_t ii = 0; ii < activeUniforms; ++ii)
 		{
@@ -4823,6 +5582,39 @@ namespace bgfx { namespace gl
 
 			num = bx::uint32_max(num, 1);
 
+			if (0 == bx::strCmp(name, "bgfx_draw", 9) )
+			{
+				// Draw transform block is set by renderer.
+				continue;
+			}
+
+			if (-1 == loc
+			&&  0 != m_uniformBlockSize)
+			{
+				const GLuint index = GLuint(ii);
+				GLint block       = -1;
+				GLint blockOffset = 0;
+				GL_CHECK(glGetActiveUniformsiv(m_id, 1, &index, GL_UNIFORM_BLOCK_INDEX, &block) );
+				GL_CHECK(glGetActiveUniformsiv(m_id, 1, &index, GL_UNIFORM_OFFSET,      &blockOffset) );
+
+				for (uint32_t jj = 0; jj < UniformBlockGL::Count; ++jj)
+				{
+					if (GLuint(block) == blockIndex[jj])
+					{
+						loc = GLint(kUniformBlockLocBit | (m_uniformBlock[jj].m_offset + blockOffset) );
+						break;
+					}
+				}
+
+				// Block members are reported as "<block>.<member>".
+				const bx::StringView member = bx::strFind(name, '.');
+				if (!member.isEmpty() )
+				{
+					const char* ptr = member.getPtr()+1;
+					bx::memMove(name, ptr, bx::strLen(ptr)+1);
+				}
+			}
+
 			int32_t offset = 0;
 			const bx::StringView array = bx::strFind(name, '[');
 			if (!array.isEmpty() )
@@ -5093,6 +5885,11 @@ namespace bgfx { namespace gl
 		}
 	}
 
+	void release(VertexArrayGL _vao)
+	{
+		GL_CHECK(glDeleteVertexArrays(1, &_vao.m_id) );
+	}
+
 	void IndexBufferGL::destroy()
 	{
 		GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0) );
@@ -5782,6 +6579,218 @@ namespace bgfx { namespace gl
 		bx::memCopy(_str, _insert, len);
 	}
 
+	static bx::StringView nextWord(bx::StringView& _parse)
+	{
+		bx::StringView word = bx::strWord(bx::strLTrimSpace(_parse) );
+		_parse = bx::strLTrimSpace(bx::StringView(word.getTerm(), _parse.getTerm() ) );
+		return word;
+	}
+
+	// Parses "uniform [precision] <vec4|mat3|mat4> <name>[<num>];" line, and
+	// returns declaration without uniform qualifier, and uniform name.
+	static bool parseBlockUniform(const bx::StringView& _line, bx::StringView& _outDecl, bx::StringView& _outName)
+	{
+		bx::StringView parse = bx::strLTrimSpace(_line);
+
+		if (0 != bx::strCmp(parse, "uniform ", 8) )
+		{
+			return false;
+		}
+
+		parse = bx::strLTrimSpace(bx::StringView(parse.getPtr()+8, parse.getTerm() ) );
+		const char* decl = parse.getPtr();
+
+		bx::StringView typen = nextWord(parse);
+
+		if (0 == bx::strCmp(typen, "lowp", 4)
+		||  0 == bx::strCmp(typen, "mediump", 7)
+		||  0 == bx::strCmp(typen, "highp", 5) )
+		{
+			typen = nextWord(parse);
+		}
+
+		if (4 != typen.getLength()
+		|| (0 != bx::strCmp(typen, "vec4", 4)
+		&&  0 != bx::strCmp(typen, "mat3", 4)
+		&&  0 != bx::strCmp(typen, "mat4", 4) ) )
+		{
+			return false;
+		}
+
+		_outName = nextWord(parse);
+
+		const bx::StringView semicolon = bx::strFind(parse, ';');
+		if (_outName.isEmpty()
+		||  semicolon.isEmpty() )
+		{
+			return false;
+		}
+
+		_outDecl.set(decl, semicolon.getTerm() );
+
+		return true;
+	}
+
+	// Writes shader code with all loose vec4/mat3/mat4 uniforms moved into
+	// std140 uniform block of the shader stage. Uniform names are remapped to
+	// block instance members, so the rest of the code stays the same.
+	static void writeUniformBlock(bx::WriterI* _writer, const bx::StringView& _code, UniformBlockGL::Enum _stage)
+	{
+		const UniformBlockNameGL& blockName = s_uniformBlockName[_stage];
+
+		bx::Error err;
+		bool blockWritten = false;
+
+		for (bx::LineReader lr(_code); !lr.isDone();)
+		{
+			const bx::StringView line = lr.next();
+
+			bx::StringView decl;
+			bx::StringView name;
+
+			if (!parseBlockUniform(line, decl, name) )
+			{
+				bx::write(_writer, line.getPtr(), line.getLength() );
+				bx::write(_writer, '\n');
+				continue;
+			}
+
+			if (blockWritten)
+			{
+				continue;
+			}
+
+			blockWritten = true;
+
+			bx::write(_writer, &err, "layout(std140) uniform %s\n{\n", blockName.m_block);
+
+			for (bx::LineReader members(_code); !members.isDone();)
+			{
+				if (parseBlockUniform(members.next(), decl, name) )
+				{
+					bx::write(_writer, &err, "\t%.*s\n", decl.getLength(), decl.getPtr() );
+				}
+			}
+
+			bx::write(_writer, &err, "} %s;\n", blockName.m_instance);
+
+			for (bx::LineReader members(_code); !members.isDone();)
+			{
+				if (parseBlockUniform(members.next(), decl, name) )
+				{
+					bx::write(_writer, &err, "#define %.*s %s.%.*s\n"
+						, name.getLength()
+						, name.getPtr()
+						, blockName.m_instance
+						, name.getLength()
+						, name.getPtr()
+						);
+				}
+			}
+		}
+	}
+
+	// Returns next model matrix uniform read in _str, or empty view at the end.
+	static bx::StringView findModelUniform(const bx::StringView& _str, uint32_t& _outIdx)
+	{
+		bx::StringView result(_str.getTerm(), _str.getTerm() );
+
+		for (uint32_t ii = 0; NULL != s_modelUniform[ii]; ++ii)
+		{
+			const bx::StringView match = bx::findIdentifierMatch(_str, s_modelUniform[ii]);
+			if (!match.isEmpty()
+			&&  match.getPtr() < result.getPtr() )
+			{
+				result  = match;
+				_outIdx = ii;
+			}
+		}
+
+		return result;
+	}
+
+	// Returns true if vertex shader reads model matrices only as u_model[0],
+	// u_modelView, and u_modelViewProj, so they can be sourced per draw.
+	static bool isDrawTransformCompatible(const bx::StringView& _code)
+	{
+		for (bx::LineReader lr(_code); !lr.isDone();)
+		{
+			const bx::StringView line = lr.next();
+
+			if (0 == bx::strCmp(bx::strLTrimSpace(line), "uniform ", 8) )
+			{
+				continue;
+			}
+
+			for (bx::StringView parse = line;;)
+			{
+				const bx::StringView model = bx::findIdentifierMatch(parse, "u_model");
+				if (model.isEmpty() )
+				{
+					break;
+				}
+
+				if (0 != bx::strCmp(bx::StringView(model.getPtr(), line.getTerm() ), "u_model[0]", 10) )
+				{
+					return false;
+				}
+
+				parse.set(model.getTerm(), line.getTerm() );
+			}
+		}
+
+		return true;
+	}
+
+	// Writes vertex shader code with model matrix reads replaced by lookups into
+	// the draw transform block. Block is indexed by gl_DrawIDARB while multi draw
+	// with per draw transforms is submitted, otherwise uniforms are used.
+	static void writeDrawTransform(bx::WriterI* _writer, const bx::StringView& _code, uint32_t _num)
+	{
+		bx::Error err;
+
+		bx::write(_writer, &err
+			, "#extension GL_ARB_shader_draw_parameters : enable\n"
+			  "layout(std140) uniform bgfx_DrawTransform\n"
+			  "{\n"
+			  "\tmat4 bgfx_drawTransform[%d];\n"
+			  "};\n"
+			  "uniform int bgfx_drawTransformEnabled;\n"
+			  "mat4 bgfx_drawMatrix(mat4 _uniform, int _idx)\n"
+			  "{\n"
+			  "\treturn 0 != bgfx_drawTransformEnabled ? bgfx_drawTransform[gl_DrawIDARB*3 + _idx] : _uniform;\n"
+			  "}\n"
+			, _num*3
+			);
+
+		for (bx::LineReader lr(_code); !lr.isDone();)
+		{
+			const bx::StringView line = lr.next();
+			bx::StringView parse = line;
+
+			if (0 != bx::strCmp(bx::strLTrimSpace(line), "uniform ", 8) )
+			{
+				uint32_t idx = 0;
+				for (bx::StringView model = findModelUniform(parse, idx)
+					; !model.isEmpty()
+					; model = findModelUniform(parse, idx)
+					)
+				{
+					// u_model is only read as u_model[0].
+					const int32_t len = 0 == idx ? 10 : model.getLength();
+
+					bx::write(_writer, parse.getPtr(), int32_t(model.getPtr() - parse.getPtr() ) );
+					bx::write(_writer, &err, "bgfx_drawMatrix(%.*s, %d)", len, model.getPtr(), idx);
+
+					parse.set(model.getPtr() + len, line.getTerm() );
+				}
+			}
+
+			bx::write(_writer, parse.getPtr(), parse.getLength() );
+			bx::write(_writer, '\n');
+		}
+	}
+
 	void ShaderGL::create(const Memory* _mem)
 	{
 		bx::MemoryReader reader(_mem->data, _mem->size);
@@ -5865,10 +6874,29 @@ namespace bgfx { namespace gl
 #if !defined NM_PLATFORM_ORBIS
 			bx::StringView code((const char*)reader.getDataPtr(), shaderSize);
 
+			m_usesModel = !bx::findIdentifierMatch(code, s_modelUniform).isEmpty();
+
+			if (GL_VERTEX_SHADER == m_type
+			&&  m_usesModel
+			&&  s_renderGL->m_drawTransformSupport
+			&&  0 != bx::strCmp(code, "#version", 8)
+			&&  isDrawTransformCompatible(code) )
+			{
+				// Each replaced read grows by at most 3x.
+				int32_t patchLen = code.getLength()*3 + (1<<10);
+				char* patch = (char*)alloca(patchLen);
+				bx::StaticMemoryBlockWriter writer(patch, patchLen);
+
+				writeDrawTransform(&writer, code, s_renderGL->m_drawTransformMax);
+				bx::write(&writer, '\0');
+
+				code.set(patch);
+			}
+
 			if (GL_COMPUTE_SHADER != m_type
 			&&  0 != bx::strCmp(code, "#version 430", 12) ) // #2000
 			{
-				int32_t tempLen = code.getLength() + (4<<10);
+				int32_t tempLen = code.getLength() + (8<<10);
 				char* temp = (char*)alloca(tempLen);
 				bx::StaticMemoryBlockWriter writer(temp, tempLen);
 
@@ -6364,7 +7392,18 @@ namespace bgfx { namespace gl
 							);
 					}
 
-					bx::write(&writer, code.getPtr(), code.getLength() );
+					if (s_renderGL->m_uniformBufferSupport)
+					{
+						writeUniformBlock(&writer
+							, code
+							, GL_FRAGMENT_SHADER == m_type ? UniformBlockGL::Fragment : UniformBlockGL::Vertex
+							);
+					}
+					else
+					{
+						bx::write(&writer, code.getPtr(), code.getLength() );
+					}
+
 					bx::write(&writer, '\0');
 				}
 
@@ -6983,6 +8022,9 @@ namespace bgfx { namespace gl
 		if (1 < m_numWindows
 		&&  m_vaoSupport)
 		{
+			m_vaoCache.invalidate();
+			m_vaoCacheSupport = false;
+			m_baseVertexSupport = false;
 			m_vaoSupport = false;
 			GL_CHECK(glBindVertexArray(0) );
 			GL_CHECK(glDeleteVertexArrays(1, &m_vao) );
@@ -7000,6 +8042,16 @@ namespace bgfx { namespace gl
 
 		updateResolution(_render->m_resolution);
 
+		resetUniformBuffer();
+
+		if (m_multiDrawSupport)
+		{
+			GL_CHECK(glBindBuffer(GL_DRAW_INDIRECT_BUFFER, m_multiDrawBuffer) );
+			GL_CHECK(glBufferData(GL_DRAW_INDIRECT_BUFFER, BGFX_GL_CONFIG_MULTI_DRAW_BUFFER_SIZE, NULL, GL_STREAM_DRAW) );
+			GL_CHECK(glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0) );
+			m_multiDrawBufferOffset = 0;
+		}
+
 		int64_t timeBegin = bx::getHPCounter();
 		int64_t captureElapsed = 0;
 
@@ -7030,6 +8082,7 @@ namespace bgfx { namespace gl
 
 		RenderDraw currentState;
 		currentState.clear();
+		m_vaoBaseVertex = 0;
 		currentState.m_stateFlags = BGFX_STATE_NONE;
 		currentState.m_stencil    = packStencil(BGFX_STENCIL_NONE, BGFX_STENCIL_NONE);
 
@@ -7089,6 +8142,10 @@ namespace bgfx { namespace gl
 			, m_timerQuerySupport && !BX_ENABLED(BX_PLATFORM_OSX)
 			);
 
+		m_drawProfiler.begin(_render
+			, m_timerQuerySupport && !BX_ENABLED(BX_PLATFORM_OSX) ? &m_drawTimer : NULL
+			);
+
 		if (m_occlusionQuerySupport)
 		{
 			m_occlusionQuery.resolve(_render);
@@ -7122,6 +8179,8 @@ namespace bgfx { namespace gl
 					view = key.m_view;
 					currentProgram = BGFX_INVALID_HANDLE;
 
+					m_drawProfiler.endQuery();
+
 					if (item > 1)
 					{
 						profiler.end();
@@ -7172,6 +8231,8 @@ namespace bgfx { namespace gl
 
 				if (isCompute)
 				{
+					m_drawProfiler.endQuery();
+
 					if (!wasCompute)
 					{
 						wasCompute = true;
@@ -7186,7 +8247,7 @@ namespace bgfx { namespace gl
 						const RenderCompute& compute = renderItem.compute;
 
 						ProgramGL& program = m_program[key.m_program.idx];
-						setProgram(program.m_id);
+						setProgram(program);
 
 						GLbitfield barrier = 0;
 						for (uint32_t ii = 0; ii < maxComputeBindings; ++ii)
@@ -7303,6 +8364,8 @@ namespace bgfx { namespace gl
 
 				const RenderDraw& draw = renderItem.draw;
 
+				m_drawProfiler.beginDraw();
+
 				const bool hasOcclusionQuery = 0 != (draw.m_stateFlags & BGFX_STATE_INTERNAL_OCCLUSION_QUERY);
 				{
 					const bool occluded = true
@@ -7684,7 +8747,14 @@ namespace bgfx { namespace gl
 					// Skip rendering if program index is valid, but program is invalid.
 					currentProgram = 0 == id ? ProgramHandle{kInvalidHandle} : currentProgram;
 
-					setProgram(id);
+					if (isValid(currentProgram) )
+					{
+						setProgram(m_program[currentProgram.idx]);
+					}
+					else
+					{
+						setProgram(0);
+					}
 					programChanged =
 						constantsChanged =
 						bindAttribs = true;
@@ -7795,15 +8865,19 @@ namespace bgfx { namespace gl
 						{
 							currentState.m_indexBuffer = draw.m_indexBuffer;
 
-							uint16_t handle = draw.m_indexBuffer.idx;
-							if (kInvalidHandle != handle)
-							{
-								IndexBufferGL& ib = m_indexBuffers[handle];
-								GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ib.m_id) );
-							}
-							else
+							// Index buffer binding is part of cached vertex array state.
+							if (!m_vaoCacheSupport)
 							{
-								GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0) );
+								uint16_t handle = draw.m_indexBuffer.idx;
+								if (kInvalidHandle != handle)
+								{
+									IndexBufferGL& ib = m_indexBuffers[handle];
+									GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ib.m_id) );
+								}
+								else
+								{
+									GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0) );
+								}
 							}
 
 							diffIndexBuffer = true;
@@ -7815,7 +8889,36 @@ namespace bgfx { namespace gl
 							diffIndexBuffer = true;
 						}
 
-						if (0 != currentState.m_streamMask)
+						if (m_vaoCacheSupport)
+						{
+							for (uint32_t idx = 0, streamMask = draw.m_streamMask
+								; 0 != streamMask
+								; streamMask >>= 1, idx += 1
+								)
+							{
+								const uint32_t ntz = bx::uint32_cnttz(streamMask);
+								streamMask >>= ntz;
+								idx         += ntz;
+
+								if (currentState.m_stream[idx].m_startVertex != draw.m_stream[idx].m_startVertex)
+								{
+									currentState.m_stream[idx].m_startVertex = draw.m_stream[idx].m_startVertex;
+									bindAttribs = true;
+								}
+							}
+
+							if (bindAttribs || diffIndexBuffer)
+							{
+								m_vaoBaseVertex = bindVertexArray(draw, currentProgram);
+
+								if (isValid(draw.m_instanceDataBuffer) )
+								{
+									GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffers[draw.m_instanceDataBuffer.idx].m_id) );
+									program.bindInstanceData(draw.m_instanceDataStride, draw.m_instanceDataOffset);
+								}
+							}
+						}
+						else if (0 != currentState.m_streamMask)
 						{
 							bool diffStartVertex = false;
 							for (uint32_t idx = 0, streamMask = draw.m_streamMask
@@ -7909,6 +9012,11 @@ namespace bgfx { namespace gl
 						uint32_t numInstances      = 0;
 						uint32_t numPrimsRendered  = 0;
 						uint32_t numDrawIndirect   = 0;
+						uint32_t numDrawMerged     = 1;
+
+						commitUniformBlocks();
+
+						m_drawProfiler.submitDraw(currentProgram, view);
 
 						if (hasOcclusionQuery)
 						{
@@ -7978,19 +9086,43 @@ namespace bgfx { namespace gl
 									: GL_UNSIGNED_INT
 									;
 
-								if (UINT32_MAX == draw.m_numIndices)
+								const uint32_t numMultiDraw = hasOcclusionQuery
+									? 0
+									: gatherMultiDraw(_render, draw, renderBind, prim, view, currentProgram, item, numItems)
+									;
+
+								if (0 != numMultiDraw)
+								{
+									submitMultiDraw(_render, viewState, view, m_program[currentProgram.idx], prim, indexFormat, numMultiDraw);
+
+									for (uint32_t ii = 0; ii < numMultiDraw; ++ii)
+									{
+										const DrawElementsIndirectCommandGL& cmd = m_multiDrawCmd[ii];
+										const uint32_t prims = cmd.m_count/prim.m_div - prim.m_sub;
+										numIndices        += cmd.m_count;
+										numPrimsSubmitted += prims;
+										numInstances      += cmd.m_instanceCount;
+										numPrimsRendered  += prims*cmd.m_instanceCount;
+									}
+
+									// Skip render items merged into this draw.
+									numDrawMerged = numMultiDraw;
+									item += numMultiDraw - 1;
+									statsKeyType[0] += numMultiDraw - 1;
+								}
+								else if (UINT32_MAX == draw.m_numIndices)
 								{
 									numIndices        = ib.m_size/indexSize;
 									numPrimsSubmitted = numIndices/prim.m_div - prim.m_sub;
 									numInstances      = draw.m_numInstances;
 									numPrimsRendered  = numPrimsSubmitted*draw.m_numInstances;
 
-									GL_CHECK(glDrawElementsInstanced(prim.m_type
+									drawElementsInstanced(prim.m_type
 										, numIndices
 										, indexFormat
-										, (void*)0
+										, 0
 										, draw.m_numInstances
-										) );
+										);
 								}
 								else if (prim.m_min <= draw.m_numIndices)
 								{
@@ -7999,12 +9131,12 @@ namespace bgfx { namespace gl
 									numInstances = draw.m_numInstances;
 									numPrimsRendered = numPrimsSubmitted*draw.m_numInstances;
 
-									GL_CHECK(glDrawElementsInstanced(prim.m_type
+									drawElementsInstanced(prim.m_type
 										, numIndices
 										, indexFormat
-										, (void*)(uintptr_t)(draw.m_startIndex*indexSize)
+										, draw.m_startIndex*indexSize
 										, draw.m_numInstances
-										) );
+										);
 								}
 							}
 							else
@@ -8014,7 +9146,7 @@ namespace bgfx { namespace gl
 								numPrimsRendered = numPrimsSubmitted*draw.m_numInstances;
 
 								GL_CHECK(glDrawArraysInstanced(prim.m_type
-									, 0
+									, m_vaoBaseVertex
 									, numVertices
 									, draw.m_numInstances
 									) );
@@ -8035,6 +9167,8 @@ namespace bgfx { namespace gl
 						statsNumPrimsRendered[primIndex]  += numPrimsRendered;
 						statsNumInstances[primIndex]      += numInstances;
 						statsNumIndices += numIndices;
+
+						m_drawProfiler.endDraw(numDrawMerged);
 					}
 				}
 			}
@@ -8045,6 +9179,8 @@ namespace bgfx { namespace gl
 				boundProgram = BGFX_INVALID_HANDLE;
 			}
 
+			m_drawProfiler.end();
+
 			if (wasCompute)
 			{
 				setViewType(view, "C");
@@ -8202,9 +9338,10 @@ namespace bgfx { namespace gl
 
 				pos++;
 				tvm.printf(10, pos++, 0x8b, " State cache:     ");
-				tvm.printf(10, pos++, 0x8b, " Sampler ");
-				tvm.printf(10, pos++, 0x8b, " %6d  "
+				tvm.printf(10, pos++, 0x8b, " Sampler   VAO ");
+				tvm.printf(10, pos++, 0x8b, " %6d  %4d "
 					, m_samplerStateCache.getCount()
+					, m_vaoCache.getCount()
 					);
 
 #if BGFX_CONFIG_RENDERER_OPENGL
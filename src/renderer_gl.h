@@ -38,6 +38,45 @@
 // on the following platforms.
 #define BGFX_GL_CONFIG_UNIFORM_CACHE BX_PLATFORM_EMSCRIPTEN
 
+// Pack vec4/mat3/mat4 uniforms into std140 uniform blocks and upload them
+// per draw into ranges of one orphaned uniform buffer on GL 3.1+/ES 3.0.
+#ifndef BGFX_GL_CONFIG_UNIFORM_BUFFER
+#	define BGFX_GL_CONFIG_UNIFORM_BUFFER (BGFX_CONFIG_RENDERER_OPENGL >= 31 || BGFX_CONFIG_RENDERER_OPENGLES >= 30)
+#endif // BGFX_GL_CONFIG_UNIFORM_BUFFER
+
+#ifndef BGFX_GL_CONFIG_UNIFORM_BUFFER_SIZE
+#	define BGFX_GL_CONFIG_UNIFORM_BUFFER_SIZE (4<<20)
+#endif // BGFX_GL_CONFIG_UNIFORM_BUFFER_SIZE
+
+// Merge consecutive compatible indexed draws into one glMultiDrawElementsIndirect
+// call when multi draw indirect is natively supported. With ARB_shader_draw_parameters
+// (core in GL 4.6) vertex shaders reading u_model[0], u_modelView, or u_modelViewProj
+// are patched to fetch them from a per-draw transform uniform block indexed by
+// gl_DrawIDARB, so draws differing only in transform are merged too. Otherwise
+// draws of programs using model matrices merge only when they share the same
+// transform.
+#ifndef BGFX_GL_CONFIG_MULTI_DRAW
+#	define BGFX_GL_CONFIG_MULTI_DRAW 1
+#endif // BGFX_GL_CONFIG_MULTI_DRAW
+
+#ifndef BGFX_GL_CONFIG_MULTI_DRAW_MAX
+#	define BGFX_GL_CONFIG_MULTI_DRAW_MAX 1024
+#endif // BGFX_GL_CONFIG_MULTI_DRAW_MAX
+
+#ifndef BGFX_GL_CONFIG_MULTI_DRAW_BUFFER_SIZE
+#	define BGFX_GL_CONFIG_MULTI_DRAW_BUFFER_SIZE (1<<20)
+#endif // BGFX_GL_CONFIG_MULTI_DRAW_BUFFER_SIZE
+
+// Cache vertex array objects per program, vertex streams, and index buffer
+// combination instead of respecifying attributes on every change.
+#ifndef BGFX_GL_CONFIG_VAO_CACHE
+#	define BGFX_GL_CONFIG_VAO_CACHE 1
+#endif // BGFX_GL_CONFIG_VAO_CACHE
+
+#ifndef BGFX_GL_CONFIG_VAO_CACHE_SIZE
+#	define BGFX_GL_CONFIG_VAO_CACHE_SIZE 512
+#endif // BGFX_GL_CONFIG_VAO_CACHE_SIZE
+
 #define BGFX_GL_PROFILER_BEGIN(_view, _abgr)                                               \
 	BX_MACRO_BLOCK_BEGIN                                                                   \
 		GL_CHECK(glPushDebugGroup(GL_DEBUG_SOURCE_APPLICATION, 0, -1, s_viewName[view]) ); \
@@ -1058,6 +1097,38 @@ typedef uint64_t GLuint64;
 #	define GL_MAX_NAME_LENGTH 0x92F6
 #endif // GL_MAX_NAME_LENGTH
 
+#ifndef GL_UNIFORM_BUFFER
+#	define GL_UNIFORM_BUFFER 0x8A11
+#endif // GL_UNIFORM_BUFFER
+
+#ifndef GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT
+#	define GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT 0x8A34
+#endif // GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT
+
+#ifndef GL_MAX_UNIFORM_BLOCK_SIZE
+#	define GL_MAX_UNIFORM_BLOCK_SIZE 0x8A30
+#endif // GL_MAX_UNIFORM_BLOCK_SIZE
+
+#ifndef GL_UNIFORM_BLOCK_INDEX
+#	define GL_UNIFORM_BLOCK_INDEX 0x8A3A
+#endif // GL_UNIFORM_BLOCK_INDEX
+
+#ifndef GL_UNIFORM_OFFSET
+#	define GL_UNIFORM_OFFSET 0x8A3B
+#endif // GL_UNIFORM_OFFSET
+
+#ifndef GL_UNIFORM_BLOCK_DATA_SIZE
+#	define GL_UNIFORM_BLOCK_DATA_SIZE 0x8A40
+#endif // GL_UNIFORM_BLOCK_DATA_SIZE
+
+#ifndef GL_INVALID_INDEX
+#	define GL_INVALID_INDEX 0xFFFFFFFFu
+#endif // GL_INVALID_INDEX
+
+#ifndef GL_STREAM_DRAW
+#	define GL_STREAM_DRAW 0x88E0
+#endif // GL_STREAM_DRAW
+
 #ifndef GL_DEBUG_SEVERITY_NOTIFICATION
 #	define GL_DEBUG_SEVERITY_NOTIFICATION 0x826b
 #endif // GL_DEBUG_SEVERITY_NOTIFICATION
@@ -1308,14 +1379,18 @@ namespace bgfx { namespace gl
 		{
 			BX_CHECK(0 != m_id, "Updating invalid index buffer.");
 
+			GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_id) );
+
 			//if (_discard)
 			{
-				// orphan buffer...
-				destroy();
-				create(m_size, NULL, m_flags);
+				// orphan buffer, keeping name so cached vertex arrays remain valid...
+				GL_CHECK(glBufferData(GL_ELEMENT_ARRAY_BUFFER
+					, m_size
+					, NULL
+					, GL_DYNAMIC_DRAW
+					) );
 			}
 
-			GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_id) );
 			GL_CHECK(glBufferSubData(GL_ELEMENT_ARRAY_BUFFER
 				, _offset
 				, _size
@@ -1405,6 +1480,44 @@ namespace bgfx { namespace gl
 		VertexLayoutHandle m_layoutHandle;
 	};
 
+	struct VertexArrayGL
+	{
+		GLuint   m_id;
+		uint16_t m_indexBuffer;
+		uint16_t m_vertexBuffer[BGFX_CONFIG_MAX_VERTEX_STREAMS];
+	};
+
+	// Matches cached vertex arrays referencing index or vertex buffer.
+	struct VertexArrayRefGL
+	{
+		bool operator()(const VertexArrayGL& _vao) const
+		{
+			if (kInvalidHandle != m_indexBuffer
+			&&  _vao.m_indexBuffer == m_indexBuffer)
+			{
+				return true;
+			}
+
+			if (kInvalidHandle != m_vertexBuffer)
+			{
+				for (uint32_t ii = 0; ii < BX_COUNTOF(_vao.m_vertexBuffer); ++ii)
+				{
+					if (_vao.m_vertexBuffer[ii] == m_vertexBuffer)
+					{
+						return true;
+					}
+				}
+			}
+
+			return false;
+		}
+
+		uint16_t m_indexBuffer;
+		uint16_t m_vertexBuffer;
+	};
+
+	void release(VertexArrayGL _vao);
+
 	struct TextureGL
 	{
 		TextureGL()
@@ -1458,6 +1571,7 @@ namespace bgfx { namespace gl
 			: m_id(0)
 			, m_type(0)
 			, m_hash(0)
+			, m_usesModel(false)
 		{
 			m_hash = 0;
 		}
@@ -1468,6 +1582,7 @@ namespace bgfx { namespace gl
 		GLuint m_id;
 		GLenum m_type;
 		uint32_t m_hash;
+		bool m_usesModel; // Reads model matrices, patched to draw transform block if vertex shader allows it.
 	};
 
 	struct FrameBufferGL
@@ -1500,12 +1615,50 @@ namespace bgfx { namespace gl
 		Attachment m_attachment[BGFX_CONFIG_MAX_FRAME_BUFFER_ATTACHMENTS];
 	};
 
+	// Uniform locations with this bit set are byte offsets into the program's
+	// uniform block shadow instead of glUniform* locations.
+	constexpr uint32_t kUniformBlockLocBit = UINT32_C(0x80000000);
+
+	// Per draw model, model view, and model view projection matrices in the
+	// draw transform uniform block.
+	constexpr uint32_t kDrawTransformSize = 3*16*sizeof(float);
+
+	struct UniformBlockGL
+	{
+		enum Enum
+		{
+			Vertex,
+			Fragment,
+
+			Count
+		};
+
+		uint32_t m_offset;
+		uint32_t m_size;
+	};
+
+	// Matches GL DrawElementsIndirectCommand layout.
+	struct DrawElementsIndirectCommandGL
+	{
+		uint32_t m_count;
+		uint32_t m_instanceCount;
+		uint32_t m_firstIndex;
+		int32_t  m_baseVertex;
+		uint32_t m_baseInstance;
+	};
+
 	struct ProgramGL
 	{
 		ProgramGL()
 			: m_id(0)
 			, m_constantBuffer(NULL)
 			, m_numPredefined(0)
+			, m_uniformBlockData(NULL)
+			, m_uniformBlockSize(0)
+			, m_uniformBufferOffset(0)
+			, m_uniformBufferFrame(UINT32_MAX)
+			, m_uniformBlockDirty(false)
+			, m_drawTransformLoc(-1)
 		{
 		}
 
@@ -1537,6 +1690,16 @@ namespace bgfx { namespace gl
 
 		void unbindAttributes();
 
+		void writeUniformBlock(uint32_t _loc, const void* _data, uint32_t _size)
+		{
+			uint8_t* dst = &m_uniformBlockData[_loc&~kUniformBlockLocBit];
+			if (0 != bx::memCmp(dst, _data, _size) )
+			{
+				bx::memCopy(dst, _data, _size);
+				m_uniformBlockDirty = true;
+			}
+		}
+
 		GLuint m_id;
 
 		uint8_t m_unboundUsedAttrib[Attrib::Count]; // For tracking unbound used attributes between begin()/end().
@@ -1549,8 +1712,17 @@ namespace bgfx { namespace gl
 		uint8_t m_numSamplers;
 
 		UniformBuffer* m_constantBuffer;
-		PredefinedUniform m_predefined[PredefinedUniform::Count];
+		PredefinedUniform m_predefined[PredefinedUniform::Count*UniformBlockGL::Count]; // Per stage when using uniform blocks.
 		uint8_t m_numPredefined;
+
+		UniformBlockGL m_uniformBlock[UniformBlockGL::Count];
+		uint8_t* m_uniformBlockData;    // CPU copy of all stage blocks, uploaded when dirty.
+		uint32_t m_uniformBlockSize;
+		uint32_t m_uniformBufferOffset; // Offset of the last upload into the shared uniform buffer.
+		uint32_t m_uniformBufferFrame;  // Uniform buffer generation of the last upload.
+		bool     m_uniformBlockDirty;
+
+		GLint m_drawTransformLoc; // Switches vertex shader to draw transform block, -1 if not patched.
 	};
 
 	struct TimerQueryGL
@@ -1694,6 +1866,195 @@ namespace bgfx { namespace gl
 		bx::RingBufferControl m_control;
 	};
 
+	// Timestamp queries around groups of draw calls, elapsed time accumulates
+	// per key until consumed. Never stalls, begin fails when out of queries.
+	struct DrawTimerQueryGL
+	{
+		DrawTimerQueryGL()
+			: m_control(BX_COUNTOF(m_query) )
+		{
+		}
+
+		void create()
+		{
+			for (uint32_t ii = 0; ii < BX_COUNTOF(m_query); ++ii)
+			{
+				Query& query = m_query[ii];
+				query.m_ready = false;
+				GL_CHECK(glGenQueries(1, &query.m_begin) );
+				GL_CHECK(glGenQueries(1, &query.m_end) );
+			}
+
+			reset();
+		}
+
+		void destroy()
+		{
+			for (uint32_t ii = 0; ii < BX_COUNTOF(m_query); ++ii)
+			{
+				Query& query = m_query[ii];
+				GL_CHECK(glDeleteQueries(1, &query.m_begin) );
+				GL_CHECK(glDeleteQueries(1, &query.m_end) );
+			}
+		}
+
+		void reset()
+		{
+			for (uint32_t ii = 0; ii < BX_COUNTOF(m_result); ++ii)
+			{
+				Result& result = m_result[ii];
+				result.m_key     = UINT64_MAX;
+				result.m_elapsed = 0;
+			}
+		}
+
+		uint32_t begin(uint64_t _key)
+		{
+			if (0 == m_control.reserve(1) )
+			{
+				update();
+
+				if (0 == m_control.reserve(1) )
+				{
+					return UINT32_MAX;
+				}
+			}
+
+			const uint32_t idx = m_control.m_current;
+			Query& query = m_query[idx];
+			query.m_key   = _key;
+			query.m_ready = false;
+
+			GL_CHECK(glQueryCounter(query.m_begin
+				, GL_TIMESTAMP
+				) );
+
+			m_control.commit(1);
+
+			return idx;
+		}
+
+		void end(uint32_t _idx)
+		{
+			Query& query = m_query[_idx];
+			query.m_ready = true;
+
+			GL_CHECK(glQueryCounter(query.m_end
+				, GL_TIMESTAMP
+				) );
+		}
+
+		void update()
+		{
+			while (0 != m_control.available() )
+			{
+				Query& query = m_query[m_control.m_read];
+
+				if (!query.m_ready)
+				{
+					break;
+				}
+
+				GLint available;
+				GL_CHECK(glGetQueryObjectiv(query.m_end
+					, GL_QUERY_RESULT_AVAILABLE
+					, &available
+					) );
+
+				if (!available)
+				{
+					break;
+				}
+
+				m_control.consume(1);
+
+				uint64_t begin;
+				GL_CHECK(glGetQueryObjectui64v(query.m_begin
+					, GL_QUERY_RESULT
+					, &begin
+					) );
+
+				uint64_t end;
+				GL_CHECK(glGetQueryObjectui64v(query.m_end
+					, GL_QUERY_RESULT
+					, &end
+					) );
+
+				Result* result = find(query.m_key, true);
+				if (NULL == result)
+				{
+					reset();
+					result = find(query.m_key, true);
+				}
+
+				result->m_elapsed += end - begin;
+			}
+		}
+
+		uint64_t consume(uint64_t _key)
+		{
+			Result* result = find(_key, false);
+			if (NULL == result)
+			{
+				return 0;
+			}
+
+			const uint64_t elapsed = result->m_elapsed;
+			result->m_elapsed = 0;
+			return elapsed;
+		}
+
+		struct Result
+		{
+			uint64_t m_key;
+			uint64_t m_elapsed;
+		};
+
+		struct Query
+		{
+			GLuint   m_begin;
+			GLuint   m_end;
+			uint64_t m_key;
+			bool     m_ready;
+		};
+
+		Result* find(uint64_t _key, bool _insert)
+		{
+			const uint32_t mask = BX_COUNTOF(m_result)-1;
+			for (uint32_t hash = uint32_t(_key ^ (_key>>29) ) * UINT32_C(0x9e3779b1), ii = 0
+				; ii < BX_COUNTOF(m_result)
+				; ++ii
+				)
+			{
+				Result& result = m_result[(hash + ii) & mask];
+
+				if (_key == result.m_key)
+				{
+					return &result;
+				}
+
+				if (UINT64_MAX == result.m_key)
+				{
+					if (!_insert)
+					{
+						return NULL;
+					}
+
+					result.m_key     = _key;
+					result.m_elapsed = 0;
+					return &result;
+				}
+			}
+
+			return NULL;
+		}
+
+		Result m_result[BGFX_CONFIG_MAX_DRAW_STATS*2];
+
+		Query m_query[BGFX_CONFIG_MAX_DRAW_STATS*4];
+		bx::RingBufferControl m_control;
+	};
+
 	struct OcclusionQueryGL
 	{
 		OcclusionQueryGL()
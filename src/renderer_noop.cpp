@@ -4,6 +4,7 @@
  */
 
 #include "bgfx_p.h"
+#include "renderer.h"
 
 namespace bgfx { namespace noop
 {
@@ -230,8 +231,9 @@ namespace bgfx { namespace noop
 		{
 		}
 
-		void setMarker(const char* /*_marker*/, uint16_t /*_len*/) override
+		void setMarker(const char* _marker, uint16_t _len) override
 		{
+			m_drawProfiler.setMarker(_marker, _len);
 		}
 
 		virtual void setName(Handle /*_handle*/, const char* /*_name*/, uint16_t /*_len*/) override
@@ -256,6 +258,32 @@ namespace bgfx { namespace noop
 
 			perfStats.gpuMemoryMax  = -INT64_MAX;
 			perfStats.gpuMemoryUsed = -INT64_MAX;
+
+			m_drawProfiler.begin(_render, NULL);
+
+			if (m_drawProfiler.isEnabled() )
+			{
+				// Nothing is rendered, report CPU cost of walking draw calls only.
+				SortKey key;
+				for (uint32_t item = 0, numItems = _render->m_numRenderItems; item < numItems; ++item)
+				{
+					const bool isCompute = key.decode(_render->m_sortKeys[item], _render->m_viewRemap);
+					if (isCompute)
+					{
+						continue;
+					}
+
+					m_drawProfiler.beginDraw();
+
+					const RenderDraw& draw = _render->m_renderItem[_render->m_sortValues[item] ].draw;
+					rendererUpdateUniforms(this, _render->m_uniformBuffer[draw.m_uniformIdx], draw.m_uniformBegin, draw.m_uniformEnd);
+
+					m_drawProfiler.submitDraw(key.m_program, key.m_view);
+					m_drawProfiler.endDraw();
+				}
+			}
+
+			m_drawProfiler.end();
 		}
 
 		void blitSetup(TextVideoMemBlitter& /*_blitter*/) override
@@ -265,6 +293,8 @@ namespace bgfx { namespace noop
 		void blitRender(TextVideoMemBlitter& /*_blitter*/, uint32_t /*_numIndices*/) override
 		{
 		}
+
+		DrawProfiler<DrawTimerNull> m_drawProfiler;
 	};
 
 	static RendererContextNOOP* s_renderNOOP;
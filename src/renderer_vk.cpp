@@ -944,6 +944,13 @@ VK_IMPORT_DEVICE
 			);
 	}
 
+	static bool isGranularityAligned(int32_t _offset, uint32_t _extent, uint32_t _size, uint32_t _granularity)
+	{
+		return 0 == uint32_t(_offset) % _granularity
+			&& (0 == _extent % _granularity || uint32_t(_offset) + _extent == _size)
+			;
+	}
+
 	struct RendererContextVK : public RendererContextI
 	{
 		RendererContextVK()
@@ -1279,6 +1286,7 @@ VK_IMPORT_DEVICE
 			VkResult result;
 			m_qfiGraphics = UINT32_MAX;
 			m_qfiCompute  = UINT32_MAX;
+			m_qfiTransfer = UINT32_MAX;
 
 			if (_init.debug
 			||  _init.profile)
@@ -1674,6 +1682,25 @@ VK_IMPORT_INSTANCE
 					}
 				}
 
+				// Transfer-only queue family maps to dedicated copy engine (DMA) when available.
+				for (uint32_t ii = 0; ii < queueFamilyPropertyCount; ++ii)
+				{
+					const VkQueueFamilyProperties& qfp = queueFamilyPropertices[ii];
+					const VkQueueFlags mask = 0
+						| VK_QUEUE_GRAPHICS_BIT
+						| VK_QUEUE_COMPUTE_BIT
+						| VK_QUEUE_TRANSFER_BIT
+						;
+
+					if (VK_QUEUE_TRANSFER_BIT == (qfp.queueFlags & mask)
+					&&  0 < qfp.queueCount)
+					{
+						m_qfiTransfer = ii;
+						m_transferGranularity = qfp.minImageTransferGranularity;
+						break;
+					}
+				}
+
 				if (UINT32_MAX == m_qfiGraphics)
 				{
 					BX_TRACE("Init error: Unable to find graphics queue.");
@@ -1731,20 +1758,29 @@ VK_IMPORT_INSTANCE
 				}
 
 				float queuePriorities[1] = { 0.0f };
-				VkDeviceQueueCreateInfo dcqi;
-				dcqi.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
-				dcqi.pNext = NULL;
-				dcqi.flags = 0;
-				dcqi.queueFamilyIndex = m_qfiGraphics;
-				dcqi.queueCount       = 1;
-				dcqi.pQueuePriorities = queuePriorities;
+				VkDeviceQueueCreateInfo dcqi[2];
+				dcqi[0].sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+				dcqi[0].pNext = NULL;
+				dcqi[0].flags = 0;
+				dcqi[0].queueFamilyIndex = m_qfiGraphics;
+				dcqi[0].queueCount       = 1;
+				dcqi[0].pQueuePriorities = queuePriorities;
+
+				uint32_t numQueueCreateInfos = 1;
+
+				if (UINT32_MAX != m_qfiTransfer)
+				{
+					dcqi[1] = dcqi[0];
+					dcqi[1].queueFamilyIndex = m_qfiTransfer;
+					++numQueueCreateInfos;
+				}
 
 				VkDeviceCreateInfo dci;
 				dci.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
 				dci.pNext = NULL;
 				dci.flags = 0;
-				dci.queueCreateInfoCount = 1;
-				dci.pQueueCreateInfos    = &dcqi;
+				dci.queueCreateInfoCount = numQueueCreateInfos;
+				dci.pQueueCreateInfos    = dcqi;
 				dci.enabledLayerCount    = numEnabledLayers;
 				dci.ppEnabledLayerNames  = enabledLayer;
 				dci.enabledExtensionCount   = numEnabledExtensions;
@@ -1784,6 +1820,25 @@ VK_IMPORT_DEVICE
 			vkGetDeviceQueue(m_device, m_qfiGraphics, 0, &m_queueGraphics);
 			vkGetDeviceQueue(m_device, m_qfiCompute,  0, &m_queueCompute);
 
+			if (UINT32_MAX != m_qfiTransfer)
+			{
+				BX_TRACE("Using dedicated transfer queue family %d.", m_qfiTransfer);
+				vkGetDeviceQueue(m_device, m_qfiTransfer, 0, &m_queueTransfer);
+			}
+			else
+			{
+				// No dedicated copy queue (software rasterizers, some mobile GPUs), transfers are
+				// batched and submitted to graphics queue.
+				m_qfiTransfer   = m_qfiGraphics;
+				m_queueTransfer = m_queueGraphics;
+				m_transferGranularity.width  = 1;
+				m_transferGranularity.height = 1;
+				m_transferGranularity.depth  = 1;
+			}
+
+			m_qfiConcurrent[0] = m_qfiGraphics;
+			m_qfiConcurrent[1] = m_qfiTransfer;
+
 #if BX_PLATFORM_WINDOWS
 			{
 				VkWin32SurfaceCreateInfoKHR sci;
@@ -2167,6 +2222,14 @@ VK_IMPORT_DEVICE
 
 			errorState = ErrorState::CommandBuffersCreated;
 
+			result = createTransfer();
+
+			if (VK_SUCCESS != result)
+			{
+				BX_TRACE("Init error: Failed to create transfer resources %d: %s.", result, getName(result) );
+				goto error;
+			}
+
 			{
 				VkDescriptorPoolSize dps[] =
 				{
@@ -2297,6 +2360,7 @@ VK_IMPORT_DEVICE
 				BX_FALLTHROUGH;
 
 			case ErrorState::CommandBuffersCreated:
+				destroyTransfer();
 				vkFreeCommandBuffers(m_device, m_commandPool, BX_COUNTOF(m_commandBuffers), m_commandBuffers);
 				vkDestroy(m_commandPool);
 				vkDestroy(m_fence);
@@ -2390,6 +2454,8 @@ VK_IMPORT_DEVICE
 				m_textures[ii].destroy();
 			}
 
+			destroyTransfer();
+
 			vkDestroy(m_pipelineCache);
 //			vkDestroy(m_pipelineLayout);
 //			vkDestroy(m_descriptorSetLayout);
@@ -4153,16 +4219,30 @@ VK_IMPORT_DEVICE
 
 		uint64_t kick(VkSemaphore _wait = VK_NULL_HANDLE, VkSemaphore _signal = VK_NULL_HANDLE)
 		{
-			VkPipelineStageFlags stageFlags = 0
-				| VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT
-				;
+			VkSemaphore waitSemaphores[2];
+			VkPipelineStageFlags waitStageFlags[2];
+			uint32_t numWaitSemaphores = 0;
+
+			if (VK_NULL_HANDLE != _wait)
+			{
+				waitSemaphores[numWaitSemaphores] = _wait;
+				waitStageFlags[numWaitSemaphores] = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+				++numWaitSemaphores;
+			}
+
+			if (flushTransfer(false) )
+			{
+				waitSemaphores[numWaitSemaphores] = m_transferDone;
+				waitStageFlags[numWaitSemaphores] = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+				++numWaitSemaphores;
+			}
 
 			VkSubmitInfo si;
 			si.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
 			si.pNext = NULL;
-			si.waitSemaphoreCount = VK_NULL_HANDLE != _wait;
-			si.pWaitSemaphores    = &_wait;
-			si.pWaitDstStageMask  = &stageFlags;
+			si.waitSemaphoreCount = numWaitSemaphores;
+			si.pWaitSemaphores    = &waitSemaphores[0];
+			si.pWaitDstStageMask  = waitStageFlags;
 			si.commandBufferCount = 1;
 			si.pCommandBuffers    = &m_commandBuffers[m_backBufferColorIdx];
 			si.signalSemaphoreCount = VK_NULL_HANDLE != _signal;
@@ -4254,16 +4334,20 @@ VK_IMPORT_DEVICE
 		{
 			vkEndCommandBuffer(commandBuffer);
 
+			// Pending uploads must land before any work recorded after them.
+			const bool transfer = flushTransfer(false);
+			VkPipelineStageFlags waitStageFlags = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+
 			VkSubmitInfo submitInfo;
 			submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
 			submitInfo.pNext = NULL;
 			submitInfo.commandBufferCount = 1;
 			submitInfo.pCommandBuffers = &commandBuffer;
-			submitInfo.waitSemaphoreCount = 0;
-			submitInfo.pWaitSemaphores = NULL;
+			submitInfo.waitSemaphoreCount = transfer;
+			submitInfo.pWaitSemaphores = &m_transferDone;
 			submitInfo.signalSemaphoreCount = 0;
 			submitInfo.pSignalSemaphores = NULL;
-			submitInfo.pWaitDstStageMask = NULL;
+			submitInfo.pWaitDstStageMask = &waitStageFlags;
 
 			VK_CHECK(vkQueueSubmit(m_queueGraphics, 1, &submitInfo, VK_NULL_HANDLE));
 			VK_CHECK(vkQueueWaitIdle(m_queueGraphics));
@@ -4271,6 +4355,394 @@ VK_IMPORT_DEVICE
 			vkFreeCommandBuffers(m_device, m_commandPool, 1, &commandBuffer);
 		}
 
+		void setSharingMode(VkSharingMode& _sharingMode, uint32_t& _queueFamilyIndexCount, const uint32_t*& _queueFamilyIndices) const
+		{
+			if (m_qfiGraphics != m_qfiTransfer)
+			{
+				_sharingMode           = VK_SHARING_MODE_CONCURRENT;
+				_queueFamilyIndexCount = BX_COUNTOF(m_qfiConcurrent);
+				_queueFamilyIndices    = m_qfiConcurrent;
+			}
+			else
+			{
+				_sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
+				_queueFamilyIndexCount = 0;
+				_queueFamilyIndices    = NULL;
+			}
+		}
+
+		bool isTransferAligned(const VkOffset3D& _offset, const VkExtent3D& _extent, const VkExtent3D& _size, uint32_t _blockWidth, uint32_t _blockHeight) const
+		{
+			const VkExtent3D& granularity = m_transferGranularity;
+
+			if (0 == granularity.width)
+			{
+				// Queue can only transfer whole mip levels.
+				return true
+					&& 0 == _offset.x
+					&& 0 == _offset.y
+					&& 0 == _offset.z
+					&& _extent.width  == _size.width
+					&& _extent.height == _size.height
+					&& _extent.depth  == _size.depth
+					;
+			}
+
+			return true
+				&& isGranularityAligned(_offset.x, _extent.width,  _size.width,  granularity.width  * _blockWidth)
+				&& isGranularityAligned(_offset.y, _extent.height, _size.height, granularity.height * _blockHeight)
+				&& isGranularityAligned(_offset.z, _extent.depth,  _size.depth,  granularity.depth)
+				;
+		}
+
+		VkResult createTransfer()
+		{
+			m_transferCommandPool = VK_NULL_HANDLE;
+			m_transferDone        = VK_NULL_HANDLE;
+			m_transferBatchIdx    = 0;
+			m_transferRecording   = false;
+			m_stagingRing.m_buffer    = VK_NULL_HANDLE;
+			m_stagingRing.m_deviceMem = VK_NULL_HANDLE;
+
+			for (uint32_t ii = 0; ii < BX_COUNTOF(m_transferBatch); ++ii)
+			{
+				TransferBatchVK& batch = m_transferBatch[ii];
+				batch.m_commandBuffer = VK_NULL_HANDLE;
+				batch.m_fence   = VK_NULL_HANDLE;
+				batch.m_head    = 0;
+				batch.m_pending = false;
+			}
+
+			VkCommandPoolCreateInfo cpci;
+			cpci.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+			cpci.pNext = NULL;
+			cpci.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+			cpci.queueFamilyIndex = m_qfiTransfer;
+			VkResult result = vkCreateCommandPool(m_device, &cpci, m_allocatorCb, &m_transferCommandPool);
+
+			if (VK_SUCCESS != result)
+			{
+				return result;
+			}
+
+			VkSemaphoreCreateInfo sci;
+			sci.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+			sci.pNext = NULL;
+			sci.flags = 0;
+			result = vkCreateSemaphore(m_device, &sci, m_allocatorCb, &m_transferDone);
+
+			if (VK_SUCCESS != result)
+			{
+				return result;
+			}
+
+			VkFenceCreateInfo fci;
+			fci.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+			fci.pNext = NULL;
+			fci.flags = 0;
+
+			VkCommandBufferAllocateInfo cbai;
+			cbai.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+			cbai.pNext = NULL;
+			cbai.commandPool = m_transferCommandPool;
+			cbai.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+			cbai.commandBufferCount = 1;
+
+			for (uint32_t ii = 0; ii < BX_COUNTOF(m_transferBatch); ++ii)
+			{
+				TransferBatchVK& batch = m_transferBatch[ii];
+
+				result = vkCreateFence(m_device, &fci, m_allocatorCb, &batch.m_fence);
+
+				if (VK_SUCCESS != result)
+				{
+					return result;
+				}
+
+				result = vkAllocateCommandBuffers(m_device, &cbai, &batch.m_commandBuffer);
+
+				if (VK_SUCCESS != result)
+				{
+					batch.m_commandBuffer = VK_NULL_HANDLE;
+					return result;
+				}
+			}
+
+			m_stagingRing.create(BGFX_VK_CONFIG_STAGING_SIZE);
+
+			return VK_SUCCESS;
+		}
+
+		void destroyTransfer()
+		{
+			if (m_transferRecording)
+			{
+				vkEndCommandBuffer(m_transferBatch[m_transferBatchIdx].m_commandBuffer);
+				m_transferRecording = false;
+			}
+
+			for (uint32_t ii = 0; ii < BX_COUNTOF(m_transferBatch); ++ii)
+			{
+				TransferBatchVK& batch = m_transferBatch[ii];
+
+				if (batch.m_pending)
+				{
+					VK_CHECK(vkWaitForFences(m_device, 1, &batch.m_fence, VK_TRUE, UINT64_MAX) );
+				}
+
+				releaseTransferBatch(batch);
+
+				if (VK_NULL_HANDLE != batch.m_commandBuffer)
+				{
+					vkFreeCommandBuffers(m_device, m_transferCommandPool, 1, &batch.m_commandBuffer);
+					batch.m_commandBuffer = VK_NULL_HANDLE;
+				}
+
+				vkDestroy(batch.m_fence);
+			}
+
+			m_stagingRing.destroy();
+			vkDestroy(m_transferDone);
+			vkDestroy(m_transferCommandPool);
+		}
+
+		void releaseTransferBatch(TransferBatchVK& _batch)
+		{
+			m_stagingRing.retire(_batch.m_head);
+
+			for (uint32_t ii = 0, num = uint32_t(_batch.m_releaseImageView.size() ); ii < num; ++ii)
+			{
+				vkDestroy(_batch.m_releaseImageView[ii]);
+			}
+
+			for (uint32_t ii = 0, num = uint32_t(_batch.m_releaseImage.size() ); ii < num; ++ii)
+			{
+				vkDestroy(_batch.m_releaseImage[ii]);
+			}
+
+			for (uint32_t ii = 0, num = uint32_t(_batch.m_releaseBuffer.size() ); ii < num; ++ii)
+			{
+				vkDestroy(_batch.m_releaseBuffer[ii]);
+			}
+
+			for (uint32_t ii = 0, num = uint32_t(_batch.m_releaseMemory.size() ); ii < num; ++ii)
+			{
+				vkFreeMemory(m_device, _batch.m_releaseMemory[ii], m_allocatorCb);
+			}
+
+			_batch.m_releaseImageView.clear();
+			_batch.m_releaseImage.clear();
+			_batch.m_releaseBuffer.clear();
+			_batch.m_releaseMemory.clear();
+			_batch.m_pending = false;
+		}
+
+		// Returns batch that was recorded last, it completes after every earlier batch, or NULL
+		// when there is no transfer in flight.
+		TransferBatchVK* getLastTransferBatch()
+		{
+			if (m_transferRecording)
+			{
+				return &m_transferBatch[m_transferBatchIdx];
+			}
+
+			TransferBatchVK& batch = m_transferBatch[(m_transferBatchIdx + BX_COUNTOF(m_transferBatch) - 1) % BX_COUNTOF(m_transferBatch)];
+			return batch.m_pending ? &batch : NULL;
+		}
+
+		// Resource might be destination of not yet completed copy. Instead of waiting for
+		// transfer, it's destroyed when last transfer batch completes.
+		void release(VkBuffer& _buffer, VkDeviceMemory& _memory)
+		{
+			TransferBatchVK* batch = getLastTransferBatch();
+
+			if (NULL == batch)
+			{
+				vkDestroy(_buffer);
+				vkFreeMemory(m_device, _memory, m_allocatorCb);
+			}
+			else
+			{
+				batch->m_releaseBuffer.push_back(_buffer);
+				batch->m_releaseMemory.push_back(_memory);
+				_buffer = VK_NULL_HANDLE;
+			}
+
+			_memory = VK_NULL_HANDLE;
+		}
+
+		void release(VkImage& _image, VkImageView* _views, uint32_t _numViews, VkDeviceMemory& _memory)
+		{
+			TransferBatchVK* batch = getLastTransferBatch();
+
+			if (NULL == batch)
+			{
+				for (uint32_t ii = 0; ii < _numViews; ++ii)
+				{
+					vkDestroy(_views[ii]);
+				}
+
+				vkDestroy(_image);
+				vkFreeMemory(m_device, _memory, m_allocatorCb);
+			}
+			else
+			{
+				for (uint32_t ii = 0; ii < _numViews; ++ii)
+				{
+					if (VK_NULL_HANDLE != _views[ii])
+					{
+						batch->m_releaseImageView.push_back(_views[ii]);
+						_views[ii] = VK_NULL_HANDLE;
+					}
+				}
+
+				batch->m_releaseImage.push_back(_image);
+				batch->m_releaseMemory.push_back(_memory);
+				_image = VK_NULL_HANDLE;
+			}
+
+			_memory = VK_NULL_HANDLE;
+		}
+
+		void retireTransfer()
+		{
+			// Batches complete in submission order, oldest one is at current index.
+			for (uint32_t ii = 0; ii < BX_COUNTOF(m_transferBatch); ++ii)
+			{
+				TransferBatchVK& batch = m_transferBatch[(m_transferBatchIdx + ii) % BX_COUNTOF(m_transferBatch)];
+
+				if (batch.m_pending)
+				{
+					if (VK_SUCCESS != vkGetFenceStatus(m_device, batch.m_fence) )
+					{
+						break;
+					}
+
+					releaseTransferBatch(batch);
+				}
+			}
+		}
+
+		VkCommandBuffer beginTransfer()
+		{
+			TransferBatchVK& batch = m_transferBatch[m_transferBatchIdx];
+
+			if (!m_transferRecording)
+			{
+				retireTransfer();
+
+				if (batch.m_pending)
+				{
+					VK_CHECK(vkWaitForFences(m_device, 1, &batch.m_fence, VK_TRUE, UINT64_MAX) );
+					releaseTransferBatch(batch);
+				}
+
+				VK_CHECK(vkResetFences(m_device, 1, &batch.m_fence) );
+
+				VkCommandBufferBeginInfo cbbi;
+				cbbi.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+				cbbi.pNext = NULL;
+				cbbi.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+				cbbi.pInheritanceInfo = NULL;
+				VK_CHECK(vkBeginCommandBuffer(batch.m_commandBuffer, &cbbi) );
+
+				m_transferRecording = true;
+			}
+
+			return batch.m_commandBuffer;
+		}
+
+		// Returns true when transfer done semaphore is signaled and must be waited on by next
+		// graphics queue submission. With _wait set, batch is waited on CPU instead.
+		bool flushTransfer(bool _wait)
+		{
+			if (!m_transferRecording)
+			{
+				return false;
+			}
+
+			TransferBatchVK& batch = m_transferBatch[m_transferBatchIdx];
+			VK_CHECK(vkEndCommandBuffer(batch.m_commandBuffer) );
+
+			VkSubmitInfo si;
+			si.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+			si.pNext = NULL;
+			si.waitSemaphoreCount = 0;
+			si.pWaitSemaphores    = NULL;
+			si.pWaitDstStageMask  = NULL;
+			si.commandBufferCount = 1;
+			si.pCommandBuffers    = &batch.m_commandBuffer;
+			si.signalSemaphoreCount = !_wait;
+			si.pSignalSemaphores    = &m_transferDone;
+			VK_CHECK(vkQueueSubmit(m_queueTransfer, 1, &si, batch.m_fence) );
+
+			batch.m_head    = m_stagingRing.m_head;
+			batch.m_pending = true;
+
+			m_transferRecording = false;
+			m_transferBatchIdx  = (m_transferBatchIdx + 1) % BX_COUNTOF(m_transferBatch);
+
+			if (_wait)
+			{
+				VK_CHECK(vkWaitForFences(m_device, 1, &batch.m_fence, VK_TRUE, UINT64_MAX) );
+				retireTransfer();
+			}
+
+			return !_wait;
+		}
+
+		// Allocates upload memory, and returns transfer command buffer into which copy from it
+		// must be recorded.
+		VkCommandBuffer allocStaging(StagingBufferVK& _out, uint32_t _size, uint32_t _align)
+		{
+			beginTransfer();
+
+			if (_size <= m_stagingRing.m_size / 2)
+			{
+				if (!m_stagingRing.alloc(_out, _size, _align) )
+				{
+					flushTransfer(true);
+					beginTransfer();
+
+					const bool ok = m_stagingRing.alloc(_out, _size, _align);
+					BX_CHECK(ok, "Staging ring allocation failed.");
+					BX_UNUSED(ok);
+				}
+
+				_out.m_deviceMem = VK_NULL_HANDLE;
+			}
+			else
+			{
+				// Allocation is too large for staging ring, use one-off buffer released with batch.
+				VkBufferCreateInfo bci;
+				bci.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+				bci.pNext = NULL;
+				bci.flags = 0;
+				bci.size  = _size;
+				bci.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+				bci.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+				bci.queueFamilyIndexCount = 0;
+				bci.pQueueFamilyIndices   = NULL;
+
+				VK_CHECK(vkCreateBuffer(m_device, &bci, m_allocatorCb, &_out.m_buffer) );
+
+				VkMemoryRequirements mr;
+				vkGetBufferMemoryRequirements(m_device, _out.m_buffer, &mr);
+				VK_CHECK(allocateMemory(&mr, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, &_out.m_deviceMem) );
+				VK_CHECK(vkBindBufferMemory(m_device, _out.m_buffer, _out.m_deviceMem, 0) );
+
+				// Memory is unmapped on release.
+				VK_CHECK(vkMapMemory(m_device, _out.m_deviceMem, 0, mr.size, 0, (void**)&_out.m_data) );
+				_out.m_offset = 0;
+
+				TransferBatchVK& batch = m_transferBatch[m_transferBatchIdx];
+				batch.m_releaseBuffer.push_back(_out.m_buffer);
+				batch.m_releaseMemory.push_back(_out.m_deviceMem);
+			}
+
+			return m_transferBatch[m_transferBatchIdx].m_commandBuffer;
+		}
+
 #define NUM_SWAPCHAIN_IMAGE 4
 		VkAllocationCallbacks*   m_allocatorCb;
 		VkDebugReportCallbackEXT m_debugReportCallback;
@@ -4305,10 +4777,22 @@ VK_IMPORT_DEVICE
 
 		uint32_t m_qfiGraphics;
 		uint32_t m_qfiCompute;
+		uint32_t m_qfiTransfer;
+		uint32_t m_qfiConcurrent[2];
 
 		VkDevice m_device;
 		VkQueue  m_queueGraphics;
 		VkQueue  m_queueCompute;
+		VkQueue  m_queueTransfer;
+
+		VkExtent3D      m_transferGranularity;
+		VkCommandPool   m_transferCommandPool;
+		VkSemaphore     m_transferDone;
+		TransferBatchVK m_transferBatch[BGFX_VK_CONFIG_MAX_TRANSFER_BATCHES];
+		StagingRingVK   m_stagingRing;
+		uint32_t        m_transferBatchIdx;
+		bool            m_transferRecording;
+
 		VkFence  m_fence;
 		VkRenderPass m_renderPass;
 		VkDescriptorPool m_descriptorPool;
@@ -4457,6 +4941,96 @@ VK_DESTROY
 		m_currentDs = 0;
 	}
 
+	void StagingRingVK::create(uint32_t _size)
+	{
+		VkAllocationCallbacks* allocatorCb = s_renderVK->m_allocatorCb;
+		VkDevice device = s_renderVK->m_device;
+
+		VkBufferCreateInfo bci;
+		bci.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+		bci.pNext = NULL;
+		bci.flags = 0;
+		bci.size  = _size;
+		bci.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+		bci.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+		bci.queueFamilyIndexCount = 0;
+		bci.pQueueFamilyIndices   = NULL;
+
+		VK_CHECK(vkCreateBuffer(
+			  device
+			, &bci
+			, allocatorCb
+			, &m_buffer
+			) );
+
+		VkMemoryRequirements mr;
+		vkGetBufferMemoryRequirements(
+			  device
+			, m_buffer
+			, &mr
+			);
+
+		VK_CHECK(s_renderVK->allocateMemory(&mr, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, &m_deviceMem) );
+
+		m_size = _size;
+		m_pos  = 0;
+		m_head = 0;
+		m_tail = 0;
+
+		VK_CHECK(vkBindBufferMemory(device, m_buffer, m_deviceMem, 0) );
+
+		VK_CHECK(vkMapMemory(device, m_deviceMem, 0, m_size, 0, (void**)&m_data) );
+	}
+
+	void StagingRingVK::destroy()
+	{
+		if (VK_NULL_HANDLE != m_deviceMem)
+		{
+			VkDevice device = s_renderVK->m_device;
+
+			vkUnmapMemory(device, m_deviceMem);
+			vkFreeMemory(device
+				, m_deviceMem
+				, s_renderVK->m_allocatorCb
+				);
+			m_deviceMem = VK_NULL_HANDLE;
+		}
+
+		vkDestroy(m_buffer);
+	}
+
+	bool StagingRingVK::alloc(StagingBufferVK& _out, uint32_t _size, uint32_t _align)
+	{
+		if (m_head == m_tail)
+		{
+			m_pos = 0;
+		}
+
+		uint32_t offset = (m_pos + _align - 1) / _align * _align;
+		uint32_t total  = offset - m_pos + _size;
+
+		if (offset + _size > m_size)
+		{
+			// Skip tail end of ring, and wrap around.
+			offset = 0;
+			total  = m_size - m_pos + _size;
+		}
+
+		if (m_head - m_tail + total > m_size)
+		{
+			return false;
+		}
+
+		m_pos   = offset + _size;
+		m_head += total;
+
+		_out.m_buffer = m_buffer;
+		_out.m_data   = &m_data[offset];
+		_out.m_offset = offset;
+
+		return true;
+	}
+
 	VkResult ImageVK::create(VkFormat _format, const VkExtent3D& _extent)
 	{
 		VkResult result;
@@ -4576,9 +5150,7 @@ VK_DESTROY
 			| (indirect             ? VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT : 0)
 			| VK_BUFFER_USAGE_TRANSFER_DST_BIT
 			;
-		bci.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-		bci.queueFamilyIndexCount = 0;
-		bci.pQueueFamilyIndices   = NULL;
+		s_renderVK->setSharingMode(bci.sharingMode, bci.queueFamilyIndexCount, bci.pQueueFamilyIndices);
 
 		VkAllocationCallbacks* allocatorCb = s_renderVK->m_allocatorCb;
 		VkDevice device = s_renderVK->m_device;
@@ -4597,132 +5169,33 @@ VK_DESTROY
 
 		if (!m_dynamic)
 		{
-//			void* dst;
-//			VK_CHECK(vkMapMemory(device, m_deviceMem, 0, ma.allocationSize, 0, &dst) );
-//			bx::memCopy(dst, _data, _size);
-//			vkUnmapMemory(device, m_deviceMem);
-
-			// staging buffer
-			VkBuffer stagingBuffer;
-			VkDeviceMemory stagingMem;
-			bci.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-			bci.pNext = NULL;
-			bci.flags = 0;
-			bci.size = _size;
-			bci.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
-			bci.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-			bci.queueFamilyIndexCount = 0;
-			bci.pQueueFamilyIndices = NULL;
-
-			VK_CHECK(vkCreateBuffer(device
-				, &bci
-				, allocatorCb
-				, &stagingBuffer
-			));
-
-			vkGetBufferMemoryRequirements(device, stagingBuffer, &mr);
-
-			VK_CHECK(s_renderVK->allocateMemory(&mr, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, &stagingMem));
-
-			VK_CHECK(vkBindBufferMemory(device, stagingBuffer, stagingMem, 0));
-
-			void* dst;
-			VK_CHECK(vkMapMemory(device, stagingMem, 0, mr.size, 0, &dst));
-			bx::memCopy(dst, _data, _size);
-			vkUnmapMemory(device, stagingMem);
-
-			VkCommandBuffer commandBuffer = s_renderVK->beginNewCommand();
-			// copy buffer to buffer
-			{
-				VkBufferCopy region;
-				region.srcOffset = 0;
-				region.dstOffset = 0;
-				region.size      = _size;
-
-				vkCmdCopyBuffer(commandBuffer, stagingBuffer, m_buffer, 1, &region);
-			}
-			s_renderVK->submitCommandAndWait(commandBuffer);
-
-			vkFreeMemory(device, stagingMem, allocatorCb);
-			vkDestroy(stagingBuffer);
+			update(VK_NULL_HANDLE, 0, _size, _data);
 		}
 	}
 
 	void BufferVK::update(VkCommandBuffer _commandBuffer, uint32_t _offset, uint32_t _size, void* _data, bool _discard)
 	{
 		BX_UNUSED(_commandBuffer, _discard);
-//		void* dst;
-//		VkDevice device = s_renderVK->m_device;
-//		VK_CHECK(vkMapMemory(device, m_deviceMem, _offset, _size, 0, &dst) );
-//		bx::memCopy(dst, _data, _size);
-//		vkUnmapMemory(device, m_deviceMem);
-
-		// staging buffer
-		VkAllocationCallbacks* allocatorCb = s_renderVK->m_allocatorCb;
-		VkDevice device = s_renderVK->m_device;
-		VkBuffer stagingBuffer;
-		VkDeviceMemory stagingMem;
-		VkBufferCreateInfo bci;
-		bci.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-		bci.pNext = NULL;
-		bci.flags = 0;
-		bci.size = _size;
-		bci.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
-		bci.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-		bci.queueFamilyIndexCount = 0;
-		bci.pQueueFamilyIndices = NULL;
-
-		VK_CHECK(vkCreateBuffer(device
-			, &bci
-			, allocatorCb
-			, &stagingBuffer
-		));
-
-		VkMemoryRequirements mr;
-		vkGetBufferMemoryRequirements(device
-			, stagingBuffer
-			, &mr
-		);
-
-		VK_CHECK(s_renderVK->allocateMemory(&mr, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, &stagingMem));
-
-		VK_CHECK(vkBindBufferMemory(device, stagingBuffer, stagingMem, 0));
-
-		void* dst;
-		VK_CHECK(vkMapMemory(device, stagingMem, 0, mr.size, 0, &dst));
-		bx::memCopy(dst, _data, _size);
-		vkUnmapMemory(device, stagingMem);
-
-		VkCommandBuffer commandBuffer = s_renderVK->beginNewCommand();
-
-		// copy buffer to buffer
-		{
-			VkBufferCopy region;
-			region.srcOffset = 0;
-			region.dstOffset = _offset;
-			region.size      = _size;
 
-			vkCmdCopyBuffer(commandBuffer, stagingBuffer, m_buffer, 1, &region);
-		}
+		// Copy is recorded into transfer batch, which is submitted before next graphics queue
+		// submission that might use this buffer.
+		StagingBufferVK staging;
+		VkCommandBuffer commandBuffer = s_renderVK->allocStaging(staging, _size, 4);
+		bx::memCopy(staging.m_data, _data, _size);
 
-		s_renderVK->submitCommandAndWait(commandBuffer);
+		VkBufferCopy region;
+		region.srcOffset = staging.m_offset;
+		region.dstOffset = _offset;
+		region.size      = _size;
 
-		vkFreeMemory(device, stagingMem, allocatorCb);
-		vkDestroy(stagingBuffer);
+		vkCmdCopyBuffer(commandBuffer, staging.m_buffer, m_buffer, 1, &region);
 	}
 
 	void BufferVK::destroy()
 	{
 		if (VK_NULL_HANDLE != m_buffer)
 		{
-			VkAllocationCallbacks* allocatorCb = s_renderVK->m_allocatorCb;
-			VkDevice device = s_renderVK->m_device;
-
-			vkDestroy(m_buffer);
-			vkFreeMemory(device
-				, m_deviceMem
-				, allocatorCb
-				);
+			s_renderVK->release(m_buffer, m_deviceMem);
 			m_dynamic = false;
 		}
 	}
@@ -5356,12 +5829,16 @@ VK_DESTROY
 				}
 			}
 
+			// Buffer offset must be multiple of both texel block size and 4.
+			const uint32_t stagingAlign = bimg::getBlockInfo(bimg::TextureFormat::Enum(m_textureFormat) ).blockSize * 4;
+
 			uint32_t totalMemSize = 0;
 			VkBufferImageCopy* bufferCopyInfo = (VkBufferImageCopy*)BX_ALLOC(g_allocator, sizeof(VkBufferImageCopy) * numSrd);
 			for (uint32_t ii = 0; ii < numSrd; ++ii)
 			{
 				uint32_t idealWidth  = bx::max<uint32_t>(1, m_width  >> imageInfos[ii].mipLevel);
 				uint32_t idealHeight = bx::max<uint32_t>(1, m_height >> imageInfos[ii].mipLevel);
+				totalMemSize = bx::strideAlign(totalMemSize, stagingAlign);
 				bufferCopyInfo[ii].bufferOffset      = totalMemSize;
 				bufferCopyInfo[ii].bufferRowLength   = 0; // assume that image data are tightly aligned
 				bufferCopyInfo[ii].bufferImageHeight = 0; // assume that image data are tightly aligned
@@ -5374,61 +5851,18 @@ VK_DESTROY
 				totalMemSize += imageInfos[ii].size;
 			}
 
-			VkBuffer stagingBuffer = VK_NULL_HANDLE;
-			VkDeviceMemory stagingDeviceMem = VK_NULL_HANDLE;
+			StagingBufferVK staging;
+			VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
 			if (totalMemSize > 0)
 			{
-				// staging buffer creation
-				VkBufferCreateInfo bci;
-				bci.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-				bci.pNext = NULL;
-				bci.flags = 0;
-				bci.size = totalMemSize;
-				bci.queueFamilyIndexCount = 0;
-				bci.pQueueFamilyIndices = NULL;
-				bci.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-				bci.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
-				VK_CHECK(vkCreateBuffer(
-					  device
-					, &bci
-					, allocatorCb
-					, &stagingBuffer
-					));
-
-				VkMemoryRequirements mr;
-				vkGetBufferMemoryRequirements(
-					  device
-					, stagingBuffer
-					, &mr
-					);
-
-				VK_CHECK(s_renderVK->allocateMemory(&mr, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, &stagingDeviceMem));
-
-				VK_CHECK(vkBindBufferMemory(
-					  device
-					, stagingBuffer
-					, stagingDeviceMem
-					, 0
-					));
-				VK_CHECK(vkMapMemory(
-					  device
-					, stagingDeviceMem
-					, 0
-					, mr.size
-					, 0
-					, (void**)& m_directAccessPtr
-					));
-
-				uint8_t* mappedMemory = (uint8_t*)m_directAccessPtr;
+				commandBuffer = s_renderVK->allocStaging(staging, totalMemSize, stagingAlign);
 
 				// copy image to staging buffer
 				for (uint32_t ii = 0; ii < numSrd; ++ii)
 				{
-					bx::memCopy(mappedMemory, imageInfos[ii].data, imageInfos[ii].size);
-					mappedMemory += imageInfos[ii].size;
+					bx::memCopy(&staging.m_data[bufferCopyInfo[ii].bufferOffset], imageInfos[ii].data, imageInfos[ii].size);
+					bufferCopyInfo[ii].bufferOffset += staging.m_offset;
 				}
-
-				vkUnmapMemory(device, stagingDeviceMem);
 			}
 
 			// create texture and allocate its device memory
@@ -5439,10 +5873,8 @@ VK_DESTROY
 				? VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT
 				: 0
 				;
-			ici.pQueueFamilyIndices = NULL;
-			ici.queueFamilyIndexCount = 0;
 			ici.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-			ici.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+			s_renderVK->setSharingMode(ici.sharingMode, ici.queueFamilyIndexCount, ici.pQueueFamilyIndices);
 			ici.usage = 0
 				| VK_IMAGE_USAGE_TRANSFER_SRC_BIT
 				| VK_IMAGE_USAGE_TRANSFER_DST_BIT
@@ -5477,26 +5909,22 @@ VK_DESTROY
 
 			vkBindImageMemory(device, m_textureImage, m_textureDeviceMem, 0);
 
-			if (stagingBuffer)
+			// Whole subresources are uploaded, which always satisfies transfer queue granularity.
+			if (VK_NULL_HANDLE != commandBuffer)
 			{
-				copyBufferToTexture(stagingBuffer, numSrd, bufferCopyInfo);
+				copyBufferToTexture(commandBuffer, staging.m_buffer, numSrd, bufferCopyInfo, true);
 			}
 			else
 			{
-				VkCommandBuffer commandBuffer = s_renderVK->beginNewCommand();
-				setImageMemoryBarrier(
-					  commandBuffer
+				setImageTransferBarrier(
+					  s_renderVK->beginTransfer()
 					, (m_flags & BGFX_TEXTURE_COMPUTE_WRITE
 						? VK_IMAGE_LAYOUT_GENERAL
 						: VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
 					  )
 					);
-				s_renderVK->submitCommandAndWait(commandBuffer);
 			}
 
-			vkFreeMemory(device, stagingDeviceMem, allocatorCb);
-			vkDestroy(stagingBuffer);
-
 			BX_FREE(g_allocator, bufferCopyInfo);
 			for (uint32_t ii = 0; ii < numSrd; ++ii)
 			{
@@ -5583,15 +6011,18 @@ VK_DESTROY
 	{
 		if (m_textureImage)
 		{
-			VkAllocationCallbacks* allocatorCb = s_renderVK->m_allocatorCb;
-			VkDevice device = s_renderVK->m_device;
+			VkImageView views[] =
+			{
+				m_textureImageStorageView,
+				m_textureImageDepthView,
+				m_textureImageView,
+			};
 
-			vkFreeMemory(device, m_textureDeviceMem, allocatorCb);
+			s_renderVK->release(m_textureImage, views, BX_COUNTOF(views), m_textureDeviceMem);
 
-			vkDestroy(m_textureImageStorageView);
-			vkDestroy(m_textureImageDepthView);
-			vkDestroy(m_textureImageView);
-			vkDestroy(m_textureImage);
+			m_textureImageStorageView = VK_NULL_HANDLE;
+			m_textureImageDepthView   = VK_NULL_HANDLE;
+			m_textureImageView        = VK_NULL_HANDLE;
 
 			m_currentImageLayout = VK_IMAGE_LAYOUT_UNDEFINED;
 		}
@@ -5602,11 +6033,11 @@ VK_DESTROY
 		BX_UNUSED(_commandPool);
 
 		const uint32_t bpp = bimg::getBitsPerPixel(bimg::TextureFormat::Enum(m_textureFormat));
+		const bimg::ImageBlockInfo& blockInfo = bimg::getBlockInfo(bimg::TextureFormat::Enum(m_textureFormat));
 		uint32_t rectpitch = _rect.m_width * bpp / 8;
 		uint32_t slicepitch = rectpitch * _rect.m_height;
 		if (bimg::isCompressed(bimg::TextureFormat::Enum(m_textureFormat)))
 		{
-			const bimg::ImageBlockInfo& blockInfo = bimg::getBlockInfo(bimg::TextureFormat::Enum(m_textureFormat));
 			rectpitch = (_rect.m_width / blockInfo.blockWidth) * blockInfo.blockSize;
 			slicepitch = (_rect.m_height / blockInfo.blockHeight) * rectpitch;
 		}
@@ -5624,46 +6055,12 @@ VK_DESTROY
 			data = temp;
 		}
 
-		VkAllocationCallbacks* allocatorCb = s_renderVK->m_allocatorCb;
-		VkDevice device = s_renderVK->m_device;
-
-		VkBuffer stagingBuffer = VK_NULL_HANDLE;
-		VkDeviceMemory stagingDeviceMem = VK_NULL_HANDLE;
-
-		// staging buffer creation
-		VkBufferCreateInfo bci;
-		bci.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-		bci.pNext = NULL;
-		bci.flags = 0;
-		bci.size = size;
-		bci.queueFamilyIndexCount = 0;
-		bci.pQueueFamilyIndices = NULL;
-		bci.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-		bci.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
-		VK_CHECK(vkCreateBuffer(
-			  device
-			, &bci
-			, allocatorCb
-			, &stagingBuffer
-			));
-
-		VkMemoryRequirements mr;
-		vkGetBufferMemoryRequirements(
-			  device
-			, stagingBuffer
-			, &mr
-			);
-
-		VK_CHECK(s_renderVK->allocateMemory(&mr, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, &stagingDeviceMem));
-
-		void* directAccessPtr = NULL;
-		VK_CHECK(vkBindBufferMemory(device, stagingBuffer, stagingDeviceMem, 0));
-		VK_CHECK(vkMapMemory(device, stagingDeviceMem, 0, size, 0, (void**)&directAccessPtr));
-		bx::memCopy(directAccessPtr, data, size);
-		vkUnmapMemory(device, stagingDeviceMem);
+		StagingBufferVK staging;
+		VkCommandBuffer commandBuffer = s_renderVK->allocStaging(staging, size, blockInfo.blockSize * 4);
+		bx::memCopy(staging.m_data, data, size);
 
 		VkBufferImageCopy region;
-		region.bufferOffset      = 0;
+		region.bufferOffset      = staging.m_offset;
 		region.bufferRowLength   = (_pitch == UINT16_MAX ? 0 : _pitch * 8 / bpp);
 		region.bufferImageHeight = 0;
 		region.imageSubresource.aspectMask     = m_vkTextureAspect;
@@ -5673,10 +6070,22 @@ VK_DESTROY
 		region.imageOffset = { _rect.m_x, _rect.m_y, _z };
 		region.imageExtent = { _rect.m_width, _rect.m_height, _depth };
 
-		copyBufferToTexture(stagingBuffer, 1, &region);
+		VkExtent3D mipSize;
+		mipSize.width  = bx::max<uint32_t>(1, m_width  >> _mip);
+		mipSize.height = bx::max<uint32_t>(1, m_height >> _mip);
+		mipSize.depth  = bx::max<uint32_t>(1, m_depth  >> _mip);
 
-		vkFreeMemory(device, stagingDeviceMem, allocatorCb);
-		vkDestroy(stagingBuffer);
+		if (s_renderVK->isTransferAligned(region.imageOffset, region.imageExtent, mipSize, blockInfo.blockWidth, blockInfo.blockHeight) )
+		{
+			copyBufferToTexture(commandBuffer, staging.m_buffer, 1, &region, true);
+		}
+		else
+		{
+			// Sub-rectangle doesn't satisfy transfer queue granularity, copy on graphics queue.
+			commandBuffer = s_renderVK->beginNewCommand();
+			copyBufferToTexture(commandBuffer, staging.m_buffer, 1, &region, false);
+			s_renderVK->submitCommandAndWait(commandBuffer);
+		}
 
 		if (NULL != temp)
 		{
@@ -5684,12 +6093,17 @@ VK_DESTROY
 		}
 	}
 
-	void TextureVK::copyBufferToTexture(VkBuffer stagingBuffer, uint32_t bufferImageCopyCount, VkBufferImageCopy* bufferImageCopy)
+	void TextureVK::copyBufferToTexture(VkCommandBuffer commandBuffer, VkBuffer stagingBuffer, uint32_t bufferImageCopyCount, VkBufferImageCopy* bufferImageCopy, bool transferQueue)
 	{
-		VkCommandBuffer commandBuffer = s_renderVK->beginNewCommand();
-
 		// image Layout transition into destination optimal
-		setImageMemoryBarrier(commandBuffer, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+		if (transferQueue)
+		{
+			setImageTransferBarrier(commandBuffer, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+		}
+		else
+		{
+			setImageMemoryBarrier(commandBuffer, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+		}
 
 		// copy buffer to image
 		vkCmdCopyBufferToImage(
@@ -5701,8 +6115,14 @@ VK_DESTROY
 			, bufferImageCopy
 			);
 
-		setImageMemoryBarrier(commandBuffer, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
-		s_renderVK->submitCommandAndWait(commandBuffer);
+		if (transferQueue)
+		{
+			setImageTransferBarrier(commandBuffer, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+		}
+		else
+		{
+			setImageMemoryBarrier(commandBuffer, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+		}
 	}
 
 	void TextureVK::setImageMemoryBarrier(VkCommandBuffer commandBuffer, VkImageLayout newImageLayout)
@@ -5720,6 +6140,45 @@ VK_DESTROY
 		m_currentImageLayout = newImageLayout;
 	}
 
+	void TextureVK::setImageTransferBarrier(VkCommandBuffer commandBuffer, VkImageLayout newImageLayout)
+	{
+		if (m_currentImageLayout == newImageLayout)
+			return;
+
+		// Transfer-only queue supports only transfer stages and accesses, visibility to graphics
+		// queue is provided by semaphore transfer batch signals.
+		const bool transferDst = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL == newImageLayout;
+
+		VkImageMemoryBarrier imb;
+		imb.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+		imb.pNext = NULL;
+		imb.srcAccessMask = transferDst ? 0 : VK_ACCESS_TRANSFER_WRITE_BIT;
+		imb.dstAccessMask = transferDst ? VK_ACCESS_TRANSFER_WRITE_BIT : 0;
+		imb.oldLayout = m_currentImageLayout;
+		imb.newLayout = newImageLayout;
+		imb.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		imb.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		imb.image = m_textureImage;
+		imb.subresourceRange.aspectMask     = m_vkTextureAspect;
+		imb.subresourceRange.baseMipLevel   = 0;
+		imb.subresourceRange.levelCount     = m_numMips;
+		imb.subresourceRange.baseArrayLayer = 0;
+		imb.subresourceRange.layerCount     = m_numSides;
+		vkCmdPipelineBarrier(commandBuffer
+			, transferDst ? VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT : VK_PIPELINE_STAGE_TRANSFER_BIT
+			, transferDst ? VK_PIPELINE_STAGE_TRANSFER_BIT    : VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT
+			, 0
+			, 0
+			, NULL
+			, 0
+			, NULL
+			, 1
+			, &imb
+			);
+
+		m_currentImageLayout = newImageLayout;
+	}
+
 	void FrameBufferVK::create(uint8_t _num, const Attachment* _attachment)
 	{
 		// create frame buffer object
@@ -36,6 +36,14 @@
 #include "renderer.h"
 #include "debug_renderdoc.h"
 
+#ifndef BGFX_VK_CONFIG_STAGING_SIZE
+#	define BGFX_VK_CONFIG_STAGING_SIZE (32<<20)
+#endif // BGFX_VK_CONFIG_STAGING_SIZE
+
+#ifndef BGFX_VK_CONFIG_MAX_TRANSFER_BATCHES
+#	define BGFX_VK_CONFIG_MAX_TRANSFER_BATCHES 4
+#endif // BGFX_VK_CONFIG_MAX_TRANSFER_BATCHES
+
 #define VK_IMPORT                                                          \
 			VK_IMPORT_FUNC(false, vkCreateInstance);                       \
 			VK_IMPORT_FUNC(false, vkGetInstanceProcAddr);                  \
@@ -101,6 +109,7 @@
 			VK_IMPORT_DEVICE_FUNC(false, vkCreateSemaphore);               \
 			VK_IMPORT_DEVICE_FUNC(false, vkDestroySemaphore);              \
 			VK_IMPORT_DEVICE_FUNC(false, vkResetFences);                   \
+			VK_IMPORT_DEVICE_FUNC(false, vkGetFenceStatus);                \
 			VK_IMPORT_DEVICE_FUNC(false, vkCreateCommandPool);             \
 			VK_IMPORT_DEVICE_FUNC(false, vkDestroyCommandPool);            \
 			VK_IMPORT_DEVICE_FUNC(false, vkResetCommandPool);              \
@@ -381,6 +390,58 @@ VK_DESTROY
 		uint32_t m_maxDescriptors;
 	};
 
+	struct StagingBufferVK
+	{
+		VkBuffer       m_buffer;
+		VkDeviceMemory m_deviceMem; // VK_NULL_HANDLE when suballocated from staging ring.
+		uint8_t*       m_data;
+		uint32_t       m_offset;
+	};
+
+	class StagingRingVK
+	{
+	public:
+		StagingRingVK()
+		{
+		}
+
+		~StagingRingVK()
+		{
+		}
+
+		void create(uint32_t _size);
+		void destroy();
+		bool alloc(StagingBufferVK& _out, uint32_t _size, uint32_t _align);
+
+		void retire(uint64_t _head)
+		{
+			m_tail = _head;
+		}
+
+		VkBuffer m_buffer;
+		VkDeviceMemory m_deviceMem;
+		uint8_t* m_data;
+		uint32_t m_size;
+		uint32_t m_pos;
+		uint64_t m_head;
+		uint64_t m_tail;
+	};
+
+	struct TransferBatchVK
+	{
+		VkCommandBuffer m_commandBuffer;
+		VkFence  m_fence;
+		uint64_t m_head;
+		bool     m_pending;
+
+		// Destroyed when batch completes. One-off staging buffers, and resources destroyed while
+		// copies into them could still be pending.
+		stl::vector<VkImageView>    m_releaseImageView;
+		stl::vector<VkImage>        m_releaseImage;
+		stl::vector<VkBuffer>       m_releaseBuffer;
+		stl::vector<VkDeviceMemory> m_releaseMemory;
+	};
+
 	struct ImageVK
 	{
 		ImageVK()
@@ -529,8 +590,9 @@ VK_DESTROY
 		void destroy();
 		void update(VkCommandPool commandPool, uint8_t _side, uint8_t _mip, const Rect& _rect, uint16_t _z, uint16_t _depth, uint16_t _pitch, const Memory* _mem);
 
-		void copyBufferToTexture(VkBuffer stagingBuffer, uint32_t bufferImageCopyCount, VkBufferImageCopy* bufferImageCopy);
+		void copyBufferToTexture(VkCommandBuffer commandBuffer, VkBuffer stagingBuffer, uint32_t bufferImageCopyCount, VkBufferImageCopy* bufferImageCopy, bool transferQueue);
 		void setImageMemoryBarrier(VkCommandBuffer commandBuffer, VkImageLayout newImageLayout);
+		void setImageTransferBarrier(VkCommandBuffer commandBuffer, VkImageLayout newImageLayout);
 
 		void* m_directAccessPtr;
 		uint64_t m_flags;
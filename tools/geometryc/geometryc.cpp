@@ -4,6 +4,7 @@
  */
 
 #include <algorithm>
+#include <thread>
 
 #include <bx/string.h>
 #include <bgfx/bgfx.h>
@@ -54,6 +55,9 @@ namespace stl = tinystl;
 #include <bx/uint32_t.h>
 #include <bx/math.h>
 #include <bx/file.h>
+#include <bx/allocator.h>
+#include <bx/cpu.h>
+#include <bx/thread.h>
 
 #include "bounds.h"
 
@@ -151,22 +155,94 @@ struct Mesh
 };
 
 static uint32_t s_obbSteps = 17;
+static bool s_meshlets = false;
+static bool s_index32 = false;
+static bool  s_quantize = false;
+static float s_quantizePosition = 0.0f;
+static float s_quantizeNormal   = 0.005f;
+static float s_quantizeTexcoord = 1.0f/4096.0f;
+static uint32_t s_numThreads = 1;
 
-#define BGFX_CHUNK_MAGIC_VB  BX_MAKEFOURCC('V', 'B', ' ', 0x1)
-#define BGFX_CHUNK_MAGIC_VBC BX_MAKEFOURCC('V', 'B', 'C', 0x0)
-#define BGFX_CHUNK_MAGIC_IB  BX_MAKEFOURCC('I', 'B', ' ', 0x0)
-#define BGFX_CHUNK_MAGIC_IBC BX_MAKEFOURCC('I', 'B', 'C', 0x1)
+static bx::DefaultAllocator s_allocator;
+
+struct Stage
+{
+	enum Enum
+	{
+		Tangents,
+		Split,
+		Optimize,
+		Meshlets,
+		Lods,
+		Quantize,
+		Bounds,
+		Compress,
+
+		Count
+	};
+};
+
+static const char* s_stageName[] =
+{
+	"tangents",
+	"split",
+	"optimize",
+	"meshlets",
+	"lods",
+	"quantize",
+	"bounds",
+	"compress",
+};
+BX_STATIC_ASSERT(BX_COUNTOF(s_stageName) == Stage::Count);
+
+// Time spent in each stage summed over all worker threads.
+static int64_t s_stageElapsed[Stage::Count];
+
+struct StageTimer
+{
+	StageTimer(Stage::Enum _stage)
+		: m_stage(_stage)
+		, m_start(bx::getHPCounter() )
+	{
+	}
+
+	~StageTimer()
+	{
+		bx::atomicFetchAndAdd(&s_stageElapsed[m_stage], bx::getHPCounter() - m_start);
+	}
+
+	Stage::Enum m_stage;
+	int64_t m_start;
+};
+static stl::vector<float> s_lodRatios;
+static stl::vector<float> s_lodErrors;
+
+// Limits recommended by meshoptimizer, both must fit meshopt_Meshlet.
+static const uint32_t kMeshletMaxVertices  = 64;
+static const uint32_t kMeshletMaxTriangles = 124;
+
+#define BGFX_CHUNK_MAGIC_VB    BX_MAKEFOURCC('V', 'B', ' ', 0x1)
+#define BGFX_CHUNK_MAGIC_VB32  BX_MAKEFOURCC('V', 'B', ' ', 0x2)
+#define BGFX_CHUNK_MAGIC_VBC   BX_MAKEFOURCC('V', 'B', 'C', 0x0)
+#define BGFX_CHUNK_MAGIC_VBC32 BX_MAKEFOURCC('V', 'B', 'C', 0x1)
+#define BGFX_CHUNK_MAGIC_IB    BX_MAKEFOURCC('I', 'B', ' ', 0x0)
+#define BGFX_CHUNK_MAGIC_IB32  BX_MAKEFOURCC('I', 'B', '3', 0x0)
+#define BGFX_CHUNK_MAGIC_IBC   BX_MAKEFOURCC('I', 'B', 'C', 0x1)
+#define BGFX_CHUNK_MAGIC_IBC32 BX_MAKEFOURCC('I', 'C', '3', 0x0)
 #define BGFX_CHUNK_MAGIC_PRI BX_MAKEFOURCC('P', 'R', 'I', 0x0)
+#define BGFX_CHUNK_MAGIC_MSL BX_MAKEFOURCC('M', 'S', 'L', 0x0)
+#define BGFX_CHUNK_MAGIC_LOD BX_MAKEFOURCC('L', 'O', 'D', 0x0)
+#define BGFX_CHUNK_MAGIC_QNT BX_MAKEFOURCC('Q', 'N', 'T', 0x0)
 
-void optimizeVertexCache(uint16_t* _indices, uint32_t _numIndices, uint32_t _numVertices)
+void optimizeVertexCache(uint32_t* _indices, uint32_t _numIndices, uint32_t _numVertices)
 {
-	uint16_t* newIndexList = new uint16_t[_numIndices];
+	uint32_t* newIndexList = new uint32_t[_numIndices];
 	meshopt_optimizeVertexCache(newIndexList, _indices, _numIndices, _numVertices);
-	bx::memCopy(_indices, newIndexList, _numIndices * 2);
+	bx::memCopy(_indices, newIndexList, _numIndices * 4);
 	delete[] newIndexList;
 }
 
-uint32_t optimizeVertexFetch(uint16_t* _indices, uint32_t _numIndices, uint8_t* _vertexData, uint32_t _numVertices, uint16_t _stride)
+uint32_t optimizeVertexFetch(uint32_t* _indices, uint32_t _numIndices, uint8_t* _vertexData, uint32_t _numVertices, uint16_t _stride)
 {
 	unsigned char* newVertices = (unsigned char*)malloc(_numVertices * _stride );
 	size_t vertexCount = meshopt_optimizeVertexFetch(newVertices, _indices, _numIndices, _vertexData, _numVertices, _stride);
@@ -176,228 +252,1305 @@ uint32_t optimizeVertexFetch(uint16_t* _indices, uint32_t _numIndices, uint8_t*
 	return uint32_t(vertexCount);
 }
 
-void writeCompressedIndices(bx::WriterI* _writer, const uint16_t* _indices, uint32_t _numIndices, uint32_t _numVertices)
+// Called from job threads, messages are appended to unit's log and printed in unit order
+// once all jobs are done.
+void writeCompressedIndices(bx::WriterI* _writer, stl::string& _log, const uint32_t* _indices, uint32_t _numIndices, uint32_t _numVertices, uint32_t _indexSize)
 {
+	StageTimer timer(Stage::Compress);
+
 	size_t maxSize = meshopt_encodeIndexBufferBound(_numIndices, _numVertices);
 	unsigned char* compressedIndices = (unsigned char*)malloc(maxSize);
 	size_t compressedSize = meshopt_encodeIndexBuffer(compressedIndices, maxSize, _indices, _numIndices);
-	bx::printf( "indices uncompressed: %10d, compressed: %10d, ratio: %0.2f%%\n"
-		, _numIndices*2
+
+	char temp[128];
+	const int32_t len = bx::snprintf(temp, BX_COUNTOF(temp), "indices uncompressed: %10d, compressed: %10d, ratio: %0.2f%%\n"
+		, _numIndices*_indexSize
 		, (uint32_t)compressedSize
-		, 100.0f - float(compressedSize ) / float(_numIndices*2)*100.0f
+		, 100.0f - float(compressedSize ) / float(_numIndices*_indexSize)*100.0f
 		);
+	_log.append(temp, temp + bx::min<int32_t>(len, BX_COUNTOF(temp)-1) );
 
 	bx::write(_writer, (uint32_t)compressedSize);
 	bx::write(_writer, compressedIndices, (uint32_t)compressedSize );
 	free(compressedIndices);
 }
 
-void writeCompressedVertices(bx::WriterI* _writer,  const uint8_t* _vertices, uint32_t _numVertices, uint16_t _stride)
+void writeCompressedVertices(bx::WriterI* _writer, stl::string& _log, const uint8_t* _vertices, uint32_t _numVertices, uint16_t _stride)
 {
+	StageTimer timer(Stage::Compress);
+
 	size_t maxSize = meshopt_encodeVertexBufferBound(_numVertices, _stride);
 	unsigned char* compressedVertices = (unsigned char*)malloc(maxSize);
 	size_t compressedSize = meshopt_encodeVertexBuffer(compressedVertices, maxSize, _vertices, _numVertices, _stride);
-	bx::printf("vertices uncompressed: %10d, compressed: %10d, ratio: %0.2f%%\n"
+
+	char temp[128];
+	const int32_t len = bx::snprintf(temp, BX_COUNTOF(temp), "vertices uncompressed: %10d, compressed: %10d, ratio: %0.2f%%\n"
 		, _numVertices * _stride
 		, (uint32_t)compressedSize
 		, 100.0f - float(compressedSize) / float(_numVertices * _stride)*100.0f
 		);
+	_log.append(temp, temp + bx::min<int32_t>(len, BX_COUNTOF(temp)-1) );
 
 	bx::write(_writer, (uint32_t)compressedSize);
 	bx::write(_writer, compressedVertices, (uint32_t)compressedSize );
 	free(compressedVertices);
 }
 
-void calcTangents(void* _vertices, uint16_t _numVertices, bgfx::VertexLayout _layout, const uint16_t* _indices, uint32_t _numIndices)
+void calcTangents(void* _vertices, uint32_t _numVertices, bgfx::VertexLayout _layout, const uint32_t* _indices, uint32_t _numIndices)
 {
 	struct PosTexcoord
 	{
-		float m_x;
-		float m_y;
-		float m_z;
-		float m_pad0;
-		float m_u;
-		float m_v;
-		float m_pad1;
-		float m_pad2;
-	};
+		float m_x;
+		float m_y;
+		float m_z;
+		float m_pad0;
+		float m_u;
+		float m_v;
+		float m_pad1;
+		float m_pad2;
+	};
+
+	float* tangents = new float[6*_numVertices];
+	bx::memSet(tangents, 0, 6*_numVertices*sizeof(float) );
+
+	PosTexcoord v0;
+	PosTexcoord v1;
+	PosTexcoord v2;
+
+	for (uint32_t ii = 0, num = _numIndices/3; ii < num; ++ii)
+	{
+		const uint32_t* indices = &_indices[ii*3];
+		uint32_t i0 = indices[0];
+		uint32_t i1 = indices[1];
+		uint32_t i2 = indices[2];
+
+		bgfx::vertexUnpack(&v0.m_x, bgfx::Attrib::Position, _layout, _vertices, i0);
+		bgfx::vertexUnpack(&v0.m_u, bgfx::Attrib::TexCoord0, _layout, _vertices, i0);
+
+		bgfx::vertexUnpack(&v1.m_x, bgfx::Attrib::Position, _layout, _vertices, i1);
+		bgfx::vertexUnpack(&v1.m_u, bgfx::Attrib::TexCoord0, _layout, _vertices, i1);
+
+		bgfx::vertexUnpack(&v2.m_x, bgfx::Attrib::Position, _layout, _vertices, i2);
+		bgfx::vertexUnpack(&v2.m_u, bgfx::Attrib::TexCoord0, _layout, _vertices, i2);
+
+		const float bax = v1.m_x - v0.m_x;
+		const float bay = v1.m_y - v0.m_y;
+		const float baz = v1.m_z - v0.m_z;
+		const float bau = v1.m_u - v0.m_u;
+		const float bav = v1.m_v - v0.m_v;
+
+		const float cax = v2.m_x - v0.m_x;
+		const float cay = v2.m_y - v0.m_y;
+		const float caz = v2.m_z - v0.m_z;
+		const float cau = v2.m_u - v0.m_u;
+		const float cav = v2.m_v - v0.m_v;
+
+		const float det = (bau * cav - bav * cau);
+		const float invDet = 1.0f / det;
+
+		const float tx = (bax * cav - cax * bav) * invDet;
+		const float ty = (bay * cav - cay * bav) * invDet;
+		const float tz = (baz * cav - caz * bav) * invDet;
+
+		const float bx = (cax * bau - bax * cau) * invDet;
+		const float by = (cay * bau - bay * cau) * invDet;
+		const float bz = (caz * bau - baz * cau) * invDet;
+
+		for (uint32_t jj = 0; jj < 3; ++jj)
+		{
+			float* tanu = &tangents[indices[jj]*6];
+			float* tanv = &tanu[3];
+			tanu[0] += tx;
+			tanu[1] += ty;
+			tanu[2] += tz;
+
+			tanv[0] += bx;
+			tanv[1] += by;
+			tanv[2] += bz;
+		}
+	}
+
+	for (uint32_t ii = 0; ii < _numVertices; ++ii)
+	{
+		const bx::Vec3 tanu = bx::load<bx::Vec3>(&tangents[ii*6]);
+		const bx::Vec3 tanv = bx::load<bx::Vec3>(&tangents[ii*6 + 3]);
+
+		float nxyzw[4];
+		bgfx::vertexUnpack(nxyzw, bgfx::Attrib::Normal, _layout, _vertices, ii);
+
+		const bx::Vec3 normal  = bx::load<bx::Vec3>(nxyzw);
+		const float    ndt     = bx::dot(normal, tanu);
+		const bx::Vec3 nxt     = bx::cross(normal, tanu);
+		const bx::Vec3 tmp     = bx::sub(tanu, bx::mul(normal, ndt) );
+
+		float tangent[4];
+		bx::store(tangent, bx::normalize(tmp) );
+		tangent[3] = bx::dot(nxt, tanv) < 0.0f ? -1.0f : 1.0f;
+
+		bgfx::vertexPack(tangent, true, bgfx::Attrib::Tangent, _layout, _vertices, ii);
+	}
+
+	delete [] tangents;
+}
+
+struct Meshlet
+{
+	uint32_t m_startIndex;
+	uint32_t m_numIndices;
+	Sphere   m_sphere;
+	bx::Vec3 m_coneApex;
+	bx::Vec3 m_coneAxis;
+	float    m_coneCutoff;
+};
+
+typedef stl::vector<Meshlet> MeshletArray;
+
+// Splits each primitive into meshlets, and rewrites its indices so that triangles of each
+// meshlet form contiguous index range.
+void buildMeshlets(
+	  MeshletArray& _meshlets
+	, uint32_t* _indices
+	, const uint8_t* _vertices
+	, uint32_t _numVertices
+	, uint32_t _stride
+	, const PrimitiveArray& _primitives
+	)
+{
+	stl::vector<meshopt_Meshlet> meshlets;
+
+	for (PrimitiveArray::const_iterator primIt = _primitives.begin(); primIt != _primitives.end(); ++primIt)
+	{
+		const Primitive& prim = *primIt;
+		uint32_t* indices = &_indices[prim.m_startIndex];
+
+		meshlets.resize(meshopt_buildMeshletsBound(prim.m_numIndices, kMeshletMaxVertices, kMeshletMaxTriangles) );
+		meshlets.resize(meshopt_buildMeshlets(
+			  meshlets.data()
+			, indices
+			, prim.m_numIndices
+			, _numVertices
+			, kMeshletMaxVertices
+			, kMeshletMaxTriangles
+			) );
+
+		uint32_t startIndex = prim.m_startIndex;
+
+		for (uint32_t ii = 0, num = uint32_t(meshlets.size() ); ii < num; ++ii)
+		{
+			const meshopt_Meshlet& src = meshlets[ii];
+
+			// Position is always first attribute in vertex layout.
+			const meshopt_Bounds bounds = meshopt_computeMeshletBounds(&src, (const float*)_vertices, _numVertices, _stride);
+
+			Meshlet meshlet;
+			meshlet.m_startIndex      = startIndex;
+			meshlet.m_numIndices      = src.triangle_count*3;
+			meshlet.m_sphere.center   = bx::load<bx::Vec3>(bounds.center);
+			meshlet.m_sphere.radius   = bounds.radius;
+			meshlet.m_coneApex        = bx::load<bx::Vec3>(bounds.cone_apex);
+			meshlet.m_coneAxis        = bx::load<bx::Vec3>(bounds.cone_axis);
+			meshlet.m_coneCutoff      = bounds.cone_cutoff;
+			_meshlets.push_back(meshlet);
+
+			for (uint32_t tri = 0; tri < src.triangle_count; ++tri)
+			{
+				*indices++ = src.vertices[src.indices[tri][0] ];
+				*indices++ = src.vertices[src.indices[tri][1] ];
+				*indices++ = src.vertices[src.indices[tri][2] ];
+			}
+
+			startIndex += meshlet.m_numIndices;
+		}
+	}
+}
+
+void write(bx::WriterI* _writer, const MeshletArray& _meshlets)
+{
+	bx::write(_writer, BGFX_CHUNK_MAGIC_MSL);
+	bx::write(_writer, uint32_t(_meshlets.size() ) );
+
+	for (MeshletArray::const_iterator it = _meshlets.begin(); it != _meshlets.end(); ++it)
+	{
+		bx::write(_writer, it->m_startIndex);
+		bx::write(_writer, it->m_numIndices);
+		bx::write(_writer, it->m_sphere);
+		bx::write(_writer, it->m_coneApex);
+		bx::write(_writer, it->m_coneAxis);
+		bx::write(_writer, it->m_coneCutoff);
+	}
+}
+
+struct Lod
+{
+	uint32_t m_startIndex;
+	uint32_t m_numIndices;
+	uint32_t m_numVertices;
+	float    m_error;
+};
+
+typedef stl::vector<Lod> LodArray;
+
+// Simplifies each primitive into progressively coarser levels appended after base indices.
+// Each level is simplified from previous one, and covers all primitives of group. Vertices
+// are then reordered by coarsest level that references them, so that each level uses only
+// vertex prefix of group vertex buffer.
+void buildLods(
+	  LodArray& _lods
+	, stl::vector<uint32_t>& _indices
+	, uint8_t* _vertices
+	, uint32_t _numVertices
+	, uint32_t _stride
+	, PrimitiveArray& _primitives
+	)
+{
+	const uint32_t numPrims = uint32_t(_primitives.size() );
+
+	Aabb aabb;
+	toAabb(aabb, _vertices, _numVertices, _stride);
+	const bx::Vec3 size = bx::sub(aabb.max, aabb.min);
+	const float extent = bx::max(size.x, bx::max(size.y, size.z) );
+
+	Lod lod;
+	lod.m_startIndex  = 0;
+	lod.m_numIndices  = uint32_t(_indices.size() );
+	lod.m_numVertices = _numVertices;
+	lod.m_error       = 0.0f;
+	_lods.push_back(lod);
+
+	stl::vector<uint32_t> prevStart;
+	stl::vector<uint32_t> prevNum;
+	prevStart.resize(numPrims);
+	prevNum.resize(numPrims);
+
+	for (uint32_t pp = 0; pp < numPrims; ++pp)
+	{
+		prevStart[pp] = _primitives[pp].m_startIndex;
+		prevNum[pp]   = _primitives[pp].m_numIndices;
+	}
+
+	stl::vector<uint32_t> lodIndices;
+
+	for (uint32_t level = 0, numLevels = uint32_t(s_lodRatios.size() ); level < numLevels; ++level)
+	{
+		const float ratio = s_lodRatios[level];
+		const float error = s_lodErrors[bx::uint32_min(level, uint32_t(s_lodErrors.size() )-1)];
+
+		lod.m_startIndex  = uint32_t(_indices.size() );
+		lod.m_numVertices = 0;
+		// meshoptimizer error is relative to mesh extents.
+		lod.m_error       = error*extent;
+
+		bool reduced = false;
+
+		for (uint32_t pp = 0; pp < numPrims; ++pp)
+		{
+			const uint32_t target = uint32_t(float(_primitives[pp].m_numIndices)*ratio)/3*3;
+
+			lodIndices.resize(prevNum[pp]);
+			const uint32_t num = uint32_t(meshopt_simplify(
+				  lodIndices.data()
+				, &_indices[prevStart[pp] ]
+				, prevNum[pp]
+				, (const float*)_vertices
+				, _numVertices
+				, _stride
+				, target
+				, error
+				) );
+
+			reduced |= num < prevNum[pp];
+
+			prevStart[pp] = uint32_t(_indices.size() );
+			prevNum[pp]   = num;
+
+			for (uint32_t ii = 0; ii < num; ++ii)
+			{
+				_indices.push_back(lodIndices[ii]);
+			}
+
+			if (0 < num)
+			{
+				optimizeVertexCache(&_indices[prevStart[pp] ], num, _numVertices);
+			}
+		}
+
+		lod.m_numIndices = uint32_t(_indices.size() ) - lod.m_startIndex;
+
+		if (!reduced
+		||  0 == lod.m_numIndices)
+		{
+			_indices.resize(lod.m_startIndex);
+			break;
+		}
+
+		_lods.push_back(lod);
+	}
+
+	const uint32_t numLods = uint32_t(_lods.size() );
+
+	stl::vector<uint8_t> coarsest;
+	coarsest.resize(_numVertices);
+	bx::memSet(coarsest.data(), 0, _numVertices);
+
+	for (uint32_t ll = 1; ll < numLods; ++ll)
+	{
+		const Lod& src = _lods[ll];
+		for (uint32_t ii = src.m_startIndex, end = ii + src.m_numIndices; ii < end; ++ii)
+		{
+			coarsest[_indices[ii] ] = uint8_t(ll);
+		}
+	}
+
+	stl::vector<uint32_t> remap;
+	remap.resize(_numVertices);
+
+	uint32_t next = 0;
+	for (uint32_t ll = numLods; ll-- > 0;)
+	{
+		for (uint32_t vv = 0; vv < _numVertices; ++vv)
+		{
+			if (ll == coarsest[vv])
+			{
+				remap[vv] = next++;
+			}
+		}
+
+		_lods[ll].m_numVertices = next;
+	}
+
+	uint8_t* vertices = (uint8_t*)malloc(_numVertices*_stride);
+	for (uint32_t vv = 0; vv < _numVertices; ++vv)
+	{
+		bx::memCopy(&vertices[remap[vv]*_stride], &_vertices[vv*_stride], _stride);
+	}
+	bx::memCopy(_vertices, vertices, _numVertices*_stride);
+	free(vertices);
+
+	for (uint32_t ii = 0, num = uint32_t(_indices.size() ); ii < num; ++ii)
+	{
+		_indices[ii] = remap[_indices[ii] ];
+	}
+
+	// Vertices of primitive are not contiguous anymore, use range referenced by its indices.
+	for (uint32_t pp = 0; pp < numPrims; ++pp)
+	{
+		Primitive& prim = _primitives[pp];
+
+		uint32_t minVertex = UINT32_MAX;
+		uint32_t maxVertex = 0;
+		for (uint32_t ii = prim.m_startIndex, end = ii + prim.m_numIndices; ii < end; ++ii)
+		{
+			minVertex = bx::uint32_min(minVertex, _indices[ii]);
+			maxVertex = bx::uint32_max(maxVertex, _indices[ii]);
+		}
+
+		prim.m_startVertex = minVertex;
+		prim.m_numVertices = maxVertex - minVertex + 1;
+	}
+}
+
+void write(bx::WriterI* _writer, const LodArray& _lods)
+{
+	bx::write(_writer, BGFX_CHUNK_MAGIC_LOD);
+	bx::write(_writer, uint8_t(_lods.size() ) );
+
+	for (LodArray::const_iterator it = _lods.begin(); it != _lods.end(); ++it)
+	{
+		bx::write(_writer, it->m_startIndex);
+		bx::write(_writer, it->m_numIndices);
+		bx::write(_writer, it->m_numVertices);
+		bx::write(_writer, it->m_error);
+	}
+}
+
+struct Quantization
+{
+	enum Enum
+	{
+		Float,
+		Half,
+		Unorm8,
+		Snorm16,
+
+		Count
+	};
+};
+
+// Attribute types are selected once for whole mesh, so that all groups share vertex layout.
+struct QuantizeSetup
+{
+	Quantization::Enum m_position;
+	Quantization::Enum m_normal;
+	Quantization::Enum m_texcoord;
+};
+
+static QuantizeSetup s_quantizeSetup;
+
+struct Dequant
+{
+	bx::Vec3 m_offset;
+	float    m_scale;
+};
+
+inline uint8_t toUnorm8(float _value)
+{
+	return uint8_t(bx::clamp(_value, 0.0f, 1.0f)*255.0f + 0.5f);
+}
+
+inline int16_t toSnorm16(float _value)
+{
+	const float value = bx::clamp(_value, -1.0f, 1.0f)*32767.0f;
+	return int16_t(value + (value < 0.0f ? -0.5f : 0.5f) );
+}
+
+inline float fromUnorm8(uint8_t _value)
+{
+	return float(_value)/255.0f;
+}
+
+inline float fromSnorm16(int16_t _value)
+{
+	return bx::max(float(_value)/32767.0f, -1.0f);
+}
+
+// Octahedral mapping of unit vector into [-1, 1] square.
+void octEncode(float* _result, const bx::Vec3& _v)
+{
+	const float l1 = bx::abs(_v.x) + bx::abs(_v.y) + bx::abs(_v.z);
+	if (0.0f == l1)
+	{
+		_result[0] = 0.0f;
+		_result[1] = 0.0f;
+		return;
+	}
+
+	float xx = _v.x / l1;
+	float yy = _v.y / l1;
+
+	if (_v.z < 0.0f)
+	{
+		const float tx = (1.0f - bx::abs(yy) ) * (xx >= 0.0f ? 1.0f : -1.0f);
+		const float ty = (1.0f - bx::abs(xx) ) * (yy >= 0.0f ? 1.0f : -1.0f);
+		xx = tx;
+		yy = ty;
+	}
+
+	_result[0] = xx;
+	_result[1] = yy;
+}
+
+bx::Vec3 octDecode(float _x, float _y)
+{
+	bx::Vec3 result(_x, _y, 1.0f - bx::abs(_x) - bx::abs(_y) );
+	const float tt = bx::max(-result.z, 0.0f);
+	result.x += result.x >= 0.0f ? -tt : tt;
+	result.y += result.y >= 0.0f ? -tt : tt;
+	return bx::normalize(result);
+}
+
+// Returns largest error of octahedral encoded unit vectors stored in given type.
+float calcOctError(const Vec3Array& _vectors, Quantization::Enum _type)
+{
+	float maxError = 0.0f;
+
+	for (Vec3Array::const_iterator it = _vectors.begin(), itEnd = _vectors.end(); it != itEnd; ++it)
+	{
+		const bx::Vec3 vv = bx::normalize(*it);
+
+		float oct[2];
+		octEncode(oct, vv);
+
+		// Encoded in 0-1 range for both types, to match decodeNormalOctahedron in shaderlib.sh.
+		if (Quantization::Unorm8 == _type)
+		{
+			oct[0] = fromUnorm8(toUnorm8(oct[0]*0.5f + 0.5f) )*2.0f - 1.0f;
+			oct[1] = fromUnorm8(toUnorm8(oct[1]*0.5f + 0.5f) )*2.0f - 1.0f;
+		}
+		else
+		{
+			oct[0] = fromSnorm16(toSnorm16(oct[0]*0.5f + 0.5f) )*2.0f - 1.0f;
+			oct[1] = fromSnorm16(toSnorm16(oct[1]*0.5f + 0.5f) )*2.0f - 1.0f;
+		}
+
+		maxError = bx::max(maxError, bx::length(bx::sub(octDecode(oct[0], oct[1]), vv) ) );
+	}
+
+	return maxError;
+}
+
+// Picks smallest attribute type within error bounds for each attribute.
+//
+// Positions are normalized to group AABB, with uniform scale so that dequantization transform
+// doesn't skew normals. Half positions would take as much space as normalized int16 positions
+// with lower precision, so they are not considered.
+void calcQuantizeSetup(QuantizeSetup& _setup, const Mesh& _mesh)
+{
+	Aabb aabb;
+	toAabb(aabb, _mesh.m_positions.data(), uint32_t(_mesh.m_positions.size() ), sizeof(bx::Vec3) );
+	const bx::Vec3 size = bx::sub(aabb.max, aabb.min);
+	const float extent = bx::max(size.x, bx::max(size.y, size.z) );
+
+	_setup.m_position = Quantization::Float;
+	if (extent*0.5f/255.0f <= s_quantizePosition)
+	{
+		_setup.m_position = Quantization::Unorm8;
+	}
+	else if (extent*0.25f/32767.0f <= s_quantizePosition)
+	{
+		_setup.m_position = Quantization::Snorm16;
+	}
+
+	_setup.m_normal = Quantization::Float;
+	if (calcOctError(_mesh.m_normals, Quantization::Unorm8) <= s_quantizeNormal)
+	{
+		_setup.m_normal = Quantization::Unorm8;
+	}
+	else if (calcOctError(_mesh.m_normals, Quantization::Snorm16) <= s_quantizeNormal)
+	{
+		_setup.m_normal = Quantization::Snorm16;
+	}
+
+	float maxError = 0.0f;
+	for (Vec3Array::const_iterator it = _mesh.m_texcoords.begin(), itEnd = _mesh.m_texcoords.end(); it != itEnd; ++it)
+	{
+		maxError = bx::max(maxError, bx::abs(bx::halfToFloat(bx::halfFromFloat(it->x) ) - it->x) );
+		maxError = bx::max(maxError, bx::abs(bx::halfToFloat(bx::halfFromFloat(it->y) ) - it->y) );
+	}
+
+	_setup.m_texcoord = maxError <= s_quantizeTexcoord
+		? Quantization::Half
+		: Quantization::Float
+		;
+
+	static const char* s_quantizationName[] =
+	{
+		"float",
+		"half",
+		"unorm8",
+		"snorm16",
+	};
+	BX_STATIC_ASSERT(BX_COUNTOF(s_quantizationName) == Quantization::Count);
+
+	bx::printf("quantize position: %s, normal: %s, texcoord: %s\n"
+		, s_quantizationName[_setup.m_position]
+		, s_quantizationName[_setup.m_normal]
+		, s_quantizationName[_setup.m_texcoord]
+		);
+}
+
+uint32_t getAttribSize(const bgfx::VertexLayout& _layout, bgfx::Attrib::Enum _attrib)
+{
+	uint8_t num;
+	bgfx::AttribType::Enum type;
+	bool normalized;
+	bool asInt;
+	_layout.decode(_attrib, num, type, normalized, asInt);
+
+	switch (type)
+	{
+	case bgfx::AttribType::Uint8:  return num;
+	case bgfx::AttribType::Uint10: return 4;
+	case bgfx::AttribType::Int16:  return num*2;
+	case bgfx::AttribType::Half:   return num*2;
+	default:                       return num*4;
+	}
+}
+
+void addQuantized(bgfx::VertexLayout& _layout, bgfx::Attrib::Enum _attrib, uint8_t _num, Quantization::Enum _type)
+{
+	switch (_type)
+	{
+	case Quantization::Unorm8:  _layout.add(_attrib, _num, bgfx::AttribType::Uint8, true);        break;
+	case Quantization::Snorm16: _layout.add(_attrib, _num, bgfx::AttribType::Int16, true);        break;
+	case Quantization::Half:    _layout.add(_attrib, _num, bgfx::AttribType::Half);               break;
+	default:                    _layout.add(_attrib, _num, bgfx::AttribType::Float);              break;
+	}
+}
+
+void storeQuantized(uint8_t* _dst, const float* _src, uint32_t _num, Quantization::Enum _type)
+{
+	for (uint32_t ii = 0; ii < _num; ++ii)
+	{
+		switch (_type)
+		{
+		case Quantization::Unorm8:  _dst[ii] = toUnorm8(_src[ii]);                                break;
+		case Quantization::Snorm16: ( (int16_t*)_dst)[ii] = toSnorm16(_src[ii]);                break;
+		case Quantization::Half:    ( (uint16_t*)_dst)[ii] = bx::halfFromFloat(_src[ii]);       break;
+		default:                    ( (float*)_dst)[ii] = _src[ii];                             break;
+		}
+	}
+}
+
+// Converts vertices into quantized layout. Normals and tangents are octahedral encoded into
+// xy in 0-1 range (tangent handedness is in z), and must be decoded in shader with
+// decodeNormalOctahedron and decodeTangentOctahedron from shaderlib.sh. Quantized attributes
+// always have 4 components, so every attribute stays 4 byte aligned. Returns true if positions
+// are quantized and need dequantization transform.
+bool quantize(
+	  stl::vector<uint8_t>& _out
+	, bgfx::VertexLayout& _outLayout
+	, Dequant& _dequant
+	, const uint8_t* _vertices
+	, uint32_t _numVertices
+	, const bgfx::VertexLayout& _layout
+	)
+{
+	const QuantizeSetup& setup = s_quantizeSetup;
+	const uint32_t stride = _layout.getStride();
+
+	_outLayout.begin();
+
+	for (uint32_t attr = 0; attr < bgfx::Attrib::Count; ++attr)
+	{
+		const bgfx::Attrib::Enum attrib = bgfx::Attrib::Enum(attr);
+		if (!_layout.has(attrib) )
+		{
+			continue;
+		}
+
+		switch (attrib)
+		{
+		case bgfx::Attrib::Position:
+			addQuantized(_outLayout, attrib, Quantization::Float == setup.m_position ? 3 : 4, setup.m_position);
+			break;
+
+		case bgfx::Attrib::Normal:
+			addQuantized(_outLayout, attrib, Quantization::Float == setup.m_normal ? 3 : 4, setup.m_normal);
+			break;
+
+		case bgfx::Attrib::Tangent:
+			addQuantized(_outLayout, attrib, 4, setup.m_normal);
+			break;
+
+		case bgfx::Attrib::TexCoord0:
+			addQuantized(_outLayout, attrib, 2, setup.m_texcoord);
+			break;
+
+		default:
+			{
+				uint8_t num;
+				bgfx::AttribType::Enum type;
+				bool normalized;
+				bool asInt;
+				_layout.decode(attrib, num, type, normalized, asInt);
+				_outLayout.add(attrib, num, type, normalized, asInt);
+			}
+			break;
+		}
+	}
+
+	_outLayout.end();
+
+	const uint32_t outStride = _outLayout.getStride();
+	_out.resize(_numVertices*outStride);
+
+	Aabb aabb;
+	toAabb(aabb, _vertices, _numVertices, stride);
+	const bx::Vec3 size = bx::sub(aabb.max, aabb.min);
+	const float extent = bx::max(bx::max(size.x, bx::max(size.y, size.z) ), bx::kFloatMin);
+
+	switch (setup.m_position)
+	{
+	case Quantization::Unorm8:
+		_dequant.m_offset = aabb.min;
+		_dequant.m_scale  = extent;
+		break;
+
+	case Quantization::Snorm16:
+		_dequant.m_offset = bx::mul(bx::add(aabb.min, aabb.max), 0.5f);
+		_dequant.m_scale  = extent*0.5f;
+		break;
+
+	default:
+		_dequant.m_offset = bx::Vec3(0.0f, 0.0f, 0.0f);
+		_dequant.m_scale  = 1.0f;
+		break;
+	}
+
+	const float invScale = 1.0f/_dequant.m_scale;
+
+	for (uint32_t vv = 0; vv < _numVertices; ++vv)
+	{
+		uint8_t* dst = &_out[vv*outStride];
+
+		for (uint32_t attr = 0; attr < bgfx::Attrib::Count; ++attr)
+		{
+			const bgfx::Attrib::Enum attrib = bgfx::Attrib::Enum(attr);
+			if (!_layout.has(attrib) )
+			{
+				continue;
+			}
+
+			uint8_t* data = &dst[_outLayout.getOffset(attrib)];
+
+			float value[4];
+			bgfx::vertexUnpack(value, attrib, _layout, _vertices, vv);
+
+			switch (attrib)
+			{
+			case bgfx::Attrib::Position:
+				{
+					const bx::Vec3 pos = bx::mul(bx::sub(bx::load<bx::Vec3>(value), _dequant.m_offset), invScale);
+					bx::store(value, pos);
+					value[3] = 1.0f;
+					storeQuantized(data, value, Quantization::Float == setup.m_position ? 3 : 4, setup.m_position);
+				}
+				break;
+
+			case bgfx::Attrib::Normal:
+			case bgfx::Attrib::Tangent:
+				{
+					const float sign = value[3];
+
+					if (Quantization::Float != setup.m_normal)
+					{
+						octEncode(value, bx::normalize(bx::load<bx::Vec3>(value) ) );
+						value[0] = value[0]*0.5f + 0.5f;
+						value[1] = value[1]*0.5f + 0.5f;
+						value[2] = bgfx::Attrib::Tangent == attrib ? sign*0.5f + 0.5f : 0.0f;
+						value[3] = 0.0f;
+					}
+
+					const uint32_t num = bgfx::Attrib::Normal == attrib
+						&& Quantization::Float == setup.m_normal
+						? 3
+						: 4
+						;
+					storeQuantized(data, value, num, setup.m_normal);
+				}
+				break;
+
+			case bgfx::Attrib::TexCoord0:
+				storeQuantized(data, value, 2, setup.m_texcoord);
+				break;
+
+			default:
+				bx::memCopy(data, &_vertices[vv*stride + _layout.getOffset(attrib)], getAttribSize(_layout, attrib) );
+				break;
+			}
+		}
+	}
+
+	return Quantization::Float != setup.m_position;
+}
+
+void write(bx::WriterI* _writer, const Dequant& _dequant)
+{
+	bx::write(_writer, BGFX_CHUNK_MAGIC_QNT);
+	bx::write(_writer, _dequant.m_offset);
+	bx::write(_writer, _dequant.m_scale);
+}
+
+void write(bx::WriterI* _writer, const void* _vertices, uint32_t _numVertices, uint32_t _stride)
+{
+	StageTimer timer(Stage::Bounds);
+
+	Sphere maxSphere;
+	calcMaxBoundingSphere(maxSphere, _vertices, _numVertices, _stride);
+
+	Sphere minSphere;
+	calcMinBoundingSphere(minSphere, _vertices, _numVertices, _stride);
+
+	if (minSphere.radius > maxSphere.radius)
+	{
+		bx::write(_writer, maxSphere);
+	}
+	else
+	{
+		bx::write(_writer, minSphere);
+	}
+
+	Aabb aabb;
+	toAabb(aabb, _vertices, _numVertices, _stride);
+	bx::write(_writer, aabb);
+
+	Obb obb;
+	calcObb(obb, _vertices, _numVertices, _stride, s_obbSteps);
+	bx::write(_writer, obb);
+}
+
+void write(bx::WriterI* _writer
+		, stl::string& _log
+		, uint8_t* _vertices
+		, uint32_t _numVertices
+		, const bgfx::VertexLayout& _layout
+		, uint32_t* _indices
+		, uint32_t _numIndices
+		, bool _compress
+		, const stl::string& _material
+		, PrimitiveArray& _primitives
+		)
+{
+	using namespace bx;
+	using namespace bgfx;
+
+	uint32_t stride = _layout.getStride();
+
+	MeshletArray meshlets;
+	if (s_meshlets)
+	{
+		StageTimer timer(Stage::Meshlets);
+		buildMeshlets(meshlets, _indices, _vertices, _numVertices, stride, _primitives);
+	}
+
+	LodArray lods;
+	stl::vector<uint32_t> lodIndices;
+	if (!s_lodRatios.empty() )
+	{
+		StageTimer timer(Stage::Lods);
+
+		lodIndices.resize(_numIndices);
+		bx::memCopy(lodIndices.data(), _indices, _numIndices*4);
+
+		buildLods(lods, lodIndices, _vertices, _numVertices, stride, _primitives);
+
+		// Meshlet ranges are unaffected, they reference base level indices only.
+		_indices    = lodIndices.data();
+		_numIndices = uint32_t(lodIndices.size() );
+	}
+
+	// Bounds, meshlets and LODs are calculated from unquantized vertices, bounds are in mesh
+	// space and dequantization transform is applied by loader.
+	const uint8_t* vertexData = _vertices;
+	const bgfx::VertexLayout* layout = &_layout;
+
+	stl::vector<uint8_t> quantized;
+	bgfx::VertexLayout quantizedLayout;
+	Dequant dequant;
+	bool hasDequant = false;
+	if (s_quantize)
+	{
+		StageTimer timer(Stage::Quantize);
+		hasDequant = quantize(quantized, quantizedLayout, dequant, _vertices, _numVertices, _layout);
+		vertexData = quantized.data();
+		layout     = &quantizedLayout;
+	}
+
+	const uint16_t vertexStride = layout->getStride();
+
+	// Groups that fit 16-bit indices are written in original format, regardless of --index32.
+	const bool index32 = _numVertices > UINT16_MAX;
+
+	if (_compress)
+	{
+		write(_writer, index32 ? BGFX_CHUNK_MAGIC_VBC32 : BGFX_CHUNK_MAGIC_VBC);
+		write(_writer, _vertices, _numVertices, stride);
+
+		write(_writer, *layout);
+
+		if (index32)
+		{
+			write(_writer, _numVertices);
+		}
+		else
+		{
+			write(_writer, uint16_t(_numVertices) );
+		}
+
+		writeCompressedVertices(_writer, _log, vertexData, _numVertices, vertexStride);
+	}
+	else
+	{
+		write(_writer, index32 ? BGFX_CHUNK_MAGIC_VB32 : BGFX_CHUNK_MAGIC_VB);
+		write(_writer, _vertices, _numVertices, stride);
+
+		write(_writer, *layout);
+
+		if (index32)
+		{
+			write(_writer, _numVertices);
+		}
+		else
+		{
+			write(_writer, uint16_t(_numVertices) );
+		}
+
+		write(_writer, vertexData, _numVertices*vertexStride);
+	}
+
+	if (hasDequant)
+	{
+		write(_writer, dequant);
+	}
+
+	if (_compress)
+	{
+		// Encoded stream doesn't depend on index size, it's selected when decoding.
+		write(_writer, index32 ? BGFX_CHUNK_MAGIC_IBC32 : BGFX_CHUNK_MAGIC_IBC);
+		write(_writer, _numIndices);
+		writeCompressedIndices(_writer, _log, _indices, _numIndices, _numVertices, index32 ? 4 : 2);
+	}
+	else if (index32)
+	{
+		write(_writer, BGFX_CHUNK_MAGIC_IB32);
+		write(_writer, _numIndices);
+		write(_writer, _indices, _numIndices*4);
+	}
+	else
+	{
+		write(_writer, BGFX_CHUNK_MAGIC_IB);
+		write(_writer, _numIndices);
+		for (uint32_t ii = 0; ii < _numIndices; ++ii)
+		{
+			write(_writer, uint16_t(_indices[ii]) );
+		}
+	}
+
+	if (s_meshlets)
+	{
+		write(_writer, meshlets);
+	}
+
+	if (!s_lodRatios.empty() )
+	{
+		write(_writer, lods);
+	}
+
+	write(_writer, BGFX_CHUNK_MAGIC_PRI);
+	uint16_t nameLen = uint16_t(_material.size() );
+	write(_writer, nameLen);
+	write(_writer, _material.c_str(), nameLen);
+	write(_writer, uint16_t(_primitives.size() ) );
+	for (PrimitiveArray::const_iterator primIt = _primitives.begin(); primIt != _primitives.end(); ++primIt)
+	{
+		const Primitive& prim = *primIt;
+		nameLen = uint16_t(prim.m_name.size() );
+		write(_writer, nameLen);
+		write(_writer, prim.m_name.c_str(), nameLen);
+		write(_writer, prim.m_startIndex);
+		write(_writer, prim.m_numIndices);
+		write(_writer, prim.m_startVertex);
+		write(_writer, prim.m_numVertices);
+		write(_writer, &_vertices[prim.m_startVertex*stride], prim.m_numVertices, stride);
+	}
+}
+
+// Group, or part of split group, written as one set of VB, IB and PRI chunks.
+struct WriteUnit
+{
+	WriteUnit()
+		: m_vertices(NULL)
+		, m_numVertices(0)
+		, m_indices(NULL)
+		, m_numIndices(0)
+		, m_output(&s_allocator)
+		, m_outputSize(0)
+	{
+	}
+
+	~WriteUnit()
+	{
+		free(m_vertices);
+		free(m_indices);
+	}
+
+	uint8_t*  m_vertices;
+	uint32_t  m_numVertices;
+	uint32_t* m_indices;
+	uint32_t  m_numIndices;
+	stl::string    m_material;
+	PrimitiveArray m_primitives;
+
+	bx::MemoryBlock m_output;
+	uint32_t        m_outputSize;
+	stl::string     m_log;
+};
+
+typedef stl::vector<WriteUnit*> WriteUnitArray;
+
+// Group as produced by parsing, before tangents are calculated and it's split.
+struct GroupJob
+{
+	WriteUnit*     m_group;
+	WriteUnitArray m_units;
+};
+
+typedef stl::vector<GroupJob> GroupJobArray;
+
+struct ProcessContext
+{
+	const bgfx::VertexLayout* m_layout;
+	bool m_tangent;
+	bool m_compress;
+
+	GroupJobArray  m_groups;
+	WriteUnitArray m_units;
+};
+
+typedef void (*JobFn)(ProcessContext& _ctx, uint32_t _idx);
+
+struct JobBatch
+{
+	JobFn           m_fn;
+	ProcessContext* m_ctx;
+	int32_t         m_numJobs;
+	int32_t         m_next;
+};
+
+static int32_t jobThreadFunc(bx::Thread* /*_thread*/, void* _userData)
+{
+	JobBatch& batch = *(JobBatch*)_userData;
+
+	for (int32_t idx = bx::atomicFetchAndAdd(&batch.m_next, 1); idx < batch.m_numJobs; idx = bx::atomicFetchAndAdd(&batch.m_next, 1) )
+	{
+		batch.m_fn(*batch.m_ctx, uint32_t(idx) );
+	}
+
+	return bx::kExitSuccess;
+}
+
+// Runs jobs on thread pool. Each job writes only its own data, so results don't depend on
+// scheduling.
+void runJobs(ProcessContext& _ctx, uint32_t _numJobs, JobFn _fn)
+{
+	JobBatch batch;
+	batch.m_fn      = _fn;
+	batch.m_ctx     = &_ctx;
+	batch.m_numJobs = int32_t(_numJobs);
+	batch.m_next    = 0;
+
+	const uint32_t numThreads = bx::uint32_clamp(s_numThreads, 1, bx::uint32_max(1, _numJobs) );
+
+	bx::Thread* threads = new bx::Thread[numThreads-1];
+	for (uint32_t ii = 0; ii < numThreads-1; ++ii)
+	{
+		threads[ii].init(jobThreadFunc, &batch, 0, "geometryc");
+	}
 
-	float* tangents = new float[6*_numVertices];
-	bx::memSet(tangents, 0, 6*_numVertices*sizeof(float) );
+	jobThreadFunc(NULL, &batch);
 
-	PosTexcoord v0;
-	PosTexcoord v1;
-	PosTexcoord v2;
+	for (uint32_t ii = 0; ii < numThreads-1; ++ii)
+	{
+		threads[ii].shutdown();
+	}
 
-	for (uint32_t ii = 0, num = _numIndices/3; ii < num; ++ii)
+	delete [] threads;
+}
+
+void addSplitUnit(
+	  WriteUnitArray& _units
+	, const WriteUnit& _group
+	, uint32_t _stride
+	, stl::vector<uint32_t>& _remap
+	, stl::vector<uint32_t>& _source
+	, stl::vector<uint32_t>& _indices
+	, PrimitiveArray& _primitives
+	)
+{
+	if (!_indices.empty() )
 	{
-		const uint16_t* indices = &_indices[ii*3];
-		uint32_t i0 = indices[0];
-		uint32_t i1 = indices[1];
-		uint32_t i2 = indices[2];
+		WriteUnit* unit = new WriteUnit;
+		unit->m_numVertices = uint32_t(_source.size() );
+		unit->m_vertices    = (uint8_t*)malloc(unit->m_numVertices*_stride);
+		unit->m_numIndices  = uint32_t(_indices.size() );
+		unit->m_indices     = (uint32_t*)malloc(unit->m_numIndices*sizeof(uint32_t) );
+		unit->m_material    = _group.m_material;
+		unit->m_primitives  = _primitives;
+
+		for (uint32_t ii = 0; ii < unit->m_numVertices; ++ii)
+		{
+			bx::memCopy(&unit->m_vertices[ii*_stride], &_group.m_vertices[_source[ii]*_stride], _stride);
+			_remap[_source[ii] ] = UINT32_MAX;
+		}
 
-		bgfx::vertexUnpack(&v0.m_x, bgfx::Attrib::Position, _layout, _vertices, i0);
-		bgfx::vertexUnpack(&v0.m_u, bgfx::Attrib::TexCoord0, _layout, _vertices, i0);
+		bx::memCopy(unit->m_indices, _indices.data(), unit->m_numIndices*sizeof(uint32_t) );
 
-		bgfx::vertexUnpack(&v1.m_x, bgfx::Attrib::Position, _layout, _vertices, i1);
-		bgfx::vertexUnpack(&v1.m_u, bgfx::Attrib::TexCoord0, _layout, _vertices, i1);
+		_units.push_back(unit);
+	}
 
-		bgfx::vertexUnpack(&v2.m_x, bgfx::Attrib::Position, _layout, _vertices, i2);
-		bgfx::vertexUnpack(&v2.m_u, bgfx::Attrib::TexCoord0, _layout, _vertices, i2);
+	_source.clear();
+	_indices.clear();
+	_primitives.clear();
+}
 
-		const float bax = v1.m_x - v0.m_x;
-		const float bay = v1.m_y - v0.m_y;
-		const float baz = v1.m_z - v0.m_z;
-		const float bau = v1.m_u - v0.m_u;
-		const float bav = v1.m_v - v0.m_v;
+// Splits group that doesn't fit 16-bit indices. Triangles of each primitive are sorted
+// spatially first, so that each split covers compact region of mesh and shares as many
+// vertices as possible, then splits are cut greedily in that order.
+void splitGroup(WriteUnitArray& _units, const WriteUnit& _group, const bgfx::VertexLayout& _layout)
+{
+	const uint32_t stride = _layout.getStride();
+	const uint32_t maxVertices = UINT16_MAX;
 
-		const float cax = v2.m_x - v0.m_x;
-		const float cay = v2.m_y - v0.m_y;
-		const float caz = v2.m_z - v0.m_z;
-		const float cau = v2.m_u - v0.m_u;
-		const float cav = v2.m_v - v0.m_v;
+	stl::vector<uint32_t> remap;
+	remap.resize(_group.m_numVertices);
+	bx::memSet(remap.data(), 0xff, _group.m_numVertices*sizeof(uint32_t) );
 
-		const float det = (bau * cav - bav * cau);
-		const float invDet = 1.0f / det;
+	stl::vector<uint32_t> sorted;
+	stl::vector<uint32_t> splitSource;
+	stl::vector<uint32_t> splitIndices;
+	PrimitiveArray splitPrimitives;
 
-		const float tx = (bax * cav - cax * bav) * invDet;
-		const float ty = (bay * cav - cay * bav) * invDet;
-		const float tz = (baz * cav - caz * bav) * invDet;
+	for (PrimitiveArray::const_iterator primIt = _group.m_primitives.begin(); primIt != _group.m_primitives.end(); ++primIt)
+	{
+		const Primitive& src = *primIt;
+
+		sorted.resize(src.m_numIndices);
+		meshopt_spatialSortTriangles(
+			  sorted.data()
+			, &_group.m_indices[src.m_startIndex]
+			, src.m_numIndices
+			, (const float*)_group.m_vertices
+			, _group.m_numVertices
+			, stride
+			);
 
-		const float bx = (cax * bau - bax * cau) * invDet;
-		const float by = (cay * bau - bay * cau) * invDet;
-		const float bz = (caz * bau - baz * cau) * invDet;
+		Primitive prim;
+		prim.m_name        = src.m_name;
+		prim.m_startVertex = uint32_t(splitSource.size() );
+		prim.m_startIndex  = uint32_t(splitIndices.size() );
 
-		for (uint32_t jj = 0; jj < 3; ++jj)
+		for (uint32_t ii = 0; ii < src.m_numIndices; ii += 3)
 		{
-			float* tanu = &tangents[indices[jj]*6];
-			float* tanv = &tanu[3];
-			tanu[0] += tx;
-			tanu[1] += ty;
-			tanu[2] += tz;
+			const uint32_t* tri = &sorted[ii];
 
-			tanv[0] += bx;
-			tanv[1] += by;
-			tanv[2] += bz;
-		}
-	}
+			const uint32_t numNew = 0
+				+ (UINT32_MAX == remap[tri[0] ])
+				+ (UINT32_MAX == remap[tri[1] ])
+				+ (UINT32_MAX == remap[tri[2] ])
+				;
 
-	for (uint32_t ii = 0; ii < _numVertices; ++ii)
-	{
-		const bx::Vec3 tanu = bx::load<bx::Vec3>(&tangents[ii*6]);
-		const bx::Vec3 tanv = bx::load<bx::Vec3>(&tangents[ii*6 + 3]);
+			if (uint32_t(splitSource.size() ) + numNew > maxVertices)
+			{
+				prim.m_numVertices = uint32_t(splitSource.size() ) - prim.m_startVertex;
+				prim.m_numIndices  = uint32_t(splitIndices.size() ) - prim.m_startIndex;
+				if (0 < prim.m_numIndices)
+				{
+					splitPrimitives.push_back(prim);
+				}
 
-		float nxyzw[4];
-		bgfx::vertexUnpack(nxyzw, bgfx::Attrib::Normal, _layout, _vertices, ii);
+				addSplitUnit(_units, _group, stride, remap, splitSource, splitIndices, splitPrimitives);
 
-		const bx::Vec3 normal  = bx::load<bx::Vec3>(nxyzw);
-		const float    ndt     = bx::dot(normal, tanu);
-		const bx::Vec3 nxt     = bx::cross(normal, tanu);
-		const bx::Vec3 tmp     = bx::sub(tanu, bx::mul(normal, ndt) );
+				prim.m_startVertex = 0;
+				prim.m_startIndex  = 0;
+			}
 
-		float tangent[4];
-		bx::store(tangent, bx::normalize(tmp) );
-		tangent[3] = bx::dot(nxt, tanv) < 0.0f ? -1.0f : 1.0f;
+			for (uint32_t edge = 0; edge < 3; ++edge)
+			{
+				uint32_t& index = remap[tri[edge] ];
+				if (UINT32_MAX == index)
+				{
+					index = uint32_t(splitSource.size() );
+					splitSource.push_back(tri[edge]);
+				}
 
-		bgfx::vertexPack(tangent, true, bgfx::Attrib::Tangent, _layout, _vertices, ii);
+				splitIndices.push_back(index);
+			}
+		}
+
+		prim.m_numVertices = uint32_t(splitSource.size() ) - prim.m_startVertex;
+		prim.m_numIndices  = uint32_t(splitIndices.size() ) - prim.m_startIndex;
+		if (0 < prim.m_numIndices)
+		{
+			splitPrimitives.push_back(prim);
+		}
 	}
 
-	delete [] tangents;
+	addSplitUnit(_units, _group, stride, remap, splitSource, splitIndices, splitPrimitives);
 }
 
-void write(bx::WriterI* _writer, const void* _vertices, uint32_t _numVertices, uint32_t _stride)
+void processGroup(ProcessContext& _ctx, uint32_t _idx)
 {
-	Sphere maxSphere;
-	calcMaxBoundingSphere(maxSphere, _vertices, _numVertices, _stride);
+	GroupJob& job = _ctx.m_groups[_idx];
+	WriteUnit* group = job.m_group;
 
-	Sphere minSphere;
-	calcMinBoundingSphere(minSphere, _vertices, _numVertices, _stride);
+	if (_ctx.m_tangent)
+	{
+		StageTimer timer(Stage::Tangents);
+		calcTangents(group->m_vertices, group->m_numVertices, *_ctx.m_layout, group->m_indices, group->m_numIndices);
+	}
 
-	if (minSphere.radius > maxSphere.radius)
+	// Tangents are calculated before splitting, so there are no seams at split borders.
+	if (!s_index32
+	&&  group->m_numVertices > UINT16_MAX)
 	{
-		bx::write(_writer, maxSphere);
+		StageTimer timer(Stage::Split);
+		splitGroup(job.m_units, *group, *_ctx.m_layout);
+		delete group;
 	}
 	else
 	{
-		bx::write(_writer, minSphere);
+		job.m_units.push_back(group);
 	}
 
-	Aabb aabb;
-	toAabb(aabb, _vertices, _numVertices, _stride);
-	bx::write(_writer, aabb);
-
-	Obb obb;
-	calcObb(obb, _vertices, _numVertices, _stride, s_obbSteps);
-	bx::write(_writer, obb);
+	job.m_group = NULL;
 }
 
-void write(bx::WriterI* _writer
-		, const uint8_t* _vertices
-		, uint32_t _numVertices
-		, const bgfx::VertexLayout& _layout
-		, const uint16_t* _indices
-		, uint32_t _numIndices
-		, bool _compress
-		, const stl::string& _material
-		, const PrimitiveArray& _primitives
-		)
+void processUnit(ProcessContext& _ctx, uint32_t _idx)
 {
-	using namespace bx;
-	using namespace bgfx;
-
-	uint32_t stride = _layout.getStride();
+	WriteUnit& unit = *_ctx.m_units[_idx];
+	const bgfx::VertexLayout& layout = *_ctx.m_layout;
 
-	if (_compress)
 	{
-		write(_writer, BGFX_CHUNK_MAGIC_VBC);
-		write(_writer, _vertices, _numVertices, stride);
+		StageTimer timer(Stage::Optimize);
 
-		write(_writer, _layout);
+		for (PrimitiveArray::const_iterator primIt = unit.m_primitives.begin(); primIt != unit.m_primitives.end(); ++primIt)
+		{
+			const Primitive& prim = *primIt;
+			optimizeVertexCache(unit.m_indices + prim.m_startIndex, prim.m_numIndices, unit.m_numVertices);
+		}
 
-		write(_writer, uint16_t(_numVertices) );
-		writeCompressedVertices(_writer, _vertices, _numVertices, uint16_t(stride));
+		unit.m_numVertices = optimizeVertexFetch(unit.m_indices, unit.m_numIndices, unit.m_vertices, unit.m_numVertices, layout.getStride() );
 	}
-	else
-	{
-		write(_writer, BGFX_CHUNK_MAGIC_VB);
-		write(_writer, _vertices, _numVertices, stride);
 
-		write(_writer, _layout);
+	if (unit.m_numVertices > 0 && unit.m_numIndices > 0)
+	{
+		bx::MemoryWriter writer(&unit.m_output);
+
+		write(&writer
+			, unit.m_log
+			, unit.m_vertices
+			, unit.m_numVertices
+			, layout
+			, unit.m_indices
+			, unit.m_numIndices
+			, _ctx.m_compress
+			, unit.m_material
+			, unit.m_primitives
+			);
 
-		write(_writer, uint16_t(_numVertices) );
-		write(_writer, _vertices, _numVertices*stride);
+		unit.m_outputSize = uint32_t(bx::seek(&writer) );
 	}
+}
 
-	if (_compress)
-	{
-		write(_writer, BGFX_CHUNK_MAGIC_IBC);
-		write(_writer, _numIndices);
-		writeCompressedIndices(_writer, _indices, _numIndices, _numVertices);
-	}
-	else
+// Processes groups on thread pool. Output is kept per unit until writeUnits.
+void processUnits(ProcessContext& _ctx)
+{
+	runJobs(_ctx, uint32_t(_ctx.m_groups.size() ), processGroup);
+
+	for (GroupJobArray::const_iterator it = _ctx.m_groups.begin(); it != _ctx.m_groups.end(); ++it)
 	{
-		write(_writer, BGFX_CHUNK_MAGIC_IB);
-		write(_writer, _numIndices);
-		write(_writer, _indices, _numIndices*2);
+		for (WriteUnitArray::const_iterator unitIt = it->m_units.begin(); unitIt != it->m_units.end(); ++unitIt)
+		{
+			_ctx.m_units.push_back(*unitIt);
+		}
 	}
 
-	write(_writer, BGFX_CHUNK_MAGIC_PRI);
-	uint16_t nameLen = uint16_t(_material.size() );
-	write(_writer, nameLen);
-	write(_writer, _material.c_str(), nameLen);
-	write(_writer, uint16_t(_primitives.size() ) );
-	for (PrimitiveArray::const_iterator primIt = _primitives.begin(); primIt != _primitives.end(); ++primIt)
+	runJobs(_ctx, uint32_t(_ctx.m_units.size() ), processUnit);
+}
+
+// Writes processed units and their log messages in the same order as they were produced.
+void writeUnits(bx::WriterI* _writer, ProcessContext& _ctx, uint32_t& _numGroups, uint32_t& _numVertices, uint32_t& _numIndices)
+{
+	for (WriteUnitArray::const_iterator it = _ctx.m_units.begin(); it != _ctx.m_units.end(); ++it)
 	{
-		const Primitive& prim = *primIt;
-		nameLen = uint16_t(prim.m_name.size() );
-		write(_writer, nameLen);
-		write(_writer, prim.m_name.c_str(), nameLen);
-		write(_writer, prim.m_startIndex);
-		write(_writer, prim.m_numIndices);
-		write(_writer, prim.m_startVertex);
-		write(_writer, prim.m_numVertices);
-		write(_writer, &_vertices[prim.m_startVertex*stride], prim.m_numVertices, stride);
+		WriteUnit* unit = *it;
+
+		if (!unit->m_log.empty() )
+		{
+			bx::printf("%s", unit->m_log.c_str() );
+		}
+
+		bx::write(_writer, unit->m_output.more(0), unit->m_outputSize);
+
+		++_numGroups;
+		_numVertices += unit->m_numVertices;
+		_numIndices  += unit->m_numIndices;
+
+		delete unit;
 	}
+
+	_ctx.m_groups.clear();
+	_ctx.m_units.clear();
 }
 
 inline uint32_t rgbaToAbgr(uint8_t _r, uint8_t _g, uint8_t _b, uint8_t _a)
@@ -889,6 +2042,33 @@ void parseGltf(char* _data, uint32_t _size, Mesh* _mesh, bool _hasBc, const bx::
 }
 
 
+bool parseFloatList(stl::vector<float>& _out, const char* _str)
+{
+	bx::StringView str(_str);
+
+	while (!str.isEmpty() )
+	{
+		const bx::StringView comma = bx::strFind(str, ',');
+
+		float value;
+		if (!bx::fromString(&value, bx::StringView(str.getPtr(), comma.getPtr() ) ) )
+		{
+			return false;
+		}
+
+		_out.push_back(value);
+
+		if (comma.isEmpty() )
+		{
+			break;
+		}
+
+		str.set(comma.getPtr()+1, str.getTerm() );
+	}
+
+	return !_out.empty();
+}
+
 void help(const char* _error = NULL)
 {
 	if (NULL != _error)
@@ -934,6 +2114,22 @@ void help(const char* _error = NULL)
 		  "      --tangent            Calculate tangent vectors (packing mode is the same as normal).\n"
 		  "      --barycentric        Adds barycentric vertex attribute (packed in bgfx::Attrib::Color1).\n"
 		  "  -c, --compress           Compress indices.\n"
+		  "  -j, --jobs <num>         Number of threads processing groups (default number of CPU cores).\n"
+		  "      --meshlets           Split primitives into meshlets with bounding sphere and normal cone for\n"
+		  "           cluster culling. Triangles of each meshlet form contiguous index range.\n"
+		  "      --index32            Allow 32-bit indices for groups exceeding 65535 vertices. By default such\n"
+		  "           groups are split in spatially coherent order to fit 16-bit indices.\n"
+		  "      --quantize <error>   Pick smallest vertex attribute types within error bounds. Positions are\n"
+		  "           normalized to group AABB within <error> units, with dequantization transform\n"
+		  "           stored in mesh. Normals and tangents are octahedral encoded into xy (tangent\n"
+		  "           handedness in z), and must be decoded in shader with decodeNormalOctahedron\n"
+		  "           and decodeTangentOctahedron from shaderlib.sh. Overrides packing options.\n"
+		  "      --quantnormal <error> Normal and tangent error bound (default 0.005).\n"
+		  "      --quantuv <error>    Texture coordinate error bound (default 1/4096).\n"
+		  "      --lod <ratios>       Generate LOD levels with comma separated index count ratios relative to\n"
+		  "           base level (for example 0.5,0.25,0.125). Each level references vertex prefix.\n"
+		  "      --loderror <errors>  Comma separated simplification error thresholds per LOD level, relative\n"
+		  "           to mesh extents. Last value is used for remaining levels. Default value is 0.01.\n"
 		  "      --[l/r]h-up+[y/z]	  Coordinate system. Default is '--lh-up+y' Left-Handed +Y is up.\n"
 
 		  "\n"
@@ -987,6 +2183,67 @@ int main(int _argc, const char* _argv[])
 	}
 
 	bool compress = cmdLine.hasArg('c', "compress");
+	s_meshlets = cmdLine.hasArg("meshlets");
+	s_index32  = cmdLine.hasArg("index32");
+
+	s_numThreads = std::thread::hardware_concurrency();
+	cmdLine.hasArg(s_numThreads, 'j', "jobs");
+	s_numThreads = bx::uint32_max(1, s_numThreads);
+
+	const char* quantizeArg = cmdLine.findOption("quantize");
+	if (NULL != quantizeArg)
+	{
+		if (!bx::fromString(&s_quantizePosition, quantizeArg) )
+		{
+			help("Invalid quantization position error.");
+			return bx::kExitFailure;
+		}
+
+		s_quantize = true;
+
+		const char* quantizeNormalArg = cmdLine.findOption("quantnormal");
+		if (NULL != quantizeNormalArg)
+		{
+			bx::fromString(&s_quantizeNormal, quantizeNormalArg);
+		}
+
+		const char* quantizeTexcoordArg = cmdLine.findOption("quantuv");
+		if (NULL != quantizeTexcoordArg)
+		{
+			bx::fromString(&s_quantizeTexcoord, quantizeTexcoordArg);
+		}
+	}
+
+	const char* lodArg = cmdLine.findOption("lod");
+	if (NULL != lodArg)
+	{
+		if (!parseFloatList(s_lodRatios, lodArg)
+		||  s_lodRatios.size() > UINT8_MAX-1)
+		{
+			help("Invalid LOD ratios.");
+			return bx::kExitFailure;
+		}
+
+		for (uint32_t ii = 0, num = uint32_t(s_lodRatios.size() ); ii < num; ++ii)
+		{
+			s_lodRatios[ii] = bx::clamp(s_lodRatios[ii], 0.0f, 1.0f);
+		}
+
+		const char* lodErrorArg = cmdLine.findOption("loderror");
+		if (NULL != lodErrorArg)
+		{
+			if (!parseFloatList(s_lodErrors, lodErrorArg) )
+			{
+				help("Invalid LOD error thresholds.");
+				return bx::kExitFailure;
+			}
+		}
+
+		if (s_lodErrors.empty() )
+		{
+			s_lodErrors.push_back(0.01f);
+		}
+	}
 
 	cmdLine.hasArg(s_obbSteps, '\0', "obb");
 	s_obbSteps = bx::uint32_min(bx::uint32_max(s_obbSteps, 1), 90);
@@ -1002,6 +2259,13 @@ int main(int _argc, const char* _argv[])
 	bool hasTangent = cmdLine.hasArg("tangent");
 	bool hasBc = cmdLine.hasArg("barycentric");
 
+	if (s_quantize)
+	{
+		// Vertices are processed unpacked, and quantized when written.
+		packNormal = 0;
+		packUv     = 0;
+	}
+
 	CoordinateSystem outputCoordinateSystem;
 	outputCoordinateSystem.m_handness = bx::Handness::Left;
 	outputCoordinateSystem.m_forward = Axis::PositiveZ;
@@ -1022,7 +2286,6 @@ int main(int _argc, const char* _argv[])
 	}
 
 	int64_t parseElapsed = -bx::getHPCounter();
-	int64_t triReorderElapsed = 0;
 
 	uint32_t size = (uint32_t)bx::getSize(&fr);
 	char* data = new char[size+1];
@@ -1131,6 +2394,11 @@ int main(int _argc, const char* _argv[])
 		}
 	}
 
+	if (s_quantize)
+	{
+		calcQuantizeSetup(s_quantizeSetup, mesh);
+	}
+
 	bgfx::VertexLayout layout;
 	layout.begin();
 	layout.add(bgfx::Attrib::Position, 3, bgfx::AttribType::Float);
@@ -1189,18 +2457,39 @@ int main(int _argc, const char* _argv[])
 
 	uint32_t stride = layout.getStride();
 	uint8_t* vertexData = new uint8_t[mesh.m_triangles.size() * 3 * stride];
-	uint16_t* indexData = new uint16_t[mesh.m_triangles.size() * 3];
-	int32_t numVertices = 0;
-	int32_t numIndices = 0;
+	uint32_t* indexData = new uint32_t[mesh.m_triangles.size() * 3];
+	uint32_t numVertices = 0;
+	uint32_t numIndices = 0;
 
-	int32_t writtenPrimitives = 0;
-	int32_t writtenVertices = 0;
-	int32_t writtenIndices = 0;
+	ProcessContext ctx;
+	ctx.m_layout   = &layout;
+	ctx.m_tangent  = hasTangent;
+	ctx.m_compress = compress;
 
 	uint8_t* vertices = vertexData;
-	uint16_t* indices = indexData;
+	uint32_t* indices = indexData;
+
+	// Groups are not limited to 16-bit index range anymore, size hash table for the largest
+	// run of triangles sharing material.
+	uint32_t maxTriangles = 0;
+	{
+		uint32_t numTriangles = 0;
+		const char* runMaterial = NULL;
+		for (GroupArray::const_iterator groupIt = mesh.m_groups.begin(); groupIt != mesh.m_groups.end(); ++groupIt)
+		{
+			if (NULL == runMaterial
+			||  0 != bx::strCmp(runMaterial, groupIt->m_material.c_str() ) )
+			{
+				numTriangles = 0;
+				runMaterial  = groupIt->m_material.c_str();
+			}
+
+			numTriangles += groupIt->m_numTriangles;
+			maxTriangles  = bx::uint32_max(maxTriangles, numTriangles);
+		}
+	}
 
-	const uint32_t tableSize = 65536 * 2;
+	const uint32_t tableSize = bx::uint32_max(65536 * 2, bx::uint32_nextpow2(maxTriangles * 3 * 2) );
 	const uint32_t hashmod = tableSize - 1;
 	uint32_t* table = new uint32_t[tableSize];
 	bx::memSet(table, 0xff, tableSize * sizeof(uint32_t));
@@ -1235,8 +2524,7 @@ int main(int _argc, const char* _argv[])
 		for (uint32_t tri = groupIt->m_startTriangle, end = tri + groupIt->m_numTriangles; tri < end; ++tri)
 		{
 			if (0 != bx::strCmp(material.c_str(), groupIt->m_material.c_str() )
-			|| sentinel
-			||  65533 <= numVertices)
+			|| sentinel)
 			{
 				prim.m_numVertices = numVertices - prim.m_startVertex;
 				prim.m_numIndices  = numIndices  - prim.m_startIndex;
@@ -1245,42 +2533,26 @@ int main(int _argc, const char* _argv[])
 					primitives.push_back(prim);
 				}
 
-				if (hasTangent)
-				{
-					calcTangents(vertexData, uint16_t(numVertices), layout, indexData, numIndices);
-				}
-
-				triReorderElapsed -= bx::getHPCounter();
-				for (PrimitiveArray::const_iterator primIt = primitives.begin(); primIt != primitives.end(); ++primIt)
+				if (numVertices > 0 && numIndices > 0)
 				{
-					const Primitive& prim1 = *primIt;
-					optimizeVertexCache(indexData + prim1.m_startIndex, prim1.m_numIndices, numVertices);
-				}
-				numVertices = optimizeVertexFetch(indexData, numIndices, vertexData, numVertices, uint16_t(stride));
-
-				triReorderElapsed += bx::getHPCounter();
-
-				if ( numVertices > 0 && numIndices > 0 )
-				{
-					write(&writer
-						  , vertexData
-						  , numVertices
-						  , layout
-						  , indexData
-						  , numIndices
-						  , compress
-						  , material
-						  , primitives
-						  );
+					WriteUnit* group = new WriteUnit;
+					group->m_numVertices = numVertices;
+					group->m_vertices    = (uint8_t*)malloc(numVertices*stride);
+					group->m_numIndices  = numIndices;
+					group->m_indices     = (uint32_t*)malloc(numIndices*sizeof(uint32_t) );
+					group->m_material    = material;
+					group->m_primitives  = primitives;
+					bx::memCopy(group->m_vertices, vertexData, numVertices*stride);
+					bx::memCopy(group->m_indices, indexData, numIndices*sizeof(uint32_t) );
+
+					GroupJob job;
+					job.m_group = group;
+					ctx.m_groups.push_back(job);
 				}
 				primitives.clear();
 
 				bx::memSet(table, 0xff, tableSize * sizeof(uint32_t));
 
-				++writtenPrimitives;
-				writtenVertices += numVertices;
-				writtenIndices += numIndices;
-
 				vertices = vertexData;
 				indices  = indexData;
 				numVertices = 0;
@@ -1372,7 +2644,7 @@ int main(int _argc, const char* _argv[])
 					exit(bx::kExitFailure);
 				}
 
-				*indices++ = (uint16_t)vertexIndex;
+				*indices++ = vertexIndex;
 				++numIndices;
 			}
 		}
@@ -1397,22 +2669,52 @@ int main(int _argc, const char* _argv[])
 
 	BX_CHECK(0 == primitives.size(), "Not all primitives are written");
 
-	bx::printf("size: %d\n", uint32_t(bx::seek(&writer) ) );
-	bx::close(&writer);
-
 	delete [] table;
 	delete [] indexData;
 	delete [] vertexData;
 
+	const uint32_t numGroups = uint32_t(ctx.m_groups.size() );
+
+	uint32_t writtenGroups   = 0;
+	uint32_t writtenVertices = 0;
+	uint32_t writtenIndices  = 0;
+
 	now = bx::getHPCounter();
 	convertElapsed += now;
+	int64_t processElapsed = -now;
+
+	processUnits(ctx);
+
+	now = bx::getHPCounter();
+	processElapsed += now;
+	int64_t writeElapsed = -now;
+
+	writeUnits(&writer, ctx, writtenGroups, writtenVertices, writtenIndices);
+
+	bx::printf("size: %d\n", uint32_t(bx::seek(&writer) ) );
+	bx::close(&writer);
+
+	writeElapsed += bx::getHPCounter();
+
+	const double freq = double(bx::getHPFrequency() );
+
+	bx::printf("parse %f [s]\nconvert %f [s]\nprocess %f [s] (%d threads, %d groups)\nwrite %f [s]\n"
+		, double(parseElapsed)/freq
+		, double(convertElapsed)/freq
+		, double(processElapsed)/freq
+		, s_numThreads
+		, numGroups
+		, double(writeElapsed)/freq
+		);
+
+	for (uint32_t stage = 0; stage < Stage::Count; ++stage)
+	{
+		bx::printf("  %-10s %f [s]\n", s_stageName[stage], double(s_stageElapsed[stage])/freq);
+	}
 
-	bx::printf("parse %f [s]\ntri reorder %f [s]\nconvert %f [s]\ng %d, p %d, v %d, i %d\n"
-		, double(parseElapsed)/bx::getHPFrequency()
-		, double(triReorderElapsed)/bx::getHPFrequency()
-		, double(convertElapsed)/bx::getHPFrequency()
+	bx::printf("g %d, p %d, v %d, i %d\n"
 		, uint32_t(mesh.m_groups.size()-1)
-		, writtenPrimitives
+		, writtenGroups
 		, writtenVertices
 		, writtenIndices
 		);
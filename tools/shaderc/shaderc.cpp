@@ -5,7 +5,17 @@
 
 #include "shaderc.h"
 #include <bx/commandline.h>
+#include <bx/cpu.h>
 #include <bx/filepath.h>
+#include <bx/mutex.h>
+#include <bx/os.h>
+#include <bx/thread.h>
+#include <thread>
+
+BX_PRAGMA_DIAGNOSTIC_PUSH()
+BX_PRAGMA_DIAGNOSTIC_IGNORED_CLANG_GCC("-Wshadow")
+#include <ShaderLang.h>
+BX_PRAGMA_DIAGNOSTIC_POP()
 
 #define MAX_TAGS 256
 extern "C"
@@ -18,6 +28,10 @@ extern "C"
 #define BGFX_CHUNK_MAGIC_FSH BX_MAKEFOURCC('F', 'S', 'H', BGFX_SHADER_BIN_VERSION)
 #define BGFX_CHUNK_MAGIC_VSH BX_MAKEFOURCC('V', 'S', 'H', BGFX_SHADER_BIN_VERSION)
 
+#define BGFX_SHADER_PACK_MAGIC BX_MAKEFOURCC('S', 'P', 'K', 1)
+#define BGFX_SHADER_PACK_ALIGN 16
+#define BGFX_SHADER_PACK_MAX_PERMUTATIONS (64<<10)
+
 #define BGFX_SHADERC_VERSION_MAJOR 1
 #define BGFX_SHADERC_VERSION_MINOR 16
 
@@ -198,6 +212,7 @@ namespace bgfx
 		, backwardsCompatibility(false)
 		, warningsAreErrors(false)
 		, keepIntermediate(false)
+		, stats(false)
 		, optimize(false)
 		, optimizationLevel(3)
 	{
@@ -211,6 +226,7 @@ namespace bgfx
 			"\t  profile: %s\n"
 			"\t  inputFile: %s\n"
 			"\t  outputFile: %s\n"
+			"\t  cacheDir: %s\n"
 			"\t  disasm: %s\n"
 			"\t  raw: %s\n"
 			"\t  preprocessOnly: %s\n"
@@ -223,6 +239,7 @@ namespace bgfx
 			"\t  backwardsCompatibility: %s\n"
 			"\t  warningsAreErrors: %s\n"
 			"\t  keepIntermediate: %s\n"
+			"\t  stats: %s\n"
 			"\t  optimize: %s\n"
 			"\t  optimizationLevel: %d\n"
 
@@ -231,6 +248,7 @@ namespace bgfx
 			, profile.c_str()
 			, inputFilePath.c_str()
 			, outputFilePath.c_str()
+			, cacheDir.c_str()
 			, disasm ? "true" : "false"
 			, raw ? "true" : "false"
 			, preprocessOnly ? "true" : "false"
@@ -243,6 +261,7 @@ namespace bgfx
 			, backwardsCompatibility ? "true" : "false"
 			, warningsAreErrors ? "true" : "false"
 			, keepIntermediate ? "true" : "false"
+			, stats ? "true" : "false"
 			, optimize ? "true" : "false"
 			, optimizationLevel
 			);
@@ -489,6 +508,255 @@ namespace bgfx
 		uint32_t m_size;
 	};
 
+	// Shared between batch jobs, caches contents of varying definitions and include files, as
+	// well as failed lookups of include files in include directories.
+	class FileCache
+	{
+	public:
+		const std::string* find(const char* _filePath)
+		{
+			{
+				bx::MutexScope lock(m_mutex);
+				FileMap::const_iterator it = m_files.find(_filePath);
+				if (it != m_files.end() )
+				{
+					return it->second.m_exists ? &it->second.m_data : NULL;
+				}
+			}
+
+			Entry entry;
+			entry.m_exists = false;
+
+			bx::FileReader reader;
+			if (bx::open(&reader, _filePath) )
+			{
+				const uint32_t size = (uint32_t)bx::getSize(&reader);
+				entry.m_data.resize(size);
+				entry.m_data.resize(bx::max<int32_t>(0, bx::read(&reader, &entry.m_data[0], size) ) );
+				entry.m_exists = true;
+				bx::close(&reader);
+
+				if (0 == entry.m_data.compare(0, 3, "\xef\xbb\xbf") )
+				{
+					entry.m_data.erase(0, 3);
+				}
+			}
+
+			bx::MutexScope lock(m_mutex);
+			FileMap::const_iterator it = m_files.insert(std::make_pair(std::string(_filePath), entry) ).first;
+			return it->second.m_exists ? &it->second.m_data : NULL;
+		}
+
+		FILE* open(const char* _filePath, const char* _mode)
+		{
+			const std::string* data = find(_filePath);
+			if (NULL == data)
+			{
+				return NULL;
+			}
+
+#if BX_PLATFORM_LINUX || BX_PLATFORM_OSX
+			if (!data->empty() )
+			{
+				return fmemopen(const_cast<char*>(data->c_str() ), data->size(), _mode);
+			}
+#endif // BX_PLATFORM_LINUX || BX_PLATFORM_OSX
+
+			return fopen(_filePath, _mode);
+		}
+
+	private:
+		struct Entry
+		{
+			std::string m_data;
+			bool m_exists;
+		};
+
+		typedef std::unordered_map<std::string, Entry> FileMap;
+		FileMap m_files;
+		bx::Mutex m_mutex;
+	};
+
+	static FileCache* s_fileCache = NULL;
+
+	typedef bool (*CompileFn)(const Options& _options, uint32_t _version, const std::string& _code, bx::WriterI* _writer);
+
+	class StringWriter : public bx::WriterI
+	{
+	public:
+		StringWriter(std::string& _str)
+			: m_str(_str)
+		{
+		}
+
+		virtual int32_t write(const void* _data, int32_t _size, bx::Error* _err) override
+		{
+			BX_UNUSED(_err);
+			m_str.append( (const char*)_data, _size);
+			return _size;
+		}
+
+	private:
+		std::string& m_str;
+	};
+
+	// 64-bit key made of two independent 32-bit hashes, collisions would silently produce wrong
+	// shader binaries.
+	struct CacheHash
+	{
+		void begin()
+		{
+			m_murmur.begin();
+			m_crc.begin();
+		}
+
+		void add(const void* _data, int32_t _len)
+		{
+			m_murmur.add(_data, _len);
+			m_crc.add(_data, _len);
+		}
+
+		void add(const bx::StringView& _str)
+		{
+			const int32_t len = _str.getLength();
+			add(&len, sizeof(len) );
+			add(_str.getPtr(), len);
+		}
+
+		void add(uint32_t _value)
+		{
+			add(&_value, sizeof(_value) );
+		}
+
+		bx::HashMurmur2A m_murmur;
+		bx::HashCrc32    m_crc;
+	};
+
+	static int32_t s_cacheHits   = 0;
+	static int32_t s_cacheMisses = 0;
+
+	static void cacheFilePath(bx::FilePath& _filePath, const Options& _options, uint32_t _version, const std::string& _code, const char* _comment, const char* _varying)
+	{
+		CacheHash hash;
+		hash.begin();
+
+		hash.add(BGFX_SHADERC_VERSION_MAJOR);
+		hash.add(BGFX_SHADERC_VERSION_MINOR);
+		hash.add(BGFX_API_VERSION);
+		hash.add(BGFX_SHADER_BIN_VERSION);
+		hash.add(__DATE__ " " __TIME__);
+
+		hash.add(uint32_t(_options.shaderType) );
+		hash.add(_options.platform.c_str() );
+		hash.add(_options.profile.c_str() );
+		hash.add(_version);
+		hash.add(0
+			| (_options.avoidFlowControl       ? 0x01 : 0)
+			| (_options.noPreshader            ? 0x02 : 0)
+			| (_options.partialPrecision       ? 0x04 : 0)
+			| (_options.preferFlowControl      ? 0x08 : 0)
+			| (_options.backwardsCompatibility ? 0x10 : 0)
+			| (_options.warningsAreErrors      ? 0x20 : 0)
+			| (_options.optimize               ? 0x40 : 0)
+			);
+		hash.add(_options.optimizationLevel);
+		hash.add(NULL != _varying ? _varying : "");
+
+		// Command line comment contains output file path, leave it out so that identical shaders
+		// compiled to different outputs share entry.
+		const size_t pos = _code.find(_comment);
+		if (std::string::npos == pos)
+		{
+			hash.add(bx::StringView(_code.c_str(), int32_t(_code.size() ) ) );
+		}
+		else
+		{
+			const size_t len = bx::strLen(_comment);
+			hash.add(bx::StringView(_code.c_str(), int32_t(pos) ) );
+			hash.add(bx::StringView(_code.c_str() + pos + len, int32_t(_code.size() - pos - len) ) );
+		}
+
+		char fileName[32];
+		bx::snprintf(fileName, BX_COUNTOF(fileName), "%08x%08x.bin", hash.m_murmur.end(), hash.m_crc.end() );
+
+		_filePath.set(_options.cacheDir.c_str() );
+		_filePath.join(fileName);
+	}
+
+	// Compiles shader with backend compiler, or when cache directory is specified reuses output
+	// of previous compile with the same input.
+	static bool compileCached(CompileFn _fn, const Options& _options, uint32_t _version, const std::string& _code, const char* _comment, const char* _varying, bx::WriterI* _writer)
+	{
+		// Disassembly, intermediate and debug files, and stats are side effects of compiling which
+		// cache can't reproduce.
+		if (_options.cacheDir.empty()
+		||  _options.disasm
+		||  _options.debugInformation
+		||  _options.keepIntermediate
+		||  _options.stats)
+		{
+			return _fn(_options, _version, _code, _writer);
+		}
+
+		bx::FilePath filePath;
+		cacheFilePath(filePath, _options, _version, _code, _comment, _varying);
+
+		std::string output;
+
+		bx::FileReader reader;
+		if (bx::open(&reader, filePath) )
+		{
+			const int32_t size = int32_t(bx::getSize(&reader) );
+			output.resize(size);
+			const int32_t read = 0 < size ? bx::read(&reader, &output[0], size) : 0;
+			bx::close(&reader);
+
+			if (0 < size
+			&&  read == size)
+			{
+				BX_TRACE("Cache hit: %s", filePath.getCPtr() );
+				bx::atomicFetchAndAdd(&s_cacheHits, 1);
+				bx::write(_writer, output.c_str(), size);
+				return true;
+			}
+
+			output.clear();
+		}
+
+		BX_TRACE("Cache miss: %s", filePath.getCPtr() );
+		bx::atomicFetchAndAdd(&s_cacheMisses, 1);
+
+		StringWriter writer(output);
+		if (!_fn(_options, _version, _code, &writer) )
+		{
+			return false;
+		}
+
+		bx::write(_writer, output.c_str(), int32_t(output.size() ) );
+
+		bx::Error err;
+		bx::makeAll(_options.cacheDir.c_str(), &err);
+
+		// Entry is written to temporary file first, concurrent compiles of the same shader must
+		// never observe partially written entry.
+		std::string tempFilePath;
+		bx::stringPrintf(tempFilePath, "%s.%x.tmp", filePath.getCPtr(), bx::getTid() );
+
+		bx::FileWriter cacheWriter;
+		if (bx::open(&cacheWriter, tempFilePath.c_str() ) )
+		{
+			bx::write(&cacheWriter, output.c_str(), int32_t(output.size() ) );
+			bx::close(&cacheWriter);
+
+			if (0 != ::rename(tempFilePath.c_str(), filePath.getCPtr() ) )
+			{
+				::remove(tempFilePath.c_str() );
+			}
+		}
+
+		return true;
+	}
+
 	char* strInsert(char* _str, const char* _insert)
 	{
 		uint32_t len = bx::strLen(_insert);
@@ -610,6 +878,13 @@ namespace bgfx
 			m_tagptr->data = scratch(_filePath);
 			m_tagptr++;
 
+			if (NULL != s_fileCache)
+			{
+				m_tagptr->tag = FPPTAG_FILEOPENFUNC;
+				m_tagptr->data = (void*)fppFileOpen;
+				m_tagptr++;
+			}
+
 			if (!_essl)
 			{
 				m_default = "#define lowp\n#define mediump\n#define highp\n";
@@ -742,6 +1017,11 @@ namespace bgfx
 			bx::vprintf(_format, _vargs);
 		}
 
+		static FILE* fppFileOpen(char* _fileName, char* _mode, void* /*_userData*/)
+		{
+			return s_fileCache->open(_fileName, _mode);
+		}
+
 		char* scratch(const char* _str)
 		{
 			char* result = &m_scratch[m_scratchPos];
@@ -882,8 +1162,17 @@ namespace bgfx
 			  "  -f <file path>                Input file path.\n"
 			  "  -i <include path>             Include path (for multiple paths use -i multiple times).\n"
 			  "  -o <file path>                Output file path.\n"
+			  "      --batch <file path>       Compile shaders listed in batch file in parallel. Each line holds shaderc\n"
+			  "                                arguments of one shader, other arguments are shared by all of them.\n"
 			  "      --bin2c [array name]      Generate C header file. If array name is not specified base file name will be used as name.\n"
+			  "      --cache <dir path>        Reuse compiled shaders from cache directory when preprocessed source and\n"
+			  "                                options didn't change.\n"
 			  "      --depends                 Generate makefile style depends file.\n"
+			  "  -j, --jobs <num>              Number of threads used by batch mode (default number of CPU cores).\n"
+			  "      --permutations <file path> Compile all define permutations from spec file in parallel into single\n"
+			  "                                pack file. Spec lines are 'axis <define>...' and 'exclude <define>...'.\n"
+			  "                                With --reflect, each permutation writes <output>.<key>.json, and with\n"
+			  "                                --depends, single depends file covers all permutations.\n"
 			  "      --platform <platform>     Target platform.\n"
 			  "           android\n"
 			  "           asm.js\n"
@@ -903,6 +1192,8 @@ namespace bgfx
 			  "      --preprocess              Preprocess only.\n"
 			  "      --define <defines>        Add defines to preprocessor (semicolon separated).\n"
 			  "      --raw                     Do not process shader. No preprocessor, and no glsl-optimizer (GLSL only).\n"
+			  "      --reflect json            Write uniforms, samplers, vertex attributes, compute work group size and\n"
+			  "                                instruction count of compiled shader to <output>.json.\n"
 			  "      --type <type>             Shader type (vertex, fragment)\n"
 			  "      --varyingdef <file path>  Path to varying.def.sc file.\n"
 			  "      --verbose                 Verbose.\n"
@@ -916,6 +1207,14 @@ namespace bgfx
 			  "  -O <level>                    Optimization level (0, 1, 2, 3).\n"
 			  "      --Werror                  Treat warnings as errors.\n"
 
+			  "\n"
+			  "Options (SPIR-V and Metal only):\n"
+
+			  "\n"
+			  "  -O <level>                    Optimization level, 0 legalize only, 1 size, 2 performance, 3 both.\n"
+			  "                                Debug names are stripped from SPIR-V output unless --debug is used.\n"
+			  "      --stats                   Print SPIR-V instruction count and size before and after optimization.\n"
+
 			  "\n"
 			  "For additional information, see https://github.com/bkaradzic/bgfx\n"
 			);
@@ -928,7 +1227,7 @@ namespace bgfx
 		return word;
 	}
 
-	bool compileShader(const char* _varying, const char* _comment, char* _shader, uint32_t _shaderLen, Options& _options, bx::FileWriter* _writer)
+	bool compileShader(const char* _varying, const char* _comment, char* _shader, uint32_t _shaderLen, Options& _options, bx::WriterI* _writer)
 	{
 		uint32_t glsl  = 0;
 		uint32_t essl  = 0;
@@ -1481,19 +1780,19 @@ namespace bgfx
 
 							if (0 != metal)
 							{
-								compiled = compileMetalShader(_options, BX_MAKEFOURCC('M', 'T', 'L', 0), code, _writer);
+								compiled = compileCached(compileMetalShader, _options, BX_MAKEFOURCC('M', 'T', 'L', 0), code, _comment, _varying, _writer);
 							}
 							else if (0 != spirv)
 							{
-								compiled = compileSPIRVShader(_options, 0, code, _writer);
+								compiled = compileCached(compileSPIRVShader, _options, 0, code, _comment, _varying, _writer);
 							}
 							else if (0 != pssl)
 							{
-								compiled = compilePSSLShader(_options, 0, code, _writer);
+								compiled = compileCached(compilePSSLShader, _options, 0, code, _comment, _varying, _writer);
 							}
 							else
 							{
-								compiled = compileHLSLShader(_options, d3d, code, _writer);
+								compiled = compileCached(compileHLSLShader, _options, d3d, code, _comment, _varying, _writer);
 							}
 						}
 					}
@@ -2269,7 +2568,7 @@ namespace bgfx
 								code += _comment;
 								code += preprocessor.m_preprocessed;
 
-								compiled = compileGLSLShader(_options, metal ? BX_MAKEFOURCC('M', 'T', 'L', 0) : essl, code, _writer);
+								compiled = compileCached(compileGLSLShader, _options, metal ? BX_MAKEFOURCC('M', 'T', 'L', 0) : essl, code, _comment, _varying, _writer);
 							}
 						}
 						else
@@ -2279,19 +2578,19 @@ namespace bgfx
 
 							if (0 != metal)
 							{
-								compiled = compileMetalShader(_options, BX_MAKEFOURCC('M', 'T', 'L', 0), code, _writer);
+								compiled = compileCached(compileMetalShader, _options, BX_MAKEFOURCC('M', 'T', 'L', 0), code, _comment, _varying, _writer);
 							}
 							else if (0 != spirv)
 							{
-								compiled = compileSPIRVShader(_options, 0, code, _writer);
+								compiled = compileCached(compileSPIRVShader, _options, 0, code, _comment, _varying, _writer);
 							}
 							else if (0 != pssl)
 							{
-								compiled = compilePSSLShader(_options, 0, code, _writer);
+								compiled = compileCached(compilePSSLShader, _options, 0, code, _comment, _varying, _writer);
 							}
 							else
 							{
-								compiled = compileHLSLShader(_options, d3d, code, _writer);
+								compiled = compileCached(compileHLSLShader, _options, d3d, code, _comment, _varying, _writer);
 							}
 						}
 					}
@@ -2318,6 +2617,670 @@ namespace bgfx
 		return compiled;
 	}
 
+	int compileShader(int _argc, const char* _argv[]);
+
+	struct BatchJob
+	{
+		std::vector<std::string> args;
+		uint32_t line;
+		bool compiled;
+	};
+
+	struct Batch
+	{
+		std::vector<BatchJob> jobs;
+		std::vector<std::string> commonArgs;
+		int32_t next;
+	};
+
+	static void parseBatchArgs(std::vector<std::string>& _args, const bx::StringView& _line)
+	{
+		const char* ptr = _line.getPtr();
+		const char* term = _line.getTerm();
+
+		while (ptr != term)
+		{
+			ptr = bx::strLTrimSpace(bx::StringView(ptr, term) ).getPtr();
+			if (ptr == term)
+			{
+				break;
+			}
+
+			std::string arg;
+			bool quoted = false;
+
+			for (; ptr != term && (quoted || !bx::isSpace(*ptr) ); ++ptr)
+			{
+				if ('"' == *ptr)
+				{
+					quoted = !quoted;
+				}
+				else
+				{
+					arg += *ptr;
+				}
+			}
+
+			_args.push_back(arg);
+		}
+	}
+
+	static int32_t batchThreadFunc(bx::Thread* /*_thread*/, void* _userData)
+	{
+		Batch& batch = *(Batch*)_userData;
+		const int32_t numJobs = int32_t(batch.jobs.size() );
+
+		std::vector<const char*> argv;
+
+		for (int32_t idx = bx::atomicFetchAndAdd(&batch.next, 1); idx < numJobs; idx = bx::atomicFetchAndAdd(&batch.next, 1) )
+		{
+			BatchJob& job = batch.jobs[idx];
+
+			// Job arguments come first, so they take precedence over ones shared by all jobs.
+			argv.clear();
+			argv.push_back("shaderc");
+
+			for (size_t ii = 0; ii < job.args.size(); ++ii)
+			{
+				argv.push_back(job.args[ii].c_str() );
+			}
+
+			for (size_t ii = 0; ii < batch.commonArgs.size(); ++ii)
+			{
+				argv.push_back(batch.commonArgs[ii].c_str() );
+			}
+
+			job.compiled = bx::kExitSuccess == compileShader(int(argv.size() ), &argv[0]);
+		}
+
+		return bx::kExitSuccess;
+	}
+
+	static uint32_t getBatchThreads(const bx::CommandLine& _cmdLine, uint32_t _numJobs)
+	{
+		uint32_t numThreads = std::thread::hardware_concurrency();
+		_cmdLine.hasArg(numThreads, 'j', "jobs");
+		return bx::uint32_clamp(numThreads, 1, bx::max<uint32_t>(1, _numJobs) );
+	}
+
+	static void runBatch(Batch& _batch, uint32_t _numThreads)
+	{
+		BX_TRACE("Batch: %d jobs, %d threads.", uint32_t(_batch.jobs.size() ), _numThreads);
+
+		_batch.next = 0;
+
+		FileCache fileCache;
+		s_fileCache = &fileCache;
+
+		// Keep glslang global state alive for the whole batch, otherwise concurrent jobs would
+		// race creating and destroying it.
+		glslang::InitializeProcess();
+
+		bx::Thread* threads = new bx::Thread[_numThreads-1];
+		for (uint32_t ii = 0; ii < _numThreads-1; ++ii)
+		{
+			threads[ii].init(batchThreadFunc, &_batch, 8<<20, "shaderc");
+		}
+
+		batchThreadFunc(NULL, &_batch);
+
+		for (uint32_t ii = 0; ii < _numThreads-1; ++ii)
+		{
+			threads[ii].shutdown();
+		}
+
+		delete [] threads;
+
+		glslang::FinalizeProcess();
+
+		s_fileCache = NULL;
+	}
+
+	static void printCacheStats()
+	{
+		if (0 != s_cacheHits + s_cacheMisses)
+		{
+			bx::printf("Cache: %d hits, %d misses.\n", s_cacheHits, s_cacheMisses);
+		}
+	}
+
+	int compileBatch(const bx::CommandLine& _cmdLine, const char* _batchFilePath)
+	{
+		Batch batch;
+
+		// Everything except batch options is passed to each job.
+		for (int32_t ii = 1, num = _cmdLine.getNum(); ii < num; ++ii)
+		{
+			const bx::StringView arg(_cmdLine.get(ii) );
+
+			if (0 == bx::strCmp(arg, "--batch")
+			||  0 == bx::strCmp(arg, "--jobs")
+			||  0 == bx::strCmp(arg, "-j") )
+			{
+				++ii;
+				continue;
+			}
+
+			batch.commonArgs.push_back(std::string(arg.getPtr(), arg.getTerm() ) );
+		}
+
+		File manifest;
+		manifest.load(_batchFilePath);
+
+		if (NULL == manifest.getData() )
+		{
+			bx::printf("Unable to open batch file '%s'.\n", _batchFilePath);
+			return bx::kExitFailure;
+		}
+
+		bx::StringView parse(manifest.getData(), manifest.getSize() );
+		for (uint32_t line = 1; !parse.isEmpty(); ++line)
+		{
+			const bx::StringView eol = bx::strFindEol(parse);
+			const bx::StringView str = bx::strRTrim(bx::strLTrimSpace(bx::StringView(parse.getPtr(), eol.getPtr() ) ), " \t\r");
+			parse = bx::strFindNl(bx::StringView(eol.getPtr(), parse.getTerm() ) );
+
+			if (!str.isEmpty()
+			&&  '#' != *str.getPtr() )
+			{
+				BatchJob job;
+				job.line = line;
+				job.compiled = false;
+				parseBatchArgs(job.args, str);
+				batch.jobs.push_back(job);
+			}
+		}
+
+		runBatch(batch, getBatchThreads(_cmdLine, uint32_t(batch.jobs.size() ) ) );
+
+		uint32_t numFailed = 0;
+		for (size_t ii = 0; ii < batch.jobs.size(); ++ii)
+		{
+			const BatchJob& job = batch.jobs[ii];
+			if (!job.compiled)
+			{
+				bx::printf("%s(%d): Failed to build shader.\n", _batchFilePath, job.line);
+				++numFailed;
+			}
+		}
+
+		bx::printf("Batch: %d shaders compiled, %d failed.\n"
+			, uint32_t(batch.jobs.size() ) - numFailed
+			, numFailed
+			);
+
+		printCacheStats();
+
+		return 0 == numFailed ? bx::kExitSuccess : bx::kExitFailure;
+	}
+
+	struct PermutationSpec
+	{
+		// Axis with N defines has N+1 choices, choice 0 is none of the defines. Permutation
+		// key is mixed radix number made of axis choices, first axis is least significant.
+		std::vector<std::vector<std::string> > axes;
+
+		// Defines that must not be all set in the same permutation.
+		std::vector<std::vector<std::string> > excludes;
+	};
+
+	static bool parsePermutationSpec(PermutationSpec& _spec, const char* _filePath)
+	{
+		File file;
+		file.load(_filePath);
+
+		if (NULL == file.getData() )
+		{
+			bx::printf("Unable to open permutation file '%s'.\n", _filePath);
+			return false;
+		}
+
+		bx::StringView parse(file.getData(), file.getSize() );
+		for (uint32_t line = 1; !parse.isEmpty(); ++line)
+		{
+			const bx::StringView eol = bx::strFindEol(parse);
+			const bx::StringView str = bx::strRTrim(bx::strLTrimSpace(bx::StringView(parse.getPtr(), eol.getPtr() ) ), " \t\r");
+			parse = bx::strFindNl(bx::StringView(eol.getPtr(), parse.getTerm() ) );
+
+			if (str.isEmpty()
+			||  '#' == *str.getPtr() )
+			{
+				continue;
+			}
+
+			std::vector<std::string> tokens;
+			parseBatchArgs(tokens, str);
+
+			if (2 > tokens.size() )
+			{
+				bx::printf("%s(%d): Expected 'axis' or 'exclude' followed by defines.\n", _filePath, line);
+				return false;
+			}
+
+			std::vector<std::string> defines(tokens.begin()+1, tokens.end() );
+
+			if ("axis" == tokens[0])
+			{
+				if (255 < defines.size() )
+				{
+					bx::printf("%s(%d): Too many defines in axis.\n", _filePath, line);
+					return false;
+				}
+
+				_spec.axes.push_back(defines);
+			}
+			else if ("exclude" == tokens[0])
+			{
+				_spec.excludes.push_back(defines);
+			}
+			else
+			{
+				bx::printf("%s(%d): Unknown keyword '%s'.\n", _filePath, line, tokens[0].c_str() );
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	static bool isExcluded(const PermutationSpec& _spec, const std::vector<std::string>& _defines)
+	{
+		for (size_t ii = 0; ii < _spec.excludes.size(); ++ii)
+		{
+			const std::vector<std::string>& exclude = _spec.excludes[ii];
+
+			bool all = true;
+			for (size_t jj = 0; jj < exclude.size() && all; ++jj)
+			{
+				all = _defines.end() != std::find(_defines.begin(), _defines.end(), exclude[jj]);
+			}
+
+			if (all)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	// Shader pack layout:
+	//
+	//   uint32_t magic
+	//   uint16_t numAxes
+	//     uint8_t numDefines
+	//       uint8_t len, char name[len]
+	//   uint32_t numEntries, sorted by key
+	//     uint32_t key, uint32_t blob
+	//   uint32_t numBlobs
+	//     uint32_t offset, uint32_t size
+	//   blobs, each is regular shader binary aligned to BGFX_SHADER_PACK_ALIGN from file start.
+	//
+	// Add files listed in makefile style depends file written by a job, skipping the target
+	// and files already in the list.
+	static void addDependencies(std::vector<std::string>& _dependencies, const char* _data)
+	{
+		if (NULL == _data)
+		{
+			return;
+		}
+
+		const bx::StringView colon = bx::strFind(_data, " : ");
+		if (colon.isEmpty() )
+		{
+			return;
+		}
+
+		for (const char* ptr = colon.getTerm(); '\0' != *ptr;)
+		{
+			if (bx::isSpace(*ptr) )
+			{
+				++ptr;
+				continue;
+			}
+
+			const char* start = ptr;
+			while ('\0' != *ptr
+			&&     !bx::isSpace(*ptr) )
+			{
+				++ptr;
+			}
+
+			const std::string fileName(start, ptr);
+			if ("\\" != fileName
+			&&  _dependencies.end() == std::find(_dependencies.begin(), _dependencies.end(), fileName) )
+			{
+				_dependencies.push_back(fileName);
+			}
+		}
+	}
+
+	static bool copyFile(const char* _dstFilePath, const char* _srcFilePath)
+	{
+		File file;
+		file.load(_srcFilePath);
+
+		if (NULL == file.getData() )
+		{
+			return false;
+		}
+
+		bx::FileWriter writer;
+		if (!bx::open(&writer, _dstFilePath) )
+		{
+			return false;
+		}
+
+		bx::write(&writer, file.getData(), int32_t(file.getSize() ) );
+		bx::close(&writer);
+
+		return true;
+	}
+
+	int compilePermutations(const bx::CommandLine& _cmdLine, const char* _specFilePath)
+	{
+		const char* outFilePath = _cmdLine.findOption('o');
+		if (NULL == outFilePath)
+		{
+			help("Output file name must be specified.");
+			return bx::kExitFailure;
+		}
+
+		if (_cmdLine.hasArg("bin2c")
+		||  _cmdLine.hasArg("preprocess") )
+		{
+			help("--bin2c and --preprocess can't be used with --permutations.");
+			return bx::kExitFailure;
+		}
+
+		PermutationSpec spec;
+		if (!parsePermutationSpec(spec, _specFilePath) )
+		{
+			return bx::kExitFailure;
+		}
+
+		uint64_t numPermutations = 1;
+		for (size_t ii = 0; ii < spec.axes.size(); ++ii)
+		{
+			numPermutations *= spec.axes[ii].size() + 1;
+
+			if (BGFX_SHADER_PACK_MAX_PERMUTATIONS < numPermutations)
+			{
+				bx::printf("Permutation spec '%s' exceeds %d permutations.\n"
+					, _specFilePath
+					, BGFX_SHADER_PACK_MAX_PERMUTATIONS
+					);
+				return bx::kExitFailure;
+			}
+		}
+
+		Batch batch;
+		std::string commonDefines;
+
+		// Output and defines are set per permutation, the rest is passed to each job. Jobs
+		// write depends and reflection files next to their temporary output, they are merged
+		// or renamed after the batch.
+		for (int32_t ii = 1, num = _cmdLine.getNum(); ii < num; ++ii)
+		{
+			const bx::StringView arg(_cmdLine.get(ii) );
+
+			if (0 == bx::strCmp(arg, "--define")
+			&&  ii+1 < num)
+			{
+				if (!commonDefines.empty() )
+				{
+					commonDefines += ";";
+				}
+
+				commonDefines += _cmdLine.get(++ii);
+				continue;
+			}
+
+			if (0 == bx::strCmp(arg, "--permutations")
+			||  0 == bx::strCmp(arg, "--jobs")
+			||  0 == bx::strCmp(arg, "-j")
+			||  0 == bx::strCmp(arg, "-o") )
+			{
+				++ii;
+				continue;
+			}
+
+			batch.commonArgs.push_back(std::string(arg.getPtr(), arg.getTerm() ) );
+		}
+
+		const bool depends = _cmdLine.hasArg("depends");
+		const bool reflect = NULL != _cmdLine.findOption("reflect");
+
+		std::vector<uint32_t> keys;
+		std::vector<std::string> defines;
+
+		for (uint32_t key = 0; key < uint32_t(numPermutations); ++key)
+		{
+			defines.clear();
+
+			for (uint32_t axis = 0, rest = key; axis < uint32_t(spec.axes.size() ); ++axis)
+			{
+				const uint32_t radix  = uint32_t(spec.axes[axis].size() + 1);
+				const uint32_t choice = rest % radix;
+				rest /= radix;
+
+				if (0 != choice)
+				{
+					defines.push_back(spec.axes[axis][choice-1]);
+				}
+			}
+
+			if (isExcluded(spec, defines) )
+			{
+				continue;
+			}
+
+			std::string define = commonDefines;
+			for (size_t ii = 0; ii < defines.size(); ++ii)
+			{
+				if (!define.empty() )
+				{
+					define += ";";
+				}
+
+				define += defines[ii];
+			}
+
+			std::string tempFilePath;
+			bx::stringPrintf(tempFilePath, "%s.%d.tmp", outFilePath, key);
+
+			BatchJob job;
+			job.line = key;
+			job.compiled = false;
+			job.args.push_back("-o");
+			job.args.push_back(tempFilePath);
+
+			if (!define.empty() )
+			{
+				job.args.push_back("--define");
+				job.args.push_back(define);
+			}
+
+			batch.jobs.push_back(job);
+			keys.push_back(key);
+		}
+
+		runBatch(batch, getBatchThreads(_cmdLine, uint32_t(batch.jobs.size() ) ) );
+
+		std::vector<std::string> blobs;
+		std::vector<uint32_t> entries;
+		std::unordered_map<std::string, uint32_t> blobMap;
+		std::vector<std::string> dependencies;
+		uint32_t numFailed = 0;
+
+		for (size_t ii = 0; ii < batch.jobs.size(); ++ii)
+		{
+			const BatchJob& job = batch.jobs[ii];
+			const std::string& tempFilePath = job.args[1];
+
+			if (depends)
+			{
+				const std::string dependsFilePath = tempFilePath + ".d";
+
+				if (job.compiled)
+				{
+					File file;
+					file.load(dependsFilePath.c_str() );
+					addDependencies(dependencies, file.getData() );
+				}
+
+				bx::remove(dependsFilePath.c_str() );
+			}
+
+			if (reflect)
+			{
+				const std::string reflectFilePath = tempFilePath + ".json";
+
+				if (job.compiled)
+				{
+					std::string permutationReflectFilePath;
+					bx::stringPrintf(permutationReflectFilePath, "%s.%d.json", outFilePath, keys[ii]);
+
+					if (!copyFile(permutationReflectFilePath.c_str(), reflectFilePath.c_str() ) )
+					{
+						bx::printf("Unable to write reflection file '%s'.\n", permutationReflectFilePath.c_str() );
+						++numFailed;
+					}
+				}
+
+				bx::remove(reflectFilePath.c_str() );
+			}
+
+			if (job.compiled)
+			{
+				File file;
+				file.load(tempFilePath.c_str() );
+
+				std::string blob;
+				if (NULL != file.getData() )
+				{
+					blob.assign(file.getData(), file.getSize() );
+				}
+
+				// Variants where defines don't affect output share single blob.
+				std::unordered_map<std::string, uint32_t>::const_iterator it = blobMap.find(blob);
+				if (it == blobMap.end() )
+				{
+					it = blobMap.insert(std::make_pair(blob, uint32_t(blobs.size() ) ) ).first;
+					blobs.push_back(blob);
+				}
+
+				entries.push_back(it->second);
+			}
+			else
+			{
+				bx::printf("%s: Failed to build permutation %d.\n", _specFilePath, keys[ii]);
+				entries.push_back(UINT32_MAX);
+				++numFailed;
+			}
+
+			bx::remove(tempFilePath.c_str() );
+		}
+
+		if (0 != numFailed)
+		{
+			bx::printf("Permutations: %d failed.\n", numFailed);
+			return bx::kExitFailure;
+		}
+
+		bx::FileWriter writer;
+		if (!bx::open(&writer, outFilePath) )
+		{
+			bx::printf("Unable to open output file '%s'.\n", outFilePath);
+			return bx::kExitFailure;
+		}
+
+		uint32_t offset = 0;
+		offset += bx::write(&writer, BGFX_SHADER_PACK_MAGIC);
+		offset += bx::write(&writer, uint16_t(spec.axes.size() ) );
+
+		for (size_t ii = 0; ii < spec.axes.size(); ++ii)
+		{
+			const std::vector<std::string>& axis = spec.axes[ii];
+			offset += bx::write(&writer, uint8_t(axis.size() ) );
+
+			for (size_t jj = 0; jj < axis.size(); ++jj)
+			{
+				const uint8_t len = uint8_t(bx::min<size_t>(axis[jj].size(), UINT8_MAX) );
+				offset += bx::write(&writer, len);
+				offset += bx::write(&writer, axis[jj].c_str(), len);
+			}
+		}
+
+		offset += bx::write(&writer, uint32_t(keys.size() ) );
+
+		for (size_t ii = 0; ii < keys.size(); ++ii)
+		{
+			offset += bx::write(&writer, keys[ii]);
+			offset += bx::write(&writer, entries[ii]);
+		}
+
+		offset += bx::write(&writer, uint32_t(blobs.size() ) );
+
+		std::vector<uint32_t> blobOffsets(blobs.size() );
+		uint32_t blobOffset = offset + uint32_t(blobs.size() ) * 2 * sizeof(uint32_t);
+
+		for (size_t ii = 0; ii < blobs.size(); ++ii)
+		{
+			blobOffset = bx::strideAlign(blobOffset, BGFX_SHADER_PACK_ALIGN);
+			blobOffsets[ii] = blobOffset;
+			blobOffset += uint32_t(blobs[ii].size() );
+
+			offset += bx::write(&writer, blobOffsets[ii]);
+			offset += bx::write(&writer, uint32_t(blobs[ii].size() ) );
+		}
+
+		const uint8_t zero[BGFX_SHADER_PACK_ALIGN] = {};
+		for (size_t ii = 0; ii < blobs.size(); ++ii)
+		{
+			offset += bx::write(&writer, zero, int32_t(blobOffsets[ii] - offset) );
+			offset += bx::write(&writer, blobs[ii].c_str(), int32_t(blobs[ii].size() ) );
+		}
+
+		bx::close(&writer);
+
+		if (depends)
+		{
+			// Single depends file covers sources of all permutations.
+			std::string dependsFilePath = outFilePath;
+			dependsFilePath += ".d";
+
+			std::string list;
+			for (size_t ii = 0; ii < dependencies.size(); ++ii)
+			{
+				list += " \\\n ";
+				list += dependencies[ii];
+			}
+
+			bx::FileWriter dependsWriter;
+			if (bx::open(&dependsWriter, dependsFilePath.c_str() ) )
+			{
+				writef(&dependsWriter, "%s :%s\n", outFilePath, list.c_str() );
+				bx::close(&dependsWriter);
+			}
+			else
+			{
+				bx::printf("Unable to open depends file '%s'.\n", dependsFilePath.c_str() );
+				return bx::kExitFailure;
+			}
+		}
+
+		bx::printf("Permutations: %d variants, %d unique, %d excluded.\n"
+			, uint32_t(keys.size() )
+			, uint32_t(blobs.size() )
+			, uint32_t(numPermutations) - uint32_t(keys.size() )
+			);
+
+		printCacheStats();
+
+		return bx::kExitSuccess;
+	}
+
 	int compileShader(int _argc, const char* _argv[])
 	{
 		bx::CommandLine cmdLine(_argc, _argv);
@@ -2339,7 +3302,22 @@ namespace bgfx
 			return bx::kExitFailure;
 		}
 
-		g_verbose = cmdLine.hasArg("verbose");
+		if (cmdLine.hasArg("verbose") )
+		{
+			g_verbose = true;
+		}
+
+		const char* batchFilePath = cmdLine.findOption("batch");
+		if (NULL != batchFilePath)
+		{
+			return compileBatch(cmdLine, batchFilePath);
+		}
+
+		const char* permutationsFilePath = cmdLine.findOption("permutations");
+		if (NULL != permutationsFilePath)
+		{
+			return compilePermutations(cmdLine, permutationsFilePath);
+		}
 
 		const char* filePath = cmdLine.findOption('f');
 		if (NULL == filePath)
@@ -2395,6 +3373,7 @@ namespace bgfx
 			options.backwardsCompatibility = cmdLine.hasArg('\0', "backwards-compatibility");
 			options.warningsAreErrors      = cmdLine.hasArg('\0', "Werror");
 			options.keepIntermediate       = cmdLine.hasArg('\0', "keep-intermediate");
+			options.stats                  = cmdLine.hasArg('\0', "stats");
 
 			uint32_t optimization = 3;
 			if (cmdLine.hasArg(optimization, 'O') )
@@ -2438,6 +3417,20 @@ namespace bgfx
 			}
 		}
 
+		const char* reflect = cmdLine.findOption("reflect");
+		if (NULL != reflect
+		&&  0 != bx::strCmp(reflect, "json") )
+		{
+			help("Reflection format must be json.");
+			return bx::kExitFailure;
+		}
+
+		const char* cacheDir = cmdLine.findOption("cache");
+		if (NULL != cacheDir)
+		{
+			options.cacheDir = cacheDir;
+		}
+
 		options.depends = cmdLine.hasArg("depends");
 		options.preprocessOnly = cmdLine.hasArg("preprocess");
 		const char* includeDir = cmdLine.findOption('i');
@@ -2496,8 +3489,18 @@ namespace bgfx
 			{
 				std::string defaultVarying = dir + "varying.def.sc";
 				const char* varyingdef = cmdLine.findOption("varyingdef", defaultVarying.c_str() );
-				attribdef.load(varyingdef);
-				varying = attribdef.getData();
+
+				if (NULL != s_fileCache)
+				{
+					const std::string* cached = s_fileCache->find(varyingdef);
+					varying = NULL != cached ? cached->c_str() : NULL;
+				}
+				else
+				{
+					attribdef.load(varyingdef);
+					varying = attribdef.getData();
+				}
+
 				if (NULL     != varying
 				&&  *varying != '\0')
 				{
@@ -2545,10 +3548,33 @@ namespace bgfx
 				return bx::kExitFailure;
 			}
 
-			compiled = compileShader(varying, commandLineComment.c_str(), data, size, options, writer);
+			std::string output;
+			StringWriter outputWriter(output);
 
+			compiled = compileShader(varying, commandLineComment.c_str(), data, size, options, &outputWriter);
+
+			bx::write(writer, output.c_str(), int32_t(output.size() ) );
 			bx::close(writer);
 			delete writer;
+
+			if (compiled
+			&&  NULL != reflect
+			&&  !options.preprocessOnly)
+			{
+				std::string reflectFilePath = options.outputFilePath + ".json";
+
+				bx::FileWriter reflectWriter;
+				if (bx::open(&reflectWriter, reflectFilePath.c_str() ) )
+				{
+					compiled = writeReflection(options, output.c_str(), uint32_t(output.size() ), &reflectWriter);
+					bx::close(&reflectWriter);
+				}
+				else
+				{
+					bx::printf("Unable to open reflection file '%s'.\n", reflectFilePath.c_str() );
+					compiled = false;
+				}
+			}
 		}
 
 		if (compiled)
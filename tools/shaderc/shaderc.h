@@ -139,6 +139,7 @@ namespace bgfx
 
 		std::string	inputFilePath;
 		std::string	outputFilePath;
+		std::string	cacheDir;
 
 		std::vector<std::string> includeDirs;
 		std::vector<std::string> defines;
@@ -158,6 +159,7 @@ namespace bgfx
 		bool backwardsCompatibility;
 		bool warningsAreErrors;
 		bool keepIntermediate;
+		bool stats;
 
 		bool optimize;
 		uint32_t optimizationLevel;
@@ -176,6 +178,8 @@ namespace bgfx
 	bool compilePSSLShader(const Options& _options, uint32_t _version, const std::string& _code, bx::WriterI* _writer);
 	bool compileSPIRVShader(const Options& _options, uint32_t _version, const std::string& _code, bx::WriterI* _writer);
 
+	bool writeReflection(const Options& _options, const void* _data, uint32_t _size, bx::WriterI* _writer);
+
 	const char* getPsslPreamble();
 
 } // namespace bgfx
@@ -5,9 +5,14 @@
 
 #include "shaderc.h"
 #include "glsl_optimizer.h"
+#include <bx/mutex.h>
 
 namespace bgfx { namespace glsl
 {
+	// glsl-optimizer releases its global type tables on cleanup, so it can't be used by
+	// multiple batch jobs at the same time.
+	static bx::Mutex s_mutex;
+
 	static bool compile(const Options& _options, uint32_t _version, const std::string& _code, bx::WriterI* _writer)
 	{
 		char ch = _options.shaderType;
@@ -373,6 +378,7 @@ namespace bgfx { namespace glsl
 
 	bool compileGLSLShader(const Options& _options, uint32_t _version, const std::string& _code, bx::WriterI* _writer)
 	{
+		bx::MutexScope lock(glsl::s_mutex);
 		return glsl::compile(_options, _version, _code, _writer);
 	}
 
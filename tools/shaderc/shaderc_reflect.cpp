@@ -0,0 +1,430 @@
+/*
+ * Copyright 2011-2020 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx#license-bsd-2-clause
+ */
+
+#include "shaderc.h"
+
+namespace bgfx { namespace reflect
+{
+	static const char* s_attribName[] =
+	{
+		"a_position",
+		"a_normal",
+		"a_tangent",
+		"a_bitangent",
+		"a_color0",
+		"a_color1",
+		"a_color2",
+		"a_color3",
+		"a_indices",
+		"a_weight",
+		"a_texcoord0",
+		"a_texcoord1",
+		"a_texcoord2",
+		"a_texcoord3",
+		"a_texcoord4",
+		"a_texcoord5",
+		"a_texcoord6",
+		"a_texcoord7",
+	};
+	BX_STATIC_ASSERT(bgfx::Attrib::Count == BX_COUNTOF(s_attribName) );
+
+	struct CodeInfo
+	{
+		uint32_t numInstructions; // UINT32_MAX if unknown.
+		uint16_t workGroupSize[3];
+	};
+
+	static void parseSpirv(CodeInfo& _info, const uint32_t* _code, uint32_t _numWords)
+	{
+		_info.numInstructions = 0;
+
+		// Instructions follow 5 word header, word count of instruction is in upper 16 bits of
+		// its first word.
+		for (uint32_t ii = 5; ii < _numWords; ++_info.numInstructions)
+		{
+			const uint32_t opcode    = _code[ii] & 0xffff;
+			const uint32_t wordCount = bx::max<uint32_t>(1, _code[ii] >> 16);
+
+			if (16 == opcode // OpExecutionMode
+			&&  6  <= wordCount
+			&&  ii + 5 < _numWords
+			&&  17 == _code[ii+2]) // LocalSize
+			{
+				_info.workGroupSize[0] = uint16_t(_code[ii+3]);
+				_info.workGroupSize[1] = uint16_t(_code[ii+4]);
+				_info.workGroupSize[2] = uint16_t(_code[ii+5]);
+			}
+
+			ii += wordCount;
+		}
+	}
+
+	static bool isDxbcDeclaration(uint32_t _opcode)
+	{
+		return (0x58 <= _opcode && _opcode <= 0x6a) // DCL_RESOURCE - DCL_GLOBAL_FLAGS
+			|| (0x8f <= _opcode && _opcode <= 0xa2) // DCL_STREAM - DCL_RESOURCE_STRUCTURED
+			||  0xce == _opcode                     // DCL_GS_INSTANCE_COUNT
+			;
+	}
+
+	static void parseDxbc(CodeInfo& _info, const uint8_t* _code, uint32_t _size)
+	{
+		if (32 > _size)
+		{
+			return;
+		}
+
+		const uint32_t numChunks = *(const uint32_t*)&_code[28];
+
+		for (uint32_t chunk = 0; chunk < numChunks && 32 + chunk*4 + 4 <= _size; ++chunk)
+		{
+			const uint32_t offset = *(const uint32_t*)&_code[32 + chunk*4];
+			if (offset + 8 > _size)
+			{
+				continue;
+			}
+
+			const uint32_t fourcc    = *(const uint32_t*)&_code[offset];
+			const uint32_t chunkSize = bx::min<uint32_t>(*(const uint32_t*)&_code[offset+4], _size - offset - 8);
+
+			if (BX_MAKEFOURCC('S', 'H', 'E', 'X') != fourcc
+			&&  BX_MAKEFOURCC('S', 'H', 'D', 'R') != fourcc)
+			{
+				continue;
+			}
+
+			const uint32_t* tokens = (const uint32_t*)&_code[offset + 8];
+			const uint32_t numTokens = chunkSize/4;
+
+			_info.numInstructions = 0;
+
+			// Skip version and length tokens.
+			for (uint32_t ii = 2; ii < numTokens;)
+			{
+				const uint32_t opcode = tokens[ii] & 0x7ff;
+				uint32_t length = (tokens[ii] >> 24) & 0x7f;
+
+				if (0x35 == opcode) // CUSTOMDATA
+				{
+					length = ii + 1 < numTokens ? tokens[ii+1] : 0;
+				}
+				else if (0x9b == opcode // DCL_THREAD_GROUP
+				     &&  ii + 3 < numTokens)
+				{
+					_info.workGroupSize[0] = uint16_t(tokens[ii+1]);
+					_info.workGroupSize[1] = uint16_t(tokens[ii+2]);
+					_info.workGroupSize[2] = uint16_t(tokens[ii+3]);
+				}
+				else if (!isDxbcDeclaration(opcode) )
+				{
+					++_info.numInstructions;
+				}
+
+				if (0 == length)
+				{
+					break;
+				}
+
+				ii += length;
+			}
+
+			return;
+		}
+	}
+
+	static void parseDx9bc(CodeInfo& _info, const uint32_t* _code, uint32_t _numTokens)
+	{
+		_info.numInstructions = 0;
+
+		// Skip version token.
+		for (uint32_t ii = 1; ii < _numTokens;)
+		{
+			const uint32_t opcode = _code[ii] & 0xffff;
+
+			if (0xffff == opcode) // END
+			{
+				break;
+			}
+
+			if (0xfffe == opcode) // COMMENT
+			{
+				ii += 1 + ( (_code[ii] >> 16) & 0x7fff);
+				continue;
+			}
+
+			if (0x1f != opcode  // DCL
+			&&  0x2f != opcode  // DEFB
+			&&  0x30 != opcode  // DEFI
+			&&  0x51 != opcode) // DEF
+			{
+				++_info.numInstructions;
+			}
+
+			ii += 1 + ( (_code[ii] >> 24) & 0xf);
+		}
+	}
+
+	static void parseGlsl(CodeInfo& _info, const char* _code, uint32_t _size)
+	{
+		static const char* s_localSize[] =
+		{
+			"local_size_x",
+			"local_size_y",
+			"local_size_z",
+		};
+
+		const bx::StringView code(_code, _size);
+
+		for (uint32_t ii = 0; ii < BX_COUNTOF(s_localSize); ++ii)
+		{
+			bx::StringView str = bx::strFind(code, s_localSize[ii]);
+			if (!str.isEmpty() )
+			{
+				str = bx::strFind(bx::StringView(str.getTerm(), code.getTerm() ), '=');
+				if (!str.isEmpty() )
+				{
+					uint32_t size = 1;
+					bx::fromString(&size, bx::strLTrimSpace(bx::StringView(str.getTerm(), code.getTerm() ) ) );
+					_info.workGroupSize[ii] = uint16_t(size);
+				}
+			}
+		}
+	}
+
+	static void parseCode(CodeInfo& _info, const Options& _options, const void* _data, uint32_t _size)
+	{
+		// Code follows variable length uniform table, copy it to get aligned tokens.
+		std::vector<uint32_t> aligned( (_size+3)/4 + 1, 0);
+		bx::memCopy(aligned.data(), _data, _size);
+		const uint8_t* code = (const uint8_t*)aligned.data();
+
+		const char* profile = _options.profile.c_str();
+
+		if (4 <= _size
+		&&  0x07230203 == *(const uint32_t*)code)
+		{
+			parseSpirv(_info, (const uint32_t*)code, _size/4);
+		}
+		else if (4 <= _size
+		     &&  BX_MAKEFOURCC('D', 'X', 'B', 'C') == *(const uint32_t*)code)
+		{
+			parseDxbc(_info, code, _size);
+		}
+		else if ('\0' != profile[0]
+		     &&  0 == bx::strCmp(&profile[1], "s_3", 3) )
+		{
+			parseDx9bc(_info, (const uint32_t*)code, _size/4);
+		}
+		else if (0 != bx::strCmp(profile, "pssl") ) // PSSL binary is opaque.
+		{
+			parseGlsl(_info, (const char*)code, _size);
+		}
+	}
+
+	static const char* getStageName(char _shaderType)
+	{
+		switch (_shaderType)
+		{
+		case 'v': return "vertex";
+		case 'f': return "fragment";
+		case 'c': return "compute";
+		default: break;
+		}
+
+		return "unknown";
+	}
+
+	static bool write(const Options& _options, const void* _data, uint32_t _size, bx::WriterI* _writer)
+	{
+		bx::MemoryReader reader(_data, _size);
+		bx::Error err;
+
+		uint32_t magic = 0;
+		bx::read(&reader, magic, &err);
+
+		const uint8_t version = uint8_t(magic >> 24);
+		if (BX_MAKEFOURCC('V', 'S', 'H', 0) != (magic & 0xffffff)
+		&&  BX_MAKEFOURCC('F', 'S', 'H', 0) != (magic & 0xffffff)
+		&&  BX_MAKEFOURCC('C', 'S', 'H', 0) != (magic & 0xffffff) )
+		{
+			bx::printf("Reflection: Output is not bgfx shader binary.\n");
+			return false;
+		}
+
+		const bool compute = 'C' == char(magic);
+
+		uint32_t inputHash  = 0;
+		uint32_t outputHash = 0;
+		bx::read(&reader, inputHash, &err);
+		bx::read(&reader, outputHash, &err);
+
+		writef(_writer, "{\n");
+		writef(_writer, "\t\"stage\": \"%s\",\n", getStageName(_options.shaderType) );
+		writef(_writer, "\t\"platform\": \"%s\",\n", _options.platform.c_str() );
+		writef(_writer, "\t\"profile\": \"%s\",\n", _options.profile.c_str() );
+		writef(_writer, "\t\"version\": %d,\n", version);
+		writef(_writer, "\t\"inputHash\": \"0x%08x\",\n", inputHash);
+		writef(_writer, "\t\"outputHash\": \"0x%08x\",\n", outputHash);
+
+		uint16_t count = 0;
+		bx::read(&reader, count, &err);
+
+		writef(_writer, "\t\"uniforms\": [");
+
+		for (uint32_t ii = 0; ii < count && err.isOk(); ++ii)
+		{
+			uint8_t nameSize = 0;
+			bx::read(&reader, nameSize, &err);
+
+			char name[256];
+			bx::read(&reader, name, nameSize, &err);
+			name[nameSize] = '\0';
+
+			uint8_t type = 0;
+			uint8_t num = 0;
+			uint16_t regIndex = 0;
+			uint16_t regCount = 0;
+			uint8_t texComponent = 0;
+			uint8_t texDimension = 0;
+			bx::read(&reader, type, &err);
+			bx::read(&reader, num, &err);
+			bx::read(&reader, regIndex, &err);
+			bx::read(&reader, regCount, &err);
+
+			if (8 <= version)
+			{
+				bx::read(&reader, texComponent, &err);
+				bx::read(&reader, texDimension, &err);
+			}
+
+			const bool sampler = 0 != (type & BGFX_UNIFORM_SAMPLERBIT);
+
+			writef(_writer, "%s\n\t\t{ \"name\": \"%s\", \"type\": \"%s\", \"num\": %d, \"regIndex\": %d, \"regCount\": %d"
+				, 0 == ii ? "" : ","
+				, name
+				, getUniformTypeName(UniformType::Enum(type & ~BGFX_UNIFORM_MASK) )
+				, num
+				, regIndex
+				, regCount
+				);
+
+			writef(_writer, ", \"stage\": \"%s\""
+				, 0 != (type & BGFX_UNIFORM_FRAGMENTBIT) ? "fragment" : getStageName(_options.shaderType)
+				);
+
+			if (sampler)
+			{
+				writef(_writer, ", \"sampler\": true, \"compare\": %s, \"texComponent\": %d, \"texDimension\": %d"
+					, 0 != (type & BGFX_UNIFORM_COMPAREBIT) ? "true" : "false"
+					, texComponent
+					, texDimension
+					);
+			}
+
+			if (0 != (type & BGFX_UNIFORM_READONLYBIT) )
+			{
+				writef(_writer, ", \"readOnly\": true");
+			}
+
+			writef(_writer, " }");
+		}
+
+		writef(_writer, "%s],\n", 0 == count ? "" : "\n\t");
+
+		CodeInfo info;
+		info.numInstructions  = UINT32_MAX;
+		info.workGroupSize[0] = 0;
+		info.workGroupSize[1] = 0;
+		info.workGroupSize[2] = 0;
+
+		if (compute
+		&&  0 == bx::strCmp(_options.profile.c_str(), "metal") )
+		{
+			bx::read(&reader, info.workGroupSize[0], &err);
+			bx::read(&reader, info.workGroupSize[1], &err);
+			bx::read(&reader, info.workGroupSize[2], &err);
+		}
+
+		uint32_t shaderSize = 0;
+		bx::read(&reader, shaderSize, &err);
+
+		const int64_t pos = bx::seek(&reader);
+		if (err.isOk()
+		&&  pos + shaderSize <= _size)
+		{
+			CodeInfo codeInfo = info;
+			parseCode(codeInfo, _options, (const uint8_t*)_data + pos, shaderSize);
+			info.numInstructions = codeInfo.numInstructions;
+
+			if (0 == info.workGroupSize[0])
+			{
+				bx::memCopy(info.workGroupSize, codeInfo.workGroupSize, sizeof(info.workGroupSize) );
+			}
+		}
+
+		bx::seek(&reader, shaderSize + 1); // Code and null terminator.
+
+		writef(_writer, "\t\"codeSize\": %d,\n", shaderSize);
+
+		if (UINT32_MAX != info.numInstructions)
+		{
+			writef(_writer, "\t\"instructions\": %d,\n", info.numInstructions);
+		}
+
+		if (compute)
+		{
+			writef(_writer, "\t\"workGroupSize\": [ %d, %d, %d ],\n"
+				, info.workGroupSize[0]
+				, info.workGroupSize[1]
+				, info.workGroupSize[2]
+				);
+		}
+
+		// GLSL binaries end after the code, attributes are bound by name at link time.
+		uint8_t numAttrs = 0;
+		uint16_t uniformBufferSize = 0;
+
+		bx::Error tailErr;
+		if (1 == bx::read(&reader, numAttrs, &tailErr) )
+		{
+			writef(_writer, "\t\"attributes\": [");
+
+			for (uint32_t ii = 0; ii < numAttrs; ++ii)
+			{
+				uint16_t id = UINT16_MAX;
+				bx::read(&reader, id, &err);
+
+				const Attrib::Enum attr = idToAttrib(id);
+				writef(_writer, "%s \"%s\""
+					, 0 == ii ? "" : ","
+					, Attrib::Count != attr ? s_attribName[attr] : "unknown"
+					);
+			}
+
+			writef(_writer, " ],\n");
+
+			bx::read(&reader, uniformBufferSize, &err);
+		}
+
+		writef(_writer, "\t\"uniformBufferSize\": %d\n", uniformBufferSize);
+		writef(_writer, "}\n");
+
+		if (!err.isOk() )
+		{
+			bx::printf("Reflection: Shader binary is truncated.\n");
+			return false;
+		}
+
+		return true;
+	}
+
+} // namespace reflect
+
+	bool writeReflection(const Options& _options, const void* _data, uint32_t _size, bx::WriterI* _writer)
+	{
+		return reflect::write(_options, _data, _size, _writer);
+	}
+
+} // namespace bgfx
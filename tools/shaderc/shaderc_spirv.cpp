@@ -670,6 +670,67 @@ namespace bgfx { namespace spirv
 		return size;
 	}
 
+	static void registerOptimizerPasses(spvtools::Optimizer& _opt, const Options& _options)
+	{
+		_opt.RegisterLegalizationPasses();
+
+		if (!_options.optimize)
+		{
+			return;
+		}
+
+		switch (_options.optimizationLevel)
+		{
+		case 0:
+			break;
+
+		case 1:
+			_opt.RegisterSizePasses();
+			break;
+
+		case 2:
+			_opt.RegisterPerformancePasses();
+			break;
+
+		default:
+			_opt.RegisterPerformancePasses();
+			_opt.RegisterSizePasses();
+			break;
+		}
+	}
+
+	struct SpirvStats
+	{
+		uint32_t numInstructions;
+		uint32_t size;
+	};
+
+	static SpirvStats getSpirvStats(const std::vector<uint32_t>& _spirv)
+	{
+		SpirvStats stats;
+		stats.numInstructions = 0;
+		stats.size = uint32_t(_spirv.size() * sizeof(uint32_t) );
+
+		// Instructions follow 5 word header, word count of instruction is in upper 16 bits of
+		// its first word.
+		for (size_t ii = 5, num = _spirv.size(); ii < num; ++stats.numInstructions)
+		{
+			ii += bx::max<uint32_t>(1, _spirv[ii] >> 16);
+		}
+
+		return stats;
+	}
+
+	static void printSpirvStats(const SpirvStats& _before, const SpirvStats& _after)
+	{
+		bx::printf("SPIR-V: %d -> %d instructions, %d -> %d bytes.\n"
+			, _before.numInstructions
+			, _after.numInstructions
+			, _before.size
+			, _after.size
+			);
+	}
+
 	static bool compile(const Options& _options, uint32_t _version, const std::string& _code, bx::WriterI* _writer, bool _firstPass)
 	{
 		BX_UNUSED(_version);
@@ -945,7 +1006,9 @@ namespace bgfx { namespace spirv
 
 				opt.SetMessageConsumer(print_msg_to_stderr);
 
-				opt.RegisterLegalizationPasses();
+				registerOptimizerPasses(opt, _options);
+
+				const SpirvStats unoptimized = getSpirvStats(spirv);
 
 				spvtools::ValidatorOptions validatorOptions;
 				validatorOptions.SetBeforeHlslLegalization(true);
@@ -1077,6 +1140,11 @@ namespace bgfx { namespace spirv
 
 					if (_version == BX_MAKEFOURCC('M', 'T', 'L', 0) )
 					{
+						if (_options.stats)
+						{
+							printSpirvStats(unoptimized, getSpirvStats(spirv) );
+						}
+
 						spirv_cross::CompilerMSL msl(std::move(spirv));
 
 						spirv_cross::ShaderResources resources = msl.get_shader_resources();
@@ -1131,6 +1199,23 @@ namespace bgfx { namespace spirv
 					}
 					else
 					{
+						// Names are only needed by reflection above, renderers use uniform
+						// table from shader binary.
+						if (_options.optimize
+						&&  0 < _options.optimizationLevel
+						&&  !_options.debugInformation)
+						{
+							spvtools::Optimizer strip(SPV_ENV_VULKAN_1_0);
+							strip.SetMessageConsumer(print_msg_to_stderr);
+							strip.RegisterPass(spvtools::CreateStripDebugInfoPass() );
+							strip.Run(spirv.data(), spirv.size(), &spirv);
+						}
+
+						if (_options.stats)
+						{
+							printSpirvStats(unoptimized, getSpirvStats(spirv) );
+						}
+
 						uint32_t shaderSize = (uint32_t)spirv.size() * sizeof(uint32_t);
 						bx::write(_writer, shaderSize);
 						bx::write(_writer, spirv.data(), shaderSize);